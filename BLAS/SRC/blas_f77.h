@@ -0,0 +1,44 @@
+/*
+ * blas_f77.h
+ * Fortran INTEGER and name mangling for the C files of the BLAS.
+ */
+
+#ifndef BLAS_F77_H
+#define BLAS_F77_H
+
+#include <stdint.h>
+
+/*
+ * Default Fortran INTEGER
+ */
+#ifndef BLAS_INT
+#if defined(LAPACK_ILP64) || defined(WeirdNEC) || defined(BLAS_API64)
+   #define BLAS_INT int64_t
+#else
+   #define BLAS_INT int32_t
+#endif
+#endif
+
+/*
+ * Fortran name mangling
+ */
+#ifndef BLAS_GLOBAL
+#if defined(UPPER)
+   #define BLAS_GLOBAL(lcname,UCNAME)  UCNAME
+#elif defined(NOCHANGE)
+   #define BLAS_GLOBAL(lcname,UCNAME)  lcname
+#else
+   #define BLAS_GLOBAL(lcname,UCNAME)  lcname##_
+#endif
+#endif
+
+/*
+ * Names of the _64 API when BLAS_API64 is defined
+ */
+#ifdef BLAS_API64
+   #define BLAS_GLOBAL_SUFFIX(lcname,UCNAME)  BLAS_GLOBAL(lcname##_64,UCNAME##_64)
+#else
+   #define BLAS_GLOBAL_SUFFIX(lcname,UCNAME)  BLAS_GLOBAL(lcname,UCNAME)
+#endif
+
+#endif
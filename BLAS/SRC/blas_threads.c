@@ -0,0 +1,53 @@
+/*
+ * blas_threads.c
+ * Number of threads of the Level 3 BLAS.
+ *
+ * The threaded Level 3 BLAS routines (built with OpenMP) partition their
+ * work among at most BLAS_GET_NUM_THREADS() threads of the OpenMP thread
+ * pool.  The number is, in order of precedence, the last positive value
+ * given to BLAS_SET_NUM_THREADS, the value of the environment variable
+ * LAPACK_NUM_THREADS, or the OpenMP default omp_get_max_threads().
+ * Without OpenMP it is always 1.
+ *
+ * When BLAS_API64 is defined this file provides the _64 entry points,
+ * which share the setting of the default ones.
+ */
+
+#include <stdlib.h>
+#include "blas_f77.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef BLAS_API64
+int blas_num_threads = -1;
+#else
+extern int blas_num_threads;
+#endif
+
+void BLAS_GLOBAL_SUFFIX(blas_set_num_threads,BLAS_SET_NUM_THREADS)(
+   const BLAS_INT *nt)
+{
+   blas_num_threads = (*nt > 0) ? (int) *nt : 0;
+}
+
+BLAS_INT BLAS_GLOBAL_SUFFIX(blas_get_num_threads,BLAS_GET_NUM_THREADS)(void)
+{
+#ifdef _OPENMP
+   const char *env;
+   int nt;
+
+   if (blas_num_threads < 0)
+   {
+      nt = 0;
+      env = getenv("LAPACK_NUM_THREADS");
+      if (env != NULL) nt = atoi(env);
+      blas_num_threads = (nt > 0) ? nt : 0;
+   }
+   if (blas_num_threads > 0)
+      return blas_num_threads;
+   return omp_get_max_threads();
+#else
+   return 1;
+#endif
+}
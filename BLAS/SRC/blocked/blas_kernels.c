@@ -0,0 +1,234 @@
+/*
+ * blas_kernels.c
+ * Runtime selection of the micro-kernels of the blocked xGEMM.
+ *
+ * The kernel path is detected once, from a constructor when the compiler
+ * supports it and otherwise on the first call, and is never changed
+ * afterwards.  xGEMM_TILE returns the register tile MR by NR that the
+ * packing in xGEMM must use for the selected path, and xGEMM_UKERNEL
+ * calls the selected micro-kernel.  The scalar path is the Fortran
+ * xGEMM_KERNEL.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "blas_kernels.h"
+
+void BLAS_GLOBAL(sgemm_kernel,SGEMM_KERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const float *alpha, const float *ap,
+   const float *bp, float *c, const BLAS_INT *ldc);
+void BLAS_GLOBAL(dgemm_kernel,DGEMM_KERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const double *alpha,
+   const double *ap, const double *bp, double *c, const BLAS_INT *ldc);
+void BLAS_GLOBAL(cgemm_kernel,CGEMM_KERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const float *alpha, const float *ap,
+   const float *bp, float *c, const BLAS_INT *ldc);
+void BLAS_GLOBAL(zgemm_kernel,ZGEMM_KERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const double *alpha,
+   const double *ap, const double *bp, double *c, const BLAS_INT *ldc);
+
+static int blas_path = -1;
+
+static BLAS_KERNEL_PATH blas_detect_path(void)
+{
+   BLAS_KERNEL_PATH path = BlasKernelScalar;
+   const char *env;
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+   __builtin_cpu_init();
+#ifdef BLAS_HAVE_AVX2
+   if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      path = BlasKernelAVX2;
+#endif
+#ifdef BLAS_HAVE_AVX512
+   if (path == BlasKernelAVX2 && __builtin_cpu_supports("avx512f"))
+      path = BlasKernelAVX512;
+#endif
+#endif
+
+/*
+ * The environment may only narrow the detected path.
+ */
+   env = getenv("LAPACK_BLAS_KERNEL");
+   if (env != NULL)
+   {
+      if (strcmp(env, "scalar") == 0)
+         path = BlasKernelScalar;
+      else if (strcmp(env, "avx2") == 0 && path > BlasKernelAVX2)
+         path = BlasKernelAVX2;
+   }
+   return path;
+}
+
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+static void blas_kernel_init(void)
+{
+   if (blas_path < 0)
+      blas_path = blas_detect_path();
+}
+
+BLAS_KERNEL_PATH blas_kernel_path(void)
+{
+   blas_kernel_init();
+   return (BLAS_KERNEL_PATH) blas_path;
+}
+
+const char *blas_kernel_name(void)
+{
+   switch (blas_kernel_path())
+   {
+      case BlasKernelAVX2:   return "avx2";
+      case BlasKernelAVX512: return "avx512";
+      default:               return "scalar";
+   }
+}
+
+void BLAS_GLOBAL(sgemm_tile,SGEMM_TILE)(BLAS_INT *mr, BLAS_INT *nr)
+{
+   switch (blas_kernel_path())
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         *mr = BLAS_AVX2_SMR; *nr = BLAS_AVX2_SNR; break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         *mr = BLAS_AVX512_SMR; *nr = BLAS_AVX512_SNR; break;
+#endif
+      default:
+         *mr = 4; *nr = 4;
+   }
+}
+
+void BLAS_GLOBAL(dgemm_tile,DGEMM_TILE)(BLAS_INT *mr, BLAS_INT *nr)
+{
+   switch (blas_kernel_path())
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         *mr = BLAS_AVX2_DMR; *nr = BLAS_AVX2_DNR; break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         *mr = BLAS_AVX512_DMR; *nr = BLAS_AVX512_DNR; break;
+#endif
+      default:
+         *mr = 4; *nr = 4;
+   }
+}
+
+void BLAS_GLOBAL(cgemm_tile,CGEMM_TILE)(BLAS_INT *mr, BLAS_INT *nr)
+{
+   switch (blas_kernel_path())
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         *mr = BLAS_AVX2_CMR; *nr = BLAS_AVX2_CNR; break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         *mr = BLAS_AVX512_CMR; *nr = BLAS_AVX512_CNR; break;
+#endif
+      default:
+         *mr = 4; *nr = 2;
+   }
+}
+
+void BLAS_GLOBAL(zgemm_tile,ZGEMM_TILE)(BLAS_INT *mr, BLAS_INT *nr)
+{
+   switch (blas_kernel_path())
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         *mr = BLAS_AVX2_ZMR; *nr = BLAS_AVX2_ZNR; break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         *mr = BLAS_AVX512_ZMR; *nr = BLAS_AVX512_ZNR; break;
+#endif
+      default:
+         *mr = 4; *nr = 2;
+   }
+}
+
+void BLAS_GLOBAL(sgemm_ukernel,SGEMM_UKERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const float *alpha, const float *ap,
+   const float *bp, float *c, const BLAS_INT *ldc)
+{
+   switch (blas_path)
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         blas_sgemm_ukr_avx2(*k, *m, *n, *alpha, ap, bp, c, *ldc); break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         blas_sgemm_ukr_avx512(*k, *m, *n, *alpha, ap, bp, c, *ldc); break;
+#endif
+      default:
+         BLAS_GLOBAL(sgemm_kernel,SGEMM_KERNEL)(k, m, n, alpha, ap, bp, c,
+                                                ldc);
+   }
+}
+
+void BLAS_GLOBAL(dgemm_ukernel,DGEMM_UKERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const double *alpha,
+   const double *ap, const double *bp, double *c, const BLAS_INT *ldc)
+{
+   switch (blas_path)
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         blas_dgemm_ukr_avx2(*k, *m, *n, *alpha, ap, bp, c, *ldc); break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         blas_dgemm_ukr_avx512(*k, *m, *n, *alpha, ap, bp, c, *ldc); break;
+#endif
+      default:
+         BLAS_GLOBAL(dgemm_kernel,DGEMM_KERNEL)(k, m, n, alpha, ap, bp, c,
+                                                ldc);
+   }
+}
+
+void BLAS_GLOBAL(cgemm_ukernel,CGEMM_UKERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const float *alpha, const float *ap,
+   const float *bp, float *c, const BLAS_INT *ldc)
+{
+   switch (blas_path)
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         blas_cgemm_ukr_avx2(*k, *m, *n, alpha, ap, bp, c, *ldc); break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         blas_cgemm_ukr_avx512(*k, *m, *n, alpha, ap, bp, c, *ldc); break;
+#endif
+      default:
+         BLAS_GLOBAL(cgemm_kernel,CGEMM_KERNEL)(k, m, n, alpha, ap, bp, c,
+                                                ldc);
+   }
+}
+
+void BLAS_GLOBAL(zgemm_ukernel,ZGEMM_UKERNEL)(const BLAS_INT *k,
+   const BLAS_INT *m, const BLAS_INT *n, const double *alpha,
+   const double *ap, const double *bp, double *c, const BLAS_INT *ldc)
+{
+   switch (blas_path)
+   {
+#ifdef BLAS_HAVE_AVX2
+      case BlasKernelAVX2:
+         blas_zgemm_ukr_avx2(*k, *m, *n, alpha, ap, bp, c, *ldc); break;
+#endif
+#ifdef BLAS_HAVE_AVX512
+      case BlasKernelAVX512:
+         blas_zgemm_ukr_avx512(*k, *m, *n, alpha, ap, bp, c, *ldc); break;
+#endif
+      default:
+         BLAS_GLOBAL(zgemm_kernel,ZGEMM_KERNEL)(k, m, n, alpha, ap, bp, c,
+                                                ldc);
+   }
+}
@@ -0,0 +1,149 @@
+/*
+ * blas_kernels.h
+ * Micro-kernels of the blocked Level 3 BLAS and their runtime dispatch.
+ *
+ * The blocked xGEMM packs op( A ) into slivers of MR rows and op( B )
+ * into slivers of NR columns, then calls xGEMM_UKERNEL once per MR by NR
+ * tile of C.  The kernel path (scalar Fortran, AVX2/FMA or AVX-512) is
+ * chosen once, when the library is loaded, from the CPUID feature bits.
+ * The environment variable LAPACK_BLAS_KERNEL (scalar, avx2 or avx512)
+ * can select a narrower path than the one detected.
+ */
+
+#ifndef BLAS_KERNELS_H
+#define BLAS_KERNELS_H
+
+#include "../blas_f77.h"
+
+typedef enum BLAS_KERNEL_PATH {
+   BlasKernelScalar=0, BlasKernelAVX2=1, BlasKernelAVX512=2
+} BLAS_KERNEL_PATH;
+
+/*
+ * Micro-kernels: C(0:m-1,0:n-1) += alpha * AP * BP, where AP holds k
+ * columns of MR packed elements and BP holds k rows of NR packed
+ * elements.  Complex arrays are stored as interleaved (re,im) pairs.
+ */
+typedef void (*blas_sgemm_ukr)(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                               float alpha, const float *ap,
+                               const float *bp, float *c, BLAS_INT ldc);
+typedef void (*blas_dgemm_ukr)(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                               double alpha, const double *ap,
+                               const double *bp, double *c, BLAS_INT ldc);
+typedef void (*blas_cgemm_ukr)(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                               const float *alpha, const float *ap,
+                               const float *bp, float *c, BLAS_INT ldc);
+typedef void (*blas_zgemm_ukr)(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                               const double *alpha, const double *ap,
+                               const double *bp, double *c, BLAS_INT ldc);
+
+/*
+ * Register tiles of the vector kernels
+ */
+#define BLAS_AVX2_SMR   16
+#define BLAS_AVX2_SNR    6
+#define BLAS_AVX2_DMR    8
+#define BLAS_AVX2_DNR    6
+#define BLAS_AVX2_CMR    8
+#define BLAS_AVX2_CNR    2
+#define BLAS_AVX2_ZMR    4
+#define BLAS_AVX2_ZNR    2
+
+#define BLAS_AVX512_SMR 32
+#define BLAS_AVX512_SNR  8
+#define BLAS_AVX512_DMR 16
+#define BLAS_AVX512_DNR  8
+#define BLAS_AVX512_CMR 16
+#define BLAS_AVX512_CNR  4
+#define BLAS_AVX512_ZMR  8
+#define BLAS_AVX512_ZNR  4
+
+void blas_sgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n, float alpha,
+                         const float *ap, const float *bp, float *c,
+                         BLAS_INT ldc);
+void blas_dgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n, double alpha,
+                         const double *ap, const double *bp, double *c,
+                         BLAS_INT ldc);
+void blas_cgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                         const float *alpha, const float *ap,
+                         const float *bp, float *c, BLAS_INT ldc);
+void blas_zgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                         const double *alpha, const double *ap,
+                         const double *bp, double *c, BLAS_INT ldc);
+
+void blas_sgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n, float alpha,
+                           const float *ap, const float *bp, float *c,
+                           BLAS_INT ldc);
+void blas_dgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n, double alpha,
+                           const double *ap, const double *bp, double *c,
+                           BLAS_INT ldc);
+void blas_cgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                           const float *alpha, const float *ap,
+                           const float *bp, float *c, BLAS_INT ldc);
+void blas_zgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                           const double *alpha, const double *ap,
+                           const double *bp, double *c, BLAS_INT ldc);
+
+/*
+ * Add alpha times the MR by NR accumulator tile AB to the leading m by n
+ * part of C.  Complex tiles hold interleaved (re,im) pairs, and alpha*AB
+ * is formed as in Fortran, so that the vector kernels round like
+ * xGEMM_KERNEL.  The kernel files are compiled with -ffp-contract=off
+ * for the same reason.
+ */
+static inline void blas_sgemm_ukr_update(BLAS_INT m, BLAS_INT n, BLAS_INT mr,
+                                         float alpha, const float *ab,
+                                         float *c, BLAS_INT ldc)
+{
+   BLAS_INT i, j;
+   for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++)
+         c[i+j*ldc] += alpha*ab[i+j*mr];
+}
+
+static inline void blas_dgemm_ukr_update(BLAS_INT m, BLAS_INT n, BLAS_INT mr,
+                                         double alpha, const double *ab,
+                                         double *c, BLAS_INT ldc)
+{
+   BLAS_INT i, j;
+   for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++)
+         c[i+j*ldc] += alpha*ab[i+j*mr];
+}
+
+static inline void blas_cgemm_ukr_update(BLAS_INT m, BLAS_INT n, BLAS_INT mr,
+                                         const float *alpha, const float *ab,
+                                         float *c, BLAS_INT ldc)
+{
+   BLAS_INT i, j, e;
+   for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++)
+      {
+         e = 2*(i+j*mr);
+         c[2*(i+j*ldc)]   += alpha[0]*ab[e] - alpha[1]*ab[e+1];
+         c[2*(i+j*ldc)+1] += alpha[0]*ab[e+1] + alpha[1]*ab[e];
+      }
+}
+
+static inline void blas_zgemm_ukr_update(BLAS_INT m, BLAS_INT n, BLAS_INT mr,
+                                         const double *alpha,
+                                         const double *ab, double *c,
+                                         BLAS_INT ldc)
+{
+   BLAS_INT i, j, e;
+   for (j = 0; j < n; j++)
+      for (i = 0; i < m; i++)
+      {
+         e = 2*(i+j*mr);
+         c[2*(i+j*ldc)]   += alpha[0]*ab[e] - alpha[1]*ab[e+1];
+         c[2*(i+j*ldc)+1] += alpha[0]*ab[e+1] + alpha[1]*ab[e];
+      }
+}
+
+/*
+ * Selected kernel path and its name ("scalar", "avx2" or "avx512")
+ */
+BLAS_KERNEL_PATH blas_kernel_path(void);
+const char *blas_kernel_name(void);
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * blas_kernels_avx2.c
+ * AVX2/FMA micro-kernels of the blocked xGEMM.
+ *
+ * Each kernel keeps an MR by NR tile of C in 12 (real) or 4 (complex)
+ * ymm accumulators: two vectors of op( A ) per packed column times one
+ * broadcast element of op( B ) per tile column.  The complex kernels
+ * form each product a*b as CGEMM_KERNEL does, (ar*br - ai*bi,
+ * ai*br + ar*bi) without FMA, so that they round like the scalar path.
+ * This file must be compiled with -mavx2 -mfma -ffp-contract=off; it is
+ * only called after the CPU has been checked for AVX2 and FMA.
+ */
+
+#include <immintrin.h>
+#include "blas_kernels.h"
+
+#define SMR BLAS_AVX2_SMR
+#define SNR BLAS_AVX2_SNR
+#define DMR BLAS_AVX2_DMR
+#define DNR BLAS_AVX2_DNR
+#define CMR BLAS_AVX2_CMR
+#define CNR BLAS_AVX2_CNR
+#define ZMR BLAS_AVX2_ZMR
+#define ZNR BLAS_AVX2_ZNR
+
+/*
+ * Rank-1 update of tile column j, and store of its accumulators
+ */
+#define SFMA(j) b = _mm256_broadcast_ss(bp+j);                \
+   c0##j = _mm256_fmadd_ps(a0, b, c0##j);                     \
+   c1##j = _mm256_fmadd_ps(a1, b, c1##j)
+#define SSTORE(j) _mm256_storeu_ps(ab+j*SMR, c0##j);          \
+   _mm256_storeu_ps(ab+j*SMR+8, c1##j)
+
+#define DFMA(j) b = _mm256_broadcast_sd(bp+j);                \
+   c0##j = _mm256_fmadd_pd(a0, b, c0##j);                     \
+   c1##j = _mm256_fmadd_pd(a1, b, c1##j)
+#define DSTORE(j) _mm256_storeu_pd(ab+j*DMR, c0##j);          \
+   _mm256_storeu_pd(ab+j*DMR+4, c1##j)
+
+#define CMAC(j) br = _mm256_broadcast_ss(bp+2*j);             \
+   bi = _mm256_broadcast_ss(bp+2*j+1);                        \
+   c0##j = _mm256_add_ps(c0##j, _mm256_addsub_ps(             \
+      _mm256_mul_ps(a0, br), _mm256_mul_ps(s0, bi)));         \
+   c1##j = _mm256_add_ps(c1##j, _mm256_addsub_ps(             \
+      _mm256_mul_ps(a1, br), _mm256_mul_ps(s1, bi)))
+#define CSTORE(j) _mm256_storeu_ps(ab+2*j*CMR, c0##j);        \
+   _mm256_storeu_ps(ab+2*j*CMR+8, c1##j)
+
+#define ZMAC(j) br = _mm256_broadcast_sd(bp+2*j);             \
+   bi = _mm256_broadcast_sd(bp+2*j+1);                        \
+   c0##j = _mm256_add_pd(c0##j, _mm256_addsub_pd(             \
+      _mm256_mul_pd(a0, br), _mm256_mul_pd(s0, bi)));         \
+   c1##j = _mm256_add_pd(c1##j, _mm256_addsub_pd(             \
+      _mm256_mul_pd(a1, br), _mm256_mul_pd(s1, bi)))
+#define ZSTORE(j) _mm256_storeu_pd(ab+2*j*ZMR, c0##j);        \
+   _mm256_storeu_pd(ab+2*j*ZMR+4, c1##j)
+
+void blas_sgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n, float alpha,
+                         const float *ap, const float *bp, float *c,
+                         BLAS_INT ldc)
+{
+   __m256 c00 = _mm256_setzero_ps(), c10 = _mm256_setzero_ps();
+   __m256 c01 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+   __m256 c02 = _mm256_setzero_ps(), c12 = _mm256_setzero_ps();
+   __m256 c03 = _mm256_setzero_ps(), c13 = _mm256_setzero_ps();
+   __m256 c04 = _mm256_setzero_ps(), c14 = _mm256_setzero_ps();
+   __m256 c05 = _mm256_setzero_ps(), c15 = _mm256_setzero_ps();
+   __m256 a0, a1, b;
+   float ab[SMR*SNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm256_loadu_ps(ap);
+      a1 = _mm256_loadu_ps(ap+8);
+      SFMA(0); SFMA(1); SFMA(2); SFMA(3); SFMA(4); SFMA(5);
+      ap += SMR;
+      bp += SNR;
+   }
+   SSTORE(0); SSTORE(1); SSTORE(2); SSTORE(3); SSTORE(4); SSTORE(5);
+   blas_sgemm_ukr_update(m, n, SMR, alpha, ab, c, ldc);
+}
+
+void blas_dgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n, double alpha,
+                         const double *ap, const double *bp, double *c,
+                         BLAS_INT ldc)
+{
+   __m256d c00 = _mm256_setzero_pd(), c10 = _mm256_setzero_pd();
+   __m256d c01 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+   __m256d c02 = _mm256_setzero_pd(), c12 = _mm256_setzero_pd();
+   __m256d c03 = _mm256_setzero_pd(), c13 = _mm256_setzero_pd();
+   __m256d c04 = _mm256_setzero_pd(), c14 = _mm256_setzero_pd();
+   __m256d c05 = _mm256_setzero_pd(), c15 = _mm256_setzero_pd();
+   __m256d a0, a1, b;
+   double ab[DMR*DNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm256_loadu_pd(ap);
+      a1 = _mm256_loadu_pd(ap+4);
+      DFMA(0); DFMA(1); DFMA(2); DFMA(3); DFMA(4); DFMA(5);
+      ap += DMR;
+      bp += DNR;
+   }
+   DSTORE(0); DSTORE(1); DSTORE(2); DSTORE(3); DSTORE(4); DSTORE(5);
+   blas_dgemm_ukr_update(m, n, DMR, alpha, ab, c, ldc);
+}
+
+void blas_cgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                         const float *alpha, const float *ap,
+                         const float *bp, float *c, BLAS_INT ldc)
+{
+   __m256 c00 = _mm256_setzero_ps(), c10 = _mm256_setzero_ps();
+   __m256 c01 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+   __m256 a0, a1, s0, s1, br, bi;
+   float ab[2*CMR*CNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm256_loadu_ps(ap);
+      a1 = _mm256_loadu_ps(ap+8);
+      s0 = _mm256_permute_ps(a0, 0xB1);
+      s1 = _mm256_permute_ps(a1, 0xB1);
+      CMAC(0); CMAC(1);
+      ap += 2*CMR;
+      bp += 2*CNR;
+   }
+   CSTORE(0); CSTORE(1);
+   blas_cgemm_ukr_update(m, n, CMR, alpha, ab, c, ldc);
+}
+
+void blas_zgemm_ukr_avx2(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                         const double *alpha, const double *ap,
+                         const double *bp, double *c, BLAS_INT ldc)
+{
+   __m256d c00 = _mm256_setzero_pd(), c10 = _mm256_setzero_pd();
+   __m256d c01 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+   __m256d a0, a1, s0, s1, br, bi;
+   double ab[2*ZMR*ZNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm256_loadu_pd(ap);
+      a1 = _mm256_loadu_pd(ap+4);
+      s0 = _mm256_permute_pd(a0, 0x5);
+      s1 = _mm256_permute_pd(a1, 0x5);
+      ZMAC(0); ZMAC(1);
+      ap += 2*ZMR;
+      bp += 2*ZNR;
+   }
+   ZSTORE(0); ZSTORE(1);
+   blas_zgemm_ukr_update(m, n, ZMR, alpha, ab, c, ldc);
+}
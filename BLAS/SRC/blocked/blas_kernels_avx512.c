@@ -0,0 +1,177 @@
+/*
+ * blas_kernels_avx512.c
+ * AVX-512 micro-kernels of the blocked xGEMM.
+ *
+ * Each kernel keeps an MR by NR tile of C in 16 zmm accumulators: two
+ * vectors of op( A ) per packed column times one broadcast element of
+ * op( B ) per tile column; the complex kernels use 8.  As in the AVX2
+ * file, the complex products are formed per term without FMA.  This file
+ * must be compiled with -mavx512f -ffp-contract=off; it is only called
+ * after the CPU has been checked for AVX-512F.
+ */
+
+#include <immintrin.h>
+#include "blas_kernels.h"
+
+#define SMR BLAS_AVX512_SMR
+#define SNR BLAS_AVX512_SNR
+#define DMR BLAS_AVX512_DMR
+#define DNR BLAS_AVX512_DNR
+#define CMR BLAS_AVX512_CMR
+#define CNR BLAS_AVX512_CNR
+#define ZMR BLAS_AVX512_ZMR
+#define ZNR BLAS_AVX512_ZNR
+
+/*
+ * Rank-1 update of tile column j, and store of its accumulators
+ */
+#define SFMA(j) b = _mm512_set1_ps(bp[j]);                    \
+   c0##j = _mm512_fmadd_ps(a0, b, c0##j);                     \
+   c1##j = _mm512_fmadd_ps(a1, b, c1##j)
+#define SSTORE(j) _mm512_storeu_ps(ab+j*SMR, c0##j);          \
+   _mm512_storeu_ps(ab+j*SMR+16, c1##j)
+
+#define DFMA(j) b = _mm512_set1_pd(bp[j]);                    \
+   c0##j = _mm512_fmadd_pd(a0, b, c0##j);                     \
+   c1##j = _mm512_fmadd_pd(a1, b, c1##j)
+#define DSTORE(j) _mm512_storeu_pd(ab+j*DMR, c0##j);          \
+   _mm512_storeu_pd(ab+j*DMR+8, c1##j)
+
+/*
+ * a*b for the interleaved complex vector a (swapped into s) and the
+ * scalar (br,bi): the products are subtracted in the real lanes and
+ * added in the imaginary ones
+ */
+#define CMAC(j) br = _mm512_set1_ps(bp[2*j]);                 \
+   bi = _mm512_set1_ps(bp[2*j+1]);                            \
+   t = _mm512_mul_ps(a0, br); u = _mm512_mul_ps(s0, bi);      \
+   c0##j = _mm512_add_ps(c0##j, _mm512_mask_sub_ps(           \
+      _mm512_add_ps(t, u), 0x5555, t, u));                    \
+   t = _mm512_mul_ps(a1, br); u = _mm512_mul_ps(s1, bi);      \
+   c1##j = _mm512_add_ps(c1##j, _mm512_mask_sub_ps(           \
+      _mm512_add_ps(t, u), 0x5555, t, u))
+#define CSTORE(j) _mm512_storeu_ps(ab+2*j*CMR, c0##j);        \
+   _mm512_storeu_ps(ab+2*j*CMR+16, c1##j)
+
+#define ZMAC(j) br = _mm512_set1_pd(bp[2*j]);                 \
+   bi = _mm512_set1_pd(bp[2*j+1]);                            \
+   t = _mm512_mul_pd(a0, br); u = _mm512_mul_pd(s0, bi);      \
+   c0##j = _mm512_add_pd(c0##j, _mm512_mask_sub_pd(           \
+      _mm512_add_pd(t, u), 0x55, t, u));                      \
+   t = _mm512_mul_pd(a1, br); u = _mm512_mul_pd(s1, bi);      \
+   c1##j = _mm512_add_pd(c1##j, _mm512_mask_sub_pd(           \
+      _mm512_add_pd(t, u), 0x55, t, u))
+#define ZSTORE(j) _mm512_storeu_pd(ab+2*j*ZMR, c0##j);        \
+   _mm512_storeu_pd(ab+2*j*ZMR+8, c1##j)
+
+void blas_sgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n, float alpha,
+                           const float *ap, const float *bp, float *c,
+                           BLAS_INT ldc)
+{
+   __m512 c00 = _mm512_setzero_ps(), c10 = _mm512_setzero_ps();
+   __m512 c01 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+   __m512 c02 = _mm512_setzero_ps(), c12 = _mm512_setzero_ps();
+   __m512 c03 = _mm512_setzero_ps(), c13 = _mm512_setzero_ps();
+   __m512 c04 = _mm512_setzero_ps(), c14 = _mm512_setzero_ps();
+   __m512 c05 = _mm512_setzero_ps(), c15 = _mm512_setzero_ps();
+   __m512 c06 = _mm512_setzero_ps(), c16 = _mm512_setzero_ps();
+   __m512 c07 = _mm512_setzero_ps(), c17 = _mm512_setzero_ps();
+   __m512 a0, a1, b;
+   float ab[SMR*SNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm512_loadu_ps(ap);
+      a1 = _mm512_loadu_ps(ap+16);
+      SFMA(0); SFMA(1); SFMA(2); SFMA(3);
+      SFMA(4); SFMA(5); SFMA(6); SFMA(7);
+      ap += SMR;
+      bp += SNR;
+   }
+   SSTORE(0); SSTORE(1); SSTORE(2); SSTORE(3);
+   SSTORE(4); SSTORE(5); SSTORE(6); SSTORE(7);
+   blas_sgemm_ukr_update(m, n, SMR, alpha, ab, c, ldc);
+}
+
+void blas_dgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n, double alpha,
+                           const double *ap, const double *bp, double *c,
+                           BLAS_INT ldc)
+{
+   __m512d c00 = _mm512_setzero_pd(), c10 = _mm512_setzero_pd();
+   __m512d c01 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+   __m512d c02 = _mm512_setzero_pd(), c12 = _mm512_setzero_pd();
+   __m512d c03 = _mm512_setzero_pd(), c13 = _mm512_setzero_pd();
+   __m512d c04 = _mm512_setzero_pd(), c14 = _mm512_setzero_pd();
+   __m512d c05 = _mm512_setzero_pd(), c15 = _mm512_setzero_pd();
+   __m512d c06 = _mm512_setzero_pd(), c16 = _mm512_setzero_pd();
+   __m512d c07 = _mm512_setzero_pd(), c17 = _mm512_setzero_pd();
+   __m512d a0, a1, b;
+   double ab[DMR*DNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm512_loadu_pd(ap);
+      a1 = _mm512_loadu_pd(ap+8);
+      DFMA(0); DFMA(1); DFMA(2); DFMA(3);
+      DFMA(4); DFMA(5); DFMA(6); DFMA(7);
+      ap += DMR;
+      bp += DNR;
+   }
+   DSTORE(0); DSTORE(1); DSTORE(2); DSTORE(3);
+   DSTORE(4); DSTORE(5); DSTORE(6); DSTORE(7);
+   blas_dgemm_ukr_update(m, n, DMR, alpha, ab, c, ldc);
+}
+
+void blas_cgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                           const float *alpha, const float *ap,
+                           const float *bp, float *c, BLAS_INT ldc)
+{
+   __m512 c00 = _mm512_setzero_ps(), c10 = _mm512_setzero_ps();
+   __m512 c01 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+   __m512 c02 = _mm512_setzero_ps(), c12 = _mm512_setzero_ps();
+   __m512 c03 = _mm512_setzero_ps(), c13 = _mm512_setzero_ps();
+   __m512 a0, a1, s0, s1, br, bi, t, u;
+   float ab[2*CMR*CNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm512_loadu_ps(ap);
+      a1 = _mm512_loadu_ps(ap+16);
+      s0 = _mm512_permute_ps(a0, 0xB1);
+      s1 = _mm512_permute_ps(a1, 0xB1);
+      CMAC(0); CMAC(1); CMAC(2); CMAC(3);
+      ap += 2*CMR;
+      bp += 2*CNR;
+   }
+   CSTORE(0); CSTORE(1); CSTORE(2); CSTORE(3);
+   blas_cgemm_ukr_update(m, n, CMR, alpha, ab, c, ldc);
+}
+
+void blas_zgemm_ukr_avx512(BLAS_INT k, BLAS_INT m, BLAS_INT n,
+                           const double *alpha, const double *ap,
+                           const double *bp, double *c, BLAS_INT ldc)
+{
+   __m512d c00 = _mm512_setzero_pd(), c10 = _mm512_setzero_pd();
+   __m512d c01 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+   __m512d c02 = _mm512_setzero_pd(), c12 = _mm512_setzero_pd();
+   __m512d c03 = _mm512_setzero_pd(), c13 = _mm512_setzero_pd();
+   __m512d a0, a1, s0, s1, br, bi, t, u;
+   double ab[2*ZMR*ZNR];
+   BLAS_INT l;
+
+   for (l = 0; l < k; l++)
+   {
+      a0 = _mm512_loadu_pd(ap);
+      a1 = _mm512_loadu_pd(ap+8);
+      s0 = _mm512_permute_pd(a0, 0x55);
+      s1 = _mm512_permute_pd(a1, 0x55);
+      ZMAC(0); ZMAC(1); ZMAC(2); ZMAC(3);
+      ap += 2*ZMR;
+      bp += 2*ZNR;
+   }
+   ZSTORE(0); ZSTORE(1); ZSTORE(2); ZSTORE(3);
+   blas_zgemm_ukr_update(m, n, ZMR, alpha, ab, c, ldc);
+}
@@ -0,0 +1,227 @@
+*> \brief \b DGEMM_KERNEL
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DGEMM_KERNEL(K,M,N,ALPHA,AP,BP,C,LDC)
+*
+*       .. Scalar Arguments ..
+*       DOUBLE PRECISION ALPHA
+*       INTEGER K,LDC,M,N
+*       ..
+*       .. Array Arguments ..
+*       DOUBLE PRECISION AP(4,*),BP(4,*),C(LDC,*)
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DGEMM_KERNEL is the micro-kernel of the blocked DGEMM. It performs
+*>
+*>    C := alpha*AP*BP + C,
+*>
+*> where AP is a packed 4 by k sliver of op( A ), BP is a packed k by 4
+*> sliver of op( B ) and only the leading m by n part of the 4 by 4
+*> product is added to C. The product is accumulated in 16 scalars,
+*> which the compiler keeps in registers.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] K
+*> \verbatim
+*>          K is INTEGER
+*>           On entry, K specifies the number of columns of AP and the
+*>           number of rows of BP. K must be at least zero.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>           On entry, M specifies the number of rows of C to update.
+*>           M must be between 1 and 4.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>           On entry, N specifies the number of columns of C to update.
+*>           N must be between 1 and 4.
+*> \endverbatim
+*>
+*> \param[in] ALPHA
+*> \verbatim
+*>          ALPHA is DOUBLE PRECISION.
+*>           On entry, ALPHA specifies the scalar alpha.
+*> \endverbatim
+*>
+*> \param[in] AP
+*> \verbatim
+*>          AP is DOUBLE PRECISION array, dimension ( 4, K )
+*>           The packed sliver of op( A ), zero padded beyond row M.
+*> \endverbatim
+*>
+*> \param[in] BP
+*> \verbatim
+*>          BP is DOUBLE PRECISION array, dimension ( 4, K )
+*>           The packed sliver of op( B ), stored row by row and zero
+*>           padded beyond column N.
+*> \endverbatim
+*>
+*> \param[in,out] C
+*> \verbatim
+*>          C is DOUBLE PRECISION array, dimension ( LDC, N )
+*>           On exit, the leading m by n part of C is overwritten by
+*>           alpha*AP*BP + C.
+*> \endverbatim
+*>
+*> \param[in] LDC
+*> \verbatim
+*>          LDC is INTEGER
+*>           On entry, LDC specifies the first dimension of C. LDC must
+*>           be at least M.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gemm
+*
+*  =====================================================================
+      SUBROUTINE DGEMM_KERNEL(K,M,N,ALPHA,AP,BP,C,LDC)
+*
+*  -- Reference BLAS level3 routine --
+*  -- Reference BLAS is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      DOUBLE PRECISION ALPHA
+      INTEGER K,LDC,M,N
+*     ..
+*     .. Array Arguments ..
+      DOUBLE PRECISION AP(4,*),BP(4,*),C(LDC,*)
+*     ..
+*
+*  =====================================================================
+*
+*     .. Local Scalars ..
+      DOUBLE PRECISION A1,A2,A3,A4,B1,B2,B3,B4,
+     +                 C11,C21,C31,C41,C12,C22,C32,C42,
+     +                 C13,C23,C33,C43,C14,C24,C34,C44
+      INTEGER I,J,L
+*     ..
+*     .. Local Arrays ..
+      DOUBLE PRECISION AB(4,4)
+*     ..
+*     .. Parameters ..
+      DOUBLE PRECISION ZERO
+      PARAMETER (ZERO=0.0D+0)
+*     ..
+      C11 = ZERO
+      C21 = ZERO
+      C31 = ZERO
+      C41 = ZERO
+      C12 = ZERO
+      C22 = ZERO
+      C32 = ZERO
+      C42 = ZERO
+      C13 = ZERO
+      C23 = ZERO
+      C33 = ZERO
+      C43 = ZERO
+      C14 = ZERO
+      C24 = ZERO
+      C34 = ZERO
+      C44 = ZERO
+*
+*     Accumulate the rank-K update in registers.
+*
+      DO 10 L = 1,K
+          A1 = AP(1,L)
+          A2 = AP(2,L)
+          A3 = AP(3,L)
+          A4 = AP(4,L)
+          B1 = BP(1,L)
+          B2 = BP(2,L)
+          B3 = BP(3,L)
+          B4 = BP(4,L)
+          C11 = C11 + A1*B1
+          C21 = C21 + A2*B1
+          C31 = C31 + A3*B1
+          C41 = C41 + A4*B1
+          C12 = C12 + A1*B2
+          C22 = C22 + A2*B2
+          C32 = C32 + A3*B2
+          C42 = C42 + A4*B2
+          C13 = C13 + A1*B3
+          C23 = C23 + A2*B3
+          C33 = C33 + A3*B3
+          C43 = C43 + A4*B3
+          C14 = C14 + A1*B4
+          C24 = C24 + A2*B4
+          C34 = C34 + A3*B4
+          C44 = C44 + A4*B4
+   10 CONTINUE
+*
+*     Add alpha times the result to the leading M by N part of C.
+*
+      IF ((M.EQ.4) .AND. (N.EQ.4)) THEN
+          C(1,1) = C(1,1) + ALPHA*C11
+          C(2,1) = C(2,1) + ALPHA*C21
+          C(3,1) = C(3,1) + ALPHA*C31
+          C(4,1) = C(4,1) + ALPHA*C41
+          C(1,2) = C(1,2) + ALPHA*C12
+          C(2,2) = C(2,2) + ALPHA*C22
+          C(3,2) = C(3,2) + ALPHA*C32
+          C(4,2) = C(4,2) + ALPHA*C42
+          C(1,3) = C(1,3) + ALPHA*C13
+          C(2,3) = C(2,3) + ALPHA*C23
+          C(3,3) = C(3,3) + ALPHA*C33
+          C(4,3) = C(4,3) + ALPHA*C43
+          C(1,4) = C(1,4) + ALPHA*C14
+          C(2,4) = C(2,4) + ALPHA*C24
+          C(3,4) = C(3,4) + ALPHA*C34
+          C(4,4) = C(4,4) + ALPHA*C44
+      ELSE
+          AB(1,1) = C11
+          AB(2,1) = C21
+          AB(3,1) = C31
+          AB(4,1) = C41
+          AB(1,2) = C12
+          AB(2,2) = C22
+          AB(3,2) = C32
+          AB(4,2) = C42
+          AB(1,3) = C13
+          AB(2,3) = C23
+          AB(3,3) = C33
+          AB(4,3) = C43
+          AB(1,4) = C14
+          AB(2,4) = C24
+          AB(3,4) = C34
+          AB(4,4) = C44
+          DO 30 J = 1,N
+              DO 20 I = 1,M
+                  C(I,J) = C(I,J) + ALPHA*AB(I,J)
+   20         CONTINUE
+   30     CONTINUE
+      END IF
+*
+      RETURN
+*
+*     End of DGEMM_KERNEL
+*
+      END
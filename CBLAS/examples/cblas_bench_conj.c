@@ -0,0 +1,97 @@
+/* cblas_bench_conj.c
+ *
+ * Times the row-major complex Level 2 calls that need a conjugated copy
+ * of a vector (GEMV and GBMV with ConjTrans, GERC, HEMV, HBMV, HPMV, HER,
+ * HER2, HPR and HPR2), next to the same calls in column-major layout,
+ * which go straight to Fortran.  Short vectors are where the cost of the
+ * copy shows.
+ *
+ * Usage: xbench_conj_CBLAS [seconds]
+ *
+ * seconds is the minimal time spent on each measurement (default: 0.1).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cblas.h"
+
+#define NSIZES 5
+#define NROUT 10
+
+static const char *names[NROUT] = {
+   "zgemv C", "cgemv C", "zgbmv C", "zgerc", "zhemv", "zhbmv", "zhpmv",
+   "zher", "zher2", "zhpr2" };
+
+static double A[2*1024*1024], X[2*1024], Y[2*1024];
+static float AF[2*1024*1024], XF[2*1024], YF[2*1024];
+
+static void call(int rout, CBLAS_LAYOUT layout, CBLAS_INT n)
+{
+   const double alpha[2] = {0.5, -0.25}, beta[2] = {0.75, 0.125};
+   const float alphaf[2] = {0.5f, -0.25f}, betaf[2] = {0.75f, 0.125f};
+
+   switch (rout) {
+   case 0: cblas_zgemv(layout, CblasConjTrans, n, n, alpha, A, n, X, 1,
+                       beta, Y, 1); break;
+   case 1: cblas_cgemv(layout, CblasConjTrans, n, n, alphaf, AF, n, XF, 1,
+                       betaf, YF, 1); break;
+   case 2: cblas_zgbmv(layout, CblasConjTrans, n, n, 2, 2, alpha, A, n, X, 1,
+                       beta, Y, 1); break;
+   case 3: cblas_zgerc(layout, n, n, alpha, X, 1, Y, 1, A, n); break;
+   case 4: cblas_zhemv(layout, CblasUpper, n, alpha, A, n, X, 1, beta, Y, 1);
+           break;
+   case 5: cblas_zhbmv(layout, CblasUpper, n, 2, alpha, A, n, X, 1, beta,
+                       Y, 1); break;
+   case 6: cblas_zhpmv(layout, CblasUpper, n, alpha, A, X, 1, beta, Y, 1);
+           break;
+   case 7: cblas_zher(layout, CblasUpper, n, 0.5, X, 1, A, n); break;
+   case 8: cblas_zher2(layout, CblasUpper, n, alpha, X, 1, Y, 1, A, n);
+           break;
+   case 9: cblas_zhpr2(layout, CblasUpper, n, alpha, X, 1, Y, 1, A); break;
+   }
+}
+
+/* Nanoseconds per call, repeated for at least tmin seconds */
+static double time_call(int rout, CBLAS_LAYOUT layout, CBLAS_INT n,
+                        double tmin)
+{
+   long reps = 0;
+   clock_t t0 = clock(), t;
+
+   do {
+      call(rout, layout, n);
+      reps++;
+      t = clock();
+   } while ((double)(t - t0) < tmin * CLOCKS_PER_SEC);
+   return 1.0e9 * (double)(t - t0) / CLOCKS_PER_SEC / reps;
+}
+
+int main (int argc, char **argv)
+{
+   const CBLAS_INT sizes[NSIZES] = {8, 16, 64, 256, 1024};
+   double tmin = (argc > 1) ? atof(argv[1]) : 0.1;
+   double trow, tcol;
+   int rout, k;
+   size_t i;
+
+   for (i = 0; i < sizeof(A)/sizeof(A[0]); i++) {
+      A[i] = 1.0 / (double)(i % 97 + 1);
+      AF[i] = (float)A[i];
+   }
+   for (i = 0; i < sizeof(X)/sizeof(X[0]); i++) {
+      X[i] = Y[i] = 1.0 / (double)(i % 13 + 1);
+      XF[i] = YF[i] = (float)X[i];
+   }
+
+   printf("routine       n   row-major ns   col-major ns   row/col\n");
+   for (rout = 0; rout < NROUT; rout++) {
+      for (k = 0; k < NSIZES; k++) {
+         trow = time_call(rout, CblasRowMajor, sizes[k], tmin);
+         tcol = time_call(rout, CblasColMajor, sizes[k], tmin);
+         printf("%-8s %6d %14.1f %14.1f %9.2f\n", names[rout],
+                (int)sizes[k], trow, tcol, trow / tcol);
+      }
+   }
+   return 0;
+}
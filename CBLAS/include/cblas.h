@@ -44,7 +44,7 @@ typedef enum CBLAS_SIDE {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
 
 #define CBLAS_ORDER CBLAS_LAYOUT /* this for backward compatibility with CBLAS_ORDER */
 
-#include "cblas_mangling_with_flags.h"
+#include "cblas_mangling.h"
 
 /*
  * Integer specific API
@@ -650,6 +650,148 @@ void cblas_zher2k(CBLAS_LAYOUT layout, CBLAS_UPLO Uplo,
                   const void *B, const CBLAS_INT ldb, const double beta,
                   void *C, const CBLAS_INT ldc);
 
+/*
+ * ===========================================================================
+ * Prototypes for the batched BLAS: a batch of independent problems, checked
+ * once and shared among the threads of the BLAS
+ * ===========================================================================
+ */
+void cblas_sgemm_batch(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const CBLAS_INT *M_array,
+                 const CBLAS_INT *N_array, const CBLAS_INT *K_array,
+                 const float *alpha_array, const float **A_array,
+                 const CBLAS_INT *lda_array, const float **B_array,
+                 const CBLAS_INT *ldb_array, const float *beta_array,
+                 float **C_array, const CBLAS_INT *ldc_array,
+                 const CBLAS_INT group_count, const CBLAS_INT *group_size);
+void cblas_sgemm_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const CBLAS_INT M, const CBLAS_INT N, const CBLAS_INT K,
+                 const float alpha, const float *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const float *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const float beta, float *C,
+                 const CBLAS_INT ldc, const CBLAS_INT stridec,
+                 const CBLAS_INT batch_size);
+void cblas_strsm_batch_strided(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const CBLAS_INT M, const CBLAS_INT N,
+                 const float alpha, const float *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, float *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const CBLAS_INT batch_size);
+void cblas_sgemv_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const CBLAS_INT M, const CBLAS_INT N,
+                 const float alpha, const float *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const float *X, const CBLAS_INT incX,
+                 const CBLAS_INT stridex, const float beta, float *Y,
+                 const CBLAS_INT incY, const CBLAS_INT stridey,
+                 const CBLAS_INT batch_size);
+
+void cblas_dgemm_batch(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const CBLAS_INT *M_array,
+                 const CBLAS_INT *N_array, const CBLAS_INT *K_array,
+                 const double *alpha_array, const double **A_array,
+                 const CBLAS_INT *lda_array, const double **B_array,
+                 const CBLAS_INT *ldb_array, const double *beta_array,
+                 double **C_array, const CBLAS_INT *ldc_array,
+                 const CBLAS_INT group_count, const CBLAS_INT *group_size);
+void cblas_dgemm_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const CBLAS_INT M, const CBLAS_INT N, const CBLAS_INT K,
+                 const double alpha, const double *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const double *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const double beta, double *C,
+                 const CBLAS_INT ldc, const CBLAS_INT stridec,
+                 const CBLAS_INT batch_size);
+void cblas_dtrsm_batch_strided(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const CBLAS_INT M, const CBLAS_INT N,
+                 const double alpha, const double *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, double *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const CBLAS_INT batch_size);
+void cblas_dgemv_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const CBLAS_INT M, const CBLAS_INT N,
+                 const double alpha, const double *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const double *X, const CBLAS_INT incX,
+                 const CBLAS_INT stridex, const double beta, double *Y,
+                 const CBLAS_INT incY, const CBLAS_INT stridey,
+                 const CBLAS_INT batch_size);
+
+void cblas_cgemm_batch(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const CBLAS_INT *M_array,
+                 const CBLAS_INT *N_array, const CBLAS_INT *K_array,
+                 const void *alpha_array, const void **A_array,
+                 const CBLAS_INT *lda_array, const void **B_array,
+                 const CBLAS_INT *ldb_array, const void *beta_array,
+                 void **C_array, const CBLAS_INT *ldc_array,
+                 const CBLAS_INT group_count, const CBLAS_INT *group_size);
+void cblas_cgemm_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const CBLAS_INT M, const CBLAS_INT N, const CBLAS_INT K,
+                 const void *alpha, const void *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const void *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const void *beta, void *C,
+                 const CBLAS_INT ldc, const CBLAS_INT stridec,
+                 const CBLAS_INT batch_size);
+void cblas_ctrsm_batch_strided(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const CBLAS_INT M, const CBLAS_INT N,
+                 const void *alpha, const void *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, void *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const CBLAS_INT batch_size);
+void cblas_cgemv_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const CBLAS_INT M, const CBLAS_INT N,
+                 const void *alpha, const void *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const void *X, const CBLAS_INT incX,
+                 const CBLAS_INT stridex, const void *beta, void *Y,
+                 const CBLAS_INT incY, const CBLAS_INT stridey,
+                 const CBLAS_INT batch_size);
+
+void cblas_zgemm_batch(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const CBLAS_INT *M_array,
+                 const CBLAS_INT *N_array, const CBLAS_INT *K_array,
+                 const void *alpha_array, const void **A_array,
+                 const CBLAS_INT *lda_array, const void **B_array,
+                 const CBLAS_INT *ldb_array, const void *beta_array,
+                 void **C_array, const CBLAS_INT *ldc_array,
+                 const CBLAS_INT group_count, const CBLAS_INT *group_size);
+void cblas_zgemm_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const CBLAS_INT M, const CBLAS_INT N, const CBLAS_INT K,
+                 const void *alpha, const void *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const void *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const void *beta, void *C,
+                 const CBLAS_INT ldc, const CBLAS_INT stridec,
+                 const CBLAS_INT batch_size);
+void cblas_ztrsm_batch_strided(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const CBLAS_INT M, const CBLAS_INT N,
+                 const void *alpha, const void *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, void *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const CBLAS_INT batch_size);
+void cblas_zgemv_batch_strided(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const CBLAS_INT M, const CBLAS_INT N,
+                 const void *alpha, const void *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const void *X, const CBLAS_INT incX,
+                 const CBLAS_INT stridex, const void *beta, void *Y,
+                 const CBLAS_INT incY, const CBLAS_INT stridey,
+                 const CBLAS_INT batch_size);
+
+/*
+ * Micro-kernel path of the Level 3 BLAS: "scalar", "avx2", "avx512" or
+ * "reference"
+ */
+const char *cblas_get_kernel_name(void);
+
+/*
+ * Number of threads of the Level 3 BLAS
+ */
+void cblas_set_num_threads(const CBLAS_INT nt);
+CBLAS_INT cblas_get_num_threads(void);
+
 void
 #ifdef HAS_ATTRIBUTE_WEAK_SUPPORT
 __attribute__((weak))
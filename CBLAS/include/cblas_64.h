@@ -603,6 +603,142 @@ void cblas_zher2k_64(CBLAS_LAYOUT layout, CBLAS_UPLO Uplo,
                   const void *B, const int64_t ldb, const double beta,
                   void *C, const int64_t ldc);
 
+/*
+ * ===========================================================================
+ * Prototypes for the batched BLAS: a batch of independent problems, checked
+ * once and shared among the threads of the BLAS
+ * ===========================================================================
+ */
+void cblas_sgemm_batch_64(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const int64_t *M_array,
+                 const int64_t *N_array, const int64_t *K_array,
+                 const float *alpha_array, const float **A_array,
+                 const int64_t *lda_array, const float **B_array,
+                 const int64_t *ldb_array, const float *beta_array,
+                 float **C_array, const int64_t *ldc_array,
+                 const int64_t group_count, const int64_t *group_size);
+void cblas_sgemm_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const int64_t M, const int64_t N, const int64_t K,
+                 const float alpha, const float *A, const int64_t lda,
+                 const int64_t stridea, const float *B, const int64_t ldb,
+                 const int64_t strideb, const float beta, float *C,
+                 const int64_t ldc, const int64_t stridec,
+                 const int64_t batch_size);
+void cblas_strsm_batch_strided_64(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const int64_t M, const int64_t N,
+                 const float alpha, const float *A, const int64_t lda,
+                 const int64_t stridea, float *B, const int64_t ldb,
+                 const int64_t strideb, const int64_t batch_size);
+void cblas_sgemv_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const int64_t M, const int64_t N,
+                 const float alpha, const float *A, const int64_t lda,
+                 const int64_t stridea, const float *X, const int64_t incX,
+                 const int64_t stridex, const float beta, float *Y,
+                 const int64_t incY, const int64_t stridey,
+                 const int64_t batch_size);
+
+void cblas_dgemm_batch_64(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const int64_t *M_array,
+                 const int64_t *N_array, const int64_t *K_array,
+                 const double *alpha_array, const double **A_array,
+                 const int64_t *lda_array, const double **B_array,
+                 const int64_t *ldb_array, const double *beta_array,
+                 double **C_array, const int64_t *ldc_array,
+                 const int64_t group_count, const int64_t *group_size);
+void cblas_dgemm_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const int64_t M, const int64_t N, const int64_t K,
+                 const double alpha, const double *A, const int64_t lda,
+                 const int64_t stridea, const double *B, const int64_t ldb,
+                 const int64_t strideb, const double beta, double *C,
+                 const int64_t ldc, const int64_t stridec,
+                 const int64_t batch_size);
+void cblas_dtrsm_batch_strided_64(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const int64_t M, const int64_t N,
+                 const double alpha, const double *A, const int64_t lda,
+                 const int64_t stridea, double *B, const int64_t ldb,
+                 const int64_t strideb, const int64_t batch_size);
+void cblas_dgemv_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const int64_t M, const int64_t N,
+                 const double alpha, const double *A, const int64_t lda,
+                 const int64_t stridea, const double *X, const int64_t incX,
+                 const int64_t stridex, const double beta, double *Y,
+                 const int64_t incY, const int64_t stridey,
+                 const int64_t batch_size);
+
+void cblas_cgemm_batch_64(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const int64_t *M_array,
+                 const int64_t *N_array, const int64_t *K_array,
+                 const void *alpha_array, const void **A_array,
+                 const int64_t *lda_array, const void **B_array,
+                 const int64_t *ldb_array, const void *beta_array,
+                 void **C_array, const int64_t *ldc_array,
+                 const int64_t group_count, const int64_t *group_size);
+void cblas_cgemm_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const int64_t M, const int64_t N, const int64_t K,
+                 const void *alpha, const void *A, const int64_t lda,
+                 const int64_t stridea, const void *B, const int64_t ldb,
+                 const int64_t strideb, const void *beta, void *C,
+                 const int64_t ldc, const int64_t stridec,
+                 const int64_t batch_size);
+void cblas_ctrsm_batch_strided_64(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const int64_t M, const int64_t N,
+                 const void *alpha, const void *A, const int64_t lda,
+                 const int64_t stridea, void *B, const int64_t ldb,
+                 const int64_t strideb, const int64_t batch_size);
+void cblas_cgemv_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const int64_t M, const int64_t N,
+                 const void *alpha, const void *A, const int64_t lda,
+                 const int64_t stridea, const void *X, const int64_t incX,
+                 const int64_t stridex, const void *beta, void *Y,
+                 const int64_t incY, const int64_t stridey,
+                 const int64_t batch_size);
+
+void cblas_zgemm_batch_64(CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const int64_t *M_array,
+                 const int64_t *N_array, const int64_t *K_array,
+                 const void *alpha_array, const void **A_array,
+                 const int64_t *lda_array, const void **B_array,
+                 const int64_t *ldb_array, const void *beta_array,
+                 void **C_array, const int64_t *ldc_array,
+                 const int64_t group_count, const int64_t *group_size);
+void cblas_zgemm_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, CBLAS_TRANSPOSE TransB,
+                 const int64_t M, const int64_t N, const int64_t K,
+                 const void *alpha, const void *A, const int64_t lda,
+                 const int64_t stridea, const void *B, const int64_t ldb,
+                 const int64_t strideb, const void *beta, void *C,
+                 const int64_t ldc, const int64_t stridec,
+                 const int64_t batch_size);
+void cblas_ztrsm_batch_strided_64(CBLAS_LAYOUT layout, CBLAS_SIDE Side,
+                 CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA,
+                 CBLAS_DIAG Diag, const int64_t M, const int64_t N,
+                 const void *alpha, const void *A, const int64_t lda,
+                 const int64_t stridea, void *B, const int64_t ldb,
+                 const int64_t strideb, const int64_t batch_size);
+void cblas_zgemv_batch_strided_64(CBLAS_LAYOUT layout,
+                 CBLAS_TRANSPOSE TransA, const int64_t M, const int64_t N,
+                 const void *alpha, const void *A, const int64_t lda,
+                 const int64_t stridea, const void *X, const int64_t incX,
+                 const int64_t stridex, const void *beta, void *Y,
+                 const int64_t incY, const int64_t stridey,
+                 const int64_t batch_size);
+
+/*
+ * Number of threads of the Level 3 BLAS
+ */
+void cblas_set_num_threads_64(const int64_t nt);
+int64_t cblas_get_num_threads_64(void);
+
 void
 #ifdef HAS_ATTRIBUTE_WEAK_SUPPORT
 __attribute__((weak))
@@ -46,6 +46,19 @@
 #define FINT const F77_INT *
 #define FINT2 F77_INT *
 
+/* Number of complex elements of the stack buffers that hold the
+*  conjugated copy of a vector in the row-major complex Level 2 routines.
+*  Only longer vectors are copied to the heap. */
+#ifndef CBLAS_CONJ_BUFSIZE
+   #define CBLAS_CONJ_BUFSIZE 256
+#endif
+
+/* Smallest number of multiply-adds per thread of the batched routines,
+*  the MINWRK of IBLAS_THREADS. */
+#ifndef CBLAS_BATCH_MINWORK
+   #define CBLAS_BATCH_MINWORK 2.0e5
+#endif
+
 /*
  * Integer specific API
  */
@@ -229,6 +242,15 @@
 #define F77_ztrmm_base        F77_GLOBAL_SUFFIX(ztrmm,ZTRMM)
 #define F77_ztrsm_base        F77_GLOBAL_SUFFIX(ztrsm,ZTRSM)
 
+/*
+ * Number of threads of the Level 3 BLAS
+ */
+
+#define F77_blas_set_num_threads_base F77_GLOBAL_SUFFIX(blas_set_num_threads,BLAS_SET_NUM_THREADS)
+#define F77_blas_get_num_threads_base F77_GLOBAL_SUFFIX(blas_get_num_threads,BLAS_GET_NUM_THREADS)
+#define F77_blas_set_num_threads(...) F77_blas_set_num_threads_base(__VA_ARGS__)
+#define F77_blas_get_num_threads(...) F77_blas_get_num_threads_base(__VA_ARGS__)
+
 /*
  * Level 1 Fortran variadic definitions
  */
@@ -1186,6 +1208,11 @@ void F77_ztrsm_base(FCHAR, FCHAR, FCHAR, FCHAR, FINT, FINT, const void *, const
 #endif
 );
 
+void F77_blas_set_num_threads_base(FINT);
+F77_INT F77_blas_get_num_threads_base(void);
+
+int API_SUFFIX(cblas_batch_threads)(const int64_t, const double);
+
 #ifdef __cplusplus
 }
 #endif
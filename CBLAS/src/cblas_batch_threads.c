@@ -0,0 +1,43 @@
+/*
+ *
+ * cblas_batch_threads.c
+ * Returns the number of threads among which a batched routine shares a
+ * batch of count problems of work multiply-adds each.
+ *
+ * The result is 1 without OpenMP, inside an active parallel region, when
+ * the batch is too small for the synchronization to pay off, or when
+ * there are fewer problems than threads and each problem is large enough
+ * for the Level 3 BLAS to thread it.  Otherwise each thread gets at least
+ * CBLAS_BATCH_MINWORK multiply-adds, and at most cblas_get_num_threads()
+ * threads are used, or omp_get_max_threads() if the BLAS library is not
+ * the reference one.  Each problem is then computed serially, since the
+ * BLAS does not thread calls made from a parallel region.
+ *
+ */
+
+#include "cblas.h"
+#include "cblas_f77.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+int API_SUFFIX(cblas_batch_threads)(const int64_t count, const double work)
+{
+#ifdef _OPENMP
+   int nt;
+
+   if (count < 2 || omp_in_parallel()) return 1;
+#ifdef CBLAS_HAVE_BLAS_THREADS
+   nt = (int) F77_blas_get_num_threads();
+#else
+   nt = omp_get_max_threads();
+#endif
+   if (count < nt && work >= 2*CBLAS_BATCH_MINWORK) return 1;
+   if ((double) nt * CBLAS_BATCH_MINWORK > work * count)
+      nt = (int) (work * count / CBLAS_BATCH_MINWORK);
+   if (nt > count) nt = (int) count;
+   return (nt > 1) ? nt : 1;
+#else
+   return 1;
+#endif
+}
@@ -39,6 +39,7 @@ void API_SUFFIX(cblas_cgbmv)(const CBLAS_LAYOUT layout,
    float ALPHA[2],BETA[2];
    CBLAS_INT tincY, tincx;
    float *x=(float *)X, *y=(float *)Y, *st=0, *tx=0;
+   float xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -77,7 +78,7 @@ void API_SUFFIX(cblas_cgbmv)(const CBLAS_LAYOUT layout,
          if (M > 0)
          {
             n = M << 1;
-            x = malloc(n*sizeof(float));
+            x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(float));
             tx = x;
 
             if( incX > 0 ) {
@@ -105,27 +106,27 @@ void API_SUFFIX(cblas_cgbmv)(const CBLAS_LAYOUT layout,
             #else
                incx = 1;
             #endif
+         }
+         else x = (float *) X;
 
-            if( incY > 0 )
-              tincY = incY;
-            else
-              tincY = -incY;
+         if( incY > 0 )
+           tincY = incY;
+         else
+           tincY = -incY;
 
-            y++;
+         y++;
 
-            if (N > 0)
-            {
-               i = tincY << 1;
-               n = i * N ;
-               st = y + n;
-               do {
-                  *y = -(*y);
-                  y += i;
-               } while(y != st);
-               y -= n;
-            }
+         if (N > 0)
+         {
+            i = tincY << 1;
+            n = i * N ;
+            st = y + n;
+            do {
+               *y = -(*y);
+               y += i;
+            } while(y != st);
+            y -= n;
          }
-         else x = (float *) X;
 
 
       }
@@ -147,7 +148,7 @@ void API_SUFFIX(cblas_cgbmv)(const CBLAS_LAYOUT layout,
                         A ,&F77_lda, x,&F77_incX, beta, Y, &F77_incY);
       if (TransA == CblasConjTrans)
       {
-         if (x != X) free(x);
+         if (x != X && x != xbuf) free(x);
          if (N > 0)
          {
             do
@@ -37,6 +37,7 @@ void API_SUFFIX(cblas_cgemv)(const CBLAS_LAYOUT layout,
    CBLAS_INT tincY, tincx;
    float *x=(float *)X, *y=(float *)Y, *st=0, *tx=0;
    const float *stx = x;
+   float xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -77,7 +78,7 @@ void API_SUFFIX(cblas_cgemv)(const CBLAS_LAYOUT layout,
          if (M > 0)
          {
             n = M << 1;
-            x = malloc(n*sizeof(float));
+            x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(float));
             tx = x;
             if( incX > 0 ) {
                i = incX << 1 ;
@@ -101,28 +102,28 @@ void API_SUFFIX(cblas_cgemv)(const CBLAS_LAYOUT layout,
             x=tx;
 
             F77_incX = 1;
+            stx = x;
+         }
+         else stx = (const float *)X;
 
-            if(incY > 0)
-               tincY = incY;
-            else
-               tincY = -incY;
+         if(incY > 0)
+            tincY = incY;
+         else
+            tincY = -incY;
 
-            y++;
+         y++;
 
-            if (N > 0)
-            {
-               i = tincY << 1;
-               n = i * N ;
-               st = y + n;
-               do {
-                  *y = -(*y);
-                  y += i;
-               } while(y != st);
-               y -= n;
-            }
-            stx = x;
+         if (N > 0)
+         {
+            i = tincY << 1;
+            n = i * N ;
+            st = y + n;
+            do {
+               *y = -(*y);
+               y += i;
+            } while(y != st);
+            y -= n;
          }
-         else stx = (const float *)X;
       }
       else
       {
@@ -143,7 +144,7 @@ void API_SUFFIX(cblas_cgemv)(const CBLAS_LAYOUT layout,
 
       if (TransA == CblasConjTrans)
       {
-         if (x != (const float *)X) free(x);
+         if (x != (const float *)X && x != xbuf) free(x);
          if (N > 0)
          {
             do
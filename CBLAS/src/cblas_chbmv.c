@@ -35,6 +35,7 @@ void API_SUFFIX(cblas_chbmv)(const CBLAS_LAYOUT layout,
    float ALPHA[2],BETA[2];
    CBLAS_INT tincY, tincx;
    float *x=(float *)X, *y=(float *)Y, *st=0, *tx;
+   float xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -68,7 +69,7 @@ void API_SUFFIX(cblas_chbmv)(const CBLAS_LAYOUT layout,
       if (N > 0)
       {
          n = N << 1;
-         x = malloc(n*sizeof(float));
+         x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(float));
 
          tx = x;
          if( incX > 0 ) {
@@ -141,7 +142,7 @@ void API_SUFFIX(cblas_chbmv)(const CBLAS_LAYOUT layout,
    if ( layout == CblasRowMajor )
    {
       RowMajorStrg = 1;
-      if(X!=x)
+      if(X!=x && x!=xbuf)
          free(x);
       if (N > 0)
       {
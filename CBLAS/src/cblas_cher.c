@@ -30,6 +30,7 @@ void API_SUFFIX(cblas_cher)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
    CBLAS_INT n, i, tincx, incx=incX;
    float *x=(float *)X, *xx=(float *)X, *tx, *st;
 
+   float xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -70,7 +71,7 @@ void API_SUFFIX(cblas_cher)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       if (N > 0)
       {
          n = N << 1;
-         x = malloc(n*sizeof(float));
+         x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(float));
          tx = x;
          if( incX > 0 ) {
             i = incX << 1 ;
@@ -107,7 +108,7 @@ void API_SUFFIX(cblas_cher)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       RowMajorStrg = 0;
       return;
    }
-   if(X!=x)
+   if(X!=x && x!=xbuf)
       free(x);
 
    CBLAS_CallFromC = 0;
@@ -32,6 +32,8 @@ void API_SUFFIX(cblas_cher2)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
    float *x=(float *)X, *xx=(float *)X, *y=(float *)Y,
          *yy=(float *)Y, *tx, *ty, *stx, *sty;
 
+   float xbuf[2*CBLAS_CONJ_BUFSIZE];
+   float ybuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -73,8 +75,8 @@ void API_SUFFIX(cblas_cher2)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       if (N > 0)
       {
          n = N << 1;
-         x = malloc(n*sizeof(float));
-         y = malloc(n*sizeof(float));
+         x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(float));
+         y = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? ybuf : malloc(n*sizeof(float));
          tx = x;
          ty = y;
          if( incX > 0 ) {
@@ -141,9 +143,9 @@ void API_SUFFIX(cblas_cher2)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       RowMajorStrg = 0;
       return;
    }
-   if(X!=x)
+   if(X!=x && x!=xbuf)
       free(x);
-   if(Y!=y)
+   if(Y!=y && y!=ybuf)
       free(y);
 
    CBLAS_CallFromC = 0;
@@ -0,0 +1,110 @@
+/*
+ *
+ * cblas_dtrsm_batch_strided.c
+ * This program is a C interface to batches of independent dtrsm.
+ *
+ * cblas_dtrsm_batch_strided solves batch_size triangular systems of the
+ * same shape, whose matrices are stridea and strideb elements apart.  A
+ * stride of zero for A solves all the systems with the same matrix.
+ *
+ * The arguments are checked once for the whole batch, then the problems
+ * are shared among the threads given by cblas_batch_threads and each one
+ * is solved by a serial call of the Fortran dtrsm.
+ *
+ */
+
+#include "cblas.h"
+#include "cblas_f77.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* One system, without checking the arguments */
+static void trsm(const CBLAS_LAYOUT layout, const CBLAS_SIDE Side,
+                 const CBLAS_UPLO Uplo, const CBLAS_TRANSPOSE TransA,
+                 const CBLAS_DIAG Diag, const CBLAS_INT M, const CBLAS_INT N,
+                 const double alpha, const double *A, const CBLAS_INT lda,
+                 double *B, const CBLAS_INT ldb)
+{
+   char SD, UL, TA, DI;
+#ifdef F77_CHAR
+   F77_CHAR F77_SD, F77_UL, F77_TA, F77_DI;
+#else
+   #define F77_SD &SD
+   #define F77_UL &UL
+   #define F77_TA &TA
+   #define F77_DI &DI
+#endif
+   F77_INT F77_M=M, F77_N=N, F77_lda=lda, F77_ldb=ldb;
+
+   if (layout == CblasColMajor)
+   {
+      SD = (Side == CblasLeft) ? 'L' : 'R';
+      UL = (Uplo == CblasUpper) ? 'U' : 'L';
+   }
+   else
+   {
+      SD = (Side == CblasLeft) ? 'R' : 'L';
+      UL = (Uplo == CblasUpper) ? 'L' : 'U';
+   }
+   TA = (TransA == CblasNoTrans) ? 'N' : (TransA == CblasTrans) ? 'T' : 'C';
+   DI = (Diag == CblasUnit) ? 'U' : 'N';
+   #ifdef F77_CHAR
+      F77_SD = C2F_CHAR(&SD);
+      F77_UL = C2F_CHAR(&UL);
+      F77_TA = C2F_CHAR(&TA);
+      F77_DI = C2F_CHAR(&DI);
+   #endif
+   if (layout == CblasColMajor)
+      F77_dtrsm(F77_SD, F77_UL, F77_TA, F77_DI, &F77_M, &F77_N, &alpha, A,
+                &F77_lda, B, &F77_ldb);
+   else
+      F77_dtrsm(F77_SD, F77_UL, F77_TA, F77_DI, &F77_N, &F77_M, &alpha, A,
+                &F77_lda, B, &F77_ldb);
+}
+
+void API_SUFFIX(cblas_dtrsm_batch_strided)(const CBLAS_LAYOUT layout,
+                 const CBLAS_SIDE Side, const CBLAS_UPLO Uplo,
+                 const CBLAS_TRANSPOSE TransA, const CBLAS_DIAG Diag,
+                 const CBLAS_INT M, const CBLAS_INT N, const double alpha,
+                 const double *A, const CBLAS_INT lda, const CBLAS_INT stridea,
+                 double *B, const CBLAS_INT ldb, const CBLAS_INT strideb,
+                 const CBLAS_INT batch_size)
+{
+   const double *a = (const double *)A;
+   double *b = (double *)B;
+   CBLAS_INT i, info = 0;
+#ifdef _OPENMP
+   int nt;
+#endif
+
+   if (layout != CblasColMajor && layout != CblasRowMajor) info = 1;
+   else if (Side != CblasLeft && Side != CblasRight) info = 2;
+   else if (Uplo != CblasUpper && Uplo != CblasLower) info = 3;
+   else if (TransA != CblasNoTrans && TransA != CblasTrans &&
+            TransA != CblasConjTrans) info = 4;
+   else if (Diag != CblasUnit && Diag != CblasNonUnit) info = 5;
+   else if (M < 0) info = 6;
+   else if (N < 0) info = 7;
+   else if (lda < 1 || lda < (Side == CblasLeft ? M : N)) info = 10;
+   else if (stridea < 0) info = 11;
+   else if (ldb < 1 || ldb < (layout == CblasColMajor ? M : N)) info = 13;
+   else if (batch_size > 1 && strideb <
+            (int64_t)ldb * (layout == CblasColMajor ? N : M)) info = 14;
+   else if (batch_size < 0) info = 15;
+   if (info)
+   {
+      API_SUFFIX(cblas_xerbla)(info, "cblas_dtrsm_batch_strided", "");
+      return;
+   }
+   if (batch_size == 0) return;
+
+#ifdef _OPENMP
+   nt = API_SUFFIX(cblas_batch_threads)(batch_size, 0.5 *
+           (Side == CblasLeft ? (double)M*M*N : (double)N*N*M));
+   #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+   for (i = 0; i < batch_size; i++)
+      trsm(layout, Side, Uplo, TransA, Diag, M, N, alpha,
+           a + (size_t)i*stridea, lda, b + (size_t)i*strideb, ldb);
+}
@@ -0,0 +1,25 @@
+/*
+ *
+ * cblas_get_kernel_name.c
+ * Returns the name of the micro-kernel path used by the Level 3 BLAS.
+ *
+ * "scalar", "avx2" or "avx512" when the BLAS library was built with the
+ * runtime-dispatched micro-kernels of BLAS/SRC/blocked, "reference"
+ * otherwise.
+ *
+ */
+
+#include "cblas.h"
+
+#ifdef CBLAS_HAVE_BLAS_KERNELS
+const char *blas_kernel_name(void);
+#endif
+
+const char *cblas_get_kernel_name(void)
+{
+#ifdef CBLAS_HAVE_BLAS_KERNELS
+   return blas_kernel_name();
+#else
+   return "reference";
+#endif
+}
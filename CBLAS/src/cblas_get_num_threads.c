@@ -0,0 +1,20 @@
+/*
+ *
+ * cblas_get_num_threads.c
+ * Returns the largest number of threads among which the Level 3 BLAS
+ * partitions a call, or 1 when the BLAS library is not built with
+ * OpenMP.
+ *
+ */
+
+#include "cblas.h"
+#include "cblas_f77.h"
+
+CBLAS_INT API_SUFFIX(cblas_get_num_threads)(void)
+{
+#ifdef CBLAS_HAVE_BLAS_THREADS
+   return (CBLAS_INT) F77_blas_get_num_threads();
+#else
+   return 1;
+#endif
+}
@@ -0,0 +1,22 @@
+/*
+ *
+ * cblas_set_num_threads.c
+ * Sets the number of threads of the Level 3 BLAS.
+ *
+ * A positive nt overrides the environment variable LAPACK_NUM_THREADS;
+ * zero or a negative nt restores the OpenMP default.  It has no effect
+ * when the BLAS library is not built with OpenMP.
+ *
+ */
+
+#include "cblas.h"
+#include "cblas_f77.h"
+
+void API_SUFFIX(cblas_set_num_threads)(const CBLAS_INT nt)
+{
+#ifdef CBLAS_HAVE_BLAS_THREADS
+   F77_INT F77_nt=nt;
+
+   F77_blas_set_num_threads(&F77_nt);
+#endif
+}
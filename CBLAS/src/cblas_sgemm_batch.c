@@ -0,0 +1,200 @@
+/*
+ *
+ * cblas_sgemm_batch.c
+ * This program is a C interface to batches of independent sgemm.
+ *
+ * cblas_sgemm_batch computes group_count groups of products.  The
+ * problems of group g share entry g of the arrays of operations,
+ * dimensions, scalars and leading dimensions, and there are
+ * group_size[g] of them; a_array, b_array and c_array hold one pointer
+ * per problem, the problems of group 0 first.
+ *
+ * cblas_sgemm_batch_strided computes batch_size products of the same
+ * shape, whose matrices are stridea, strideb and stridec elements apart.
+ * A stride of zero shares an input matrix among the problems.
+ *
+ * The arguments are checked once for the whole batch, then the problems
+ * are shared among the threads given by cblas_batch_threads and each one
+ * is computed by a serial call of the Fortran sgemm.
+ *
+ */
+
+#include "cblas.h"
+#include "cblas_f77.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Checks the arguments of a group, returns the number of the first illegal
+ * one or 0.  ia, ib and ic are the numbers of lda, ldb and ldc. */
+static CBLAS_INT check(const CBLAS_LAYOUT layout, const CBLAS_TRANSPOSE TransA,
+                       const CBLAS_TRANSPOSE TransB, const CBLAS_INT M,
+                       const CBLAS_INT N, const CBLAS_INT K,
+                       const CBLAS_INT lda, const CBLAS_INT ldb,
+                       const CBLAS_INT ldc, const CBLAS_INT ia,
+                       const CBLAS_INT ib, const CBLAS_INT ic)
+{
+   CBLAS_INT nrowa, nrowb, nrowc;
+
+   if (layout != CblasColMajor && layout != CblasRowMajor) return 1;
+   if (TransA != CblasNoTrans && TransA != CblasTrans &&
+       TransA != CblasConjTrans) return 2;
+   if (TransB != CblasNoTrans && TransB != CblasTrans &&
+       TransB != CblasConjTrans) return 3;
+   if (M < 0) return 4;
+   if (N < 0) return 5;
+   if (K < 0) return 6;
+   if (layout == CblasColMajor)
+   {
+      nrowa = (TransA == CblasNoTrans) ? M : K;
+      nrowb = (TransB == CblasNoTrans) ? K : N;
+      nrowc = M;
+   }
+   else
+   {
+      nrowa = (TransA == CblasNoTrans) ? K : M;
+      nrowb = (TransB == CblasNoTrans) ? N : K;
+      nrowc = N;
+   }
+   if (lda < 1 || lda < nrowa) return ia;
+   if (ldb < 1 || ldb < nrowb) return ib;
+   if (ldc < 1 || ldc < nrowc) return ic;
+   return 0;
+}
+
+/* One product, without checking the arguments */
+static void gemm(const CBLAS_LAYOUT layout, const CBLAS_TRANSPOSE TransA,
+                 const CBLAS_TRANSPOSE TransB, const CBLAS_INT M,
+                 const CBLAS_INT N, const CBLAS_INT K, const float alpha,
+                 const float *A, const CBLAS_INT lda, const float *B,
+                 const CBLAS_INT ldb, const float beta, float *C,
+                 const CBLAS_INT ldc)
+{
+   char TA, TB;
+#ifdef F77_CHAR
+   F77_CHAR F77_TA, F77_TB;
+#else
+   #define F77_TA &TA
+   #define F77_TB &TB
+#endif
+   F77_INT F77_M=M, F77_N=N, F77_K=K, F77_lda=lda, F77_ldb=ldb;
+   F77_INT F77_ldc=ldc;
+
+   TA = (TransA == CblasNoTrans) ? 'N' : (TransA == CblasTrans) ? 'T' : 'C';
+   TB = (TransB == CblasNoTrans) ? 'N' : (TransB == CblasTrans) ? 'T' : 'C';
+   #ifdef F77_CHAR
+      F77_TA = C2F_CHAR(&TA);
+      F77_TB = C2F_CHAR(&TB);
+   #endif
+   if (layout == CblasColMajor)
+      F77_sgemm(F77_TA, F77_TB, &F77_M, &F77_N, &F77_K, &alpha, A,
+                &F77_lda, B, &F77_ldb, &beta, C, &F77_ldc);
+   else
+      F77_sgemm(F77_TB, F77_TA, &F77_N, &F77_M, &F77_K, &alpha, B,
+                &F77_ldb, A, &F77_lda, &beta, C, &F77_ldc);
+}
+
+void API_SUFFIX(cblas_sgemm_batch)(const CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE *TransA_array,
+                 const CBLAS_TRANSPOSE *TransB_array, const CBLAS_INT *M_array,
+                 const CBLAS_INT *N_array, const CBLAS_INT *K_array,
+                 const float *alpha_array, const float **A_array,
+                 const CBLAS_INT *lda_array, const float **B_array,
+                 const CBLAS_INT *ldb_array, const float *beta_array,
+                 float **C_array, const CBLAS_INT *ldc_array,
+                 const CBLAS_INT group_count, const CBLAS_INT *group_size)
+{
+   CBLAS_INT g, i, info, first, count = 0;
+   double work = 0.0;
+#ifdef _OPENMP
+   int nt;
+#endif
+
+   if (group_count < 0)
+   {
+      API_SUFFIX(cblas_xerbla)(15, "cblas_sgemm_batch",
+                               "");
+      return;
+   }
+   for (g = 0; g < group_count; g++)
+   {
+      if (group_size[g] < 0)
+      {
+         API_SUFFIX(cblas_xerbla)(16, "cblas_sgemm_batch",
+                                  "Illegal setting in group %" CBLAS_IFMT "\n", g);
+         return;
+      }
+      info = check(layout, TransA_array[g], TransB_array[g], M_array[g],
+                   N_array[g], K_array[g], lda_array[g], ldb_array[g],
+                   ldc_array[g], 9, 11, 14);
+      if (info)
+      {
+         API_SUFFIX(cblas_xerbla)(info, "cblas_sgemm_batch",
+                                  "Illegal setting in group %" CBLAS_IFMT "\n", g);
+         return;
+      }
+      count += group_size[g];
+      work += (double)group_size[g] * M_array[g] * N_array[g] * K_array[g];
+   }
+   if (count == 0) return;
+
+#ifdef _OPENMP
+   nt = API_SUFFIX(cblas_batch_threads)(count, work/count);
+   #pragma omp parallel num_threads(nt) private(g, i, first) if(nt > 1)
+#endif
+   {
+      for (g = 0, first = 0; g < group_count; first += group_size[g], g++)
+      {
+#ifdef _OPENMP
+         #pragma omp for schedule(static) nowait
+#endif
+         for (i = first; i < first + group_size[g]; i++)
+            gemm(layout, TransA_array[g], TransB_array[g], M_array[g],
+                 N_array[g], K_array[g], alpha_array[g], A_array[i],
+                 lda_array[g], B_array[i], ldb_array[g], beta_array[g],
+                 C_array[i], ldc_array[g]);
+      }
+   }
+}
+
+void API_SUFFIX(cblas_sgemm_batch_strided)(const CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE TransA, const CBLAS_TRANSPOSE TransB,
+                 const CBLAS_INT M, const CBLAS_INT N, const CBLAS_INT K,
+                 const float alpha, const float *A, const CBLAS_INT lda,
+                 const CBLAS_INT stridea, const float *B, const CBLAS_INT ldb,
+                 const CBLAS_INT strideb, const float beta, float *C,
+                 const CBLAS_INT ldc, const CBLAS_INT stridec,
+                 const CBLAS_INT batch_size)
+{
+   const float *a = (const float *)A, *b = (const float *)B;
+   float *c = (float *)C;
+   CBLAS_INT i, info;
+#ifdef _OPENMP
+   int nt;
+#endif
+
+   info = check(layout, TransA, TransB, M, N, K, lda, ldb, ldc, 9, 12, 16);
+   if (info == 0)
+   {
+      if (stridea < 0) info = 10;
+      else if (strideb < 0) info = 13;
+      else if (batch_size > 1 && stridec <
+               (int64_t)ldc * (layout == CblasColMajor ? N : M)) info = 17;
+      else if (batch_size < 0) info = 18;
+   }
+   if (info)
+   {
+      API_SUFFIX(cblas_xerbla)(info, "cblas_sgemm_batch_strided", "");
+      return;
+   }
+   if (batch_size == 0) return;
+
+#ifdef _OPENMP
+   nt = API_SUFFIX(cblas_batch_threads)(batch_size, (double)M*N*K);
+   #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+   for (i = 0; i < batch_size; i++)
+      gemm(layout, TransA, TransB, M, N, K, alpha,
+           a + (size_t)i*stridea, lda, b + (size_t)i*strideb, ldb, beta,
+           c + (size_t)i*stridec, ldc);
+}
@@ -0,0 +1,95 @@
+/*
+ *
+ * cblas_sgemv_batch_strided.c
+ * This program is a C interface to batches of independent sgemv.
+ *
+ * cblas_sgemv_batch_strided computes batch_size matrix-vector products
+ * of the same shape, whose matrices and vectors are stridea, stridex and
+ * stridey elements apart.  A stride of zero for A or x shares the input
+ * among the problems.
+ *
+ * The arguments are checked once for the whole batch, then the problems
+ * are shared among the threads given by cblas_batch_threads and each one
+ * is computed by a call of the Fortran sgemv.
+ *
+ */
+
+#include "cblas.h"
+#include "cblas_f77.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* One product, without checking the arguments */
+static void gemv(const CBLAS_LAYOUT layout, const CBLAS_TRANSPOSE TransA,
+                 const CBLAS_INT M, const CBLAS_INT N, const float alpha,
+                 const float *A, const CBLAS_INT lda, const float *X,
+                 const CBLAS_INT incX, const float beta, float *Y,
+                 const CBLAS_INT incY)
+{
+   char TA;
+#ifdef F77_CHAR
+   F77_CHAR F77_TA;
+#else
+   #define F77_TA &TA
+#endif
+   F77_INT F77_M=M, F77_N=N, F77_lda=lda, F77_incX=incX, F77_incY=incY;
+   if (layout == CblasColMajor)
+      TA = (TransA == CblasNoTrans) ? 'N' : (TransA == CblasTrans) ? 'T' : 'C';
+   else
+      TA = (TransA == CblasNoTrans) ? 'T' : 'N';
+   #ifdef F77_CHAR
+      F77_TA = C2F_CHAR(&TA);
+   #endif
+   if (layout == CblasColMajor)
+      F77_sgemv(F77_TA, &F77_M, &F77_N, &alpha, A, &F77_lda, X, &F77_incX,
+                &beta, Y, &F77_incY);
+   else
+      F77_sgemv(F77_TA, &F77_N, &F77_M, &alpha, A, &F77_lda, X, &F77_incX,
+                &beta, Y, &F77_incY);
+}
+
+void API_SUFFIX(cblas_sgemv_batch_strided)(const CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE TransA, const CBLAS_INT M,
+                 const CBLAS_INT N, const float alpha, const float *A,
+                 const CBLAS_INT lda, const CBLAS_INT stridea, const float *X,
+                 const CBLAS_INT incX, const CBLAS_INT stridex,
+                 const float beta, float *Y, const CBLAS_INT incY,
+                 const CBLAS_INT stridey, const CBLAS_INT batch_size)
+{
+   const float *a = (const float *)A, *x = (const float *)X;
+   float *y = (float *)Y;
+   CBLAS_INT i, leny, info = 0;
+#ifdef _OPENMP
+   int nt;
+#endif
+
+   leny = (TransA == CblasNoTrans) ? M : N;
+   if (layout != CblasColMajor && layout != CblasRowMajor) info = 1;
+   else if (TransA != CblasNoTrans && TransA != CblasTrans &&
+            TransA != CblasConjTrans) info = 2;
+   else if (M < 0) info = 3;
+   else if (N < 0) info = 4;
+   else if (lda < 1 || lda < (layout == CblasColMajor ? M : N)) info = 7;
+   else if (stridea < 0) info = 8;
+   else if (incX == 0) info = 10;
+   else if (stridex < 0) info = 11;
+   else if (incY == 0) info = 14;
+   else if (batch_size > 1 && leny > 0 && stridey <
+            1 + (int64_t)(leny - 1) * (incY > 0 ? incY : -incY)) info = 15;
+   else if (batch_size < 0) info = 16;
+   if (info)
+   {
+      API_SUFFIX(cblas_xerbla)(info, "cblas_sgemv_batch_strided", "");
+      return;
+   }
+   if (batch_size == 0) return;
+
+#ifdef _OPENMP
+   nt = API_SUFFIX(cblas_batch_threads)(batch_size, (double)M*N);
+   #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+   for (i = 0; i < batch_size; i++)
+      gemv(layout, TransA, M, N, alpha, a + (size_t)i*stridea, lda,
+           x + (size_t)i*stridex, incX, beta, y + (size_t)i*stridey, incY);
+}
@@ -39,6 +39,7 @@ void API_SUFFIX(cblas_zgbmv)(const CBLAS_LAYOUT layout,
    double ALPHA[2],BETA[2];
    CBLAS_INT tincY, tincx;
    double *x=(double *)X, *y=(double *)Y, *st=0, *tx;
+   double xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -77,7 +78,7 @@ void API_SUFFIX(cblas_zgbmv)(const CBLAS_LAYOUT layout,
          if (M > 0)
          {
             n = M << 1;
-            x = malloc(n*sizeof(double));
+            x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(double));
             tx = x;
 
             if( incX > 0 ) {
@@ -105,27 +106,27 @@ void API_SUFFIX(cblas_zgbmv)(const CBLAS_LAYOUT layout,
             #else
                incx = 1;
             #endif
+         }
+         else x = (double *) X;
 
-            if( incY > 0 )
-              tincY = incY;
-            else
-              tincY = -incY;
+         if( incY > 0 )
+           tincY = incY;
+         else
+           tincY = -incY;
 
-            y++;
+         y++;
 
-            if (N > 0)
-            {
-               i = tincY << 1;
-               n = i * N ;
-               st = y + n;
-               do {
-                  *y = -(*y);
-                  y += i;
-               } while(y != st);
-               y -= n;
-            }
+         if (N > 0)
+         {
+            i = tincY << 1;
+            n = i * N ;
+            st = y + n;
+            do {
+               *y = -(*y);
+               y += i;
+            } while(y != st);
+            y -= n;
          }
-         else x = (double *) X;
 
 
       }
@@ -147,7 +148,7 @@ void API_SUFFIX(cblas_zgbmv)(const CBLAS_LAYOUT layout,
                         A ,&F77_lda, x,&F77_incX, beta, Y, &F77_incY);
       if (TransA == CblasConjTrans)
       {
-         if (x != X) free(x);
+         if (x != X && x != xbuf) free(x);
          if (N > 0)
          {
             do
@@ -36,6 +36,7 @@ void API_SUFFIX(cblas_zgemv)(const CBLAS_LAYOUT layout,
    double ALPHA[2],BETA[2];
    CBLAS_INT tincY, tincx;
    double *x=(double *)X, *y=(double *)Y, *st=0, *tx;
+   double xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -76,7 +77,7 @@ void API_SUFFIX(cblas_zgemv)(const CBLAS_LAYOUT layout,
          if (M > 0)
          {
             n = M << 1;
-            x = malloc(n*sizeof(double));
+            x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(double));
             tx = x;
             if( incX > 0 ) {
                i = incX << 1 ;
@@ -104,27 +105,27 @@ void API_SUFFIX(cblas_zgemv)(const CBLAS_LAYOUT layout,
             #else
                incx = 1;
             #endif
+         }
+         else x = (double *) X;
 
-            if(incY > 0)
-               tincY = incY;
-            else
-               tincY = -incY;
+         if(incY > 0)
+            tincY = incY;
+         else
+            tincY = -incY;
 
-            y++;
+         y++;
 
-            if (N > 0)
-            {
-               i = tincY << 1;
-               n = i * N ;
-               st = y + n;
-               do {
-                  *y = -(*y);
-                  y += i;
-               } while(y != st);
-               y -= n;
-            }
+         if (N > 0)
+         {
+            i = tincY << 1;
+            n = i * N ;
+            st = y + n;
+            do {
+               *y = -(*y);
+               y += i;
+            } while(y != st);
+            y -= n;
          }
-         else x = (double *) X;
       }
       else
       {
@@ -145,7 +146,7 @@ void API_SUFFIX(cblas_zgemv)(const CBLAS_LAYOUT layout,
 
       if (TransA == CblasConjTrans)
       {
-         if (x != (double *)X) free(x);
+         if (x != (double *)X && x != xbuf) free(x);
          if (N > 0)
          {
             do
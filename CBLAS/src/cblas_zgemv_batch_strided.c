@@ -0,0 +1,128 @@
+/*
+ *
+ * cblas_zgemv_batch_strided.c
+ * This program is a C interface to batches of independent zgemv.
+ *
+ * cblas_zgemv_batch_strided computes batch_size matrix-vector products
+ * of the same shape, whose matrices and vectors are stridea, stridex and
+ * stridey elements apart.  A stride of zero for A or x shares the input
+ * among the problems.
+ *
+ * The arguments are checked once for the whole batch, then the problems
+ * are shared among the threads given by cblas_batch_threads and each one
+ * is computed by a call of the Fortran zgemv.
+ *
+ */
+
+#include <stdlib.h>
+#include "cblas.h"
+#include "cblas_f77.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* One product, without checking the arguments */
+static void gemv(const CBLAS_LAYOUT layout, const CBLAS_TRANSPOSE TransA,
+                 const CBLAS_INT M, const CBLAS_INT N, const void *alpha,
+                 const double *A, const CBLAS_INT lda, const double *X,
+                 const CBLAS_INT incX, const void *beta, double *Y,
+                 const CBLAS_INT incY)
+{
+   char TA;
+#ifdef F77_CHAR
+   F77_CHAR F77_TA;
+#else
+   #define F77_TA &TA
+#endif
+   F77_INT F77_M=M, F77_N=N, F77_lda=lda, F77_incX=incX, F77_incY=incY;
+   F77_INT F77_one=1;
+   const double *alp = (const double *)alpha, *bet = (const double *)beta;
+   double ALPHA[2], BETA[2], xbuf[2*CBLAS_CONJ_BUFSIZE], *x;
+   CBLAS_INT i, ix, incy;
+
+   if (layout == CblasRowMajor && TransA == CblasConjTrans)
+   {
+      /* conj( y ) := conj( alpha )*A'*conj( x ) + conj( beta )*conj( y ),
+       * where A' is the column-major N by M matrix stored in A */
+      ALPHA[0] = alp[0];
+      ALPHA[1] = -alp[1];
+      BETA[0] = bet[0];
+      BETA[1] = -bet[1];
+      x = (M <= CBLAS_CONJ_BUFSIZE) ? xbuf : malloc(2*M*sizeof(double));
+      ix = (incX > 0) ? 0 : (1 - M)*incX;
+      for (i = 0; i < M; i++, ix += incX)
+      {
+         x[2*i] = X[2*ix];
+         x[2*i+1] = -X[2*ix+1];
+      }
+      incy = (incY > 0) ? incY : -incY;
+      for (i = 0; i < N; i++) Y[2*i*incy+1] = -Y[2*i*incy+1];
+      TA = 'N';
+      #ifdef F77_CHAR
+         F77_TA = C2F_CHAR(&TA);
+      #endif
+      F77_zgemv(F77_TA, &F77_N, &F77_M, ALPHA, A, &F77_lda, x, &F77_one,
+                BETA, Y, &F77_incY);
+      for (i = 0; i < N; i++) Y[2*i*incy+1] = -Y[2*i*incy+1];
+      if (x != xbuf) free(x);
+      return;
+   }
+   if (layout == CblasColMajor)
+      TA = (TransA == CblasNoTrans) ? 'N' : (TransA == CblasTrans) ? 'T' : 'C';
+   else
+      TA = (TransA == CblasNoTrans) ? 'T' : 'N';
+   #ifdef F77_CHAR
+      F77_TA = C2F_CHAR(&TA);
+   #endif
+   if (layout == CblasColMajor)
+      F77_zgemv(F77_TA, &F77_M, &F77_N, alpha, A, &F77_lda, X, &F77_incX,
+                beta, Y, &F77_incY);
+   else
+      F77_zgemv(F77_TA, &F77_N, &F77_M, alpha, A, &F77_lda, X, &F77_incX,
+                beta, Y, &F77_incY);
+}
+
+void API_SUFFIX(cblas_zgemv_batch_strided)(const CBLAS_LAYOUT layout,
+                 const CBLAS_TRANSPOSE TransA, const CBLAS_INT M,
+                 const CBLAS_INT N, const void *alpha, const void *A,
+                 const CBLAS_INT lda, const CBLAS_INT stridea, const void *X,
+                 const CBLAS_INT incX, const CBLAS_INT stridex,
+                 const void *beta, void *Y, const CBLAS_INT incY,
+                 const CBLAS_INT stridey, const CBLAS_INT batch_size)
+{
+   const double *a = (const double *)A, *x = (const double *)X;
+   double *y = (double *)Y;
+   CBLAS_INT i, leny, info = 0;
+#ifdef _OPENMP
+   int nt;
+#endif
+
+   leny = (TransA == CblasNoTrans) ? M : N;
+   if (layout != CblasColMajor && layout != CblasRowMajor) info = 1;
+   else if (TransA != CblasNoTrans && TransA != CblasTrans &&
+            TransA != CblasConjTrans) info = 2;
+   else if (M < 0) info = 3;
+   else if (N < 0) info = 4;
+   else if (lda < 1 || lda < (layout == CblasColMajor ? M : N)) info = 7;
+   else if (stridea < 0) info = 8;
+   else if (incX == 0) info = 10;
+   else if (stridex < 0) info = 11;
+   else if (incY == 0) info = 14;
+   else if (batch_size > 1 && leny > 0 && stridey <
+            1 + (int64_t)(leny - 1) * (incY > 0 ? incY : -incY)) info = 15;
+   else if (batch_size < 0) info = 16;
+   if (info)
+   {
+      API_SUFFIX(cblas_xerbla)(info, "cblas_zgemv_batch_strided", "");
+      return;
+   }
+   if (batch_size == 0) return;
+
+#ifdef _OPENMP
+   nt = API_SUFFIX(cblas_batch_threads)(batch_size, 4.0*(double)M*N);
+   #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+   for (i = 0; i < batch_size; i++)
+      gemv(layout, TransA, M, N, alpha, a + 2*(size_t)i*stridea, lda,
+           x + 2*(size_t)i*stridex, incX, beta, y + 2*(size_t)i*stridey, incY);
+}
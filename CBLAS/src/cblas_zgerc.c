@@ -26,6 +26,7 @@ void API_SUFFIX(cblas_zgerc)(const CBLAS_LAYOUT layout, const CBLAS_INT M, const
    CBLAS_INT n, i, tincy, incy=incY;
    double *y=(double *)Y, *yy=(double *)Y, *ty, *st;
 
+   double ybuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -41,7 +42,7 @@ void API_SUFFIX(cblas_zgerc)(const CBLAS_LAYOUT layout, const CBLAS_INT M, const
       if (N > 0)
       {
          n = N << 1;
-         y = malloc(n*sizeof(double));
+         y = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? ybuf : malloc(n*sizeof(double));
 
          ty = y;
          if( incY > 0 ) {
@@ -74,7 +75,7 @@ void API_SUFFIX(cblas_zgerc)(const CBLAS_LAYOUT layout, const CBLAS_INT M, const
 
       F77_zgeru( &F77_N, &F77_M, alpha, y, &F77_incY, X, &F77_incX, A,
                       &F77_lda);
-      if(Y!=y)
+      if(Y!=y && y!=ybuf)
          free(y);
 
    } else API_SUFFIX(cblas_xerbla)(1, "cblas_zgerc", "Illegal layout setting, %d\n", layout);
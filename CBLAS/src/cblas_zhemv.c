@@ -34,6 +34,7 @@ void API_SUFFIX(cblas_zhemv)(const CBLAS_LAYOUT layout,
    double ALPHA[2],BETA[2];
    CBLAS_INT tincY, tincx;
    double *x=(double *)X, *y=(double *)Y, *st=0, *tx;
+   double xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -68,7 +69,7 @@ void API_SUFFIX(cblas_zhemv)(const CBLAS_LAYOUT layout,
       if (N > 0)
       {
          n = N << 1;
-         x = malloc(n*sizeof(double));
+         x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(double));
 
          tx = x;
          if( incX > 0 ) {
@@ -142,7 +143,7 @@ void API_SUFFIX(cblas_zhemv)(const CBLAS_LAYOUT layout,
    if ( layout == CblasRowMajor )
    {
       RowMajorStrg = 1;
-      if ( X != x )
+      if ( X != x && x != xbuf )
          free(x);
       if (N > 0)
       {
@@ -30,6 +30,7 @@ void API_SUFFIX(cblas_zher)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
    CBLAS_INT n, i, tincx, incx=incX;
    double *x=(double *)X, *xx=(double *)X, *tx, *st;
 
+   double xbuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -70,7 +71,7 @@ void API_SUFFIX(cblas_zher)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       if (N > 0)
       {
          n = N << 1;
-         x = malloc(n*sizeof(double));
+         x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(double));
          tx = x;
          if( incX > 0 ) {
             i = incX << 1 ;
@@ -101,7 +102,7 @@ void API_SUFFIX(cblas_zher)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       else x = (double *) X;
       F77_zher(F77_UL, &F77_N, &alpha, x, &F77_incX, A, &F77_lda);
    } else API_SUFFIX(cblas_xerbla)(1, "cblas_zher", "Illegal layout setting, %d\n", layout);
-   if(X!=x)
+   if(X!=x && x!=xbuf)
       free(x);
 
    CBLAS_CallFromC = 0;
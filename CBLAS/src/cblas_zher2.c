@@ -32,6 +32,8 @@ void API_SUFFIX(cblas_zher2)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
    double *x=(double *)X, *xx=(double *)X, *y=(double *)Y,
          *yy=(double *)Y, *tx, *ty, *stx, *sty;
 
+   double xbuf[2*CBLAS_CONJ_BUFSIZE];
+   double ybuf[2*CBLAS_CONJ_BUFSIZE];
    extern int CBLAS_CallFromC;
    extern int RowMajorStrg;
    RowMajorStrg = 0;
@@ -73,8 +75,8 @@ void API_SUFFIX(cblas_zher2)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       if (N > 0)
       {
          n = N << 1;
-         x = malloc(n*sizeof(double));
-         y = malloc(n*sizeof(double));
+         x = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? xbuf : malloc(n*sizeof(double));
+         y = ( n <= 2*CBLAS_CONJ_BUFSIZE ) ? ybuf : malloc(n*sizeof(double));
          tx = x;
          ty = y;
          if( incX > 0 ) {
@@ -142,9 +144,9 @@ void API_SUFFIX(cblas_zher2)(const CBLAS_LAYOUT layout, const CBLAS_UPLO Uplo,
       RowMajorStrg = 0;
       return;
    }
-   if(X!=x)
+   if(X!=x && x!=xbuf)
       free(x);
-   if(Y!=y)
+   if(Y!=y && y!=ybuf)
       free(y);
 
    CBLAS_CallFromC = 0;
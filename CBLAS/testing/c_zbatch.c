@@ -0,0 +1,436 @@
+/*
+ * c_zbatch.c
+ * Tests the batched Z routines of CBLAS: cblas_zgemm_batch,
+ * cblas_zgemm_batch_strided, cblas_ztrsm_batch_strided and
+ * cblas_zgemv_batch_strided.
+ *
+ * Each batch is computed once by the batched routine and once problem by
+ * problem by the routine that it batches, in both layouts and for all the
+ * options; the two results must agree, including the elements between
+ * the matrices, which must be left unchanged.  The illegal arguments must
+ * be reported to cblas_xerbla with their number, and leave the output
+ * unchanged.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include "cblas.h"
+
+#define W      2      /* numbers per element */
+#define NB     5      /* problems per batch */
+#define EPS    DBL_EPSILON
+
+static const double alpha[2] = {1.25, 0.5}, beta[2] = {-0.5, 0.25};
+static const CBLAS_LAYOUT layouts[2] = {CblasColMajor, CblasRowMajor};
+static const CBLAS_TRANSPOSE trans[3] = {CblasNoTrans, CblasTrans,
+                                         CblasConjTrans};
+
+static int nerr;
+static CBLAS_INT xinfo;
+
+/* Records the argument reported by the routines */
+void cblas_xerbla(CBLAS_INT info, const char *rout, const char *form, ...)
+{
+   xinfo = info;
+}
+
+/* Fills x with n random numbers between -1 and 1 */
+static void fill(double *x, size_t n)
+{
+   static unsigned long seed = 1;
+   size_t i;
+
+   for (i = 0; i < n; i++)
+   {
+      seed = (1103515245UL * seed + 12345UL) % 2147483648UL;
+      x[i] = (double) (2.0 * seed / 2147483648.0 - 1.0);
+   }
+}
+
+/* Compares the n numbers of x and y, reports a difference as an error */
+static void compare(const char *rout, const double *x, const double *y, size_t n,
+                    CBLAS_INT k, const char *what)
+{
+   size_t i;
+   double d, tol = 16.0 * EPS * (k + 1);
+
+   for (i = 0; i < n; i++)
+   {
+      d = (double)x[i] - (double)y[i];
+      if (d < 0) d = -d;
+      if (d > tol * (1.0 + (y[i] < 0 ? -y[i] : y[i])))
+      {
+         printf(" ***** %s: %s: element %lu differs: %g, %g\n", rout, what,
+                (unsigned long)i, (double)x[i], (double)y[i]);
+         nerr++;
+         return;
+      }
+   }
+}
+
+/* Checks that an illegal call reported argument info */
+static void chkxer(const char *rout, CBLAS_INT info)
+{
+   if (xinfo != info)
+   {
+      printf(" ***** %s: illegal argument %ld reported as %ld\n", rout,
+             (long)info, (long)xinfo);
+      nerr++;
+   }
+   xinfo = 0;
+}
+
+static void test_gemm_batch_strided(void)
+{
+   static const CBLAS_INT dims[][3] = {{0, 3, 2}, {3, 0, 2}, {4, 5, 0},
+      {1, 1, 1}, {7, 5, 6}, {16, 9, 12}};
+   const char *rout = "cblas_zgemm_batch_strided";
+   CBLAS_INT l, ta, tb, d, i, M, N, K, lda, ldb, ldc, sa, sb, sc, ra, rb;
+   double *a, *b, *c1, *c2;
+   size_t na, nb, nc;
+   int e0 = nerr;
+
+   for (l = 0; l < 2; l++)
+   for (ta = 0; ta < 3; ta++)
+   for (tb = 0; tb < 3; tb++)
+   for (d = 0; d < (CBLAS_INT)(sizeof(dims)/sizeof(dims[0])); d++)
+   {
+      M = dims[d][0]; N = dims[d][1]; K = dims[d][2];
+      /* rows and columns of the stored A and B, in the layout */
+      ra = (ta == 0) ? M : K;
+      rb = (tb == 0) ? K : N;
+      if (layouts[l] == CblasColMajor)
+      {
+         lda = ra + 1; ldb = rb + 1; ldc = M + 2;
+         sa = lda * ((ta == 0) ? K : M) + 3;
+         sb = ldb * ((tb == 0) ? N : K) + 1;
+         sc = ldc * N + 2;
+      }
+      else
+      {
+         lda = ((ta == 0) ? K : M) + 1; ldb = ((tb == 0) ? N : K) + 1;
+         ldc = N + 2;
+         sa = lda * ra + 3;
+         sb = ldb * rb + 1;
+         sc = ldc * M + 2;
+      }
+      /* share A among the problems in one case */
+      if (d == 4) sa = 0;
+      na = W * (size_t)(sa * NB + lda * (M + K + 1));
+      nb = W * (size_t)(sb * NB + ldb * (N + K + 1));
+      nc = W * (size_t)(sc * NB + 1);
+      a = malloc(na * sizeof(double));
+      b = malloc(nb * sizeof(double));
+      c1 = malloc(nc * sizeof(double));
+      c2 = malloc(nc * sizeof(double));
+      fill(a, na); fill(b, nb); fill(c1, nc);
+      memcpy(c2, c1, nc * sizeof(double));
+
+      cblas_zgemm_batch_strided(layouts[l], trans[ta], trans[tb], M, N, K,
+         alpha, a, lda, sa, b, ldb, sb, beta, c1, ldc, sc, NB);
+      for (i = 0; i < NB; i++)
+         cblas_zgemm(layouts[l], trans[ta], trans[tb], M, N, K, alpha,
+            a + W*i*sa, lda, b + W*i*sb, ldb, beta, c2 + W*i*sc, ldc);
+      compare(rout, c1, c2, nc, K, "C");
+      free(a); free(b); free(c1); free(c2);
+   }
+
+   /* Illegal arguments */
+   a = calloc(W * 64, sizeof(double));
+   c1 = calloc(W * 64, sizeof(double));
+   c2 = calloc(W * 64, sizeof(double));
+   cblas_zgemm_batch_strided(0, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 1);
+   cblas_zgemm_batch_strided(CblasColMajor, 0, CblasNoTrans, 2, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 2);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, 0, 2, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 3);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, -1, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 4);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, -1, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 5);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, -1, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 6);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 1, 4, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 9);
+   cblas_zgemm_batch_strided(CblasRowMajor, CblasNoTrans, CblasNoTrans, 2, 2, 3, alpha, a, 2, 6, a, 2, 6, beta, c1, 2, 4, 2);
+   chkxer(rout, 9);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 2, -1, a, 2, 4, beta, c1, 2, 4, 2);
+   chkxer(rout, 10);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasTrans, 2, 3, 2, alpha, a, 2, 4, a, 2, 6, beta, c1, 2, 6, 2);
+   chkxer(rout, 12);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 2, 4, a, 2, -1, beta, c1, 2, 4, 2);
+   chkxer(rout, 13);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 1, 4, 2);
+   chkxer(rout, 16);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 3, 2);
+   chkxer(rout, 17);
+   cblas_zgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, 2, 2, 2, alpha, a, 2, 4, a, 2, 4, beta, c1, 2, 4, -1);
+   chkxer(rout, 18);
+   compare(rout, c1, c2, W * 64, 0, "C after an illegal call");
+   free(a); free(c1); free(c2);
+
+   printf(" %-32s %s\n", rout, (nerr == e0) ? "PASSED" : "FAILED");
+}
+
+static void test_gemm_batch(void)
+{
+   /* Three groups, the second one empty */
+   static const CBLAS_INT M[3] = {3, 4, 9}, N[3] = {5, 2, 8}, K[3] = {2, 6, 7},
+      size[3] = {2, 0, 3};
+   const CBLAS_TRANSPOSE ta[3] = {CblasNoTrans, CblasConjTrans, CblasTrans},
+      tb[3] = {CblasTrans, CblasNoTrans, CblasNoTrans};
+   const char *rout = "cblas_zgemm_batch";
+   static const double alphas[6] = {1.0, 0.5, -2.0, 0.0, 0.5, -0.25},
+      betas[6] = {0.0, 0.0, 1.0, 1.0, -1.5, 0.5};
+   CBLAS_INT lda[3], ldb[3], ldc[3], ncol[3], l, g, i, p;
+   const void *ap[NB], *bp[NB];
+   void *cp[NB];
+   double *a, *b, *c1, *c2;
+   size_t n = W * 256;
+   int e0 = nerr;
+
+   a = malloc(NB * n * sizeof(double));
+   b = malloc(NB * n * sizeof(double));
+   c1 = malloc(NB * n * sizeof(double));
+   c2 = malloc(NB * n * sizeof(double));
+   for (l = 0; l < 2; l++)
+   {
+      for (g = 0; g < 3; g++)
+      {
+         if (layouts[l] == CblasColMajor)
+         {
+            lda[g] = ((ta[g] == CblasNoTrans) ? M[g] : K[g]) + 1;
+            ldb[g] = ((tb[g] == CblasNoTrans) ? K[g] : N[g]) + 2;
+            ldc[g] = M[g] + 1;
+            ncol[g] = N[g];
+         }
+         else
+         {
+            lda[g] = ((ta[g] == CblasNoTrans) ? K[g] : M[g]) + 1;
+            ldb[g] = ((tb[g] == CblasNoTrans) ? N[g] : K[g]) + 2;
+            ldc[g] = N[g] + 1;
+            ncol[g] = M[g];
+         }
+      }
+      fill(a, NB * n); fill(b, NB * n); fill(c1, NB * n);
+      /* betas of zero: C must not be read */
+      for (i = 0; i < (CBLAS_INT)n; i++) c1[i] = 0.0 / 0.0;
+      memcpy(c2, c1, NB * n * sizeof(double));
+      for (i = 0; i < NB; i++)
+      {
+         ap[i] = a + i * n;
+         bp[i] = b + i * n;
+         cp[i] = c1 + i * n;
+      }
+      cblas_zgemm_batch(layouts[l], ta, tb, M, N, K, alphas, ap, lda, bp,
+                        ldb, betas, cp, ldc, 3, size);
+      for (g = 0, p = 0; g < 3; g++)
+         for (i = 0; i < size[g]; i++, p++)
+            cblas_zgemm(layouts[l], ta[g], tb[g], M[g], N[g], K[g],
+                        alphas + 2*g, a + p * n, lda[g], b + p * n, ldb[g],
+                        betas + 2*g, c2 + p * n, ldc[g]);
+      for (g = 0, p = 0; g < 3; g++)
+         for (i = 0; i < size[g]; i++, p++)
+            compare(rout, c1 + p * n, c2 + p * n, W * ldc[g] * ncol[g], K[g],
+                    "C");
+      compare(rout, c1 + p * n, c2 + p * n, (NB - p) * n, 0, "C");
+   }
+
+   /* Illegal arguments */
+   {
+      CBLAS_INT one = 1, two = 2, mone = -1, gsize = 1;
+      CBLAS_TRANSPOSE nt = CblasNoTrans;
+
+      cblas_zgemm_batch(CblasColMajor, &nt, &nt, &two, &two, &two, alphas,
+                        ap, &two, bp, &two, betas, cp, &two, -1, &gsize);
+      chkxer(rout, 15);
+      cblas_zgemm_batch(CblasColMajor, &nt, &nt, &two, &two, &two, alphas,
+                        ap, &two, bp, &two, betas, cp, &two, 1, &mone);
+      chkxer(rout, 16);
+      cblas_zgemm_batch(CblasColMajor, &nt, &nt, &mone, &two, &two, alphas,
+                        ap, &two, bp, &two, betas, cp, &two, 1, &gsize);
+      chkxer(rout, 4);
+      cblas_zgemm_batch(CblasColMajor, &nt, &nt, &two, &two, &two, alphas,
+                        ap, &one, bp, &two, betas, cp, &two, 1, &gsize);
+      chkxer(rout, 9);
+      cblas_zgemm_batch(CblasColMajor, &nt, &nt, &two, &two, &two, alphas,
+                        ap, &two, bp, &one, betas, cp, &two, 1, &gsize);
+      chkxer(rout, 11);
+      cblas_zgemm_batch(CblasColMajor, &nt, &nt, &two, &two, &two, alphas,
+                        ap, &two, bp, &two, betas, cp, &one, 1, &gsize);
+      chkxer(rout, 14);
+   }
+   free(a); free(b); free(c1); free(c2);
+
+   printf(" %-32s %s\n", rout, (nerr == e0) ? "PASSED" : "FAILED");
+}
+
+static void test_trsm_batch_strided(void)
+{
+   static const CBLAS_INT dims[][2] = {{0, 3}, {5, 0}, {6, 4}, {1, 7}};
+   const CBLAS_SIDE sides[2] = {CblasLeft, CblasRight};
+   const CBLAS_UPLO uplos[2] = {CblasUpper, CblasLower};
+   const CBLAS_DIAG diags[2] = {CblasNonUnit, CblasUnit};
+   const char *rout = "cblas_ztrsm_batch_strided";
+   CBLAS_INT l, s, u, t, dg, d, i, j, M, N, na, lda, ldb, sa, sb;
+   double *a, *b1, *b2;
+   size_t nta, ntb;
+   int e0 = nerr;
+
+   for (l = 0; l < 2; l++)
+   for (s = 0; s < 2; s++)
+   for (u = 0; u < 2; u++)
+   for (t = 0; t < 3; t++)
+   for (dg = 0; dg < 2; dg++)
+   for (d = 0; d < 4; d++)
+   {
+      M = dims[d][0]; N = dims[d][1];
+      na = (s == 0) ? M : N;
+      lda = na + 1;
+      ldb = ((layouts[l] == CblasColMajor) ? M : N) + 2;
+      sa = lda * na + 1;
+      sb = ldb * ((layouts[l] == CblasColMajor) ? N : M) + 3;
+      nta = W * (size_t)(sa * NB + 1);
+      ntb = W * (size_t)(sb * NB + 1);
+      a = malloc(nta * sizeof(double));
+      b1 = malloc(ntb * sizeof(double));
+      b2 = malloc(ntb * sizeof(double));
+      fill(a, nta); fill(b1, ntb);
+      /* well conditioned triangles */
+      for (i = 0; i < NB; i++)
+         for (j = 0; j < na; j++)
+            a[W * (i * sa + j * (lda + 1))] += 4.0;
+      memcpy(b2, b1, ntb * sizeof(double));
+
+      cblas_ztrsm_batch_strided(layouts[l], sides[s], uplos[u], trans[t],
+         diags[dg], M, N, alpha, a, lda, sa, b1, ldb, sb, NB);
+      for (i = 0; i < NB; i++)
+         cblas_ztrsm(layouts[l], sides[s], uplos[u], trans[t], diags[dg],
+            M, N, alpha, a + W*i*sa, lda, b2 + W*i*sb, ldb);
+      compare(rout, b1, b2, ntb, na, "B");
+      free(a); free(b1); free(b2);
+   }
+
+   /* Illegal arguments */
+   a = calloc(W * 64, sizeof(double));
+   b1 = calloc(W * 64, sizeof(double));
+   b2 = calloc(W * 64, sizeof(double));
+   cblas_ztrsm_batch_strided(0, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 2, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 1);
+   cblas_ztrsm_batch_strided(CblasColMajor, 0, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 2, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 2);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, 0, CblasNoTrans, CblasNonUnit, 2, 2, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 3);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, 0, CblasNonUnit, 2, 2, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 4);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, 0, 2, 2, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 5);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, -1, 2, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 6);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 2, -1, alpha, a, 2, 4, b1, 2, 4, 2);
+   chkxer(rout, 7);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasRight, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 3, alpha, a, 2, 9, b1, 2, 6, 2);
+   chkxer(rout, 10);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 2, alpha, a, 2, -1, b1, 2, 4, 2);
+   chkxer(rout, 11);
+   cblas_ztrsm_batch_strided(CblasRowMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 3, alpha, a, 2, 4, b1, 2, 9, 2);
+   chkxer(rout, 13);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 2, alpha, a, 2, 4, b1, 2, 3, 2);
+   chkxer(rout, 14);
+   cblas_ztrsm_batch_strided(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, 2, 2, alpha, a, 2, 4, b1, 2, 4, -1);
+   chkxer(rout, 15);
+   compare(rout, b1, b2, W * 64, 0, "B after an illegal call");
+   free(a); free(b1); free(b2);
+
+   printf(" %-32s %s\n", rout, (nerr == e0) ? "PASSED" : "FAILED");
+}
+
+static void test_gemv_batch_strided(void)
+{
+   static const CBLAS_INT dims[][2] = {{0, 4}, {4, 0}, {5, 7}, {9, 3}};
+   static const CBLAS_INT incs[][2] = {{1, 1}, {-2, 1}, {1, -3}, {3, 2}};
+   const char *rout = "cblas_zgemv_batch_strided";
+   CBLAS_INT l, t, d, k, i, M, N, lda, lenx, leny, incx, incy, sa, sx, sy;
+   double *a, *x, *y1, *y2;
+   size_t na, nx, ny;
+   int e0 = nerr;
+
+   for (l = 0; l < 2; l++)
+   for (t = 0; t < 3; t++)
+   for (d = 0; d < 4; d++)
+   for (k = 0; k < 4; k++)
+   {
+      M = dims[d][0]; N = dims[d][1];
+      incx = incs[k][0]; incy = incs[k][1];
+      lenx = (t == 0) ? N : M;
+      leny = (t == 0) ? M : N;
+      lda = ((layouts[l] == CblasColMajor) ? M : N) + 1;
+      sa = lda * ((layouts[l] == CblasColMajor) ? N : M) + 2;
+      sx = (k == 3) ? 0 : lenx * (incx > 0 ? incx : -incx) + 1;
+      sy = leny * (incy > 0 ? incy : -incy) + 1;
+      na = W * (size_t)(sa * NB + 1);
+      nx = W * (size_t)(sx * NB + lenx * 3 + 1);
+      ny = W * (size_t)(sy * NB + 1);
+      a = malloc(na * sizeof(double));
+      x = malloc(nx * sizeof(double));
+      y1 = malloc(ny * sizeof(double));
+      y2 = malloc(ny * sizeof(double));
+      fill(a, na); fill(x, nx); fill(y1, ny);
+      memcpy(y2, y1, ny * sizeof(double));
+
+      cblas_zgemv_batch_strided(layouts[l], trans[t], M, N, alpha, a, lda,
+         sa, x, incx, sx, beta, y1, incy, sy, NB);
+      for (i = 0; i < NB; i++)
+         cblas_zgemv(layouts[l], trans[t], M, N, alpha, a + W*i*sa, lda,
+            x + W*i*sx, incx, beta, y2 + W*i*sy, incy);
+      compare(rout, y1, y2, ny, lenx, "y");
+      free(a); free(x); free(y1); free(y2);
+   }
+
+   /* Illegal arguments */
+   a = calloc(W * 64, sizeof(double));
+   y1 = calloc(W * 64, sizeof(double));
+   y2 = calloc(W * 64, sizeof(double));
+   cblas_zgemv_batch_strided(0, CblasNoTrans, 2, 2, alpha, a, 2, 4, a, 1, 2, beta, y1, 1, 2, 2);
+   chkxer(rout, 1);
+   cblas_zgemv_batch_strided(CblasColMajor, 0, 2, 2, alpha, a, 2, 4, a, 1, 2, beta, y1, 1, 2, 2);
+   chkxer(rout, 2);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, -1, 2, alpha, a, 2, 4, a, 1, 2, beta, y1, 1, 2, 2);
+   chkxer(rout, 3);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, -1, alpha, a, 2, 4, a, 1, 2, beta, y1, 1, 2, 2);
+   chkxer(rout, 4);
+   cblas_zgemv_batch_strided(CblasRowMajor, CblasNoTrans, 2, 3, alpha, a, 2, 6, a, 1, 3, beta, y1, 1, 2, 2);
+   chkxer(rout, 7);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, 2, alpha, a, 2, -1, a, 1, 2, beta, y1, 1, 2, 2);
+   chkxer(rout, 8);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, 2, alpha, a, 2, 4, a, 0, 2, beta, y1, 1, 2, 2);
+   chkxer(rout, 10);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, 2, alpha, a, 2, 4, a, 1, -1, beta, y1, 1, 2, 2);
+   chkxer(rout, 11);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, 2, alpha, a, 2, 4, a, 1, 2, beta, y1, 0, 2, 2);
+   chkxer(rout, 14);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, 2, alpha, a, 2, 4, a, 1, 2, beta, y1, 2, 2, 2);
+   chkxer(rout, 15);
+   cblas_zgemv_batch_strided(CblasColMajor, CblasNoTrans, 2, 2, alpha, a, 2, 4, a, 1, 2, beta, y1, 1, 2, -1);
+   chkxer(rout, 16);
+   compare(rout, y1, y2, W * 64, 0, "y after an illegal call");
+   free(a); free(y1); free(y2);
+
+   printf(" %-32s %s\n", rout, (nerr == e0) ? "PASSED" : "FAILED");
+}
+
+int main(void)
+{
+   printf(" Tests of the batched Z routines of CBLAS\n\n");
+   test_gemm_batch_strided();
+   test_gemm_batch();
+   test_trsm_batch_strided();
+   test_gemv_batch_strided();
+   if (nerr)
+      printf("\n ***** %d ERRORS DETECTED *****\n", nerr);
+   else
+      printf("\n END OF TESTS\n");
+   return nerr != 0;
+}
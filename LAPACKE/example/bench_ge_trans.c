@@ -0,0 +1,175 @@
+/*
+   LAPACKE_?ge_trans Benchmark
+   ===========================
+
+   The program measures the bandwidth of the layout conversion done by
+   LAPACKE_sge_trans, LAPACKE_dge_trans, LAPACKE_cge_trans and
+   LAPACKE_zge_trans, which every row-major call of a LAPACKE _work
+   routine goes through, and compares it with the straightforward
+   double loop that these routines used before they were blocked.
+
+   The bandwidth counts one read and one write of each element of the
+   matrix.  Square, tall and skinny, and short and wide shapes are
+   timed, from the row-major and the column-major side.
+
+   Usage
+   =====
+
+   xbench_ge_trans [precisions] [seconds]
+
+   precisions is a string of the letters s, d, c and z (default: sd),
+   and seconds the minimal time spent on each measurement (default:
+   0.2).
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lapacke_utils.h"
+
+/* The double loop of the unblocked LAPACKE_?ge_trans, and a wrapper of
+ * the blocked one with the same prototype */
+#define GE_TRANS( ref, blk, type, lapacke_ge_trans )                         \
+static void ref( int matrix_layout, lapack_int m, lapack_int n,             \
+                 const void* vin, lapack_int ldin,                          \
+                 void* vout, lapack_int ldout )                             \
+{                                                                            \
+    const type* in = (const type*)vin;                                       \
+    type* out = (type*)vout;                                                 \
+    lapack_int i, j, x, y;                                                   \
+    if( matrix_layout == LAPACK_COL_MAJOR ) {                                \
+        x = n;                                                               \
+        y = m;                                                               \
+    } else {                                                                 \
+        x = m;                                                               \
+        y = n;                                                               \
+    }                                                                        \
+    for( i = 0; i < MIN( y, ldin ); i++ ) {                                  \
+        for( j = 0; j < MIN( x, ldout ); j++ ) {                             \
+            out[ (size_t)i*ldout + j ] = in[ (size_t)j*ldin + i ];           \
+        }                                                                    \
+    }                                                                        \
+}                                                                            \
+static void blk( int matrix_layout, lapack_int m, lapack_int n,             \
+                 const void* in, lapack_int ldin,                           \
+                 void* out, lapack_int ldout )                              \
+{                                                                            \
+    lapacke_ge_trans( matrix_layout, m, n, (const type*)in, ldin,            \
+                      (type*)out, ldout );                                   \
+}
+
+GE_TRANS( ref_sge_trans, blk_sge_trans, float, LAPACKE_sge_trans )
+GE_TRANS( ref_dge_trans, blk_dge_trans, double, LAPACKE_dge_trans )
+GE_TRANS( ref_cge_trans, blk_cge_trans, lapack_complex_float,
+          LAPACKE_cge_trans )
+GE_TRANS( ref_zge_trans, blk_zge_trans, lapack_complex_double,
+          LAPACKE_zge_trans )
+
+typedef void (*trans_fn)( int, lapack_int, lapack_int, const void*,
+                          lapack_int, void*, lapack_int );
+
+static const lapack_int shapes[][2] = {
+    { 500, 500 }, { 2000, 2000 }, { 4096, 4096 },
+    { 100000, 8 }, { 20000, 64 }, { 8, 100000 }, { 64, 20000 }
+};
+
+/* Seconds per call of f, repeated for at least tmin seconds */
+static double time_trans( trans_fn f, int layout, lapack_int m, lapack_int n,
+                          const void* in, lapack_int ldin, void* out,
+                          lapack_int ldout, double tmin )
+{
+    long reps = 0;
+    clock_t t0 = clock(), t;
+
+    do {
+        f( layout, m, n, in, ldin, out, ldout );
+        reps++;
+        t = clock();
+    } while( (double)( t - t0 ) < tmin * CLOCKS_PER_SEC );
+    return (double)( t - t0 ) / CLOCKS_PER_SEC / reps;
+}
+
+/* Main program */
+int main(int argc, char **argv) {
+
+    const char* precs = ( argc > 1 ) ? argv[1] : "sd";
+    double tmin = ( argc > 2 ) ? atof( argv[2] ) : 0.2;
+    const char* p;
+    size_t s, k, nel, esize = 0;
+    int l, layout, fails = 0;
+    lapack_int m, n, ldin, ldout;
+    trans_fn ref = NULL, blk = NULL;
+    unsigned char *in, *out1, *out2;
+    double tref, tblk, gb;
+
+    printf( "prec layout        m        n   loop GB/s  blocked GB/s  speedup\n" );
+    for( p = precs; *p != '\0'; p++ ) {
+        switch( *p ) {
+        case 's':
+            esize = sizeof(float);
+            ref = ref_sge_trans;
+            blk = blk_sge_trans;
+            break;
+        case 'd':
+            esize = sizeof(double);
+            ref = ref_dge_trans;
+            blk = blk_dge_trans;
+            break;
+        case 'c':
+            esize = sizeof(lapack_complex_float);
+            ref = ref_cge_trans;
+            blk = blk_cge_trans;
+            break;
+        case 'z':
+            esize = sizeof(lapack_complex_double);
+            ref = ref_zge_trans;
+            blk = blk_zge_trans;
+            break;
+        default:
+            continue;
+        }
+        for( k = 0; k < sizeof(shapes)/sizeof(shapes[0]); k++ ) {
+            m = shapes[k][0];
+            n = shapes[k][1];
+            nel = (size_t)m*n;
+            in = (unsigned char*)malloc( nel*esize );
+            out1 = (unsigned char*)malloc( nel*esize );
+            out2 = (unsigned char*)malloc( nel*esize );
+            if( in == NULL || out1 == NULL || out2 == NULL ) {
+                printf( "Not enough memory for %d x %d\n", (int)m, (int)n );
+                free( in ); free( out1 ); free( out2 );
+                continue;
+            }
+            for( s = 0; s < nel*esize; s++ ) {
+                in[s] = (unsigned char)rand();
+            }
+            for( l = 0; l < 2; l++ ) {
+                layout = l ? LAPACK_COL_MAJOR : LAPACK_ROW_MAJOR;
+                ldin = ( layout == LAPACK_ROW_MAJOR ) ? n : m;
+                ldout = ( layout == LAPACK_ROW_MAJOR ) ? m : n;
+                tref = time_trans( ref, layout, m, n, in, ldin, out1, ldout,
+                                   tmin );
+                tblk = time_trans( blk, layout, m, n, in, ldin, out2, ldout,
+                                   tmin );
+                if( memcmp( out1, out2, nel*esize ) != 0 ) {
+                    fails++;
+                }
+                gb = 2.0 * nel * esize * 1.0e-9;
+                printf( "   %c %-6s %8d %8d %11.2f %13.2f %8.2f\n", *p,
+                        layout == LAPACK_ROW_MAJOR ? "row" : "col",
+                        (int)m, (int)n, gb / tref, gb / tblk, tref / tblk );
+            }
+            free( in );
+            free( out1 );
+            free( out2 );
+        }
+    }
+    if( fails > 0 ) {
+        printf( "%d conversions differ from the loop\n", fails );
+    }
+    exit( fails > 0 );
+} /* End of LAPACKE_?ge_trans Benchmark */
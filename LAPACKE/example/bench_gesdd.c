@@ -0,0 +1,168 @@
+/*
+   LAPACKE_dgesdd Benchmark
+   ========================
+
+   The program times the singular value decomposition
+
+      A = U * SIGMA * VT
+
+   of random n by n matrices by DGESDD with JOBZ = 'S', on 1, 2, 4, ...
+   OpenMP threads up to the maximal number of threads.  With more than
+   one thread, the divide and conquer of the bidiagonal SVD solves its
+   subproblems in parallel (DLASD0_TASK), and the secular equations and
+   singular vector updates of each merge are shared out among the
+   threads (DLASD3_TASK).
+
+   The speedup is relative to the time on one thread, and the last
+   column is the largest difference between the singular values
+   computed on one thread and on nthr threads, relative to the largest
+   singular value.
+
+   The library has to be built with BUILD_OPENMP for the times to
+   depend on the number of threads.
+
+   Usage
+   =====
+
+   xbench_gesdd [seconds] [n ...]
+
+   seconds is the minimal time spent on each measurement (default: 0,
+   that is a single call), and n the orders of the matrices (default:
+   2000 4000 6000 8000 10000).
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lapacke.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static const lapack_int sizes[] = { 2000, 4000, 6000, 8000, 10000 };
+
+/* Wall clock time in seconds */
+static double wtime( void )
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static void set_threads( int nthr )
+{
+#ifdef _OPENMP
+    omp_set_num_threads( nthr );
+#else
+    (void)nthr;
+#endif
+}
+
+/* Fastest of the calls of DGESDD made in at least tmin seconds.  The
+ * singular values of the last call are returned in s, and *info is
+ * the first nonzero INFO returned, if any. */
+static double time_gesdd( lapack_int n, const double* a, double* w,
+                          double* s, double* u, double* vt, double tmin,
+                          lapack_int* info )
+{
+    double t, t0, tbest = -1.0, ttot = 0.0;
+    lapack_int iinfo;
+
+    *info = 0;
+    do {
+        memcpy( w, a, (size_t)n*n*sizeof(double) );
+        t0 = wtime();
+        iinfo = LAPACKE_dgesdd( LAPACK_COL_MAJOR, 'S', n, n, w, n, s, u, n,
+                                vt, n );
+        t = wtime() - t0;
+        if( iinfo != 0 && *info == 0 ) {
+            *info = iinfo;
+        }
+        ttot += t;
+        if( tbest < 0.0 || t < tbest ) {
+            tbest = t;
+        }
+    } while( ttot < tmin );
+    return tbest;
+}
+
+/* Main program */
+int main(int argc, char **argv) {
+
+    double tmin = ( argc > 1 ) ? atof( argv[1] ) : 0.0;
+    int nsizes = ( argc > 2 ) ? argc - 2
+                              : (int)( sizeof(sizes)/sizeof(sizes[0]) );
+    int k, p, nthr = 1;
+    size_t i, nel;
+    lapack_int j, n, info;
+    double *a, *w, *s1, *s2, *u, *vt;
+    double t1, tp, dmax;
+
+#ifdef _OPENMP
+    nthr = omp_get_max_threads();
+#endif
+    printf( "threads: %d\n", nthr );
+    printf( "       n  threads    DGESDD s  speedup  rel. diff\n" );
+    for( k = 0; k < nsizes; k++ ) {
+        n = ( argc > 2 ) ? (lapack_int)atoi( argv[k+2] ) : sizes[k];
+        if( n <= 0 ) {
+            continue;
+        }
+        nel = (size_t)n*n;
+        a = (double*)malloc( nel*sizeof(double) );
+        w = (double*)malloc( nel*sizeof(double) );
+        u = (double*)malloc( nel*sizeof(double) );
+        vt = (double*)malloc( nel*sizeof(double) );
+        s1 = (double*)malloc( (size_t)n*sizeof(double) );
+        s2 = (double*)malloc( (size_t)n*sizeof(double) );
+        if( a == NULL || w == NULL || u == NULL || vt == NULL ||
+            s1 == NULL || s2 == NULL ) {
+            printf( "Not enough memory for n = %d\n", (int)n );
+            free( a ); free( w ); free( u ); free( vt );
+            free( s1 ); free( s2 );
+            continue;
+        }
+        for( i = 0; i < nel; i++ ) {
+            a[i] = 2.0 * rand() / RAND_MAX - 1.0;
+        }
+        set_threads( 1 );
+        t1 = time_gesdd( n, a, w, s1, u, vt, tmin, &info );
+        if( info != 0 ) {
+            printf( "%8d %8d  DGESDD returned INFO = %d\n", (int)n, 1,
+                    (int)info );
+        }
+        printf( "%8d %8d %11.4f %8.2f %10.2e\n", (int)n, 1, t1, 1.0, 0.0 );
+        for( p = 2; p < 2*nthr; p *= 2 ) {
+            if( p > nthr ) {
+                p = nthr;
+            }
+            set_threads( p );
+            tp = time_gesdd( n, a, w, s2, u, vt, tmin, &info );
+            if( info != 0 ) {
+                printf( "%8d %8d  DGESDD returned INFO = %d\n", (int)n, p,
+                        (int)info );
+            }
+            dmax = 0.0;
+            for( j = 0; j < n; j++ ) {
+                if( s1[j] - s2[j] > dmax ) dmax = s1[j] - s2[j];
+                if( s2[j] - s1[j] > dmax ) dmax = s2[j] - s1[j];
+            }
+            printf( "%8d %8d %11.4f %8.2f %10.2e\n", (int)n, p, tp,
+                    t1 / tp, s1[0] > 0.0 ? dmax / s1[0] : dmax );
+        }
+        set_threads( nthr );
+        free( a );
+        free( w );
+        free( u );
+        free( vt );
+        free( s1 );
+        free( s2 );
+    }
+    exit( 0 );
+} /* End of LAPACKE_dgesdd Benchmark */
@@ -0,0 +1,177 @@
+/*
+   LAPACKE_dtrsyl3 Benchmark
+   =========================
+
+   The program times the solution of the triangular Sylvester equation
+
+      op(A)*X + X*op(B) = scale*C
+
+   by the unblocked DTRSYL, by the blocked DTRSYL3 run on one thread,
+   and by DTRSYL3 run on all the OpenMP threads, which solves the
+   blocks of X by anti-diagonals in parallel (DTRSYL3_TASK).  A and B
+   are random upper triangular matrices of order n, and both op(A) =
+   op(B) = 'N' and op(A) = op(B) = 'T' are timed.
+
+   The last column is the largest difference between the solutions of
+   the serial and the parallel DTRSYL3, relative to the largest entry
+   of the serial one.
+
+   The library has to be built with BUILD_OPENMP for the parallel
+   column to differ from the serial one.
+
+   Usage
+   =====
+
+   xbench_trsyl3 [seconds] [n ...]
+
+   seconds is the minimal time spent on each measurement (default:
+   0.5), and n the orders of the matrices (default: 200 500 1000 2000).
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lapacke.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static const lapack_int sizes[] = { 200, 500, 1000, 2000 };
+
+/* Wall clock time in seconds */
+static double wtime( void )
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static void set_threads( int nthr )
+{
+#ifdef _OPENMP
+    omp_set_num_threads( nthr );
+#else
+    (void)nthr;
+#endif
+}
+
+/* Fastest of the calls of DTRSYL (blocked = 0) or DTRSYL3 (blocked = 1)
+ * made in at least tmin seconds.  X is overwritten by the solution of
+ * the last call. */
+static double time_trsyl( int blocked, char tran, lapack_int n,
+                          const double* a, const double* b, const double* c,
+                          double* x, double tmin )
+{
+    double t, t0, tbest = -1.0, ttot = 0.0, scale;
+
+    do {
+        memcpy( x, c, (size_t)n*n*sizeof(double) );
+        t0 = wtime();
+        if( blocked ) {
+            LAPACKE_dtrsyl3( LAPACK_COL_MAJOR, tran, tran, 1, n, n, a, n,
+                             b, n, x, n, &scale );
+        } else {
+            LAPACKE_dtrsyl( LAPACK_COL_MAJOR, tran, tran, 1, n, n, a, n,
+                            b, n, x, n, &scale );
+        }
+        t = wtime() - t0;
+        ttot += t;
+        if( tbest < 0.0 || t < tbest ) {
+            tbest = t;
+        }
+    } while( ttot < tmin );
+    return tbest;
+}
+
+/* Random upper triangular matrix of order n with a diagonal in [1,2],
+ * so that A*X + X*B = C is well conditioned */
+static void random_triu( lapack_int n, double* a )
+{
+    lapack_int i, j;
+
+    for( j = 0; j < n; j++ ) {
+        for( i = 0; i < n; i++ ) {
+            if( i < j ) {
+                a[(size_t)j*n + i] = 2.0 * rand() / RAND_MAX - 1.0;
+            } else if( i == j ) {
+                a[(size_t)j*n + i] = 1.0 + (double)rand() / RAND_MAX;
+            } else {
+                a[(size_t)j*n + i] = 0.0;
+            }
+        }
+    }
+}
+
+/* Main program */
+int main(int argc, char **argv) {
+
+    double tmin = ( argc > 1 ) ? atof( argv[1] ) : 0.5;
+    int nsizes = ( argc > 2 ) ? argc - 2
+                              : (int)( sizeof(sizes)/sizeof(sizes[0]) );
+    int k, t, nthr = 1;
+    size_t i, nel;
+    lapack_int n;
+    char tran;
+    double *a, *b, *c, *x1, *x2;
+    double tsyl, tser, tpar, xmax, dmax;
+
+#ifdef _OPENMP
+    nthr = omp_get_max_threads();
+#endif
+    printf( "threads: %d\n", nthr );
+    printf( "tran        n    DTRSYL s  DTRSYL3 1 thr s  DTRSYL3 %3d thr s"
+            "  speedup  rel. diff\n", nthr );
+    for( k = 0; k < nsizes; k++ ) {
+        n = ( argc > 2 ) ? (lapack_int)atoi( argv[k+2] ) : sizes[k];
+        if( n <= 0 ) {
+            continue;
+        }
+        nel = (size_t)n*n;
+        a = (double*)malloc( nel*sizeof(double) );
+        b = (double*)malloc( nel*sizeof(double) );
+        c = (double*)malloc( nel*sizeof(double) );
+        x1 = (double*)malloc( nel*sizeof(double) );
+        x2 = (double*)malloc( nel*sizeof(double) );
+        if( a == NULL || b == NULL || c == NULL || x1 == NULL || x2 == NULL ) {
+            printf( "Not enough memory for n = %d\n", (int)n );
+            free( a ); free( b ); free( c ); free( x1 ); free( x2 );
+            continue;
+        }
+        random_triu( n, a );
+        random_triu( n, b );
+        for( i = 0; i < nel; i++ ) {
+            c[i] = 2.0 * rand() / RAND_MAX - 1.0;
+        }
+        for( t = 0; t < 2; t++ ) {
+            tran = t ? 'T' : 'N';
+            tsyl = time_trsyl( 0, tran, n, a, b, c, x1, tmin );
+            set_threads( 1 );
+            tser = time_trsyl( 1, tran, n, a, b, c, x1, tmin );
+            set_threads( nthr );
+            tpar = time_trsyl( 1, tran, n, a, b, c, x2, tmin );
+            xmax = 0.0;
+            dmax = 0.0;
+            for( i = 0; i < nel; i++ ) {
+                if( x1[i] > xmax ) xmax = x1[i];
+                if( -x1[i] > xmax ) xmax = -x1[i];
+                if( x1[i] - x2[i] > dmax ) dmax = x1[i] - x2[i];
+                if( x2[i] - x1[i] > dmax ) dmax = x2[i] - x1[i];
+            }
+            printf( "   %c %8d %11.4f %16.4f %18.4f %8.2f %10.2e\n", tran,
+                    (int)n, tsyl, tser, tpar, tser / tpar,
+                    xmax > 0.0 ? dmax / xmax : dmax );
+        }
+        free( a );
+        free( b );
+        free( c );
+        free( x1 );
+        free( x2 );
+    }
+    exit( 0 );
+} /* End of LAPACKE_dtrsyl3 Benchmark */
@@ -0,0 +1,818 @@
+/*
+   LAPACKE Example : Batched factorizations and solves
+   ===================================================
+
+   The program factors batches of random matrices with
+   LAPACKE_?getrf_batch_strided, LAPACKE_?potrf_batch_strided and
+   LAPACKE_?geqrf_batch_strided, and solves with the factors by
+   LAPACKE_?getrs_batch_strided and LAPACKE_?potrs_batch_strided, in all
+   precisions and both layouts.
+
+   Description
+   ===========
+
+   The orders cover the interleaved code for small real matrices and the
+   one-matrix-at-a-time code, and the batch sizes are not multiples of the
+   number of matrices factored at once.  Each solution is checked by its
+   scaled residual |op(A)*X - B| / ( n*eps*|A|*|X| ), the QR factors are
+   compared with those of LAPACKE_?geqrf, and singular or indefinite
+   matrices must give the INFO and factors of LAPACKE_?getrf and
+   LAPACKE_?potrf.  Invalid arguments must give the right negative return
+   value.  The program returns a nonzero exit status on failure.
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+/* Batched factorizations and solves */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <complex.h>
+#include <lapacke.h>
+
+#define THRESH 30.0
+
+/* Element (i,j) of a matrix with leading dimension ld */
+#define IDX( layout, i, j, ld ) ( (layout) == LAPACK_COL_MAJOR ? \
+                                  (size_t)(i) + (size_t)(j)*(ld) : \
+                                  (size_t)(i)*(ld) + (size_t)(j) )
+
+static double rnd( void )
+{
+    return (double)rand() / RAND_MAX - 0.5;
+}
+
+static int check( const char* what, int layout, lapack_int n, double r )
+{
+    if( r >= 0.0 && r < THRESH ) return 0;
+    printf( "%s failed: %s, n = %d, ratio = %g\n", what,
+            layout == LAPACK_COL_MAJOR ? "column-major" : "row-major",
+            (int)n, r );
+    return 1;
+}
+
+/* Single: residual |op(A)*X - B| / ( n*eps*|A|*|X| ) of the solutions */
+static double s_resid( int layout, char trans, lapack_int n,
+                         lapack_int nrhs, const float* a, lapack_int lda,
+                         const float* x, const float* b, lapack_int ldb )
+{
+    lapack_int i, j, k;
+    double anrm = 0.0, xnrm = 0.0, rmax = 0.0;
+    float s, aik;
+
+    for( i = 0; i < n*n; i++ ) {
+        anrm = fmax( anrm, fabsf( a[IDX( layout, i % n, i / n, lda )] ) );
+    }
+    for( j = 0; j < nrhs; j++ ) {
+        for( i = 0; i < n; i++ ) {
+            xnrm = fmax( xnrm, fabsf( x[IDX( layout, i, j, ldb )] ) );
+            s = b[IDX( layout, i, j, ldb )];
+            for( k = 0; k < n; k++ ) {
+                aik = ( trans == 'N' ) ? a[IDX( layout, i, k, lda )] :
+                                         a[IDX( layout, k, i, lda )];
+                if( trans == 'C' ) aik = ( aik );
+                s -= aik * x[IDX( layout, k, j, ldb )];
+            }
+            rmax = fmax( rmax, fabsf( s ) );
+        }
+    }
+    if( anrm == 0.0 || xnrm == 0.0 ) return rmax;
+    return rmax / ( n * FLT_EPSILON * anrm * xnrm );
+}
+
+/* Single: largest difference |x - y| / ( n*eps*|x| ) of two arrays */
+static double s_diff( lapack_int n, const float* x, const float* y,
+                        lapack_int len )
+{
+    lapack_int i;
+    double d = 0.0, xnrm = 0.0;
+
+    for( i = 0; i < len; i++ ) {
+        d = fmax( d, fabsf( x[i] - y[i] ) );
+        xnrm = fmax( xnrm, fabsf( x[i] ) );
+    }
+    if( xnrm == 0.0 ) return d;
+    return d / ( n * FLT_EPSILON * xnrm );
+}
+
+/* Single: tests a batch of count n-by-n systems with nrhs right-hand sides */
+static int test_s( int layout, lapack_int n, lapack_int nrhs,
+                     lapack_int count )
+{
+    const lapack_int lda = n, stride = n*n;
+    const lapack_int ldb = ( layout == LAPACK_COL_MAJOR ) ? n : nrhs;
+    const lapack_int strideb = n*nrhs;
+    const char transs[2] = { 'N', 'T' };
+    float *a0, *a, *b0, *b, *t, *tau, *tau1;
+    lapack_int *ipiv, *info, info1;
+    lapack_int i, j, k, l;
+    char uplo;
+    double r;
+    int fails = 0;
+
+    a0 = (float*)malloc( sizeof(float)*stride*count );
+    a = (float*)malloc( sizeof(float)*stride*count );
+    t = (float*)malloc( sizeof(float)*stride );
+    b0 = (float*)malloc( sizeof(float)*strideb*count );
+    b = (float*)malloc( sizeof(float)*strideb*count );
+    tau = (float*)malloc( sizeof(float)*n*count );
+    tau1 = (float*)malloc( sizeof(float)*n );
+    ipiv = (lapack_int*)malloc( sizeof(lapack_int)*n*count );
+    info = (lapack_int*)malloc( sizeof(lapack_int)*count );
+    for( i = 0; i < stride*count; i++ ) a0[i] = (float)rnd();
+    for( i = 0; i < strideb*count; i++ ) b0[i] = (float)rnd();
+
+    /* LU factorization and solves, with a singular matrix */
+    memcpy( a, a0, sizeof(float)*stride*count );
+    for( i = 0; i < n; i++ ) {
+        a[stride + IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    LAPACKE_sgetrf_batch_strided( layout, n, n, a, lda, stride, ipiv, n,
+                                   count, info );
+    memcpy( t, a0 + stride, sizeof(float)*stride );
+    for( i = 0; i < n; i++ ) {
+        t[IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    info1 = LAPACKE_sgetrf( layout, n, n, t, lda, ipiv + n );
+    if( info[1] != info1 || info1 == 0 ) {
+        printf( "sgetrf: INFO = %d, expected %d\n", (int)info[1],
+                (int)info1 );
+        fails++;
+    }
+    memcpy( a + stride, a0 + stride, sizeof(float)*stride );
+    LAPACKE_sgetrf( layout, n, n, a + stride, lda, ipiv + n );
+    for( k = 0; k < count; k++ ) {
+        if( k != 1 && info[k] != 0 ) fails++;
+    }
+    for( l = 0; l < 2; l++ ) {
+        memcpy( b, b0, sizeof(float)*strideb*count );
+        LAPACKE_sgetrs_batch_strided( layout, transs[l], n, nrhs, a, lda,
+                                       stride, ipiv, n, b, ldb, strideb,
+                                       count );
+        for( k = 0; k < count; k++ ) {
+            r = s_resid( layout, transs[l], n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "sgetrs", layout, n, r );
+        }
+    }
+    /* The same factorization for all right-hand sides */
+    memcpy( b, b0, sizeof(float)*strideb*count );
+    LAPACKE_sgetrs_batch_strided( layout, 'N', n, nrhs, a, lda, 0, ipiv, 0,
+                                   b, ldb, strideb, count );
+    for( k = 0; k < count; k++ ) {
+        r = s_resid( layout, 'N', n, nrhs, a0, lda, b + k*strideb,
+                       b0 + k*strideb, ldb );
+        fails += check( "sgetrs, stridea = 0", layout, n, r );
+    }
+
+    /* Cholesky factorization and solves, with an indefinite matrix */
+    for( k = 0; k < count; k++ ) {
+        for( j = 0; j < n; j++ ) {
+            for( i = 0; i < n; i++ ) {
+                float s = ( i == j ) ? n : 0.0;
+                for( l = 0; l < n; l++ ) {
+                    s += ( a0[k*stride + l + i*n] ) * a0[k*stride + l + j*n];
+                }
+                a[k*stride + IDX( layout, i, j, lda )] = s;
+            }
+        }
+    }
+    memcpy( a0, a, sizeof(float)*stride*count );
+    for( l = 0; l < 2; l++ ) {
+        uplo = l ? 'U' : 'L';
+        memcpy( a, a0, sizeof(float)*stride*count );
+        a[2*stride + IDX( layout, n-1, n-1, lda )] = -1.0;
+        LAPACKE_spotrf_batch_strided( layout, uplo, n, a, lda, stride,
+                                       count, info );
+        memcpy( t, a0 + 2*stride, sizeof(float)*stride );
+        t[IDX( layout, n-1, n-1, lda )] = -1.0;
+        info1 = LAPACKE_spotrf( layout, uplo, n, t, lda );
+        if( count > 2 && ( info[2] != info1 || info1 != n ||
+            !( s_diff( n, t, a + 2*stride, stride ) < THRESH ) ) ) {
+            printf( "spotrf: INFO = %d, expected %d\n", (int)info[2],
+                    (int)info1 );
+            fails++;
+        }
+        memcpy( a + 2*stride, a0 + 2*stride, sizeof(float)*stride );
+        LAPACKE_spotrf( layout, uplo, n, a + 2*stride, lda );
+        for( k = 0; k < count; k++ ) {
+            if( k != 2 && info[k] != 0 ) fails++;
+        }
+        memcpy( b, b0, sizeof(float)*strideb*count );
+        LAPACKE_spotrs_batch_strided( layout, uplo, n, nrhs, a, lda, stride,
+                                       b, ldb, strideb, count );
+        for( k = 0; k < count; k++ ) {
+            r = s_resid( layout, 'N', n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "spotrs", layout, n, r );
+        }
+    }
+
+    /* QR factorization, compared with LAPACKE_sgeqrf */
+    memcpy( a, a0, sizeof(float)*stride*count );
+    LAPACKE_sgeqrf_batch_strided( layout, n, n, a, lda, stride, tau, n,
+                                   count );
+    for( k = 0; k < count; k++ ) {
+        memcpy( t, a0 + k*stride, sizeof(float)*stride );
+        LAPACKE_sgeqrf( layout, n, n, t, lda, tau1 );
+        r = fmax( s_diff( n, t, a + k*stride, stride ),
+                  s_diff( n, tau1, tau + k*n, n ) );
+        fails += check( "sgeqrf", layout, n, r );
+    }
+
+    free( a0 );
+    free( a );
+    free( t );
+    free( b0 );
+    free( b );
+    free( tau );
+    free( tau1 );
+    free( ipiv );
+    free( info );
+    return fails;
+}
+
+/* Double: residual |op(A)*X - B| / ( n*eps*|A|*|X| ) of the solutions */
+static double d_resid( int layout, char trans, lapack_int n,
+                         lapack_int nrhs, const double* a, lapack_int lda,
+                         const double* x, const double* b, lapack_int ldb )
+{
+    lapack_int i, j, k;
+    double anrm = 0.0, xnrm = 0.0, rmax = 0.0;
+    double s, aik;
+
+    for( i = 0; i < n*n; i++ ) {
+        anrm = fmax( anrm, fabs( a[IDX( layout, i % n, i / n, lda )] ) );
+    }
+    for( j = 0; j < nrhs; j++ ) {
+        for( i = 0; i < n; i++ ) {
+            xnrm = fmax( xnrm, fabs( x[IDX( layout, i, j, ldb )] ) );
+            s = b[IDX( layout, i, j, ldb )];
+            for( k = 0; k < n; k++ ) {
+                aik = ( trans == 'N' ) ? a[IDX( layout, i, k, lda )] :
+                                         a[IDX( layout, k, i, lda )];
+                if( trans == 'C' ) aik = ( aik );
+                s -= aik * x[IDX( layout, k, j, ldb )];
+            }
+            rmax = fmax( rmax, fabs( s ) );
+        }
+    }
+    if( anrm == 0.0 || xnrm == 0.0 ) return rmax;
+    return rmax / ( n * DBL_EPSILON * anrm * xnrm );
+}
+
+/* Double: largest difference |x - y| / ( n*eps*|x| ) of two arrays */
+static double d_diff( lapack_int n, const double* x, const double* y,
+                        lapack_int len )
+{
+    lapack_int i;
+    double d = 0.0, xnrm = 0.0;
+
+    for( i = 0; i < len; i++ ) {
+        d = fmax( d, fabs( x[i] - y[i] ) );
+        xnrm = fmax( xnrm, fabs( x[i] ) );
+    }
+    if( xnrm == 0.0 ) return d;
+    return d / ( n * DBL_EPSILON * xnrm );
+}
+
+/* Double: tests a batch of count n-by-n systems with nrhs right-hand sides */
+static int test_d( int layout, lapack_int n, lapack_int nrhs,
+                     lapack_int count )
+{
+    const lapack_int lda = n, stride = n*n;
+    const lapack_int ldb = ( layout == LAPACK_COL_MAJOR ) ? n : nrhs;
+    const lapack_int strideb = n*nrhs;
+    const char transs[2] = { 'N', 'T' };
+    double *a0, *a, *b0, *b, *t, *tau, *tau1;
+    lapack_int *ipiv, *info, info1;
+    lapack_int i, j, k, l;
+    char uplo;
+    double r;
+    int fails = 0;
+
+    a0 = (double*)malloc( sizeof(double)*stride*count );
+    a = (double*)malloc( sizeof(double)*stride*count );
+    t = (double*)malloc( sizeof(double)*stride );
+    b0 = (double*)malloc( sizeof(double)*strideb*count );
+    b = (double*)malloc( sizeof(double)*strideb*count );
+    tau = (double*)malloc( sizeof(double)*n*count );
+    tau1 = (double*)malloc( sizeof(double)*n );
+    ipiv = (lapack_int*)malloc( sizeof(lapack_int)*n*count );
+    info = (lapack_int*)malloc( sizeof(lapack_int)*count );
+    for( i = 0; i < stride*count; i++ ) a0[i] = rnd();
+    for( i = 0; i < strideb*count; i++ ) b0[i] = rnd();
+
+    /* LU factorization and solves, with a singular matrix */
+    memcpy( a, a0, sizeof(double)*stride*count );
+    for( i = 0; i < n; i++ ) {
+        a[stride + IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    LAPACKE_dgetrf_batch_strided( layout, n, n, a, lda, stride, ipiv, n,
+                                   count, info );
+    memcpy( t, a0 + stride, sizeof(double)*stride );
+    for( i = 0; i < n; i++ ) {
+        t[IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    info1 = LAPACKE_dgetrf( layout, n, n, t, lda, ipiv + n );
+    if( info[1] != info1 || info1 == 0 ) {
+        printf( "dgetrf: INFO = %d, expected %d\n", (int)info[1],
+                (int)info1 );
+        fails++;
+    }
+    memcpy( a + stride, a0 + stride, sizeof(double)*stride );
+    LAPACKE_dgetrf( layout, n, n, a + stride, lda, ipiv + n );
+    for( k = 0; k < count; k++ ) {
+        if( k != 1 && info[k] != 0 ) fails++;
+    }
+    for( l = 0; l < 2; l++ ) {
+        memcpy( b, b0, sizeof(double)*strideb*count );
+        LAPACKE_dgetrs_batch_strided( layout, transs[l], n, nrhs, a, lda,
+                                       stride, ipiv, n, b, ldb, strideb,
+                                       count );
+        for( k = 0; k < count; k++ ) {
+            r = d_resid( layout, transs[l], n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "dgetrs", layout, n, r );
+        }
+    }
+    /* The same factorization for all right-hand sides */
+    memcpy( b, b0, sizeof(double)*strideb*count );
+    LAPACKE_dgetrs_batch_strided( layout, 'N', n, nrhs, a, lda, 0, ipiv, 0,
+                                   b, ldb, strideb, count );
+    for( k = 0; k < count; k++ ) {
+        r = d_resid( layout, 'N', n, nrhs, a0, lda, b + k*strideb,
+                       b0 + k*strideb, ldb );
+        fails += check( "dgetrs, stridea = 0", layout, n, r );
+    }
+
+    /* Cholesky factorization and solves, with an indefinite matrix */
+    for( k = 0; k < count; k++ ) {
+        for( j = 0; j < n; j++ ) {
+            for( i = 0; i < n; i++ ) {
+                double s = ( i == j ) ? n : 0.0;
+                for( l = 0; l < n; l++ ) {
+                    s += ( a0[k*stride + l + i*n] ) * a0[k*stride + l + j*n];
+                }
+                a[k*stride + IDX( layout, i, j, lda )] = s;
+            }
+        }
+    }
+    memcpy( a0, a, sizeof(double)*stride*count );
+    for( l = 0; l < 2; l++ ) {
+        uplo = l ? 'U' : 'L';
+        memcpy( a, a0, sizeof(double)*stride*count );
+        a[2*stride + IDX( layout, n-1, n-1, lda )] = -1.0;
+        LAPACKE_dpotrf_batch_strided( layout, uplo, n, a, lda, stride,
+                                       count, info );
+        memcpy( t, a0 + 2*stride, sizeof(double)*stride );
+        t[IDX( layout, n-1, n-1, lda )] = -1.0;
+        info1 = LAPACKE_dpotrf( layout, uplo, n, t, lda );
+        if( count > 2 && ( info[2] != info1 || info1 != n ||
+            !( d_diff( n, t, a + 2*stride, stride ) < THRESH ) ) ) {
+            printf( "dpotrf: INFO = %d, expected %d\n", (int)info[2],
+                    (int)info1 );
+            fails++;
+        }
+        memcpy( a + 2*stride, a0 + 2*stride, sizeof(double)*stride );
+        LAPACKE_dpotrf( layout, uplo, n, a + 2*stride, lda );
+        for( k = 0; k < count; k++ ) {
+            if( k != 2 && info[k] != 0 ) fails++;
+        }
+        memcpy( b, b0, sizeof(double)*strideb*count );
+        LAPACKE_dpotrs_batch_strided( layout, uplo, n, nrhs, a, lda, stride,
+                                       b, ldb, strideb, count );
+        for( k = 0; k < count; k++ ) {
+            r = d_resid( layout, 'N', n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "dpotrs", layout, n, r );
+        }
+    }
+
+    /* QR factorization, compared with LAPACKE_dgeqrf */
+    memcpy( a, a0, sizeof(double)*stride*count );
+    LAPACKE_dgeqrf_batch_strided( layout, n, n, a, lda, stride, tau, n,
+                                   count );
+    for( k = 0; k < count; k++ ) {
+        memcpy( t, a0 + k*stride, sizeof(double)*stride );
+        LAPACKE_dgeqrf( layout, n, n, t, lda, tau1 );
+        r = fmax( d_diff( n, t, a + k*stride, stride ),
+                  d_diff( n, tau1, tau + k*n, n ) );
+        fails += check( "dgeqrf", layout, n, r );
+    }
+
+    free( a0 );
+    free( a );
+    free( t );
+    free( b0 );
+    free( b );
+    free( tau );
+    free( tau1 );
+    free( ipiv );
+    free( info );
+    return fails;
+}
+
+/* Complex: residual |op(A)*X - B| / ( n*eps*|A|*|X| ) of the solutions */
+static double c_resid( int layout, char trans, lapack_int n,
+                         lapack_int nrhs, const lapack_complex_float* a, lapack_int lda,
+                         const lapack_complex_float* x, const lapack_complex_float* b, lapack_int ldb )
+{
+    lapack_int i, j, k;
+    double anrm = 0.0, xnrm = 0.0, rmax = 0.0;
+    lapack_complex_float s, aik;
+
+    for( i = 0; i < n*n; i++ ) {
+        anrm = fmax( anrm, cabsf( a[IDX( layout, i % n, i / n, lda )] ) );
+    }
+    for( j = 0; j < nrhs; j++ ) {
+        for( i = 0; i < n; i++ ) {
+            xnrm = fmax( xnrm, cabsf( x[IDX( layout, i, j, ldb )] ) );
+            s = b[IDX( layout, i, j, ldb )];
+            for( k = 0; k < n; k++ ) {
+                aik = ( trans == 'N' ) ? a[IDX( layout, i, k, lda )] :
+                                         a[IDX( layout, k, i, lda )];
+                if( trans == 'C' ) aik = conjf( aik );
+                s -= aik * x[IDX( layout, k, j, ldb )];
+            }
+            rmax = fmax( rmax, cabsf( s ) );
+        }
+    }
+    if( anrm == 0.0 || xnrm == 0.0 ) return rmax;
+    return rmax / ( n * FLT_EPSILON * anrm * xnrm );
+}
+
+/* Complex: largest difference |x - y| / ( n*eps*|x| ) of two arrays */
+static double c_diff( lapack_int n, const lapack_complex_float* x, const lapack_complex_float* y,
+                        lapack_int len )
+{
+    lapack_int i;
+    double d = 0.0, xnrm = 0.0;
+
+    for( i = 0; i < len; i++ ) {
+        d = fmax( d, cabsf( x[i] - y[i] ) );
+        xnrm = fmax( xnrm, cabsf( x[i] ) );
+    }
+    if( xnrm == 0.0 ) return d;
+    return d / ( n * FLT_EPSILON * xnrm );
+}
+
+/* Complex: tests a batch of count n-by-n systems with nrhs right-hand sides */
+static int test_c( int layout, lapack_int n, lapack_int nrhs,
+                     lapack_int count )
+{
+    const lapack_int lda = n, stride = n*n;
+    const lapack_int ldb = ( layout == LAPACK_COL_MAJOR ) ? n : nrhs;
+    const lapack_int strideb = n*nrhs;
+    const char transs[2] = { 'N', 'C' };
+    lapack_complex_float *a0, *a, *b0, *b, *t, *tau, *tau1;
+    lapack_int *ipiv, *info, info1;
+    lapack_int i, j, k, l;
+    char uplo;
+    double r;
+    int fails = 0;
+
+    a0 = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*stride*count );
+    a = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*stride*count );
+    t = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*stride );
+    b0 = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*strideb*count );
+    b = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*strideb*count );
+    tau = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*n*count );
+    tau1 = (lapack_complex_float*)malloc( sizeof(lapack_complex_float)*n );
+    ipiv = (lapack_int*)malloc( sizeof(lapack_int)*n*count );
+    info = (lapack_int*)malloc( sizeof(lapack_int)*count );
+    for( i = 0; i < stride*count; i++ ) a0[i] = lapack_make_complex_float( (float)rnd(), (float)rnd() );
+    for( i = 0; i < strideb*count; i++ ) b0[i] = lapack_make_complex_float( (float)rnd(), (float)rnd() );
+
+    /* LU factorization and solves, with a singular matrix */
+    memcpy( a, a0, sizeof(lapack_complex_float)*stride*count );
+    for( i = 0; i < n; i++ ) {
+        a[stride + IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    LAPACKE_cgetrf_batch_strided( layout, n, n, a, lda, stride, ipiv, n,
+                                   count, info );
+    memcpy( t, a0 + stride, sizeof(lapack_complex_float)*stride );
+    for( i = 0; i < n; i++ ) {
+        t[IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    info1 = LAPACKE_cgetrf( layout, n, n, t, lda, ipiv + n );
+    if( info[1] != info1 || info1 == 0 ) {
+        printf( "cgetrf: INFO = %d, expected %d\n", (int)info[1],
+                (int)info1 );
+        fails++;
+    }
+    memcpy( a + stride, a0 + stride, sizeof(lapack_complex_float)*stride );
+    LAPACKE_cgetrf( layout, n, n, a + stride, lda, ipiv + n );
+    for( k = 0; k < count; k++ ) {
+        if( k != 1 && info[k] != 0 ) fails++;
+    }
+    for( l = 0; l < 2; l++ ) {
+        memcpy( b, b0, sizeof(lapack_complex_float)*strideb*count );
+        LAPACKE_cgetrs_batch_strided( layout, transs[l], n, nrhs, a, lda,
+                                       stride, ipiv, n, b, ldb, strideb,
+                                       count );
+        for( k = 0; k < count; k++ ) {
+            r = c_resid( layout, transs[l], n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "cgetrs", layout, n, r );
+        }
+    }
+    /* The same factorization for all right-hand sides */
+    memcpy( b, b0, sizeof(lapack_complex_float)*strideb*count );
+    LAPACKE_cgetrs_batch_strided( layout, 'N', n, nrhs, a, lda, 0, ipiv, 0,
+                                   b, ldb, strideb, count );
+    for( k = 0; k < count; k++ ) {
+        r = c_resid( layout, 'N', n, nrhs, a0, lda, b + k*strideb,
+                       b0 + k*strideb, ldb );
+        fails += check( "cgetrs, stridea = 0", layout, n, r );
+    }
+
+    /* Cholesky factorization and solves, with an indefinite matrix */
+    for( k = 0; k < count; k++ ) {
+        for( j = 0; j < n; j++ ) {
+            for( i = 0; i < n; i++ ) {
+                lapack_complex_float s = ( i == j ) ? n : 0.0;
+                for( l = 0; l < n; l++ ) {
+                    s += conjf( a0[k*stride + l + i*n] ) * a0[k*stride + l + j*n];
+                }
+                a[k*stride + IDX( layout, i, j, lda )] = s;
+            }
+        }
+    }
+    memcpy( a0, a, sizeof(lapack_complex_float)*stride*count );
+    for( l = 0; l < 2; l++ ) {
+        uplo = l ? 'U' : 'L';
+        memcpy( a, a0, sizeof(lapack_complex_float)*stride*count );
+        a[2*stride + IDX( layout, n-1, n-1, lda )] = -1.0;
+        LAPACKE_cpotrf_batch_strided( layout, uplo, n, a, lda, stride,
+                                       count, info );
+        memcpy( t, a0 + 2*stride, sizeof(lapack_complex_float)*stride );
+        t[IDX( layout, n-1, n-1, lda )] = -1.0;
+        info1 = LAPACKE_cpotrf( layout, uplo, n, t, lda );
+        if( count > 2 && ( info[2] != info1 || info1 != n ||
+            !( c_diff( n, t, a + 2*stride, stride ) < THRESH ) ) ) {
+            printf( "cpotrf: INFO = %d, expected %d\n", (int)info[2],
+                    (int)info1 );
+            fails++;
+        }
+        memcpy( a + 2*stride, a0 + 2*stride, sizeof(lapack_complex_float)*stride );
+        LAPACKE_cpotrf( layout, uplo, n, a + 2*stride, lda );
+        for( k = 0; k < count; k++ ) {
+            if( k != 2 && info[k] != 0 ) fails++;
+        }
+        memcpy( b, b0, sizeof(lapack_complex_float)*strideb*count );
+        LAPACKE_cpotrs_batch_strided( layout, uplo, n, nrhs, a, lda, stride,
+                                       b, ldb, strideb, count );
+        for( k = 0; k < count; k++ ) {
+            r = c_resid( layout, 'N', n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "cpotrs", layout, n, r );
+        }
+    }
+
+    /* QR factorization, compared with LAPACKE_cgeqrf */
+    memcpy( a, a0, sizeof(lapack_complex_float)*stride*count );
+    LAPACKE_cgeqrf_batch_strided( layout, n, n, a, lda, stride, tau, n,
+                                   count );
+    for( k = 0; k < count; k++ ) {
+        memcpy( t, a0 + k*stride, sizeof(lapack_complex_float)*stride );
+        LAPACKE_cgeqrf( layout, n, n, t, lda, tau1 );
+        r = fmax( c_diff( n, t, a + k*stride, stride ),
+                  c_diff( n, tau1, tau + k*n, n ) );
+        fails += check( "cgeqrf", layout, n, r );
+    }
+
+    free( a0 );
+    free( a );
+    free( t );
+    free( b0 );
+    free( b );
+    free( tau );
+    free( tau1 );
+    free( ipiv );
+    free( info );
+    return fails;
+}
+
+/* Double complex: residual |op(A)*X - B| / ( n*eps*|A|*|X| ) of the solutions */
+static double z_resid( int layout, char trans, lapack_int n,
+                         lapack_int nrhs, const lapack_complex_double* a, lapack_int lda,
+                         const lapack_complex_double* x, const lapack_complex_double* b, lapack_int ldb )
+{
+    lapack_int i, j, k;
+    double anrm = 0.0, xnrm = 0.0, rmax = 0.0;
+    lapack_complex_double s, aik;
+
+    for( i = 0; i < n*n; i++ ) {
+        anrm = fmax( anrm, cabs( a[IDX( layout, i % n, i / n, lda )] ) );
+    }
+    for( j = 0; j < nrhs; j++ ) {
+        for( i = 0; i < n; i++ ) {
+            xnrm = fmax( xnrm, cabs( x[IDX( layout, i, j, ldb )] ) );
+            s = b[IDX( layout, i, j, ldb )];
+            for( k = 0; k < n; k++ ) {
+                aik = ( trans == 'N' ) ? a[IDX( layout, i, k, lda )] :
+                                         a[IDX( layout, k, i, lda )];
+                if( trans == 'C' ) aik = conj( aik );
+                s -= aik * x[IDX( layout, k, j, ldb )];
+            }
+            rmax = fmax( rmax, cabs( s ) );
+        }
+    }
+    if( anrm == 0.0 || xnrm == 0.0 ) return rmax;
+    return rmax / ( n * DBL_EPSILON * anrm * xnrm );
+}
+
+/* Double complex: largest difference |x - y| / ( n*eps*|x| ) of two arrays */
+static double z_diff( lapack_int n, const lapack_complex_double* x, const lapack_complex_double* y,
+                        lapack_int len )
+{
+    lapack_int i;
+    double d = 0.0, xnrm = 0.0;
+
+    for( i = 0; i < len; i++ ) {
+        d = fmax( d, cabs( x[i] - y[i] ) );
+        xnrm = fmax( xnrm, cabs( x[i] ) );
+    }
+    if( xnrm == 0.0 ) return d;
+    return d / ( n * DBL_EPSILON * xnrm );
+}
+
+/* Double complex: tests a batch of count n-by-n systems with nrhs right-hand sides */
+static int test_z( int layout, lapack_int n, lapack_int nrhs,
+                     lapack_int count )
+{
+    const lapack_int lda = n, stride = n*n;
+    const lapack_int ldb = ( layout == LAPACK_COL_MAJOR ) ? n : nrhs;
+    const lapack_int strideb = n*nrhs;
+    const char transs[2] = { 'N', 'C' };
+    lapack_complex_double *a0, *a, *b0, *b, *t, *tau, *tau1;
+    lapack_int *ipiv, *info, info1;
+    lapack_int i, j, k, l;
+    char uplo;
+    double r;
+    int fails = 0;
+
+    a0 = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*stride*count );
+    a = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*stride*count );
+    t = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*stride );
+    b0 = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*strideb*count );
+    b = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*strideb*count );
+    tau = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*n*count );
+    tau1 = (lapack_complex_double*)malloc( sizeof(lapack_complex_double)*n );
+    ipiv = (lapack_int*)malloc( sizeof(lapack_int)*n*count );
+    info = (lapack_int*)malloc( sizeof(lapack_int)*count );
+    for( i = 0; i < stride*count; i++ ) a0[i] = lapack_make_complex_double( rnd(), rnd() );
+    for( i = 0; i < strideb*count; i++ ) b0[i] = lapack_make_complex_double( rnd(), rnd() );
+
+    /* LU factorization and solves, with a singular matrix */
+    memcpy( a, a0, sizeof(lapack_complex_double)*stride*count );
+    for( i = 0; i < n; i++ ) {
+        a[stride + IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    LAPACKE_zgetrf_batch_strided( layout, n, n, a, lda, stride, ipiv, n,
+                                   count, info );
+    memcpy( t, a0 + stride, sizeof(lapack_complex_double)*stride );
+    for( i = 0; i < n; i++ ) {
+        t[IDX( layout, i, n/2, lda )] = 0.0;
+    }
+    info1 = LAPACKE_zgetrf( layout, n, n, t, lda, ipiv + n );
+    if( info[1] != info1 || info1 == 0 ) {
+        printf( "zgetrf: INFO = %d, expected %d\n", (int)info[1],
+                (int)info1 );
+        fails++;
+    }
+    memcpy( a + stride, a0 + stride, sizeof(lapack_complex_double)*stride );
+    LAPACKE_zgetrf( layout, n, n, a + stride, lda, ipiv + n );
+    for( k = 0; k < count; k++ ) {
+        if( k != 1 && info[k] != 0 ) fails++;
+    }
+    for( l = 0; l < 2; l++ ) {
+        memcpy( b, b0, sizeof(lapack_complex_double)*strideb*count );
+        LAPACKE_zgetrs_batch_strided( layout, transs[l], n, nrhs, a, lda,
+                                       stride, ipiv, n, b, ldb, strideb,
+                                       count );
+        for( k = 0; k < count; k++ ) {
+            r = z_resid( layout, transs[l], n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "zgetrs", layout, n, r );
+        }
+    }
+    /* The same factorization for all right-hand sides */
+    memcpy( b, b0, sizeof(lapack_complex_double)*strideb*count );
+    LAPACKE_zgetrs_batch_strided( layout, 'N', n, nrhs, a, lda, 0, ipiv, 0,
+                                   b, ldb, strideb, count );
+    for( k = 0; k < count; k++ ) {
+        r = z_resid( layout, 'N', n, nrhs, a0, lda, b + k*strideb,
+                       b0 + k*strideb, ldb );
+        fails += check( "zgetrs, stridea = 0", layout, n, r );
+    }
+
+    /* Cholesky factorization and solves, with an indefinite matrix */
+    for( k = 0; k < count; k++ ) {
+        for( j = 0; j < n; j++ ) {
+            for( i = 0; i < n; i++ ) {
+                lapack_complex_double s = ( i == j ) ? n : 0.0;
+                for( l = 0; l < n; l++ ) {
+                    s += conj( a0[k*stride + l + i*n] ) * a0[k*stride + l + j*n];
+                }
+                a[k*stride + IDX( layout, i, j, lda )] = s;
+            }
+        }
+    }
+    memcpy( a0, a, sizeof(lapack_complex_double)*stride*count );
+    for( l = 0; l < 2; l++ ) {
+        uplo = l ? 'U' : 'L';
+        memcpy( a, a0, sizeof(lapack_complex_double)*stride*count );
+        a[2*stride + IDX( layout, n-1, n-1, lda )] = -1.0;
+        LAPACKE_zpotrf_batch_strided( layout, uplo, n, a, lda, stride,
+                                       count, info );
+        memcpy( t, a0 + 2*stride, sizeof(lapack_complex_double)*stride );
+        t[IDX( layout, n-1, n-1, lda )] = -1.0;
+        info1 = LAPACKE_zpotrf( layout, uplo, n, t, lda );
+        if( count > 2 && ( info[2] != info1 || info1 != n ||
+            !( z_diff( n, t, a + 2*stride, stride ) < THRESH ) ) ) {
+            printf( "zpotrf: INFO = %d, expected %d\n", (int)info[2],
+                    (int)info1 );
+            fails++;
+        }
+        memcpy( a + 2*stride, a0 + 2*stride, sizeof(lapack_complex_double)*stride );
+        LAPACKE_zpotrf( layout, uplo, n, a + 2*stride, lda );
+        for( k = 0; k < count; k++ ) {
+            if( k != 2 && info[k] != 0 ) fails++;
+        }
+        memcpy( b, b0, sizeof(lapack_complex_double)*strideb*count );
+        LAPACKE_zpotrs_batch_strided( layout, uplo, n, nrhs, a, lda, stride,
+                                       b, ldb, strideb, count );
+        for( k = 0; k < count; k++ ) {
+            r = z_resid( layout, 'N', n, nrhs, a0 + k*stride, lda,
+                           b + k*strideb, b0 + k*strideb, ldb );
+            fails += check( "zpotrs", layout, n, r );
+        }
+    }
+
+    /* QR factorization, compared with LAPACKE_zgeqrf */
+    memcpy( a, a0, sizeof(lapack_complex_double)*stride*count );
+    LAPACKE_zgeqrf_batch_strided( layout, n, n, a, lda, stride, tau, n,
+                                   count );
+    for( k = 0; k < count; k++ ) {
+        memcpy( t, a0 + k*stride, sizeof(lapack_complex_double)*stride );
+        LAPACKE_zgeqrf( layout, n, n, t, lda, tau1 );
+        r = fmax( z_diff( n, t, a + k*stride, stride ),
+                  z_diff( n, tau1, tau + k*n, n ) );
+        fails += check( "zgeqrf", layout, n, r );
+    }
+
+    free( a0 );
+    free( a );
+    free( t );
+    free( b0 );
+    free( b );
+    free( tau );
+    free( tau1 );
+    free( ipiv );
+    free( info );
+    return fails;
+}
+
+/* Main program */
+int main( void )
+{
+    const lapack_int sizes[4] = { 1, 5, 24, 40 };
+    const int layouts[2] = { LAPACK_COL_MAJOR, LAPACK_ROW_MAJOR };
+    double a[16];
+    lapack_int ipiv[4], info[2];
+    int fails = 0, i, l;
+
+    for( l = 0; l < 2; l++ ) {
+        for( i = 0; i < 4; i++ ) {
+            fails += test_s( layouts[l], sizes[i], 3, 37 );
+            fails += test_d( layouts[l], sizes[i], 3, 37 );
+            fails += test_c( layouts[l], sizes[i], 3, 11 );
+            fails += test_z( layouts[l], sizes[i], 3, 11 );
+        }
+        fails += test_d( layouts[l], 7, 30, 9 );
+    }
+
+    /* Invalid arguments */
+    if( LAPACKE_dgetrf_batch_strided( LAPACK_COL_MAJOR, 4, 4, a, 4, 15, ipiv,
+                                      4, 1, info ) != -6 ) fails++;
+    if( LAPACKE_dgetrf_batch_strided( LAPACK_ROW_MAJOR, 2, 4, a, 3, 8, ipiv,
+                                      2, 1, info ) != -5 ) fails++;
+    if( LAPACKE_dpotrf_batch_strided( LAPACK_COL_MAJOR, 'X', 4, a, 4, 16, 1,
+                                      info ) != -2 ) fails++;
+    if( LAPACKE_dgetrs_batch_strided( LAPACK_COL_MAJOR, 'N', 4, 1, a, 4, 16,
+                                      ipiv, 3, a, 4, 4, 1 ) != -9 ) fails++;
+    if( LAPACKE_dpotrs_batch_strided( LAPACK_ROW_MAJOR, 'L', 4, 2, a, 4, 0,
+                                      a, 1, 8, 1 ) != -9 ) fails++;
+    if( LAPACKE_dgeqrf_batch_strided( LAPACK_COL_MAJOR, 4, 4, a, 4, 16, a,
+                                      4, -1 ) != -9 ) fails++;
+
+    printf( "%s\n", fails ? "FAILED" : "OK" );
+    exit( fails != 0 );
+} /* End of LAPACKE batch example */
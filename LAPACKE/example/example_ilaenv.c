@@ -0,0 +1,90 @@
+/*
+   LAPACKE Example : ILAENV tuning table
+   =====================================
+
+   The program sets the block size of DGEQRF in the tuning table of
+   ILAENV, and checks with a workspace query of LAPACKE_dgeqrf_work, which
+   asks for N*NB elements, that DGEQRF uses it.
+
+   Description
+   ===========
+
+   The table is written to a file with LAPACKE_ilaenv_save, cleared with
+   LAPACKE_ilaenv_reset and read back with LAPACKE_ilaenv_load.  The entry
+   is then removed with LAPACKE_ilaenv_unset, after which DGEQRF uses its
+   built-in block size again.  The same file can be given to any program
+   with the environment variable LAPACK_ILAENV_FILE.
+
+   The program returns a nonzero exit status if one of the checks fails.
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+/* ILAENV tuning table */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <lapacke.h>
+
+#define N    100
+#define NB   8
+#define FILE_NAME "example_ilaenv.tab"
+
+/* Returns the block size DGEQRF uses for an N-by-N matrix */
+static lapack_int geqrf_nb( void )
+{
+    double a[1], tau[1], work[1];
+    LAPACKE_dgeqrf_work( LAPACK_COL_MAJOR, N, N, a, N, tau, work, -1 );
+    return (lapack_int)work[0] / N;
+}
+
+/* Main program */
+int main( void )
+{
+    lapack_int nb0, nb1, info;
+    int fails = 0;
+
+    LAPACKE_ilaenv_reset();
+    nb0 = geqrf_nb();
+    printf( "Built-in block size of DGEQRF: %d\n", (int)nb0 );
+
+    /* Set the block size */
+    info = LAPACKE_ilaenv_set( 1, "dgeqrf", NB );
+    nb1 = geqrf_nb();
+    printf( "Block size after LAPACKE_ilaenv_set: %d\n", (int)nb1 );
+    if( info != 0 || nb1 != NB || LAPACKE_ilaenv_get( 1, "DGEQRF" ) != NB )
+        fails++;
+
+    /* Save it, clear the table and read it back */
+    info = LAPACKE_ilaenv_save( FILE_NAME );
+    if( info != 0 ) fails++;
+    LAPACKE_ilaenv_reset();
+    if( LAPACKE_ilaenv_get( 1, "DGEQRF" ) != -1 || geqrf_nb() != nb0 )
+        fails++;
+    info = LAPACKE_ilaenv_load( FILE_NAME );
+    nb1 = geqrf_nb();
+    printf( "Block size read from %s: %d\n", FILE_NAME, (int)nb1 );
+    if( info != 0 || nb1 != NB ) fails++;
+    remove( FILE_NAME );
+
+    /* Back to the built-in block size */
+    info = LAPACKE_ilaenv_unset( 1, "DGEQRF" );
+    if( info != 0 || geqrf_nb() != nb0 ) fails++;
+
+    /* No entry for the block sizes of DGEQR, chosen with N3 */
+    if( LAPACKE_ilaenv_set( 1, "DGEQR", NB ) != 4 ||
+        LAPACKE_ilaenv_get( 1, "DGEQR" ) != -1 ) fails++;
+
+    /* Nothing to read */
+    if( LAPACKE_ilaenv_load( FILE_NAME ) != 1 ) fails++;
+
+    if( fails != 0 ) {
+        printf( "%d checks failed\n", fails );
+        return 1;
+    }
+    printf( "All checks passed\n" );
+    return 0;
+}
+/* End of LAPACKE Example */
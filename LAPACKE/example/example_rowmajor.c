@@ -0,0 +1,284 @@
+/*
+   LAPACKE Example : In-place row-major drivers
+   ============================================
+
+   The program solves the same small systems with LAPACKE_?gesv,
+   LAPACKE_?posv and LAPACKE_?gels, in double precision and double
+   complex, in two ways:
+
+   - in row-major layout, where these drivers work in place on the
+     buffers of the caller, whose column-major view is A**T;
+   - in column-major layout, on copies of A and B transposed by the
+     program, as LAPACKE used to do for row-major arguments.
+
+   Description
+   ===========
+
+   The in-place paths must return the same outputs as the transposing
+   path, up to rounding: the solution B, and A overwritten by its
+   factorization (the LU factors and the pivots, the Cholesky factor, or
+   the QR or LQ factorization with its Householder vectors), so that a
+   caller can use them as the output of the LAPACK routine.  The matrices
+   are stored with leading dimensions larger than their number of
+   columns.
+
+   The program prints the largest relative difference for each case and
+   returns a nonzero exit status if one is larger than a small multiple
+   of the machine precision, or if INFO differs.
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+/* In-place row-major drivers */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <complex.h>
+#include <lapacke.h>
+
+#define MAXN  12
+#define NRHS  3
+#define LDA   ( MAXN + 2 )
+#define LDB   ( NRHS + 1 )
+#define TOL   ( 100.0 * DBL_EPSILON )
+
+typedef lapack_complex_double zcomplex;
+
+static int fails = 0;
+
+/* Entries of the test matrices */
+static double dentry( lapack_int i, lapack_int j )
+{
+    return 1.0 / ( i + 2*j + 1 ) + ( i == j ? 2.0 : 0.0 );
+}
+
+static zcomplex zentry( lapack_int i, lapack_int j )
+{
+    return lapack_make_complex_double( dentry( i, j ),
+                                       0.25 / ( 2*i + j + 1 ) - 0.1*( i < j ) );
+}
+
+/* Symmetric (Hermitian) positive definite matrix from the entries */
+static double dspd( lapack_int i, lapack_int j )
+{
+    return i <= j ? dentry( i, j ) + dentry( j, i ) : dspd( j, i );
+}
+
+static zcomplex zhpd( lapack_int i, lapack_int j )
+{
+    if( i > j ) return conj( zhpd( j, i ) );
+    if( i == j ) return lapack_make_complex_double( 2.0*dentry( i, i ), 0.0 );
+    return zentry( i, j );
+}
+
+/* Prints the result of a case and counts the failures */
+static void report( const char* name, lapack_int info1, lapack_int info2,
+                    double diff )
+{
+    int ok = ( info1 == info2 && diff <= TOL );
+    printf( "%-24s info %2d  difference %9.2e  %s\n", name, (int)info1,
+            diff, ok ? "ok" : "FAILED" );
+    if( !ok ) fails++;
+}
+
+/* Largest difference between the m-by-n row-major x and the column-major
+ * y, relative to the largest entry of y */
+static double ddiff( lapack_int m, lapack_int n, const double* x,
+                     lapack_int ldx, const double* y, lapack_int ldy )
+{
+    double d = 0.0, s = 0.0;
+    lapack_int i, j;
+    for( i = 0; i < m; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            double e = fabs( x[i*ldx+j] - y[i+j*ldy] );
+            d = e > d ? e : d;
+            s = fabs( y[i+j*ldy] ) > s ? fabs( y[i+j*ldy] ) : s;
+        }
+    }
+    return s > 0.0 ? d / s : d;
+}
+
+static double zdiff( lapack_int m, lapack_int n, const zcomplex* x,
+                     lapack_int ldx, const zcomplex* y, lapack_int ldy )
+{
+    double d = 0.0, s = 0.0;
+    lapack_int i, j;
+    for( i = 0; i < m; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            double e = cabs( x[i*ldx+j] - y[i+j*ldy] );
+            d = e > d ? e : d;
+            s = cabs( y[i+j*ldy] ) > s ? cabs( y[i+j*ldy] ) : s;
+        }
+    }
+    return s > 0.0 ? d / s : d;
+}
+
+/* Same, for the upper (uplo = 'U') or lower triangle only */
+static double dtrdiff( char uplo, lapack_int n, const double* x,
+                       lapack_int ldx, const double* y, lapack_int ldy )
+{
+    double d = 0.0, s = 0.0;
+    lapack_int i, j;
+    for( i = 0; i < n; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            if( ( uplo == 'U' ) != ( i <= j ) && i != j ) continue;
+            double e = fabs( x[i*ldx+j] - y[i+j*ldy] );
+            d = e > d ? e : d;
+            s = fabs( y[i+j*ldy] ) > s ? fabs( y[i+j*ldy] ) : s;
+        }
+    }
+    return s > 0.0 ? d / s : d;
+}
+
+static double ztrdiff( char uplo, lapack_int n, const zcomplex* x,
+                       lapack_int ldx, const zcomplex* y, lapack_int ldy )
+{
+    double d = 0.0, s = 0.0;
+    lapack_int i, j;
+    for( i = 0; i < n; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            if( ( uplo == 'U' ) != ( i <= j ) && i != j ) continue;
+            double e = cabs( x[i*ldx+j] - y[i+j*ldy] );
+            d = e > d ? e : d;
+            s = cabs( y[i+j*ldy] ) > s ? cabs( y[i+j*ldy] ) : s;
+        }
+    }
+    return s > 0.0 ? d / s : d;
+}
+
+/* Fills the row-major x and its column-major copy y */
+static void dfill( lapack_int m, lapack_int n, double (*f)( lapack_int,
+                   lapack_int ), double* x, lapack_int ldx, double* y,
+                   lapack_int ldy )
+{
+    lapack_int i, j;
+    for( i = 0; i < m; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            x[i*ldx+j] = y[i+j*ldy] = f( i, j );
+        }
+    }
+}
+
+static void zfill( lapack_int m, lapack_int n, zcomplex (*f)( lapack_int,
+                   lapack_int ), zcomplex* x, lapack_int ldx, zcomplex* y,
+                   lapack_int ldy )
+{
+    lapack_int i, j;
+    for( i = 0; i < m; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            x[i*ldx+j] = y[i+j*ldy] = f( i, j );
+        }
+    }
+}
+
+static double drhs( lapack_int i, lapack_int j )
+{
+    return 1.0 + i - 0.5*j;
+}
+
+static zcomplex zrhs( lapack_int i, lapack_int j )
+{
+    return lapack_make_complex_double( 1.0 + i - 0.5*j, 0.5*i + j );
+}
+
+/* Main program */
+int main( void )
+{
+    static double a[MAXN*LDA], b[MAXN*LDB], ac[MAXN*MAXN], bc[MAXN*NRHS];
+    static zcomplex za[MAXN*LDA], zb[MAXN*LDB], zac[MAXN*MAXN],
+                    zbc[MAXN*NRHS];
+    lapack_int ipiv[MAXN], ipivc[MAXN];
+    lapack_int info1, info2, m, n, mx, k;
+    static const lapack_int mval[2] = { MAXN, 7 }, nval[2] = { 7, MAXN };
+    double d, e;
+    char name[32];
+    char uplo, trans;
+    int u, t;
+
+    /* GESV: LU factors, pivots and solution */
+    n = MAXN;
+    dfill( n, n, dentry, a, LDA, ac, n );
+    dfill( n, NRHS, drhs, b, LDB, bc, n );
+    info1 = LAPACKE_dgesv( LAPACK_ROW_MAJOR, n, NRHS, a, LDA, ipiv, b, LDB );
+    info2 = LAPACKE_dgesv( LAPACK_COL_MAJOR, n, NRHS, ac, n, ipivc, bc, n );
+    d = ddiff( n, n, a, LDA, ac, n );
+    e = ddiff( n, NRHS, b, LDB, bc, n );
+    if( memcmp( ipiv, ipivc, sizeof(ipiv) ) != 0 ) d = 1.0;
+    report( "dgesv", info1, info2, d > e ? d : e );
+
+    zfill( n, n, zentry, za, LDA, zac, n );
+    zfill( n, NRHS, zrhs, zb, LDB, zbc, n );
+    info1 = LAPACKE_zgesv( LAPACK_ROW_MAJOR, n, NRHS, za, LDA, ipiv, zb, LDB );
+    info2 = LAPACKE_zgesv( LAPACK_COL_MAJOR, n, NRHS, zac, n, ipivc, zbc, n );
+    d = zdiff( n, n, za, LDA, zac, n );
+    e = zdiff( n, NRHS, zb, LDB, zbc, n );
+    if( memcmp( ipiv, ipivc, sizeof(ipiv) ) != 0 ) d = 1.0;
+    report( "zgesv", info1, info2, d > e ? d : e );
+
+    /* POSV: Cholesky factor and solution */
+    for( u = 0; u < 2; u++ ) {
+        uplo = u == 0 ? 'U' : 'L';
+        dfill( n, n, dspd, a, LDA, ac, n );
+        dfill( n, NRHS, drhs, b, LDB, bc, n );
+        info1 = LAPACKE_dposv( LAPACK_ROW_MAJOR, uplo, n, NRHS, a, LDA, b,
+                               LDB );
+        info2 = LAPACKE_dposv( LAPACK_COL_MAJOR, uplo, n, NRHS, ac, n, bc,
+                               n );
+        d = dtrdiff( uplo, n, a, LDA, ac, n );
+        e = ddiff( n, NRHS, b, LDB, bc, n );
+        sprintf( name, "dposv uplo=%c", uplo );
+        report( name, info1, info2, d > e ? d : e );
+
+        zfill( n, n, zhpd, za, LDA, zac, n );
+        zfill( n, NRHS, zrhs, zb, LDB, zbc, n );
+        info1 = LAPACKE_zposv( LAPACK_ROW_MAJOR, uplo, n, NRHS, za, LDA, zb,
+                               LDB );
+        info2 = LAPACKE_zposv( LAPACK_COL_MAJOR, uplo, n, NRHS, zac, n, zbc,
+                               n );
+        d = ztrdiff( uplo, n, za, LDA, zac, n );
+        e = zdiff( n, NRHS, zb, LDB, zbc, n );
+        sprintf( name, "zposv uplo=%c", uplo );
+        report( name, info1, info2, d > e ? d : e );
+    }
+
+    /* GELS: QR or LQ factorization with its Householder vectors, and
+     * solution */
+    for( k = 0; k < 2; k++ ) {
+        m = mval[k];
+        n = nval[k];
+        mx = m > n ? m : n;
+        for( t = 0; t < 2; t++ ) {
+            trans = t == 0 ? 'N' : 'T';
+            dfill( m, n, dentry, a, LDA, ac, m );
+            dfill( t == 0 ? m : n, NRHS, drhs, b, LDB, bc, mx );
+            info1 = LAPACKE_dgels( LAPACK_ROW_MAJOR, trans, m, n, NRHS, a,
+                                   LDA, b, LDB );
+            info2 = LAPACKE_dgels( LAPACK_COL_MAJOR, trans, m, n, NRHS, ac,
+                                   m, bc, mx );
+            d = ddiff( m, n, a, LDA, ac, m );
+            e = ddiff( t == 0 ? n : m, NRHS, b, LDB, bc, mx );
+            sprintf( name, "dgels %dx%d trans=%c", (int)m, (int)n, trans );
+            report( name, info1, info2, d > e ? d : e );
+
+            trans = t == 0 ? 'N' : 'C';
+            zfill( m, n, zentry, za, LDA, zac, m );
+            zfill( t == 0 ? m : n, NRHS, zrhs, zb, LDB, zbc, mx );
+            info1 = LAPACKE_zgels( LAPACK_ROW_MAJOR, trans, m, n, NRHS, za,
+                                   LDA, zb, LDB );
+            info2 = LAPACKE_zgels( LAPACK_COL_MAJOR, trans, m, n, NRHS, zac,
+                                   m, zbc, mx );
+            d = zdiff( m, n, za, LDA, zac, m );
+            e = zdiff( t == 0 ? n : m, NRHS, zb, LDB, zbc, mx );
+            sprintf( name, "zgels %dx%d trans=%c", (int)m, (int)n, trans );
+            report( name, info1, info2, d > e ? d : e );
+        }
+    }
+
+    printf( "%s\n", fails ? "FAILED" : "OK" );
+    exit( fails != 0 );
+} /* End of LAPACKE in-place row-major example */
@@ -0,0 +1,144 @@
+/*
+   LAPACKE Example : Workspace allocator and arena
+   ===============================================
+
+   The program installs its own workspace allocator, which counts the
+   calls it receives, and computes the singular value decomposition of
+   the same small matrix many times with LAPACKE_dgesdd.  In row-major
+   layout each call allocates five blocks: the integer and the real
+   workspace, and the column-major copies of A, U and V**T.
+
+   Description
+   ===========
+
+   Without the arena, every call of LAPACKE_dgesdd allocates and frees its
+   workspace.  With the arena enabled by LAPACKE_set_workspace_arena, the
+   workspace is carved out of a per-thread buffer that is reused from one
+   call to the next, and the allocator is only called while the buffer
+   grows to the size the calls need.  The counters returned by
+   LAPACKE_get_workspace_stats show the number of blocks and bytes of
+   workspace, and the peak amount in use.
+
+   The program checks that the workspace has the requested alignment,
+   that the arena calls the allocator a bounded number of times, that
+   every block is freed, and that the singular values are the same in both
+   modes.  It returns a nonzero exit status otherwise.
+
+  -- LAPACKE Example routine --
+  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*/
+/* Workspace allocator and arena */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lapacke.h>
+
+#define N     40
+#define CALLS 100
+#define ALIGN 128
+
+/* Allocator that counts its calls in the context */
+typedef struct {
+    long nmalloc;
+    long nfree;
+    long misaligned;
+} counters;
+
+static void* counting_malloc( size_t size, size_t alignment, void* context )
+{
+    counters* c = (counters*)context;
+    char *p, *q;
+    p = (char*)malloc( size + alignment + sizeof(void*) );
+    if( p == NULL ) return NULL;
+    q = p + sizeof(void*) + alignment - 1;
+    q -= (size_t)q % alignment;
+    ((void**)q)[-1] = p;
+    c->nmalloc++;
+    return q;
+}
+
+static void counting_free( void* p, void* context )
+{
+    counters* c = (counters*)context;
+    free( ((void**)p)[-1] );
+    c->nfree++;
+}
+
+/* Checks the alignment of a block from LAPACKE_workspace_malloc */
+static void check_block( counters* c, lapack_int n )
+{
+    double* w = (double*)LAPACKE_workspace_malloc( n*sizeof(double) );
+    if( w == NULL || (size_t)w % ALIGN != 0 ) c->misaligned++;
+    LAPACKE_workspace_free( w );
+}
+
+/* Computes the SVD CALLS times, returns the number of failed calls */
+static int solve( double* s )
+{
+    static double a[N*N], u[N*N], vt[N*N];
+    lapack_int i, j, k, info;
+    int fails = 0;
+
+    for( k = 0; k < CALLS; k++ ) {
+        for( i = 0; i < N; i++ ) {
+            for( j = 0; j < N; j++ ) {
+                a[i*N+j] = 1.0 / ( i + 2*j + 1 ) + ( i == j ? 1.0 : 0.0 );
+            }
+        }
+        info = LAPACKE_dgesdd( LAPACK_ROW_MAJOR, 'S', N, N, a, N, s, u, N,
+                               vt, N );
+        if( info != 0 ) fails++;
+    }
+    return fails;
+}
+
+/* Main program */
+int main( void )
+{
+    counters c = { 0, 0, 0 };
+    lapacke_workspace_stats st;
+    double s0[N], s1[N];
+    int fails = 0;
+    long calls_heap, calls_arena;
+
+    LAPACKE_set_workspace_allocator( counting_malloc, counting_free, ALIGN,
+                                     &c );
+    check_block( &c, 3 );
+
+    /* Workspace from the allocator on every call */
+    LAPACKE_set_workspace_arena( 0 );
+    LAPACKE_reset_workspace_stats();
+    fails += solve( s0 );
+    LAPACKE_get_workspace_stats( &st );
+    calls_heap = c.nmalloc;
+    printf( "Without arena: %ld allocator calls, %lu blocks, %lu bytes, "
+            "peak %lu bytes\n", calls_heap, (unsigned long)st.count,
+            (unsigned long)st.bytes, (unsigned long)st.peak );
+
+    /* Workspace from the arena */
+    LAPACKE_set_workspace_arena( 1 );
+    LAPACKE_reset_workspace_stats();
+    fails += solve( s1 );
+    check_block( &c, 1000 );
+    LAPACKE_get_workspace_stats( &st );
+    calls_arena = c.nmalloc - calls_heap;
+    printf( "With arena:    %ld allocator calls, %lu blocks, %lu bytes, "
+            "peak %lu bytes, arena %lu bytes\n", calls_arena,
+            (unsigned long)st.count, (unsigned long)st.bytes,
+            (unsigned long)st.peak, (unsigned long)st.arena );
+    if( calls_arena > 10 ) fails++;
+    if( st.in_use != 0 || st.arena == 0 ) fails++;
+
+    LAPACKE_release_workspace_arena();
+    LAPACKE_set_workspace_arena( 0 );
+    LAPACKE_set_workspace_allocator( NULL, NULL, 0, NULL );
+    if( c.nmalloc != c.nfree ) fails++;
+    if( c.misaligned != 0 ) fails++;
+    if( memcmp( s0, s1, sizeof(s0) ) != 0 ) fails++;
+
+    printf( "%s\n", fails ? "FAILED" : "OK" );
+    exit( fails != 0 );
+} /* End of LAPACKE workspace example */
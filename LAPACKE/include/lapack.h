@@ -11,6 +11,7 @@
 #include "lapacke_mangling.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <stdarg.h>
 #include <inttypes.h>
 
@@ -11344,6 +11345,25 @@ void LAPACK_zlauum_base(
 void LAPACK_ilaver(
     lapack_int* vers_major, lapack_int* vers_minor, lapack_int* vers_patch );
 
+#define LAPACK_ilaenvtab_base LAPACK_GLOBAL_SUFFIX(ilaenvtab,ILAENVTAB)
+void LAPACK_ilaenvtab_base(
+    char const* job,
+    lapack_int const* ispec,
+    char const* name,
+    lapack_int* value,
+    lapack_int* info
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+/* name is a routine or file name of any length */
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define LAPACK_ilaenvtab(job, ispec, name, value, info) \
+        LAPACK_ilaenvtab_base(job, ispec, name, value, info, 1, strlen(name))
+#else
+    #define LAPACK_ilaenvtab(...) LAPACK_ilaenvtab_base(__VA_ARGS__)
+#endif
+
 #define LAPACK_dopgtr_base LAPACK_GLOBAL_SUFFIX(dopgtr,DOPGTR)
 void LAPACK_dopgtr_base(
     char const* uplo,
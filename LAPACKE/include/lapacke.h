@@ -12892,10 +12892,179 @@ lapack_int LAPACKE_zunhr_col_work( int matrix_layout, lapack_int m, lapack_int n
                                    lapack_int lda, lapack_complex_double* t,
                                    lapack_int ldt, lapack_complex_double* d );
 
+/* Batched routines.  Matrix k of a batch of batch_size matrices starts at
+ * a + k*stridea, and likewise for ipiv, tau and b; info[k] is the INFO of
+ * matrix k.  The arguments are checked once for the whole batch, and the
+ * return value is 0 or minus the position of an invalid argument.  In
+ * ?getrs and ?potrs, stridea (and strideipiv) may be 0 to solve with the
+ * same factorization for every block of right-hand sides. */
+lapack_int LAPACKE_sgetrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, float* a, lapack_int lda,
+                                         lapack_int stridea, lapack_int* ipiv,
+                                         lapack_int strideipiv,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_dgetrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_int* ipiv,
+                                         lapack_int strideipiv,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_cgetrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, lapack_complex_float* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_int* ipiv,
+                                         lapack_int strideipiv,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_zgetrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, lapack_complex_double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_int* ipiv,
+                                         lapack_int strideipiv,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_sgetrs_batch_strided( int matrix_layout, char trans,
+                                         lapack_int n, lapack_int nrhs,
+                                         const float* a, lapack_int lda,
+                                         lapack_int stridea,
+                                         const lapack_int* ipiv,
+                                         lapack_int strideipiv, float* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_dgetrs_batch_strided( int matrix_layout, char trans,
+                                         lapack_int n, lapack_int nrhs,
+                                         const double* a, lapack_int lda,
+                                         lapack_int stridea,
+                                         const lapack_int* ipiv,
+                                         lapack_int strideipiv, double* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_cgetrs_batch_strided( int matrix_layout, char trans,
+                                         lapack_int n, lapack_int nrhs,
+                                         const lapack_complex_float* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         const lapack_int* ipiv,
+                                         lapack_int strideipiv,
+                                         lapack_complex_float* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_zgetrs_batch_strided( int matrix_layout, char trans,
+                                         lapack_int n, lapack_int nrhs,
+                                         const lapack_complex_double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         const lapack_int* ipiv,
+                                         lapack_int strideipiv,
+                                         lapack_complex_double* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_spotrf_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, float* a, lapack_int lda,
+                                         lapack_int stridea,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_dpotrf_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_cpotrf_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, lapack_complex_float* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_zpotrf_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, lapack_complex_double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_int batch_size,
+                                         lapack_int* info );
+lapack_int LAPACKE_spotrs_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, lapack_int nrhs,
+                                         const float* a, lapack_int lda,
+                                         lapack_int stridea, float* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_dpotrs_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, lapack_int nrhs,
+                                         const double* a, lapack_int lda,
+                                         lapack_int stridea, double* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_cpotrs_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, lapack_int nrhs,
+                                         const lapack_complex_float* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_complex_float* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_zpotrs_batch_strided( int matrix_layout, char uplo,
+                                         lapack_int n, lapack_int nrhs,
+                                         const lapack_complex_double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_complex_double* b,
+                                         lapack_int ldb, lapack_int strideb,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_sgeqrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, float* a, lapack_int lda,
+                                         lapack_int stridea, float* tau,
+                                         lapack_int stridetau,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_dgeqrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         double* tau, lapack_int stridetau,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_cgeqrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, lapack_complex_float* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_complex_float* tau,
+                                         lapack_int stridetau,
+                                         lapack_int batch_size );
+lapack_int LAPACKE_zgeqrf_batch_strided( int matrix_layout, lapack_int m,
+                                         lapack_int n, lapack_complex_double* a,
+                                         lapack_int lda, lapack_int stridea,
+                                         lapack_complex_double* tau,
+                                         lapack_int stridetau,
+                                         lapack_int batch_size );
+
 /* APIs for set/get nancheck flags */
 void LAPACKE_set_nancheck( int flag );
 int LAPACKE_get_nancheck( void );
 
+/* APIs for the workspace allocator */
+typedef void* (*lapacke_malloc_fn)( size_t size, size_t alignment,
+                                    void* context );
+typedef void (*lapacke_free_fn)( void* p, void* context );
+
+typedef struct {
+    size_t count;      /* number of workspace allocations */
+    size_t bytes;      /* bytes allocated in total */
+    size_t in_use;     /* bytes allocated and not freed yet */
+    size_t peak;       /* largest value of in_use */
+    size_t arena;      /* size of the workspace arena */
+} lapacke_workspace_stats;
+
+void* LAPACKE_workspace_malloc( size_t size );
+void LAPACKE_workspace_free( void* p );
+void LAPACKE_set_workspace_allocator( lapacke_malloc_fn malloc_fn,
+                                      lapacke_free_fn free_fn,
+                                      size_t alignment, void* context );
+void LAPACKE_set_workspace_arena( int flag );
+int LAPACKE_get_workspace_arena( void );
+void LAPACKE_release_workspace_arena( void );
+void LAPACKE_get_workspace_stats( lapacke_workspace_stats* stats );
+void LAPACKE_reset_workspace_stats( void );
+
+/* APIs for the tuning table of ILAENV */
+lapack_int LAPACKE_ilaenv_get( lapack_int ispec, const char* name );
+lapack_int LAPACKE_ilaenv_set( lapack_int ispec, const char* name,
+                               lapack_int value );
+lapack_int LAPACKE_ilaenv_unset( lapack_int ispec, const char* name );
+void LAPACKE_ilaenv_reset( void );
+lapack_int LAPACKE_ilaenv_load( const char* file );
+lapack_int LAPACKE_ilaenv_save( const char* file );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
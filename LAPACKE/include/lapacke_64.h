@@ -12859,6 +12859,133 @@ int64_t LAPACKE_zunhr_col_work_64( int matrix_layout, int64_t m, int64_t n,
                                    int64_t lda, lapack_complex_double* t,
                                    int64_t ldt, lapack_complex_double* d );
 
+/* Batched routines.  Matrix k of a batch of batch_size matrices starts at
+ * a + k*stridea, and likewise for ipiv, tau and b; info[k] is the INFO of
+ * matrix k.  The arguments are checked once for the whole batch, and the
+ * return value is 0 or minus the position of an invalid argument.  In
+ * ?getrs and ?potrs, stridea (and strideipiv) may be 0 to solve with the
+ * same factorization for every block of right-hand sides. */
+int64_t LAPACKE_sgetrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, float* a, int64_t lda,
+                                         int64_t stridea, int64_t* ipiv,
+                                         int64_t strideipiv, int64_t batch_size,
+                                         int64_t* info );
+int64_t LAPACKE_dgetrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, double* a, int64_t lda,
+                                         int64_t stridea, int64_t* ipiv,
+                                         int64_t strideipiv, int64_t batch_size,
+                                         int64_t* info );
+int64_t LAPACKE_cgetrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, lapack_complex_float* a,
+                                         int64_t lda, int64_t stridea,
+                                         int64_t* ipiv, int64_t strideipiv,
+                                         int64_t batch_size, int64_t* info );
+int64_t LAPACKE_zgetrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, lapack_complex_double* a,
+                                         int64_t lda, int64_t stridea,
+                                         int64_t* ipiv, int64_t strideipiv,
+                                         int64_t batch_size, int64_t* info );
+int64_t LAPACKE_sgetrs_batch_strided_64( int matrix_layout, char trans,
+                                         int64_t n, int64_t nrhs,
+                                         const float* a, int64_t lda,
+                                         int64_t stridea, const int64_t* ipiv,
+                                         int64_t strideipiv, float* b,
+                                         int64_t ldb, int64_t strideb,
+                                         int64_t batch_size );
+int64_t LAPACKE_dgetrs_batch_strided_64( int matrix_layout, char trans,
+                                         int64_t n, int64_t nrhs,
+                                         const double* a, int64_t lda,
+                                         int64_t stridea, const int64_t* ipiv,
+                                         int64_t strideipiv, double* b,
+                                         int64_t ldb, int64_t strideb,
+                                         int64_t batch_size );
+int64_t LAPACKE_cgetrs_batch_strided_64( int matrix_layout, char trans,
+                                         int64_t n, int64_t nrhs,
+                                         const lapack_complex_float* a,
+                                         int64_t lda, int64_t stridea,
+                                         const int64_t* ipiv,
+                                         int64_t strideipiv,
+                                         lapack_complex_float* b, int64_t ldb,
+                                         int64_t strideb, int64_t batch_size );
+int64_t LAPACKE_zgetrs_batch_strided_64( int matrix_layout, char trans,
+                                         int64_t n, int64_t nrhs,
+                                         const lapack_complex_double* a,
+                                         int64_t lda, int64_t stridea,
+                                         const int64_t* ipiv,
+                                         int64_t strideipiv,
+                                         lapack_complex_double* b, int64_t ldb,
+                                         int64_t strideb, int64_t batch_size );
+int64_t LAPACKE_spotrf_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, float* a, int64_t lda,
+                                         int64_t stridea, int64_t batch_size,
+                                         int64_t* info );
+int64_t LAPACKE_dpotrf_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, double* a, int64_t lda,
+                                         int64_t stridea, int64_t batch_size,
+                                         int64_t* info );
+int64_t LAPACKE_cpotrf_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, lapack_complex_float* a,
+                                         int64_t lda, int64_t stridea,
+                                         int64_t batch_size, int64_t* info );
+int64_t LAPACKE_zpotrf_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, lapack_complex_double* a,
+                                         int64_t lda, int64_t stridea,
+                                         int64_t batch_size, int64_t* info );
+int64_t LAPACKE_spotrs_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, int64_t nrhs,
+                                         const float* a, int64_t lda,
+                                         int64_t stridea, float* b, int64_t ldb,
+                                         int64_t strideb, int64_t batch_size );
+int64_t LAPACKE_dpotrs_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, int64_t nrhs,
+                                         const double* a, int64_t lda,
+                                         int64_t stridea, double* b,
+                                         int64_t ldb, int64_t strideb,
+                                         int64_t batch_size );
+int64_t LAPACKE_cpotrs_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, int64_t nrhs,
+                                         const lapack_complex_float* a,
+                                         int64_t lda, int64_t stridea,
+                                         lapack_complex_float* b, int64_t ldb,
+                                         int64_t strideb, int64_t batch_size );
+int64_t LAPACKE_zpotrs_batch_strided_64( int matrix_layout, char uplo,
+                                         int64_t n, int64_t nrhs,
+                                         const lapack_complex_double* a,
+                                         int64_t lda, int64_t stridea,
+                                         lapack_complex_double* b, int64_t ldb,
+                                         int64_t strideb, int64_t batch_size );
+int64_t LAPACKE_sgeqrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, float* a, int64_t lda,
+                                         int64_t stridea, float* tau,
+                                         int64_t stridetau,
+                                         int64_t batch_size );
+int64_t LAPACKE_dgeqrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, double* a, int64_t lda,
+                                         int64_t stridea, double* tau,
+                                         int64_t stridetau,
+                                         int64_t batch_size );
+int64_t LAPACKE_cgeqrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, lapack_complex_float* a,
+                                         int64_t lda, int64_t stridea,
+                                         lapack_complex_float* tau,
+                                         int64_t stridetau,
+                                         int64_t batch_size );
+int64_t LAPACKE_zgeqrf_batch_strided_64( int matrix_layout, int64_t m,
+                                         int64_t n, lapack_complex_double* a,
+                                         int64_t lda, int64_t stridea,
+                                         lapack_complex_double* tau,
+                                         int64_t stridetau,
+                                         int64_t batch_size );
+
+/* APIs for the tuning table of ILAENV */
+int64_t LAPACKE_ilaenv_get_64( int64_t ispec, const char* name );
+int64_t LAPACKE_ilaenv_set_64( int64_t ispec, const char* name,
+                               int64_t value );
+int64_t LAPACKE_ilaenv_unset_64( int64_t ispec, const char* name );
+void LAPACKE_ilaenv_reset_64( void );
+int64_t LAPACKE_ilaenv_load_64( const char* file );
+int64_t LAPACKE_ilaenv_save_64( const char* file );
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,252 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************
+* Contents: Prototypes of the BLAS routines called by the row-major paths of
+*           the LAPACKE utility functions. This header is not installed.
+*****************************************************************************/
+
+#ifndef _LAPACKE_BLAS_H_
+#define _LAPACKE_BLAS_H_
+
+#include "lapack.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define BLAS_get_num_threads_base LAPACK_GLOBAL_SUFFIX(blas_get_num_threads,BLAS_GET_NUM_THREADS)
+lapack_int BLAS_get_num_threads_base( void );
+#define BLAS_get_num_threads() BLAS_get_num_threads_base()
+
+#define BLAS_isamax_base LAPACK_GLOBAL_SUFFIX(isamax,ISAMAX)
+lapack_int BLAS_isamax_base(
+    lapack_int const* n, float const* x, lapack_int const* incx );
+#define BLAS_isamax(...) BLAS_isamax_base(__VA_ARGS__)
+
+#define BLAS_sswap_base LAPACK_GLOBAL_SUFFIX(sswap,SSWAP)
+void BLAS_sswap_base(
+    lapack_int const* n, float* x, lapack_int const* incx,
+    float* y, lapack_int const* incy );
+#define BLAS_sswap(...) BLAS_sswap_base(__VA_ARGS__)
+
+#define BLAS_sscal_base LAPACK_GLOBAL_SUFFIX(sscal,SSCAL)
+void BLAS_sscal_base(
+    lapack_int const* n, float const* alpha, float* x, lapack_int const* incx );
+#define BLAS_sscal(...) BLAS_sscal_base(__VA_ARGS__)
+
+#define BLAS_sgemm_base LAPACK_GLOBAL_SUFFIX(sgemm,SGEMM)
+void BLAS_sgemm_base(
+    char const* transa, char const* transb,
+    lapack_int const* m, lapack_int const* n, lapack_int const* k,
+    float const* alpha, float const* A, lapack_int const* lda,
+    float const* B, lapack_int const* ldb,
+    float const* beta, float* C, lapack_int const* ldc
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_sgemm(...) BLAS_sgemm_base(__VA_ARGS__, 1, 1)
+#else
+    #define BLAS_sgemm(...) BLAS_sgemm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_strsm_base LAPACK_GLOBAL_SUFFIX(strsm,STRSM)
+void BLAS_strsm_base(
+    char const* side, char const* uplo, char const* transa, char const* diag,
+    lapack_int const* m, lapack_int const* n,
+    float const* alpha, float const* A, lapack_int const* lda,
+    float* B, lapack_int const* ldb
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_strsm(...) BLAS_strsm_base(__VA_ARGS__, 1, 1, 1, 1)
+#else
+    #define BLAS_strsm(...) BLAS_strsm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_idamax_base LAPACK_GLOBAL_SUFFIX(idamax,IDAMAX)
+lapack_int BLAS_idamax_base(
+    lapack_int const* n, double const* x, lapack_int const* incx );
+#define BLAS_idamax(...) BLAS_idamax_base(__VA_ARGS__)
+
+#define BLAS_dswap_base LAPACK_GLOBAL_SUFFIX(dswap,DSWAP)
+void BLAS_dswap_base(
+    lapack_int const* n, double* x, lapack_int const* incx,
+    double* y, lapack_int const* incy );
+#define BLAS_dswap(...) BLAS_dswap_base(__VA_ARGS__)
+
+#define BLAS_dscal_base LAPACK_GLOBAL_SUFFIX(dscal,DSCAL)
+void BLAS_dscal_base(
+    lapack_int const* n, double const* alpha, double* x, lapack_int const* incx );
+#define BLAS_dscal(...) BLAS_dscal_base(__VA_ARGS__)
+
+#define BLAS_dgemm_base LAPACK_GLOBAL_SUFFIX(dgemm,DGEMM)
+void BLAS_dgemm_base(
+    char const* transa, char const* transb,
+    lapack_int const* m, lapack_int const* n, lapack_int const* k,
+    double const* alpha, double const* A, lapack_int const* lda,
+    double const* B, lapack_int const* ldb,
+    double const* beta, double* C, lapack_int const* ldc
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_dgemm(...) BLAS_dgemm_base(__VA_ARGS__, 1, 1)
+#else
+    #define BLAS_dgemm(...) BLAS_dgemm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_dtrsm_base LAPACK_GLOBAL_SUFFIX(dtrsm,DTRSM)
+void BLAS_dtrsm_base(
+    char const* side, char const* uplo, char const* transa, char const* diag,
+    lapack_int const* m, lapack_int const* n,
+    double const* alpha, double const* A, lapack_int const* lda,
+    double* B, lapack_int const* ldb
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_dtrsm(...) BLAS_dtrsm_base(__VA_ARGS__, 1, 1, 1, 1)
+#else
+    #define BLAS_dtrsm(...) BLAS_dtrsm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_icamax_base LAPACK_GLOBAL_SUFFIX(icamax,ICAMAX)
+lapack_int BLAS_icamax_base(
+    lapack_int const* n, lapack_complex_float const* x, lapack_int const* incx );
+#define BLAS_icamax(...) BLAS_icamax_base(__VA_ARGS__)
+
+#define BLAS_cswap_base LAPACK_GLOBAL_SUFFIX(cswap,CSWAP)
+void BLAS_cswap_base(
+    lapack_int const* n, lapack_complex_float* x, lapack_int const* incx,
+    lapack_complex_float* y, lapack_int const* incy );
+#define BLAS_cswap(...) BLAS_cswap_base(__VA_ARGS__)
+
+#define BLAS_cscal_base LAPACK_GLOBAL_SUFFIX(cscal,CSCAL)
+void BLAS_cscal_base(
+    lapack_int const* n, lapack_complex_float const* alpha,
+    lapack_complex_float* x, lapack_int const* incx );
+#define BLAS_cscal(...) BLAS_cscal_base(__VA_ARGS__)
+
+#define BLAS_cgemm_base LAPACK_GLOBAL_SUFFIX(cgemm,CGEMM)
+void BLAS_cgemm_base(
+    char const* transa, char const* transb,
+    lapack_int const* m, lapack_int const* n, lapack_int const* k,
+    lapack_complex_float const* alpha,
+    lapack_complex_float const* A, lapack_int const* lda,
+    lapack_complex_float const* B, lapack_int const* ldb,
+    lapack_complex_float const* beta, lapack_complex_float* C, lapack_int const* ldc
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_cgemm(...) BLAS_cgemm_base(__VA_ARGS__, 1, 1)
+#else
+    #define BLAS_cgemm(...) BLAS_cgemm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_ctrsm_base LAPACK_GLOBAL_SUFFIX(ctrsm,CTRSM)
+void BLAS_ctrsm_base(
+    char const* side, char const* uplo, char const* transa, char const* diag,
+    lapack_int const* m, lapack_int const* n,
+    lapack_complex_float const* alpha,
+    lapack_complex_float const* A, lapack_int const* lda,
+    lapack_complex_float* B, lapack_int const* ldb
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_ctrsm(...) BLAS_ctrsm_base(__VA_ARGS__, 1, 1, 1, 1)
+#else
+    #define BLAS_ctrsm(...) BLAS_ctrsm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_izamax_base LAPACK_GLOBAL_SUFFIX(izamax,IZAMAX)
+lapack_int BLAS_izamax_base(
+    lapack_int const* n, lapack_complex_double const* x, lapack_int const* incx );
+#define BLAS_izamax(...) BLAS_izamax_base(__VA_ARGS__)
+
+#define BLAS_zswap_base LAPACK_GLOBAL_SUFFIX(zswap,ZSWAP)
+void BLAS_zswap_base(
+    lapack_int const* n, lapack_complex_double* x, lapack_int const* incx,
+    lapack_complex_double* y, lapack_int const* incy );
+#define BLAS_zswap(...) BLAS_zswap_base(__VA_ARGS__)
+
+#define BLAS_zscal_base LAPACK_GLOBAL_SUFFIX(zscal,ZSCAL)
+void BLAS_zscal_base(
+    lapack_int const* n, lapack_complex_double const* alpha,
+    lapack_complex_double* x, lapack_int const* incx );
+#define BLAS_zscal(...) BLAS_zscal_base(__VA_ARGS__)
+
+#define BLAS_zgemm_base LAPACK_GLOBAL_SUFFIX(zgemm,ZGEMM)
+void BLAS_zgemm_base(
+    char const* transa, char const* transb,
+    lapack_int const* m, lapack_int const* n, lapack_int const* k,
+    lapack_complex_double const* alpha,
+    lapack_complex_double const* A, lapack_int const* lda,
+    lapack_complex_double const* B, lapack_int const* ldb,
+    lapack_complex_double const* beta, lapack_complex_double* C, lapack_int const* ldc
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_zgemm(...) BLAS_zgemm_base(__VA_ARGS__, 1, 1)
+#else
+    #define BLAS_zgemm(...) BLAS_zgemm_base(__VA_ARGS__)
+#endif
+
+#define BLAS_ztrsm_base LAPACK_GLOBAL_SUFFIX(ztrsm,ZTRSM)
+void BLAS_ztrsm_base(
+    char const* side, char const* uplo, char const* transa, char const* diag,
+    lapack_int const* m, lapack_int const* n,
+    lapack_complex_double const* alpha,
+    lapack_complex_double const* A, lapack_int const* lda,
+    lapack_complex_double* B, lapack_int const* ldb
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    , FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN, FORTRAN_STRLEN
+#endif
+);
+#ifdef LAPACK_FORTRAN_STRLEN_END
+    #define BLAS_ztrsm(...) BLAS_ztrsm_base(__VA_ARGS__, 1, 1, 1, 1)
+#else
+    #define BLAS_ztrsm(...) BLAS_ztrsm_base(__VA_ARGS__)
+#endif
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif  /* _LAPACKE_BLAS_H_ */
@@ -33,6 +33,18 @@
 #ifndef _LAPACKE_UTILS_H_
 #define _LAPACKE_UTILS_H_
 
+/* The workspace of the LAPACKE functions is allocated with
+ * LAPACKE_work_malloc and released with LAPACKE_work_free.  These are
+ * LAPACKE_workspace_malloc and LAPACKE_workspace_free, unless
+ * LAPACKE_malloc and LAPACKE_free are defined when LAPACKE is compiled */
+#if defined(LAPACKE_malloc) && defined(LAPACKE_free)
+#define LAPACKE_work_malloc( size ) LAPACKE_malloc( size )
+#define LAPACKE_work_free( p )      LAPACKE_free( p )
+#else
+#define LAPACKE_work_malloc( size ) LAPACKE_workspace_malloc( size )
+#define LAPACKE_work_free( p )      LAPACKE_workspace_free( p )
+#endif
+
 #include "lapacke.h"
 
 #ifdef __cplusplus
@@ -301,6 +313,97 @@ void API_SUFFIX(LAPACKE_ztz_trans)( int matrix_layout, char direct, char uplo,
                         const lapack_complex_double *in, lapack_int ldin,
                         lapack_complex_double *out, lapack_int ldout );
 
+/* In-place transpose of a square matrix */
+void API_SUFFIX(LAPACKE_cge_trans_inplace)( lapack_int n, lapack_complex_float* a,
+                        lapack_int lda );
+void API_SUFFIX(LAPACKE_dge_trans_inplace)( lapack_int n, double* a,
+                        lapack_int lda );
+void API_SUFFIX(LAPACKE_sge_trans_inplace)( lapack_int n, float* a,
+                        lapack_int lda );
+void API_SUFFIX(LAPACKE_zge_trans_inplace)( lapack_int n, lapack_complex_double* a,
+                        lapack_int lda );
+
+/* In-place solvers on row-major arrays, used by the row-major paths of the
+ * drivers instead of transposed copies */
+lapack_int API_SUFFIX(LAPACKE_cgels_rowmajor)( char trans, lapack_int m,
+                        lapack_int n, lapack_int nrhs, lapack_complex_float* a,
+                        lapack_int lda, lapack_complex_float* b, lapack_int ldb,
+                        lapack_complex_float* work, lapack_int lwork );
+lapack_int API_SUFFIX(LAPACKE_cgetrf_rowmajor)( lapack_int m, lapack_int n,
+                        lapack_complex_float* a, lapack_int lda, lapack_int* ipiv );
+void API_SUFFIX(LAPACKE_cgetrs_rowmajor)( char trans, lapack_int n, lapack_int nrhs,
+                        const lapack_complex_float* a, lapack_int lda,
+                        const lapack_int* ipiv, lapack_complex_float* b, lapack_int ldb );
+void API_SUFFIX(LAPACKE_cpotrs_rowmajor)( char uplo, lapack_int n, lapack_int nrhs,
+                        const lapack_complex_float* a, lapack_int lda, lapack_complex_float* b,
+                        lapack_int ldb );
+lapack_int API_SUFFIX(LAPACKE_dgels_rowmajor)( char trans, lapack_int m,
+                        lapack_int n, lapack_int nrhs, double* a,
+                        lapack_int lda, double* b, lapack_int ldb,
+                        double* work, lapack_int lwork );
+lapack_int API_SUFFIX(LAPACKE_dgetrf_rowmajor)( lapack_int m, lapack_int n,
+                        double* a, lapack_int lda, lapack_int* ipiv );
+void API_SUFFIX(LAPACKE_dgetrs_rowmajor)( char trans, lapack_int n, lapack_int nrhs,
+                        const double* a, lapack_int lda,
+                        const lapack_int* ipiv, double* b, lapack_int ldb );
+void API_SUFFIX(LAPACKE_dpotrs_rowmajor)( char uplo, lapack_int n, lapack_int nrhs,
+                        const double* a, lapack_int lda, double* b,
+                        lapack_int ldb );
+lapack_int API_SUFFIX(LAPACKE_sgels_rowmajor)( char trans, lapack_int m,
+                        lapack_int n, lapack_int nrhs, float* a,
+                        lapack_int lda, float* b, lapack_int ldb,
+                        float* work, lapack_int lwork );
+lapack_int API_SUFFIX(LAPACKE_sgetrf_rowmajor)( lapack_int m, lapack_int n,
+                        float* a, lapack_int lda, lapack_int* ipiv );
+void API_SUFFIX(LAPACKE_sgetrs_rowmajor)( char trans, lapack_int n, lapack_int nrhs,
+                        const float* a, lapack_int lda,
+                        const lapack_int* ipiv, float* b, lapack_int ldb );
+void API_SUFFIX(LAPACKE_spotrs_rowmajor)( char uplo, lapack_int n, lapack_int nrhs,
+                        const float* a, lapack_int lda, float* b,
+                        lapack_int ldb );
+lapack_int API_SUFFIX(LAPACKE_zgels_rowmajor)( char trans, lapack_int m,
+                        lapack_int n, lapack_int nrhs, lapack_complex_double* a,
+                        lapack_int lda, lapack_complex_double* b, lapack_int ldb,
+                        lapack_complex_double* work, lapack_int lwork );
+lapack_int API_SUFFIX(LAPACKE_zgetrf_rowmajor)( lapack_int m, lapack_int n,
+                        lapack_complex_double* a, lapack_int lda, lapack_int* ipiv );
+void API_SUFFIX(LAPACKE_zgetrs_rowmajor)( char trans, lapack_int n, lapack_int nrhs,
+                        const lapack_complex_double* a, lapack_int lda,
+                        const lapack_int* ipiv, lapack_complex_double* b, lapack_int ldb );
+void API_SUFFIX(LAPACKE_zpotrs_rowmajor)( char uplo, lapack_int n, lapack_int nrhs,
+                        const lapack_complex_double* a, lapack_int lda, lapack_complex_double* b,
+                        lapack_int ldb );
+
+/* Batched routines.  Batches of real matrices of order at most
+ * LAPACKE_BATCH_NMAX are factored LAPACKE_BATCH_?LANES at a time in an
+ * interleaved copy, element (i,j) of matrix l at w[(i+j*m)*nl+l], so that
+ * the innermost loops run across the matrices.  A batch is shared among
+ * threads by chunks of at least LAPACKE_BATCH_MINWORK flops. */
+#ifndef LAPACKE_BATCH_NMAX
+#define LAPACKE_BATCH_NMAX 24
+#endif
+#define LAPACKE_BATCH_SLANES 16
+#define LAPACKE_BATCH_DLANES 8
+#ifndef LAPACKE_BATCH_MINWORK
+#define LAPACKE_BATCH_MINWORK 2.0e5
+#endif
+
+lapack_int API_SUFFIX(LAPACKE_batch_threads)( lapack_int count, double work );
+void API_SUFFIX(LAPACKE_dge_interleave)( lapack_int m, lapack_int n,
+                        const double* a, lapack_int rs, lapack_int cs,
+                        lapack_int nl, lapack_int l, double* w );
+void API_SUFFIX(LAPACKE_dge_deinterleave)( char uplo, lapack_int m,
+                        lapack_int n, lapack_int nl, lapack_int l,
+                        const double* w, double* a, lapack_int rs,
+                        lapack_int cs );
+void API_SUFFIX(LAPACKE_sge_interleave)( lapack_int m, lapack_int n,
+                        const float* a, lapack_int rs, lapack_int cs,
+                        lapack_int nl, lapack_int l, float* w );
+void API_SUFFIX(LAPACKE_sge_deinterleave)( char uplo, lapack_int m,
+                        lapack_int n, lapack_int nl, lapack_int l,
+                        const float* w, float* a, lapack_int rs,
+                        lapack_int cs );
+
 /* NaN checkers */
 #define LAPACK_SISNAN( x ) ( x != x )
 #define LAPACK_DISNAN( x ) ( x != x )
@@ -97,7 +97,7 @@ lapack_int API_SUFFIX(LAPACKE_cbbcsd)( int matrix_layout, char jobu1, char jobu2
     }
     lrwork = (lapack_int)rwork_query;
     /* Allocate memory for work arrays */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * lrwork );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -108,7 +108,7 @@ lapack_int API_SUFFIX(LAPACKE_cbbcsd)( int matrix_layout, char jobu1, char jobu2
                                 v1t, ldv1t, v2t, ldv2t, b11d, b11e, b12d, b12e,
                                 b21d, b21e, b22d, b22e, rwork, lrwork );
     /* Release memory and exit */
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cbbcsd", info );
@@ -61,13 +61,13 @@ lapack_int API_SUFFIX(LAPACKE_cgbbrd)( int matrix_layout, char vect, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,MAX(m,n)) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,MAX(m,n)) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,MAX(m,n)) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,MAX(m,n)) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -76,9 +76,9 @@ lapack_int API_SUFFIX(LAPACKE_cgbbrd)( int matrix_layout, char vect, lapack_int
     info = API_SUFFIX(LAPACKE_cgbbrd_work)( matrix_layout, vect, m, n, ncc, kl, ku, ab, ldab,
                                 d, e, q, ldq, pt, ldpt, c, ldc, work, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgbbrd", info );
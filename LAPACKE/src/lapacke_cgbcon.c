@@ -56,13 +56,13 @@ lapack_int API_SUFFIX(LAPACKE_cgbcon)( int matrix_layout, char norm, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -71,9 +71,9 @@ lapack_int API_SUFFIX(LAPACKE_cgbcon)( int matrix_layout, char norm, lapack_int
     info = API_SUFFIX(LAPACKE_cgbcon_work)( matrix_layout, norm, n, kl, ku, ab, ldab, ipiv,
                                 anorm, rcond, work, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgbcon", info );
@@ -57,7 +57,7 @@ lapack_int API_SUFFIX(LAPACKE_cgbequ_work)( int matrix_layout, lapack_int m, lap
         }
         /* Allocate memory for temporary array(s) */
         ab_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_cgbequ_work)( int matrix_layout, lapack_int m, lap
             info = info - 1;
         }
         /* Release memory and exit */
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgbequ_work", info );
@@ -82,26 +82,26 @@ lapack_int API_SUFFIX(LAPACKE_cgbrfs_work)( int matrix_layout, char trans, lapac
         }
         /* Allocate memory for temporary array(s) */
         ab_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         afb_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldafb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldafb_t * MAX(1,n) );
         if( afb_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldb_t * MAX(1,nrhs) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
         x_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldx_t * MAX(1,nrhs) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -123,13 +123,13 @@ lapack_int API_SUFFIX(LAPACKE_cgbrfs_work)( int matrix_layout, char trans, lapac
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, n, nrhs, x_t, ldx_t, x, ldx );
         /* Release memory and exit */
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_3:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_2:
-        LAPACKE_free( afb_t );
+        LAPACKE_work_free( afb_t );
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgbrfs_work", info );
@@ -84,13 +84,13 @@ lapack_int API_SUFFIX(LAPACKE_cgbrfsx)( int matrix_layout, char trans, char eque
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,3*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,3*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -101,9 +101,9 @@ lapack_int API_SUFFIX(LAPACKE_cgbrfsx)( int matrix_layout, char trans, char eque
                                  ldx, rcond, berr, n_err_bnds, err_bnds_norm,
                                  err_bnds_comp, nparams, params, work, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgbrfsx", info );
@@ -55,7 +55,7 @@ lapack_int API_SUFFIX(LAPACKE_cgebak_work)( int matrix_layout, char job, char si
         }
         /* Allocate memory for temporary array(s) */
         v_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,m) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,m) );
         if( v_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_cgebak_work)( int matrix_layout, char job, char si
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, n, m, v_t, ldv_t, v, ldv );
         /* Release memory and exit */
-        LAPACKE_free( v_t );
+        LAPACKE_work_free( v_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgebak_work", info );
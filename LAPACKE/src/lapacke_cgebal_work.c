@@ -56,7 +56,7 @@ lapack_int API_SUFFIX(LAPACKE_cgebal_work)( int matrix_layout, char job, lapack_
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'p' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 's' ) ) {
             a_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 lda_t * MAX(1,n) );
             if( a_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -81,7 +81,7 @@ lapack_int API_SUFFIX(LAPACKE_cgebal_work)( int matrix_layout, char job, lapack_
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'p' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 's' ) ) {
-            LAPACKE_free( a_t );
+            LAPACKE_work_free( a_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -55,7 +55,7 @@ lapack_int API_SUFFIX(LAPACKE_cgecon_work)( int matrix_layout, char norm, lapack
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_cgecon_work)( int matrix_layout, char norm, lapack
             info = info - 1;
         }
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgecon_work", info );
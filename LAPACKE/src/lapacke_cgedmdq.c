@@ -98,17 +98,17 @@ lapack_int API_SUFFIX(LAPACKE_cgedmdq)( int matrix_layout, char jobs, char jobz,
     lwork  = LAPACK_C2INT( work_query );
     liwork = iwork_query;
     /* Allocate memory for work arrays */
-    zwork  = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * lzwork );
+    zwork  = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * lzwork );
     if( zwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work  = (float*)LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+    work  = (float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -120,11 +120,11 @@ lapack_int API_SUFFIX(LAPACKE_cgedmdq)( int matrix_layout, char jobs, char jobz,
                                  b, ldb, v, ldv, s, lds, zwork, lzwork,
 				 work, lwork, iwork, liwork );
     /* Release memory and exit */
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_2:
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( zwork );
+    LAPACKE_work_free( zwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgedmdq", info );
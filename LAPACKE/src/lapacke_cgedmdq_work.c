@@ -120,37 +120,37 @@ lapack_int API_SUFFIX(LAPACKE_cgedmdq_work)( int matrix_layout, char jobs, char
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        f_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ldf_t * MAX(1,n) );
+        f_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldf_t * MAX(1,n) );
         if( f_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        x_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ldx_t * MAX(1,n) );
+        x_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldx_t * MAX(1,n) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
-        y_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ldy_t * MAX(1,n) );
+        y_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldy_t * MAX(1,n) );
         if( y_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
-        z_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ldz_t * MAX(1,n) );
+        z_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldz_t * MAX(1,n) );
         if( z_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_3;
         }
-        b_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
+        b_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_4;
         }
-        v_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,n) );
+        v_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,n) );
         if( v_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_5;
         }
-        s_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * lds_t * MAX(1,n) );
+        s_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * lds_t * MAX(1,n) );
         if( s_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_6;
@@ -180,19 +180,19 @@ lapack_int API_SUFFIX(LAPACKE_cgedmdq_work)( int matrix_layout, char jobs, char
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, v_t, ldv_t, v, ldv );
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, s_t, lds_t, s, lds );
         /* Release memory and exit */
-        LAPACKE_free( s_t );
+        LAPACKE_work_free( s_t );
 exit_level_6:
-        LAPACKE_free( v_t );
+        LAPACKE_work_free( v_t );
 exit_level_5:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_4:
-        LAPACKE_free( z_t );
+        LAPACKE_work_free( z_t );
 exit_level_3:
-        LAPACKE_free( y_t );
+        LAPACKE_work_free( y_t );
 exit_level_2:
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_1:
-        LAPACKE_free( f_t );
+        LAPACKE_work_free( f_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgedmdq_work", info );
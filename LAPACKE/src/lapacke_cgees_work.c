@@ -72,14 +72,14 @@ lapack_int API_SUFFIX(LAPACKE_cgees_work)( int matrix_layout, char jobvs, char s
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvs, 'v' ) ) {
             vs_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvs_t * MAX(1,n) );
             if( vs_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -101,10 +101,10 @@ lapack_int API_SUFFIX(LAPACKE_cgees_work)( int matrix_layout, char jobvs, char s
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvs, 'v' ) ) {
-            LAPACKE_free( vs_t );
+            LAPACKE_work_free( vs_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgees_work", info );
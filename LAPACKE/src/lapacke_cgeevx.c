@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeevx)( int matrix_layout, char balanc, char jobv
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeevx)( int matrix_layout, char balanc, char jobv
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -85,9 +85,9 @@ lapack_int API_SUFFIX(LAPACKE_cgeevx)( int matrix_layout, char balanc, char jobv
                                 lda, w, vl, ldvl, vr, ldvr, ilo, ihi, scale,
                                 abnrm, rconde, rcondv, work, lwork, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgeevx", info );
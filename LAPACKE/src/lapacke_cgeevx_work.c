@@ -84,14 +84,14 @@ lapack_int API_SUFFIX(LAPACKE_cgeevx_work)( int matrix_layout, char balanc, char
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvl, 'v' ) ) {
             vl_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvl_t * MAX(1,n) );
             if( vl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -100,7 +100,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeevx_work)( int matrix_layout, char balanc, char
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvr, 'v' ) ) {
             vr_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvr_t * MAX(1,n) );
             if( vr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -126,14 +126,14 @@ lapack_int API_SUFFIX(LAPACKE_cgeevx_work)( int matrix_layout, char balanc, char
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvr, 'v' ) ) {
-            LAPACKE_free( vr_t );
+            LAPACKE_work_free( vr_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( jobvl, 'v' ) ) {
-            LAPACKE_free( vl_t );
+            LAPACKE_work_free( vl_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgeevx_work", info );
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_cgelss)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,5*MIN(m,n)) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,5*MIN(m,n)) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_cgelss)( int matrix_layout, lapack_int m, lapack_i
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -85,9 +85,9 @@ lapack_int API_SUFFIX(LAPACKE_cgelss)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_cgelss_work)( matrix_layout, m, n, nrhs, a, lda, b, ldb, s,
                                 rcond, rank, work, lwork, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgelss", info );
@@ -73,13 +73,13 @@ lapack_int API_SUFFIX(LAPACKE_cgemqr_work)( int matrix_layout, char side, char t
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,k) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,k) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         c_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
@@ -96,9 +96,9 @@ lapack_int API_SUFFIX(LAPACKE_cgemqr_work)( int matrix_layout, char side, char t
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc );
         /* Release memory and exit */
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgemqr_work", info );
@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_cgemqrt)( int matrix_layout, char side, char trans
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,m) * MAX(1,nb) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,m) * MAX(1,nb) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_cgemqrt)( int matrix_layout, char side, char trans
     info = API_SUFFIX(LAPACKE_cgemqrt_work)( matrix_layout, side, trans, m, n, k, nb, v, ldv,
                                  t, ldt, c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgemqrt", info );
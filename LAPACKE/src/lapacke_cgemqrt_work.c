@@ -72,19 +72,19 @@ lapack_int API_SUFFIX(LAPACKE_cgemqrt_work)( int matrix_layout, char side, char
         }
         /* Allocate memory for temporary array(s) */
         v_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,k) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,k) );
         if( v_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         t_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldt_t * MAX(1,nb) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldt_t * MAX(1,nb) );
         if( t_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         c_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
@@ -102,11 +102,11 @@ lapack_int API_SUFFIX(LAPACKE_cgemqrt_work)( int matrix_layout, char side, char
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc );
         /* Release memory and exit */
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_2:
-        LAPACKE_free( t_t );
+        LAPACKE_work_free( t_t );
 exit_level_1:
-        LAPACKE_free( v_t );
+        LAPACKE_work_free( v_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgemqrt_work", info );
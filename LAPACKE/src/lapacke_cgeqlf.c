@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeqlf)( int matrix_layout, lapack_int m, lapack_i
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeqlf)( int matrix_layout, lapack_int m, lapack_i
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_cgeqlf_work)( matrix_layout, m, n, a, lda, tau, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgeqlf", info );
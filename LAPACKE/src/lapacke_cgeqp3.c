@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeqp3)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeqp3)( int matrix_layout, lapack_int m, lapack_i
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -77,9 +77,9 @@ lapack_int API_SUFFIX(LAPACKE_cgeqp3)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_cgeqp3_work)( matrix_layout, m, n, a, lda, jpvt, tau, work,
                                 lwork, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgeqp3", info );
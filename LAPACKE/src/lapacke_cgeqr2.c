@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeqr2)( int matrix_layout, lapack_int m, lapack_i
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_cgeqr2)( int matrix_layout, lapack_int m, lapack_i
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_cgeqr2_work)( matrix_layout, m, n, a, lda, tau, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgeqr2", info );
@@ -65,13 +65,13 @@ lapack_int API_SUFFIX(LAPACKE_cgerfs)( int matrix_layout, char trans, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -80,9 +80,9 @@ lapack_int API_SUFFIX(LAPACKE_cgerfs)( int matrix_layout, char trans, lapack_int
     info = API_SUFFIX(LAPACKE_cgerfs_work)( matrix_layout, trans, n, nrhs, a, lda, af, ldaf,
                                 ipiv, b, ldb, x, ldx, ferr, berr, work, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgerfs", info );
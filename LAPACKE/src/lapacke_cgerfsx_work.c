@@ -90,39 +90,39 @@ lapack_int API_SUFFIX(LAPACKE_cgerfsx_work)( int matrix_layout, char trans, char
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         af_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldaf_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldaf_t * MAX(1,n) );
         if( af_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldb_t * MAX(1,nrhs) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
         x_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldx_t * MAX(1,nrhs) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_3;
         }
         err_bnds_norm_t = (float*)
-            LAPACKE_malloc( sizeof(float) * nrhs * MAX(1,n_err_bnds) );
+            LAPACKE_work_malloc( sizeof(float) * nrhs * MAX(1,n_err_bnds) );
         if( err_bnds_norm_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_4;
         }
         err_bnds_comp_t = (float*)
-            LAPACKE_malloc( sizeof(float) * nrhs * MAX(1,n_err_bnds) );
+            LAPACKE_work_malloc( sizeof(float) * nrhs * MAX(1,n_err_bnds) );
         if( err_bnds_comp_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_5;
@@ -147,17 +147,17 @@ lapack_int API_SUFFIX(LAPACKE_cgerfsx_work)( int matrix_layout, char trans, char
         API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, nrhs, n_err_bnds, err_bnds_comp_t,
                            nrhs, err_bnds_comp, nrhs );
         /* Release memory and exit */
-        LAPACKE_free( err_bnds_comp_t );
+        LAPACKE_work_free( err_bnds_comp_t );
 exit_level_5:
-        LAPACKE_free( err_bnds_norm_t );
+        LAPACKE_work_free( err_bnds_norm_t );
 exit_level_4:
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_3:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_2:
-        LAPACKE_free( af_t );
+        LAPACKE_work_free( af_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgerfsx_work", info );
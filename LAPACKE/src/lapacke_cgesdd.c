@@ -66,12 +66,12 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd)( int matrix_layout, char jobz, lapack_int
     }
     /* Allocate memory for working array(s) */
     iwork = (lapack_int*)
-        LAPACKE_malloc( sizeof(lapack_int) * MAX(1,8*MIN(m,n)) );
+        LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,8*MIN(m,n)) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * lrwork );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -85,7 +85,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd)( int matrix_layout, char jobz, lapack_int
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -94,11 +94,11 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd)( int matrix_layout, char jobz, lapack_int
     info = API_SUFFIX(LAPACKE_cgesdd_work)( matrix_layout, jobz, m, n, a, lda, s, u, ldu, vt,
                                 ldvt, work, lwork, rwork, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgesdd", info );
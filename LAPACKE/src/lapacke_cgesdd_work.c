@@ -91,7 +91,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd_work)( int matrix_layout, char jobz, lapack
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -99,7 +99,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd_work)( int matrix_layout, char jobz, lapack
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m<n) ) ) {
             u_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldu_t * MAX(1,ncols_u) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -109,7 +109,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd_work)( int matrix_layout, char jobz, lapack
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m>=n) ) ) {
             vt_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvt_t * MAX(1,n) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -139,15 +139,15 @@ lapack_int API_SUFFIX(LAPACKE_cgesdd_work)( int matrix_layout, char jobz, lapack
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m>=n) ) ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m<n) ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgesdd_work", info );
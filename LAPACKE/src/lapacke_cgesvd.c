@@ -57,7 +57,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesvd)( int matrix_layout, char jobu, char jobvt,
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,5*MIN(m,n)) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,5*MIN(m,n)) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesvd)( int matrix_layout, char jobu, char jobvt,
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -84,9 +84,9 @@ lapack_int API_SUFFIX(LAPACKE_cgesvd)( int matrix_layout, char jobu, char jobvt,
         superb[i] = rwork[i];
     }
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgesvd", info );
@@ -72,17 +72,17 @@ lapack_int API_SUFFIX(LAPACKE_cgesvdq)( int matrix_layout, char joba, char jobp,
     lcwork = LAPACK_C2INT(cwork_query);
     lrwork = (lapack_int)rwork_query;
     /* Allocate memory for work arrays */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    cwork = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * lcwork );
+    cwork = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * lcwork );
     if( cwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * lrwork );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -93,9 +93,9 @@ lapack_int API_SUFFIX(LAPACKE_cgesvdq)( int matrix_layout, char joba, char jobp,
                                  iwork, liwork, cwork, lcwork, rwork, lrwork );
 
     /* Release memory and exit */
-    LAPACKE_free( iwork );
-    LAPACKE_free( cwork );
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( iwork );
+    LAPACKE_work_free( cwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgesvdq", info );
@@ -90,14 +90,14 @@ lapack_int API_SUFFIX(LAPACKE_cgesvdx_work)( int matrix_layout, char jobu, char
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-          LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+          LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobu, 'v' ) ) {
             u_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) * ldu_t * MAX(1,ncols_u) );
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldu_t * MAX(1,ncols_u) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -105,7 +105,7 @@ lapack_int API_SUFFIX(LAPACKE_cgesvdx_work)( int matrix_layout, char jobu, char
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvt, 'v' ) ) {
             vt_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) * ldvt_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldvt_t * MAX(1,n) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -132,14 +132,14 @@ lapack_int API_SUFFIX(LAPACKE_cgesvdx_work)( int matrix_layout, char jobu, char
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvt, 'v' ) ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( jobu, 'v' ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgesvdx_work", info );
@@ -68,14 +68,14 @@ lapack_int API_SUFFIX(LAPACKE_cgesvj_work)( int matrix_layout, char joba, char j
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-           LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+           LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobv, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ) {
             v_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldv_t * MAX(1,n) );
             if( v_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -100,10 +100,10 @@ lapack_int API_SUFFIX(LAPACKE_cgesvj_work)( int matrix_layout, char joba, char j
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobv, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ) {
-            LAPACKE_free( v_t );
+            LAPACKE_work_free( v_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgesvj_work", info );
@@ -0,0 +1,110 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function cgetrf for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+lapack_int API_SUFFIX(LAPACKE_cgetrf_batch_strided)( int matrix_layout,
+                                  lapack_int m, lapack_int n,
+                                  lapack_complex_float* a, lapack_int lda,
+                                  lapack_int stridea,
+                                  lapack_int* ipiv, lapack_int strideipiv,
+                                  lapack_int batch_size, lapack_int* info )
+{
+    lapack_int k, mn = MIN(m,n);
+    double work;
+#ifdef _OPENMP
+    lapack_int nt;
+#endif
+    if( matrix_layout != LAPACK_COL_MAJOR &&
+        matrix_layout != LAPACK_ROW_MAJOR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch */
+    if( m < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -3 );
+        return -3;
+    }
+    if( lda < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? m : n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -5 );
+        return -5;
+    }
+    if( stridea < lda * ( matrix_layout == LAPACK_COL_MAJOR ? n : m ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -6 );
+        return -6;
+    }
+    if( strideipiv < mn ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -8 );
+        return -8;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrf_batch_strided", -9 );
+        return -9;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( API_SUFFIX(LAPACKE_cge_nancheck)( matrix_layout, m, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -4;
+            }
+        }
+    }
+#endif
+    /* Number of real multiply-adds per matrix */
+    work = 4.0*( (double)m*n*mn - 0.5*(double)(m+n)*mn*mn +
+                 (double)mn*mn*mn/3.0 );
+    /* One matrix at a time by the recursive LU of CGETRF2, which calls
+     * neither ILAENV nor the blocked code */
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+    for( k = 0; k < batch_size; k++ ) {
+        if( matrix_layout == LAPACK_COL_MAJOR ) {
+            LAPACK_cgetrf2( &m, &n, a + (size_t)k*stridea, &lda,
+                            ipiv + (size_t)k*strideipiv, &info[k] );
+        } else {
+            info[k] = API_SUFFIX(LAPACKE_cgetrf_rowmajor)( m, n,
+                        a + (size_t)k*stridea, lda,
+                        ipiv + (size_t)k*strideipiv );
+        }
+    }
+    return 0;
+}
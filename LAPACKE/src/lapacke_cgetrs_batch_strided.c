@@ -0,0 +1,139 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function cgetrs for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+lapack_int API_SUFFIX(LAPACKE_cgetrs_batch_strided)( int matrix_layout,
+                                  char trans, lapack_int n, lapack_int nrhs,
+                                  const lapack_complex_float* a,
+                                  lapack_int lda, lapack_int stridea,
+                                  const lapack_int* ipiv,
+                                  lapack_int strideipiv,
+                                  lapack_complex_float* b, lapack_int ldb,
+                                  lapack_int strideb,
+                                  lapack_int batch_size )
+{
+    lapack_int k;
+    lapack_logical notran;
+    double work;
+#ifdef _OPENMP
+    lapack_int nt;
+#endif
+    if( matrix_layout != LAPACK_COL_MAJOR &&
+        matrix_layout != LAPACK_ROW_MAJOR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch.  A stride of 0 for A
+     * and ipiv uses the same factorization for all right-hand sides. */
+    notran = API_SUFFIX(LAPACKE_lsame)( trans, 'n' );
+    if( !notran && !API_SUFFIX(LAPACKE_lsame)( trans, 't' ) &&
+        !API_SUFFIX(LAPACKE_lsame)( trans, 'c' ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -3 );
+        return -3;
+    }
+    if( nrhs < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -4 );
+        return -4;
+    }
+    if( lda < MAX(1,n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -6 );
+        return -6;
+    }
+    if( stridea != 0 && stridea < lda*n ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -7 );
+        return -7;
+    }
+    if( strideipiv != 0 && strideipiv < n ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -9 );
+        return -9;
+    }
+    if( ldb < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? n : nrhs) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -11 );
+        return -11;
+    }
+    if( strideb < ldb * ( matrix_layout == LAPACK_COL_MAJOR ? nrhs : n ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -12 );
+        return -12;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetrs_batch_strided", -13 );
+        return -13;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( ( k == 0 || stridea != 0 ) &&
+                API_SUFFIX(LAPACKE_cge_nancheck)( matrix_layout, n, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -5;
+            }
+            if( API_SUFFIX(LAPACKE_cge_nancheck)( matrix_layout, n, nrhs,
+                                                  b + (size_t)k*strideb,
+                                                  ldb ) ) {
+                return -10;
+            }
+        }
+    }
+#endif
+    if( n == 0 || nrhs == 0 ) {
+        return 0;
+    }
+    /* Number of real multiply-adds per right-hand side block */
+    work = 4.0*(double)n*n*nrhs;
+    /* One right-hand side block at a time */
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+    for( k = 0; k < batch_size; k++ ) {
+        lapack_int info;
+        if( matrix_layout == LAPACK_COL_MAJOR ) {
+            LAPACK_cgetrs( &trans, &n, &nrhs, a + (size_t)k*stridea, &lda,
+                           ipiv + (size_t)k*strideipiv,
+                           b + (size_t)k*strideb, &ldb, &info );
+        } else {
+            API_SUFFIX(LAPACKE_cgetrs_rowmajor)( trans, n, nrhs,
+                        a + (size_t)k*stridea, lda,
+                        ipiv + (size_t)k*strideipiv,
+                        b + (size_t)k*strideb, ldb );
+        }
+    }
+    return 0;
+}
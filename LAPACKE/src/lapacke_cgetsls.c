@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_cgetsls)( int matrix_layout, char trans, lapack_in
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_cgetsls)( int matrix_layout, char trans, lapack_in
     info = API_SUFFIX(LAPACKE_cgetsls_work)( matrix_layout, trans, m, n, nrhs, a, lda, b, ldb,
                                work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgetsls", info );
@@ -65,13 +65,13 @@ lapack_int API_SUFFIX(LAPACKE_cgges)( int matrix_layout, char jobvsl, char jobvs
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
         }
     }
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,8*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,8*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -86,7 +86,7 @@ lapack_int API_SUFFIX(LAPACKE_cgges)( int matrix_layout, char jobvsl, char jobvs
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -96,12 +96,12 @@ lapack_int API_SUFFIX(LAPACKE_cgges)( int matrix_layout, char jobvsl, char jobvs
                                lda, b, ldb, sdim, alpha, beta, vsl, ldvsl, vsr,
                                ldvsr, work, lwork, rwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
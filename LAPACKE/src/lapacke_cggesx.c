@@ -70,13 +70,13 @@ lapack_int API_SUFFIX(LAPACKE_cggesx)( int matrix_layout, char jobvsl, char jobv
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
         }
     }
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,8*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,8*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -93,13 +93,13 @@ lapack_int API_SUFFIX(LAPACKE_cggesx)( int matrix_layout, char jobvsl, char jobv
     liwork = iwork_query;
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_3;
@@ -110,14 +110,14 @@ lapack_int API_SUFFIX(LAPACKE_cggesx)( int matrix_layout, char jobvsl, char jobv
                                 vsl, ldvsl, vsr, ldvsr, rconde, rcondv, work,
                                 lwork, rwork, iwork, liwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_3:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_2:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
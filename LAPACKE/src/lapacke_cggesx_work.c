@@ -96,20 +96,20 @@ lapack_int API_SUFFIX(LAPACKE_cggesx_work)( int matrix_layout, char jobvsl, char
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvsl, 'v' ) ) {
             vsl_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvsl_t * MAX(1,n) );
             if( vsl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -118,7 +118,7 @@ lapack_int API_SUFFIX(LAPACKE_cggesx_work)( int matrix_layout, char jobvsl, char
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvsr, 'v' ) ) {
             vsr_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvsr_t * MAX(1,n) );
             if( vsr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -149,16 +149,16 @@ lapack_int API_SUFFIX(LAPACKE_cggesx_work)( int matrix_layout, char jobvsl, char
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvsr, 'v' ) ) {
-            LAPACKE_free( vsr_t );
+            LAPACKE_work_free( vsr_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( jobvsl, 'v' ) ) {
-            LAPACKE_free( vsl_t );
+            LAPACKE_work_free( vsl_t );
         }
 exit_level_2:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cggesx_work", info );
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_cggev3)( int matrix_layout,
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,8*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,8*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_cggev3)( int matrix_layout,
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -87,9 +87,9 @@ lapack_int API_SUFFIX(LAPACKE_cggev3)( int matrix_layout,
                                 alpha, beta, vl, ldvl, vr, ldvr, work, lwork,
                                 rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cggev3", info );
@@ -94,20 +94,20 @@ lapack_int API_SUFFIX(LAPACKE_cggev3_work)( int matrix_layout,
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvl, 'v' ) ) {
             vl_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvl_t * MAX(1,ncols_vl) );
             if( vl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -116,7 +116,7 @@ lapack_int API_SUFFIX(LAPACKE_cggev3_work)( int matrix_layout,
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvr, 'v' ) ) {
             vr_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvr_t * MAX(1,ncols_vr) );
             if( vr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -146,16 +146,16 @@ lapack_int API_SUFFIX(LAPACKE_cggev3_work)( int matrix_layout,
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvr, 'v' ) ) {
-            LAPACKE_free( vr_t );
+            LAPACKE_work_free( vr_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( jobvl, 'v' ) ) {
-            LAPACKE_free( vl_t );
+            LAPACKE_work_free( vl_t );
         }
 exit_level_2:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cggev3_work", info );
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_cggevx)( int matrix_layout, char balanc, char jobv
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'e' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -85,13 +85,13 @@ lapack_int API_SUFFIX(LAPACKE_cggevx)( int matrix_layout, char balanc, char jobv
     }
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'n' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n+2) );
+        iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n+2) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_1;
         }
     }
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * lrwork );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -108,7 +108,7 @@ lapack_int API_SUFFIX(LAPACKE_cggevx)( int matrix_layout, char balanc, char jobv
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_3;
@@ -119,18 +119,18 @@ lapack_int API_SUFFIX(LAPACKE_cggevx)( int matrix_layout, char balanc, char jobv
                                 ilo, ihi, lscale, rscale, abnrm, bbnrm, rconde,
                                 rcondv, work, lwork, rwork, iwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_3:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_2:
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'n' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'e' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -70,13 +70,13 @@ lapack_int API_SUFFIX(LAPACKE_cggsvd3)( int matrix_layout, char jobu, char jobv,
         goto exit_level_0;
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -86,9 +86,9 @@ lapack_int API_SUFFIX(LAPACKE_cggsvd3)( int matrix_layout, char jobu, char jobv,
                                  a, lda, b, ldb, alpha, beta, u, ldu, v, ldv, q,
                                  ldq, work, lwork, rwork, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cggsvd3", info );
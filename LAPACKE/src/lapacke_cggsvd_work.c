@@ -92,20 +92,20 @@ lapack_int API_SUFFIX(LAPACKE_cggsvd_work)( int matrix_layout, char jobu, char j
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobu, 'u' ) ) {
             u_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldu_t * MAX(1,m) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -114,7 +114,7 @@ lapack_int API_SUFFIX(LAPACKE_cggsvd_work)( int matrix_layout, char jobu, char j
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ) {
             v_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldv_t * MAX(1,p) );
             if( v_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -123,7 +123,7 @@ lapack_int API_SUFFIX(LAPACKE_cggsvd_work)( int matrix_layout, char jobu, char j
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobq, 'q' ) ) {
             q_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldq_t * MAX(1,n) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -154,20 +154,20 @@ lapack_int API_SUFFIX(LAPACKE_cggsvd_work)( int matrix_layout, char jobu, char j
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobq, 'q' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_4:
         if( API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ) {
-            LAPACKE_free( v_t );
+            LAPACKE_work_free( v_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( jobu, 'u' ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_2:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cggsvd_work", info );
@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_cgtcon)( char norm, lapack_int n,
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_cgtcon)( char norm, lapack_int n,
     info = API_SUFFIX(LAPACKE_cgtcon_work)( norm, n, dl, d, du, du2, ipiv, anorm, rcond,
                                 work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgtcon", info );
@@ -72,14 +72,14 @@ lapack_int API_SUFFIX(LAPACKE_cgtrfs_work)( int matrix_layout, char trans, lapac
         }
         /* Allocate memory for temporary array(s) */
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldb_t * MAX(1,nrhs) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         x_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldx_t * MAX(1,nrhs) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -98,9 +98,9 @@ lapack_int API_SUFFIX(LAPACKE_cgtrfs_work)( int matrix_layout, char trans, lapac
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, n, nrhs, x_t, ldx_t, x, ldx );
         /* Release memory and exit */
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_1:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgtrfs_work", info );
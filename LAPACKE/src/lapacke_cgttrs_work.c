@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_cgttrs_work)( int matrix_layout, char trans, lapac
         }
         /* Allocate memory for temporary array(s) */
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldb_t * MAX(1,nrhs) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_cgttrs_work)( int matrix_layout, char trans, lapac
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, n, nrhs, b_t, ldb_t, b, ldb );
         /* Release memory and exit */
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cgttrs_work", info );
@@ -62,13 +62,13 @@ lapack_int API_SUFFIX(LAPACKE_chbev_2stage)( int matrix_layout, char jobz, char
     }
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,3*n-2) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,3*n-2) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -77,9 +77,9 @@ lapack_int API_SUFFIX(LAPACKE_chbev_2stage)( int matrix_layout, char jobz, char
     info = API_SUFFIX(LAPACKE_chbev_2stage_work)( matrix_layout, jobz, uplo, n, kd, ab, ldab, w, z,
                                ldz, work, lwork, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chbev_2stage", info );
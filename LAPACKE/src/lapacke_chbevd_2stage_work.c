@@ -74,14 +74,14 @@ lapack_int API_SUFFIX(LAPACKE_chbevd_2stage_work)( int matrix_layout, char jobz,
         }
         /* Allocate memory for temporary array(s) */
         ab_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
             z_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldz_t * MAX(1,n) );
             if( z_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -104,10 +104,10 @@ lapack_int API_SUFFIX(LAPACKE_chbevd_2stage_work)( int matrix_layout, char jobz,
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-            LAPACKE_free( z_t );
+            LAPACKE_work_free( z_t );
         }
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chbevd_2stage_work", info );
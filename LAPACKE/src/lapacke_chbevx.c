@@ -70,18 +70,18 @@ lapack_int API_SUFFIX(LAPACKE_chbevx)( int matrix_layout, char jobz, char range,
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,5*n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,5*n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,7*n) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,7*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -91,11 +91,11 @@ lapack_int API_SUFFIX(LAPACKE_chbevx)( int matrix_layout, char jobz, char range,
                                 ldab, q, ldq, vl, vu, il, iu, abstol, m, w, z,
                                 ldz, work, rwork, iwork, ifail );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chbevx", info );
@@ -72,20 +72,20 @@ lapack_int API_SUFFIX(LAPACKE_chbgst_work)( int matrix_layout, char vect, char u
         }
         /* Allocate memory for temporary array(s) */
         ab_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         bb_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldbb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldbb_t * MAX(1,n) );
         if( bb_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
             x_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldx_t * MAX(1,n) );
             if( x_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -109,12 +109,12 @@ lapack_int API_SUFFIX(LAPACKE_chbgst_work)( int matrix_layout, char vect, char u
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
-            LAPACKE_free( x_t );
+            LAPACKE_work_free( x_t );
         }
 exit_level_2:
-        LAPACKE_free( bb_t );
+        LAPACKE_work_free( bb_t );
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chbgst_work", info );
@@ -58,7 +58,7 @@ lapack_int API_SUFFIX(LAPACKE_chbtrd)( int matrix_layout, char vect, char uplo,
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_chbtrd)( int matrix_layout, char vect, char uplo,
     info = API_SUFFIX(LAPACKE_chbtrd_work)( matrix_layout, vect, uplo, n, kd, ab, ldab, d, e,
                                 q, ldq, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chbtrd", info );
@@ -64,14 +64,14 @@ lapack_int API_SUFFIX(LAPACKE_chbtrd_work)( int matrix_layout, char vect, char u
         }
         /* Allocate memory for temporary array(s) */
         ab_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'u' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
             q_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldq_t * MAX(1,n) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -97,10 +97,10 @@ lapack_int API_SUFFIX(LAPACKE_chbtrd_work)( int matrix_layout, char vect, char u
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'u' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chbtrd_work", info );
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_checon_3)( int matrix_layout, char uplo, lapack_in
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_checon_3)( int matrix_layout, char uplo, lapack_in
     info = API_SUFFIX(LAPACKE_checon_3_work)( matrix_layout, uplo, n, a, lda, e, ipiv, anorm,
                                 rcond, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_checon_3", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_cheequb)( int matrix_layout, char uplo, lapack_int
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,3*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,3*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_cheequb)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_cheequb_work)( matrix_layout, uplo, n, a, lda, s, scond, amax,
                                  work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cheequb", info );
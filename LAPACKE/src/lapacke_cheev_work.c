@@ -47,9 +47,13 @@ lapack_int API_SUFFIX(LAPACKE_cheev_work)( int matrix_layout, char jobz, char up
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        lapack_complex_float* a_t = NULL;
-        /* Check leading dimension(s) */
+        lapack_int lda_t = MAX(1,lda);
+        lapack_int i, ione = 1;
+        char uplo_t = API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ? 'l' :
+                      ( API_SUFFIX(LAPACKE_lsame)( uplo, 'l' ) ? 'u' : uplo );
+        /* The column-major view of A is A**T = conjg( A ), which is stored
+         * in the other triangle and whose eigenvectors are conjg( Z ); they
+         * are transposed and conjugated back in place */
         if( lda < n ) {
             info = -6;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cheev_work", info );
@@ -57,36 +61,22 @@ lapack_int API_SUFFIX(LAPACKE_cheev_work)( int matrix_layout, char jobz, char up
         }
         /* Query optimal working array(s) size if requested */
         if( lwork == -1 ) {
-            LAPACK_cheev( &jobz, &uplo, &n, a, &lda_t, w, work, &lwork, rwork,
+            LAPACK_cheev( &jobz, &uplo_t, &n, a, &lda_t, w, work, &lwork, rwork,
                           &info );
             return (info < 0) ? (info - 1) : info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_che_trans)( matrix_layout, uplo, n, a, lda, a_t, lda_t );
         /* Call LAPACK function and adjust info */
-        LAPACK_cheev( &jobz, &uplo, &n, a_t, &lda_t, w, work, &lwork, rwork,
+        LAPACK_cheev( &jobz, &uplo_t, &n, a, &lda_t, w, work, &lwork, rwork,
                       &info );
         if( info < 0 ) {
             info = info - 1;
         }
         /* Transpose output matrices */
-        if ( jobz == 'V' || jobz == 'v' ) {
-            API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, n, n, a_t, lda_t, a, lda );
-        } else {
-            API_SUFFIX(LAPACKE_che_trans)( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
-        }
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cheev_work", info );
+        if( info >= 0 && API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
+            API_SUFFIX(LAPACKE_cge_trans_inplace)( n, a, lda );
+            for( i = 0; i < n; i++ ) {
+                LAPACK_clacgv( &n, &a[(size_t)i*lda], &ione );
+            }
         }
     } else {
         info = -1;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_chesv_aa_2stage)( int matrix_layout, char uplo, la
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_chesv_aa_2stage)( int matrix_layout, char uplo, la
     					       a, lda, tb, ltb, ipiv, ipiv2, b,
                                ldb, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chesv_aa_2stage", info );
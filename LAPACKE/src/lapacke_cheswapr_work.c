@@ -48,7 +48,7 @@ lapack_int API_SUFFIX(LAPACKE_cheswapr_work)( int matrix_layout, char uplo, lapa
         lapack_complex_float* a_t = NULL;
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_cheswapr_work)( int matrix_layout, char uplo, lapa
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_che_trans)( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cheswapr_work", info );
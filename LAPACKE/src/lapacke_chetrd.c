@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_chetrd)( int matrix_layout, char uplo, lapack_int
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_chetrd)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_chetrd_work)( matrix_layout, uplo, n, a, lda, d, e, tau, work,
                                 lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chetrd", info );
@@ -70,12 +70,12 @@ lapack_int API_SUFFIX(LAPACKE_chetrf_aa_2stage_work)( int matrix_layout, char up
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+        a_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        tb_t = (lapack_complex_float*)LAPACKE_malloc( sizeof(lapack_complex_float) * ltb );
+        tb_t = (lapack_complex_float*)LAPACKE_work_malloc( sizeof(lapack_complex_float) * ltb );
         if( tb_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
@@ -92,9 +92,9 @@ lapack_int API_SUFFIX(LAPACKE_chetrf_aa_2stage_work)( int matrix_layout, char up
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_che_trans)( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
         /* Release memory and exit */
-        LAPACKE_free( tb_t );
+        LAPACKE_work_free( tb_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chetrf_aa_2stage_work", info );
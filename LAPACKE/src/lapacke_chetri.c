@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_chetri)( int matrix_layout, char uplo, lapack_int
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_chetri)( int matrix_layout, char uplo, lapack_int
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_chetri_work)( matrix_layout, uplo, n, a, lda, ipiv, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chetri", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_chetri2x)( int matrix_layout, char uplo, lapack_in
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,n+nb+1)*(+1) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,n+nb+1)*(+1) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_chetri2x)( int matrix_layout, char uplo, lapack_in
     info = API_SUFFIX(LAPACKE_chetri2x_work)( matrix_layout, uplo, n, a, lda, ipiv, work,
                                   nb );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chetri2x", info );
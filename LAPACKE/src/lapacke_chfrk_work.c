@@ -60,13 +60,13 @@ lapack_int API_SUFFIX(LAPACKE_chfrk_work)( int matrix_layout, char transr, char
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,ka) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,ka) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         c_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -82,9 +82,9 @@ lapack_int API_SUFFIX(LAPACKE_chfrk_work)( int matrix_layout, char transr, char
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cpf_trans)( LAPACK_COL_MAJOR, transr, uplo, n, c_t, c );
         /* Release memory and exit */
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chfrk_work", info );
@@ -55,7 +55,7 @@ lapack_int API_SUFFIX(LAPACKE_chpcon)( int matrix_layout, char uplo, lapack_int
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_chpcon)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_chpcon_work)( matrix_layout, uplo, n, ap, ipiv, anorm, rcond,
                                 work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chpcon", info );
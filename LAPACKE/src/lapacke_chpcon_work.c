@@ -48,7 +48,7 @@ lapack_int API_SUFFIX(LAPACKE_chpcon_work)( int matrix_layout, char uplo, lapack
         lapack_complex_float* ap_t = NULL;
         /* Allocate memory for temporary array(s) */
         ap_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_chpcon_work)( int matrix_layout, char uplo, lapack
             info = info - 1;
         }
         /* Release memory and exit */
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chpcon_work", info );
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_chpevx_work)( int matrix_layout, char jobz, char r
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
             z_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldz_t * MAX(1,ncols_z) );
             if( z_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_chpevx_work)( int matrix_layout, char jobz, char r
             }
         }
         ap_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -96,10 +96,10 @@ lapack_int API_SUFFIX(LAPACKE_chpevx_work)( int matrix_layout, char jobz, char r
         }
         API_SUFFIX(LAPACKE_chp_trans)( LAPACK_COL_MAJOR, uplo, n, ap_t, ap );
         /* Release memory and exit */
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_1:
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-            LAPACKE_free( z_t );
+            LAPACKE_work_free( z_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
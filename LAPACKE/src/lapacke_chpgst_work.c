@@ -48,14 +48,14 @@ lapack_int API_SUFFIX(LAPACKE_chpgst_work)( int matrix_layout, lapack_int itype,
         lapack_complex_float* bp_t = NULL;
         /* Allocate memory for temporary array(s) */
         ap_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         bp_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( bp_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -72,9 +72,9 @@ lapack_int API_SUFFIX(LAPACKE_chpgst_work)( int matrix_layout, lapack_int itype,
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_chp_trans)( LAPACK_COL_MAJOR, uplo, n, ap_t, ap );
         /* Release memory and exit */
-        LAPACKE_free( bp_t );
+        LAPACKE_work_free( bp_t );
 exit_level_1:
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chpgst_work", info );
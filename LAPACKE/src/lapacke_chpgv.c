@@ -56,13 +56,13 @@ lapack_int API_SUFFIX(LAPACKE_chpgv)( int matrix_layout, lapack_int itype, char
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,3*n-2) );
+    rwork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,3*n-2) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n-1) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n-1) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -71,9 +71,9 @@ lapack_int API_SUFFIX(LAPACKE_chpgv)( int matrix_layout, lapack_int itype, char
     info = API_SUFFIX(LAPACKE_chpgv_work)( matrix_layout, itype, jobz, uplo, n, ap, bp, w, z,
                                ldz, work, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chpgv", info );
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_chpgvd_work)( int matrix_layout, lapack_int itype,
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
             z_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldz_t * MAX(1,n) );
             if( z_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -77,14 +77,14 @@ lapack_int API_SUFFIX(LAPACKE_chpgvd_work)( int matrix_layout, lapack_int itype,
             }
         }
         ap_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         bp_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( bp_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -106,12 +106,12 @@ lapack_int API_SUFFIX(LAPACKE_chpgvd_work)( int matrix_layout, lapack_int itype,
         API_SUFFIX(LAPACKE_chp_trans)( LAPACK_COL_MAJOR, uplo, n, ap_t, ap );
         API_SUFFIX(LAPACKE_chp_trans)( LAPACK_COL_MAJOR, uplo, n, bp_t, bp );
         /* Release memory and exit */
-        LAPACKE_free( bp_t );
+        LAPACKE_work_free( bp_t );
 exit_level_2:
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_1:
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-            LAPACKE_free( z_t );
+            LAPACKE_work_free( z_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -69,28 +69,28 @@ lapack_int API_SUFFIX(LAPACKE_chpsvx_work)( int matrix_layout, char fact, char u
         }
         /* Allocate memory for temporary array(s) */
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldb_t * MAX(1,nrhs) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         x_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ldx_t * MAX(1,nrhs) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         ap_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
         afp_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( afp_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -114,13 +114,13 @@ lapack_int API_SUFFIX(LAPACKE_chpsvx_work)( int matrix_layout, char fact, char u
             API_SUFFIX(LAPACKE_chp_trans)( LAPACK_COL_MAJOR, uplo, n, afp_t, afp );
         }
         /* Release memory and exit */
-        LAPACKE_free( afp_t );
+        LAPACKE_work_free( afp_t );
 exit_level_3:
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_2:
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_1:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chpsvx_work", info );
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_chseqr)( int matrix_layout, char job, char compz,
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_chseqr)( int matrix_layout, char job, char compz,
     info = API_SUFFIX(LAPACKE_chseqr_work)( matrix_layout, job, compz, n, ilo, ihi, h, ldh,
                                 w, z, ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_chseqr", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_claghe)( int matrix_layout, lapack_int n, lapack_i
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_claghe)( int matrix_layout, lapack_int n, lapack_i
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_claghe_work)( matrix_layout, n, k, d, a, lda, iseed, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_claghe", info );
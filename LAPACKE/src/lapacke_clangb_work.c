@@ -60,7 +60,7 @@ float API_SUFFIX(LAPACKE_clangb_work)( int matrix_layout, char norm, lapack_int
         }
         /* Allocate memory for work array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( norm_lapack, 'i' ) ) {
-            work_lapack = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+            work_lapack = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
             if( work_lapack == NULL ) {
                 info = LAPACK_WORK_MEMORY_ERROR;
                 goto exit_level_0;
@@ -70,7 +70,7 @@ float API_SUFFIX(LAPACKE_clangb_work)( int matrix_layout, char norm, lapack_int
         res = LAPACK_clangb( &norm, &n, &ku, &kl, ab, &ldab, work );
         /* Release memory and exit */
         if( work_lapack ) {
-            LAPACKE_free( work_lapack );
+            LAPACKE_work_free( work_lapack );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -53,7 +53,7 @@ float API_SUFFIX(LAPACKE_clanhe)( int matrix_layout, char norm, char uplo, lapac
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) || API_SUFFIX(LAPACKE_lsame)( norm, '1' ) ||
         API_SUFFIX(LAPACKE_lsame)( norm, 'O' ) ) {
-        work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+        work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -64,7 +64,7 @@ float API_SUFFIX(LAPACKE_clanhe)( int matrix_layout, char norm, char uplo, lapac
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) || API_SUFFIX(LAPACKE_lsame)( norm, '1' ) ||
         API_SUFFIX(LAPACKE_lsame)( norm, 'O' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -66,7 +66,7 @@ float API_SUFFIX(LAPACKE_clantr_work)( int matrix_layout, char norm, char uplo,
         }
         /* Allocate memory for work array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( norm_lapack, 'i' ) ) {
-            work_lapack = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+            work_lapack = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
             if( work_lapack == NULL ) {
                 info = LAPACK_WORK_MEMORY_ERROR;
                 goto exit_level_0;
@@ -76,7 +76,7 @@ float API_SUFFIX(LAPACKE_clantr_work)( int matrix_layout, char norm, char uplo,
         res = LAPACK_clantr( &norm_lapack, &uplo_lapack, &diag, &n, &m, a, &lda, work_lapack );
         /* Release memory and exit */
         if( work_lapack ) {
-            LAPACKE_free( work_lapack );
+            LAPACKE_work_free( work_lapack );
         }
 exit_level_0:
         if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -57,7 +57,7 @@ lapack_int API_SUFFIX(LAPACKE_clarcm)(int matrix_layout, lapack_int m,
 #endif
     /* Allocate memory for work array(s) */
     rwork = (float*)
-        LAPACKE_malloc(sizeof(float) * MAX(1, 2 * m * n));
+        LAPACKE_work_malloc(sizeof(float) * MAX(1, 2 * m * n));
     if (rwork == NULL) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_clarcm)(int matrix_layout, lapack_int m,
     info = API_SUFFIX(LAPACKE_clarcm_work)(matrix_layout, m, n, a, lda, b, ldb,
                                 c, ldc, rwork);
     /* Release memory and exit */
-    LAPACKE_free(rwork);
+    LAPACKE_work_free(rwork);
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_clarcm", info );
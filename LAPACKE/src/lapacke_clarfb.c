@@ -85,7 +85,7 @@ lapack_int API_SUFFIX(LAPACKE_clarfb)( int matrix_layout, char side, char trans,
     }
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * ldwork * MAX(1,k) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldwork * MAX(1,k) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -94,7 +94,7 @@ lapack_int API_SUFFIX(LAPACKE_clarfb)( int matrix_layout, char side, char trans,
     info = API_SUFFIX(LAPACKE_clarfb_work)( matrix_layout, side, trans, direct, storev, m, n,
                                 k, v, ldv, t, ldt, c, ldc, work, ldwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_clarfb", info );
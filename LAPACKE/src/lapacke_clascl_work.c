@@ -58,7 +58,7 @@ lapack_int API_SUFFIX(LAPACKE_clascl_work)( int matrix_layout, char type, lapack
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-           LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+           LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_clascl_work)( int matrix_layout, char type, lapack
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, nrows_a, n, a_t, lda_t, a, lda );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_clascl_work", info );
@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_cpbstf_work)( int matrix_layout, char uplo, lapack
         }
         /* Allocate memory for temporary array(s) */
         bb_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldbb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldbb_t * MAX(1,n) );
         if( bb_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_cpbstf_work)( int matrix_layout, char uplo, lapack
         API_SUFFIX(LAPACKE_cpb_trans)( LAPACK_COL_MAJOR, uplo, n, kb, bb_t, ldbb_t, bb,
                            ldbb );
         /* Release memory and exit */
-        LAPACKE_free( bb_t );
+        LAPACKE_work_free( bb_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cpbstf_work", info );
@@ -46,7 +46,7 @@ lapack_int API_SUFFIX(LAPACKE_cpftrf_work)( int matrix_layout, char transr, char
         lapack_complex_float* a_t = NULL;
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_cpftrf_work)( int matrix_layout, char transr, char
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cpf_trans)( LAPACK_COL_MAJOR, transr, uplo, n, a_t, a );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cpftrf_work", info );
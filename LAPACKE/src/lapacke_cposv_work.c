@@ -45,11 +45,27 @@ lapack_int API_SUFFIX(LAPACKE_cposv_work)( int matrix_layout, char uplo, lapack_
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        lapack_int ldb_t = MAX(1,n);
-        lapack_complex_float* a_t = NULL;
-        lapack_complex_float* b_t = NULL;
-        /* Check leading dimension(s) */
+        lapack_int lda_t = MAX(1,lda);
+        char uplo_t = API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ? 'l' :
+                      ( API_SUFFIX(LAPACKE_lsame)( uplo, 'l' ) ? 'u' : uplo );
+        /* Factor A**T in the other triangle in place, then solve in place,
+         * see LAPACKE_cpotrs_rowmajor */
+        if( !API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) &&
+            !API_SUFFIX(LAPACKE_lsame)( uplo, 'l' ) ) {
+            info = -2;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cposv_work", info );
+            return info;
+        }
+        if( n < 0 ) {
+            info = -3;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cposv_work", info );
+            return info;
+        }
+        if( nrhs < 0 ) {
+            info = -4;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cposv_work", info );
+            return info;
+        }
         if( lda < n ) {
             info = -6;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cposv_work", info );
@@ -60,38 +76,9 @@ lapack_int API_SUFFIX(LAPACKE_cposv_work)( int matrix_layout, char uplo, lapack_
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cposv_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
-                            ldb_t * MAX(1,nrhs) );
-        if( b_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_1;
-        }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_cpo_trans)( matrix_layout, uplo, n, a, lda, a_t, lda_t );
-        API_SUFFIX(LAPACKE_cge_trans)( matrix_layout, n, nrhs, b, ldb, b_t, ldb_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_cposv( &uplo, &n, &nrhs, a_t, &lda_t, b_t, &ldb_t, &info );
-        if( info < 0 ) {
-            info = info - 1;
-        }
-        /* Transpose output matrices */
-        API_SUFFIX(LAPACKE_cpo_trans)( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
-        API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, n, nrhs, b_t, ldb_t, b, ldb );
-        /* Release memory and exit */
-        LAPACKE_free( b_t );
-exit_level_1:
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cposv_work", info );
+        LAPACK_cpotrf( &uplo_t, &n, a, &lda_t, &info );
+        if( info == 0 ) {
+            API_SUFFIX(LAPACKE_cpotrs_rowmajor)( uplo, n, nrhs, a, lda, b, ldb );
         }
     } else {
         info = -1;
@@ -43,36 +43,21 @@ lapack_int API_SUFFIX(LAPACKE_cpotrf_work)( int matrix_layout, char uplo, lapack
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        lapack_complex_float* a_t = NULL;
-        /* Check leading dimension(s) */
+        lapack_int lda_t = MAX(1,lda);
+        char uplo_t = API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ? 'l' :
+                      ( API_SUFFIX(LAPACKE_lsame)( uplo, 'l' ) ? 'u' : uplo );
+        /* The column-major view of A is A**T, whose Cholesky factor in the
+         * other triangle is the transpose of the requested one */
         if( lda < n ) {
             info = -5;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cpotrf_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_cpo_trans)( matrix_layout, uplo, n, a, lda, a_t, lda_t );
         /* Call LAPACK function and adjust info */
-        LAPACK_cpotrf( &uplo, &n, a_t, &lda_t, &info );
+        LAPACK_cpotrf( &uplo_t, &n, a, &lda_t, &info );
         if( info < 0 ) {
             info = info - 1;
         }
-        /* Transpose output matrices */
-        API_SUFFIX(LAPACKE_cpo_trans)( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cpotrf_work", info );
-        }
     } else {
         info = -1;
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cpotrf_work", info );
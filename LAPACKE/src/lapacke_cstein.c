@@ -60,12 +60,12 @@ lapack_int API_SUFFIX(LAPACKE_cstein)( int matrix_layout, lapack_int n, const fl
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,5*n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,5*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -74,9 +74,9 @@ lapack_int API_SUFFIX(LAPACKE_cstein)( int matrix_layout, lapack_int n, const fl
     info = API_SUFFIX(LAPACKE_cstein_work)( matrix_layout, n, d, e, m, w, iblock, isplit, z,
                                 ldz, work, iwork, ifailv );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cstein", info );
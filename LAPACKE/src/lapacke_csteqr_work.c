@@ -55,7 +55,7 @@ lapack_int API_SUFFIX(LAPACKE_csteqr_work)( int matrix_layout, char compz, lapac
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( compz, 'i' ) || API_SUFFIX(LAPACKE_lsame)( compz, 'v' ) ) {
             z_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldz_t * MAX(1,n) );
             if( z_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_csteqr_work)( int matrix_layout, char compz, lapac
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( compz, 'i' ) || API_SUFFIX(LAPACKE_lsame)( compz, 'v' ) ) {
-            LAPACKE_free( z_t );
+            LAPACKE_work_free( z_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -81,20 +81,20 @@ lapack_int API_SUFFIX(LAPACKE_ctgevc_work)( int matrix_layout, char side, char h
         }
         /* Allocate memory for temporary array(s) */
         s_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lds_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lds_t * MAX(1,n) );
         if( s_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         p_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldp_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldp_t * MAX(1,n) );
         if( p_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'l' ) ) {
             vl_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvl_t * MAX(1,mm) );
             if( vl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -103,7 +103,7 @@ lapack_int API_SUFFIX(LAPACKE_ctgevc_work)( int matrix_layout, char side, char h
         }
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'r' ) ) {
             vr_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldvr_t * MAX(1,mm) );
             if( vr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -139,16 +139,16 @@ lapack_int API_SUFFIX(LAPACKE_ctgevc_work)( int matrix_layout, char side, char h
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'r' ) ) {
-            LAPACKE_free( vr_t );
+            LAPACKE_work_free( vr_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'l' ) ) {
-            LAPACKE_free( vl_t );
+            LAPACKE_work_free( vl_t );
         }
 exit_level_2:
-        LAPACKE_free( p_t );
+        LAPACKE_work_free( p_t );
 exit_level_1:
-        LAPACKE_free( s_t );
+        LAPACKE_work_free( s_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctgevc_work", info );
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_ctgsna)( int matrix_layout, char job, char howmny,
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n+2) );
+        iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n+2) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -89,7 +89,7 @@ lapack_int API_SUFFIX(LAPACKE_ctgsna)( int matrix_layout, char job, char howmny,
     /* Allocate memory for work arrays */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
         work = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_1;
@@ -101,11 +101,11 @@ lapack_int API_SUFFIX(LAPACKE_ctgsna)( int matrix_layout, char job, char howmny,
                                 lwork, iwork );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_ctgsyl)( int matrix_layout, char trans, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,m+n+2) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,m+n+2) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -90,7 +90,7 @@ lapack_int API_SUFFIX(LAPACKE_ctgsyl)( int matrix_layout, char trans, lapack_int
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -100,9 +100,9 @@ lapack_int API_SUFFIX(LAPACKE_ctgsyl)( int matrix_layout, char trans, lapack_int
                                 c, ldc, d, ldd, e, lde, f, ldf, scale, dif,
                                 work, lwork, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctgsyl", info );
@@ -106,37 +106,37 @@ lapack_int API_SUFFIX(LAPACKE_ctgsyl_work)( int matrix_layout, char trans, lapac
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,m) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,m) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         b_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         c_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
         d_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldd_t * MAX(1,m) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldd_t * MAX(1,m) );
         if( d_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_3;
         }
         e_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lde_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lde_t * MAX(1,n) );
         if( e_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_4;
         }
         f_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldf_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldf_t * MAX(1,n) );
         if( f_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_5;
@@ -159,17 +159,17 @@ lapack_int API_SUFFIX(LAPACKE_ctgsyl_work)( int matrix_layout, char trans, lapac
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc );
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, f_t, ldf_t, f, ldf );
         /* Release memory and exit */
-        LAPACKE_free( f_t );
+        LAPACKE_work_free( f_t );
 exit_level_5:
-        LAPACKE_free( e_t );
+        LAPACKE_work_free( e_t );
 exit_level_4:
-        LAPACKE_free( d_t );
+        LAPACKE_work_free( d_t );
 exit_level_3:
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_2:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctgsyl_work", info );
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_ctpmqrt)( int matrix_layout, char side, char trans
     lwork = API_SUFFIX(LAPACKE_lsame)( side, 'L' ) ? MAX(1,nb) * MAX(1,n) :
                        ( API_SUFFIX(LAPACKE_lsame)( side, 'R' ) ? MAX(1,m) * MAX(1,nb) : 0 );
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -85,7 +85,7 @@ lapack_int API_SUFFIX(LAPACKE_ctpmqrt)( int matrix_layout, char side, char trans
     info = API_SUFFIX(LAPACKE_ctpmqrt_work)( matrix_layout, side, trans, m, n, k, l, nb, v,
                                  ldv, t, ldt, a, lda, b, ldb, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctpmqrt", info );
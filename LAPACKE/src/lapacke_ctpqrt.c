@@ -57,7 +57,7 @@ lapack_int API_SUFFIX(LAPACKE_ctpqrt)( int matrix_layout, lapack_int m, lapack_i
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * MAX(1,nb) * MAX(1,n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * MAX(1,nb) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_ctpqrt)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_ctpqrt_work)( matrix_layout, m, n, l, nb, a, lda, b, ldb,
                                 t, ldt, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctpqrt", info );
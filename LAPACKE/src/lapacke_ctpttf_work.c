@@ -48,14 +48,14 @@ lapack_int API_SUFFIX(LAPACKE_ctpttf_work)( int matrix_layout, char transr, char
         lapack_complex_float* arf_t = NULL;
         /* Allocate memory for temporary array(s) */
         ap_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         arf_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                             ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( arf_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -71,9 +71,9 @@ lapack_int API_SUFFIX(LAPACKE_ctpttf_work)( int matrix_layout, char transr, char
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cpf_trans)( LAPACK_COL_MAJOR, transr, uplo, n, arf_t, arf );
         /* Release memory and exit */
-        LAPACKE_free( arf_t );
+        LAPACKE_work_free( arf_t );
 exit_level_1:
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctpttf_work", info );
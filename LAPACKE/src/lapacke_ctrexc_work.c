@@ -62,14 +62,14 @@ lapack_int API_SUFFIX(LAPACKE_ctrexc_work)( int matrix_layout, char compq, lapac
         }
         /* Allocate memory for temporary array(s) */
         t_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldt_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldt_t * MAX(1,n) );
         if( t_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'v' ) ) {
             q_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                                 ldq_t * MAX(1,n) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -94,10 +94,10 @@ lapack_int API_SUFFIX(LAPACKE_ctrexc_work)( int matrix_layout, char compq, lapac
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'v' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( t_t );
+        LAPACKE_work_free( t_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctrexc_work", info );
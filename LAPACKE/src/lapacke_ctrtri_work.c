@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_ctrtri_work)( int matrix_layout, char uplo, char d
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_ctrtri_work)( int matrix_layout, char uplo, char d
         API_SUFFIX(LAPACKE_ctr_trans)( LAPACK_COL_MAJOR, uplo, diag, n, a_t, lda_t, a,
                            lda );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ctrtri_work", info );
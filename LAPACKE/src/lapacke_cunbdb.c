@@ -86,7 +86,7 @@ lapack_int API_SUFFIX(LAPACKE_cunbdb)( int matrix_layout, char trans, char signs
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -96,7 +96,7 @@ lapack_int API_SUFFIX(LAPACKE_cunbdb)( int matrix_layout, char trans, char signs
                                 x12, ldx12, x21, ldx21, x22, ldx22, theta, phi,
                                 taup1, taup2, tauq1, tauq2, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cunbdb", info );
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_cunmbr)( int matrix_layout, char vect, char side,
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -81,7 +81,7 @@ lapack_int API_SUFFIX(LAPACKE_cunmbr)( int matrix_layout, char vect, char side,
     info = API_SUFFIX(LAPACKE_cunmbr_work)( matrix_layout, vect, side, trans, m, n, k, a,
                                 lda, tau, c, ldc, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cunmbr", info );
@@ -74,17 +74,17 @@ lapack_int API_SUFFIX(LAPACKE_cunmlq_work)( int matrix_layout, char side, char t
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( side, 'l' ) ) {
             a_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,m) );
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,m) );
         } else {
             a_t = (lapack_complex_float*)
-                LAPACKE_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(lapack_complex_float) * lda_t * MAX(1,n) );
         }
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         c_t = (lapack_complex_float*)
-            LAPACKE_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_float) * ldc_t * MAX(1,n) );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
@@ -101,9 +101,9 @@ lapack_int API_SUFFIX(LAPACKE_cunmlq_work)( int matrix_layout, char side, char t
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc );
         /* Release memory and exit */
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cunmlq_work", info );
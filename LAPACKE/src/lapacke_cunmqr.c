@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_cunmqr)( int matrix_layout, char side, char trans,
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_cunmqr)( int matrix_layout, char side, char trans,
     info = API_SUFFIX(LAPACKE_cunmqr_work)( matrix_layout, side, trans, m, n, k, a, lda, tau,
                                 c, ldc, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cunmqr", info );
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_cunmtr)( int matrix_layout, char side, char uplo,
     lwork = LAPACK_C2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_cunmtr)( int matrix_layout, char side, char uplo,
     info = API_SUFFIX(LAPACKE_cunmtr_work)( matrix_layout, side, uplo, trans, m, n, a, lda,
                                 tau, c, ldc, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cunmtr", info );
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_cupmtr)( int matrix_layout, char side, char uplo,
     }
     /* Allocate memory for working array(s) */
     work = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -81,7 +81,7 @@ lapack_int API_SUFFIX(LAPACKE_cupmtr)( int matrix_layout, char side, char uplo,
     info = API_SUFFIX(LAPACKE_cupmtr_work)( matrix_layout, side, uplo, trans, m, n, ap, tau,
                                 c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_cupmtr", info );
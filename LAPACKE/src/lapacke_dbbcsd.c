@@ -97,7 +97,7 @@ lapack_int API_SUFFIX(LAPACKE_dbbcsd)( int matrix_layout, char jobu1, char jobu2
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -108,7 +108,7 @@ lapack_int API_SUFFIX(LAPACKE_dbbcsd)( int matrix_layout, char jobu1, char jobu2
                                 v1t, ldv1t, v2t, ldv2t, b11d, b11e, b12d, b12e,
                                 b21d, b21e, b22d, b22e, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dbbcsd", info );
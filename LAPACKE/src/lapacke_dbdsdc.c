@@ -68,12 +68,12 @@ lapack_int API_SUFFIX(LAPACKE_dbdsdc)( int matrix_layout, char uplo, char compq,
         lwork = 1; /* Any value */
     }
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,8*n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,8*n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -82,9 +82,9 @@ lapack_int API_SUFFIX(LAPACKE_dbdsdc)( int matrix_layout, char uplo, char compq,
     info = API_SUFFIX(LAPACKE_dbdsdc_work)( matrix_layout, uplo, compq, n, d, e, u, ldu, vt,
                                 ldvt, q, iq, work, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dbdsdc", info );
@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_dbdsdc_work)( int matrix_layout, char uplo, char c
         }
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            u_t = (double*)LAPACKE_malloc( sizeof(double) * ldu_t * MAX(1,n) );
+            u_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldu_t * MAX(1,n) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_dbdsdc_work)( int matrix_layout, char uplo, char c
         }
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
             vt_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvt_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvt_t * MAX(1,n) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -93,11 +93,11 @@ lapack_int API_SUFFIX(LAPACKE_dbdsdc_work)( int matrix_layout, char uplo, char c
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_1:
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dbdsqr)( int matrix_layout, char uplo, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,4*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,4*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_dbdsqr)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_dbdsqr_work)( matrix_layout, uplo, n, ncvt, nru, ncc, d, e, vt,
                                 ldvt, u, ldu, c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dbdsqr", info );
@@ -60,12 +60,12 @@ lapack_int API_SUFFIX(LAPACKE_dbdsvdx)( int matrix_layout, char uplo, char jobz,
     }
 #endif
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(12*n,1) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(12*n,1) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -79,9 +79,9 @@ lapack_int API_SUFFIX(LAPACKE_dbdsvdx)( int matrix_layout, char uplo, char jobz,
         superb[i] = iwork[i+1];
     }
     /* Release memory and exit */
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_1:
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dbdsvdx", info );
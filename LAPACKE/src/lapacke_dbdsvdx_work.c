@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_dbdsvdx_work)( int matrix_layout, char uplo, char
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
            z_t = (double*)
-              LAPACKE_malloc( sizeof(double) * ldz_t * MAX(ncols_z,1) );
+              LAPACKE_work_malloc( sizeof(double) * ldz_t * MAX(ncols_z,1) );
            if( z_t == NULL ) {
               info = LAPACK_TRANSPOSE_MEMORY_ERROR;
               goto exit_level_0;
@@ -82,7 +82,7 @@ lapack_int API_SUFFIX(LAPACKE_dbdsvdx_work)( int matrix_layout, char uplo, char
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-            LAPACKE_free( z_t );
+            LAPACKE_work_free( z_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
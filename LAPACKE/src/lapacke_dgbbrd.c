@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_dgbbrd)( int matrix_layout, char vect, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*MAX(m,n)) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*MAX(m,n)) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_dgbbrd)( int matrix_layout, char vect, lapack_int
     info = API_SUFFIX(LAPACKE_dgbbrd_work)( matrix_layout, vect, m, n, ncc, kl, ku, ab, ldab,
                                 d, e, q, ldq, pt, ldpt, c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgbbrd", info );
@@ -78,13 +78,13 @@ lapack_int API_SUFFIX(LAPACKE_dgbbrd_work)( int matrix_layout, char vect, lapack
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        ab_t = (double*)LAPACKE_malloc( sizeof(double) * ldab_t * MAX(1,n) );
+        ab_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'q' ) ) {
-            q_t = (double*)LAPACKE_malloc( sizeof(double) * ldq_t * MAX(1,m) );
+            q_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldq_t * MAX(1,m) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -92,7 +92,7 @@ lapack_int API_SUFFIX(LAPACKE_dgbbrd_work)( int matrix_layout, char vect, lapack
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'p' ) ) {
             pt_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldpt_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldpt_t * MAX(1,n) );
             if( pt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -100,7 +100,7 @@ lapack_int API_SUFFIX(LAPACKE_dgbbrd_work)( int matrix_layout, char vect, lapack
         }
         if( ncc != 0 ) {
             c_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldc_t * MAX(1,ncc) );
+                LAPACKE_work_malloc( sizeof(double) * ldc_t * MAX(1,ncc) );
             if( c_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_3;
@@ -131,18 +131,18 @@ lapack_int API_SUFFIX(LAPACKE_dgbbrd_work)( int matrix_layout, char vect, lapack
         }
         /* Release memory and exit */
         if( ncc != 0 ) {
-            LAPACKE_free( c_t );
+            LAPACKE_work_free( c_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'p' ) ) {
-            LAPACKE_free( pt_t );
+            LAPACKE_work_free( pt_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'q' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgbbrd_work", info );
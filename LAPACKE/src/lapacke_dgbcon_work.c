@@ -56,7 +56,7 @@ lapack_int API_SUFFIX(LAPACKE_dgbcon_work)( int matrix_layout, char norm, lapack
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        ab_t = (double*)LAPACKE_malloc( sizeof(double) * ldab_t * MAX(1,n) );
+        ab_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dgbcon_work)( int matrix_layout, char norm, lapack
             info = info - 1;
         }
         /* Release memory and exit */
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgbcon_work", info );
@@ -85,12 +85,12 @@ lapack_int API_SUFFIX(LAPACKE_dgbsvxx)( int matrix_layout, char fact, char trans
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,4*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,4*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -102,9 +102,9 @@ lapack_int API_SUFFIX(LAPACKE_dgbsvxx)( int matrix_layout, char fact, char trans
                                  err_bnds_norm, err_bnds_comp, nparams, params,
                                  work, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgbsvxx", info );
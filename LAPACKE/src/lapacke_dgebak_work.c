@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_dgebak_work)( int matrix_layout, char job, char si
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        v_t = (double*)LAPACKE_malloc( sizeof(double) * ldv_t * MAX(1,m) );
+        v_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldv_t * MAX(1,m) );
         if( v_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_dgebak_work)( int matrix_layout, char job, char si
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, n, m, v_t, ldv_t, v, ldv );
         /* Release memory and exit */
-        LAPACKE_free( v_t );
+        LAPACKE_work_free( v_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgebak_work", info );
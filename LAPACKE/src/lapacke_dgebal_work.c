@@ -55,7 +55,7 @@ lapack_int API_SUFFIX(LAPACKE_dgebal_work)( int matrix_layout, char job, lapack_
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'p' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 's' ) ) {
-            a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
+            a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,n) );
             if( a_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_0;
@@ -79,7 +79,7 @@ lapack_int API_SUFFIX(LAPACKE_dgebal_work)( int matrix_layout, char job, lapack_
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'p' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 's' ) ) {
-            LAPACKE_free( a_t );
+            LAPACKE_work_free( a_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
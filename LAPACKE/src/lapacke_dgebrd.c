@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_dgebrd)( int matrix_layout, lapack_int m, lapack_i
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_dgebrd)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_dgebrd_work)( matrix_layout, m, n, a, lda, d, e, tauq, taup,
                                 work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgebrd", info );
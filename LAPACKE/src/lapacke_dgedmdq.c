@@ -91,12 +91,12 @@ lapack_int API_SUFFIX(LAPACKE_dgedmdq)( int matrix_layout, char jobs, char jobz,
     lwork  = (lapack_int) work_query;
     liwork = iwork_query;
     /* Allocate memory for work arrays */
-    work  = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work  = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -108,9 +108,9 @@ lapack_int API_SUFFIX(LAPACKE_dgedmdq)( int matrix_layout, char jobs, char jobz,
                                  b, ldb, v, ldv, s, lds, work, lwork, iwork,
                                  liwork );
     /* Release memory and exit */
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_1:
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgedmdq", info );
@@ -74,14 +74,14 @@ lapack_int API_SUFFIX(LAPACKE_dgeesx_work)( int matrix_layout, char jobvs, char
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
+        a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvs, 'v' ) ) {
             vs_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvs_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvs_t * MAX(1,n) );
             if( vs_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -103,10 +103,10 @@ lapack_int API_SUFFIX(LAPACKE_dgeesx_work)( int matrix_layout, char jobvs, char
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvs, 'v' ) ) {
-            LAPACKE_free( vs_t );
+            LAPACKE_work_free( vs_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeesx_work", info );
@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeev)( int matrix_layout, char jobvl, char jobvr,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeev)( int matrix_layout, char jobvl, char jobvr,
     info = API_SUFFIX(LAPACKE_dgeev_work)( matrix_layout, jobvl, jobvr, n, a, lda, wr, wi,
                                vl, ldvl, vr, ldvr, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeev", info );
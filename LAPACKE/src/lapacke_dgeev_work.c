@@ -76,14 +76,14 @@ lapack_int API_SUFFIX(LAPACKE_dgeev_work)( int matrix_layout, char jobvl, char j
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
+        a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvl, 'v' ) ) {
             vl_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvl_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvl_t * MAX(1,n) );
             if( vl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -91,7 +91,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeev_work)( int matrix_layout, char jobvl, char j
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvr, 'v' ) ) {
             vr_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvr_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvr_t * MAX(1,n) );
             if( vr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -115,14 +115,14 @@ lapack_int API_SUFFIX(LAPACKE_dgeev_work)( int matrix_layout, char jobvl, char j
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvr, 'v' ) ) {
-            LAPACKE_free( vr_t );
+            LAPACKE_work_free( vr_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( jobvl, 'v' ) ) {
-            LAPACKE_free( vl_t );
+            LAPACKE_work_free( vl_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeev_work", info );
@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeevx)( int matrix_layout, char balanc, char jobv
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
         iwork = (lapack_int*)
-            LAPACKE_malloc( sizeof(lapack_int) * MAX(1,2*n-2) );
+            LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,2*n-2) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeevx)( int matrix_layout, char balanc, char jobv
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -86,10 +86,10 @@ lapack_int API_SUFFIX(LAPACKE_dgeevx)( int matrix_layout, char balanc, char jobv
                                 scale, abnrm, rconde, rcondv, work, lwork,
                                 iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
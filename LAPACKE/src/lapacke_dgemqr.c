@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_dgemqr)( int matrix_layout, char side, char trans,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -79,7 +79,7 @@ lapack_int API_SUFFIX(LAPACKE_dgemqr)( int matrix_layout, char side, char trans,
     info = API_SUFFIX(LAPACKE_dgemqr_work)( matrix_layout, side, trans, m, n, k, a, lda,
                                 t, tsize, c, ldc, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgemqr", info );
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_dgemqrt)( int matrix_layout, char side, char trans
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,m) * MAX(1,nb) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,m) * MAX(1,nb) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dgemqrt)( int matrix_layout, char side, char trans
     info = API_SUFFIX(LAPACKE_dgemqrt_work)( matrix_layout, side, trans, m, n, k, nb, v, ldv,
                                  t, ldt, c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgemqrt", info );
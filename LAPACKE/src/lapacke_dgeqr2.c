@@ -50,7 +50,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeqr2)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -58,7 +58,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeqr2)( int matrix_layout, lapack_int m, lapack_i
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_dgeqr2_work)( matrix_layout, m, n, a, lda, tau, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqr2", info );
@@ -0,0 +1,154 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function dgeqrf for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+lapack_int API_SUFFIX(LAPACKE_dgeqrf_batch_strided)( int matrix_layout,
+                                  lapack_int m, lapack_int n, double* a,
+                                  lapack_int lda, lapack_int stridea,
+                                  double* tau, lapack_int stridetau,
+                                  lapack_int batch_size )
+{
+    lapack_int k, info = 0, lwork = -1, mn = MIN(m,n);
+    lapack_logical blocked;
+    double work_query, work;
+#ifdef _OPENMP
+    lapack_int nt = 1;
+#endif
+    if( matrix_layout != LAPACK_COL_MAJOR &&
+        matrix_layout != LAPACK_ROW_MAJOR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch */
+    if( m < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -3 );
+        return -3;
+    }
+    if( lda < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? m : n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -5 );
+        return -5;
+    }
+    if( stridea < lda * ( matrix_layout == LAPACK_COL_MAJOR ? n : m ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -6 );
+        return -6;
+    }
+    if( stridetau < mn ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -8 );
+        return -8;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", -9 );
+        return -9;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( API_SUFFIX(LAPACKE_dge_nancheck)( matrix_layout, m, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -4;
+            }
+        }
+    }
+#endif
+    if( mn == 0 || batch_size == 0 ) {
+        return 0;
+    }
+    /* The column-major view of a row-major A is A**T, whose LQ
+     * factorization by DGELQF stores the QR factorization of A: the
+     * reflectors below the diagonal of A, R above it, and the same tau.
+     * Query the workspace once for the whole batch; the unblocked code,
+     * which does not call ILAENV, is used when DGEQRF would use it. */
+    if( matrix_layout == LAPACK_COL_MAJOR ) {
+        LAPACK_dgeqrf( &m, &n, a, &lda, tau, &work_query, &lwork, &info );
+    } else {
+        LAPACK_dgelqf( &n, &m, a, &lda, tau, &work_query, &lwork, &info );
+    }
+    lwork = MAX( n, (lapack_int)work_query );
+    blocked = ( mn > lwork / n );
+    if( !blocked ) {
+        lwork = n;
+    }
+    /* Number of multiply-adds per matrix */
+    work = (double)mn*mn*( MAX(m,n) - mn/3.0 );
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel num_threads(nt) if(nt > 1)
+#endif
+    {
+        /* Workspace of each thread */
+        double* w = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
+        lapack_int j, iinfo;
+
+        if( w == NULL ) {
+#ifdef _OPENMP
+            #pragma omp atomic write
+#endif
+            info = LAPACK_WORK_MEMORY_ERROR;
+        }
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( j = 0; j < batch_size; j++ ) {
+            double* aj = a + (size_t)j*stridea;
+            double* tj = tau + (size_t)j*stridetau;
+            if( w == NULL ) {
+                continue;
+            }
+            if( matrix_layout == LAPACK_COL_MAJOR ) {
+                if( blocked ) {
+                    LAPACK_dgeqrf( &m, &n, aj, &lda, tj, w, &lwork, &iinfo );
+                } else {
+                    LAPACK_dgeqr2( &m, &n, aj, &lda, tj, w, &iinfo );
+                }
+            } else {
+                if( blocked ) {
+                    LAPACK_dgelqf( &n, &m, aj, &lda, tj, w, &lwork, &iinfo );
+                } else {
+                    LAPACK_dgelq2( &n, &m, aj, &lda, tj, w, &iinfo );
+                }
+            }
+        }
+        LAPACKE_work_free( w );
+    }
+    if( info == LAPACK_WORK_MEMORY_ERROR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrf_batch_strided", info );
+    }
+    return info;
+}
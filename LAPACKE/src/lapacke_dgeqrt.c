@@ -51,7 +51,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeqrt)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,nb) * MAX(1,n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,nb) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_dgeqrt)( int matrix_layout, lapack_int m, lapack_i
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_dgeqrt_work)( matrix_layout, m, n, nb, a, lda, t, ldt, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrt", info );
@@ -60,13 +60,13 @@ lapack_int API_SUFFIX(LAPACKE_dgeqrt_work)( int matrix_layout, lapack_int m, lap
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
+        a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         t_t = (double*)
-            LAPACKE_malloc( sizeof(double) * ldt_t * MAX(1,MIN(m,n)) );
+            LAPACKE_work_malloc( sizeof(double) * ldt_t * MAX(1,MIN(m,n)) );
         if( t_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
@@ -83,9 +83,9 @@ lapack_int API_SUFFIX(LAPACKE_dgeqrt_work)( int matrix_layout, lapack_int m, lap
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, nb, MIN(m,n), t_t, ldt_t, t,
                            ldt );
         /* Release memory and exit */
-        LAPACKE_free( t_t );
+        LAPACKE_work_free( t_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgeqrt_work", info );
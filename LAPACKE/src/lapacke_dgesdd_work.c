@@ -88,7 +88,7 @@ lapack_int API_SUFFIX(LAPACKE_dgesdd_work)( int matrix_layout, char jobz, lapack
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
+        a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -96,7 +96,7 @@ lapack_int API_SUFFIX(LAPACKE_dgesdd_work)( int matrix_layout, char jobz, lapack
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m<n) ) ) {
             u_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldu_t * MAX(1,ncols_u) );
+                LAPACKE_work_malloc( sizeof(double) * ldu_t * MAX(1,ncols_u) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -105,7 +105,7 @@ lapack_int API_SUFFIX(LAPACKE_dgesdd_work)( int matrix_layout, char jobz, lapack
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m>=n) ) ) {
             vt_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvt_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvt_t * MAX(1,n) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -134,15 +134,15 @@ lapack_int API_SUFFIX(LAPACKE_dgesdd_work)( int matrix_layout, char jobz, lapack
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m>=n) ) ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'a' ) || API_SUFFIX(LAPACKE_lsame)( jobz, 's' ) ||
             ( API_SUFFIX(LAPACKE_lsame)( jobz, 'o' ) && (m<n) ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgesdd_work", info );
@@ -72,17 +72,17 @@ lapack_int API_SUFFIX(LAPACKE_dgesvdq)( int matrix_layout, char joba, char jobp,
     lwork = (lapack_int)work_query;
     lrwork = (lapack_int)rwork_query;
     /* Allocate memory for work arrays */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    rwork = (double*)LAPACKE_malloc( sizeof(double) * lrwork );
+    rwork = (double*)LAPACKE_work_malloc( sizeof(double) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -93,9 +93,9 @@ lapack_int API_SUFFIX(LAPACKE_dgesvdq)( int matrix_layout, char joba, char jobp,
                                  iwork, liwork, work, lwork, rwork, lrwork );
 
     /* Release memory and exit */
-    LAPACKE_free( iwork );
-    LAPACKE_free( work );
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( iwork );
+    LAPACKE_work_free( work );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgesvdq", info );
@@ -0,0 +1,296 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function dgetrs for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+/* Solves op(A)*X = B for the NL n-by-nrhs right-hand sides interleaved in
+ * b, with the LU factorizations from LAPACKE_dgetrf_batch_strided
+ * interleaved in w.  piv[i*NL+l] is the pivot row of row i in matrix l. */
+
+#define NL LAPACKE_BATCH_DLANES
+
+static void dgetrs_interleaved( lapack_logical notran, lapack_int n,
+                                lapack_int nrhs, const double* w,
+                                const lapack_int* piv, double* b )
+{
+    lapack_int i, j, k, l, p;
+    double u[NL], t;
+    const double* ck;
+    double *bj, *bl;
+
+    if( notran ) {
+        /* Apply the row interchanges to B */
+        for( l = 0; l < NL; l++ ) {
+            bl = b + l;
+            for( i = 0; i < n; i++ ) {
+                p = piv[i*NL+l] - 1;
+                for( j = 0; j < nrhs; j++ ) {
+                    t = bl[(size_t)(i+j*n)*NL];
+                    bl[(size_t)(i+j*n)*NL] = bl[(size_t)(p+j*n)*NL];
+                    bl[(size_t)(p+j*n)*NL] = t;
+                }
+            }
+        }
+    }
+    for( j = 0; j < nrhs; j++ ) {
+        bj = b + (size_t)j*n*NL;
+        if( notran ) {
+            /* Solve L*X = B, overwriting B with X */
+            for( k = 0; k < n; k++ ) {
+                ck = w + (size_t)k*n*NL;
+                for( l = 0; l < NL; l++ ) {
+                    u[l] = bj[k*NL+l];
+                }
+                for( i = k+1; i < n; i++ ) {
+                    for( l = 0; l < NL; l++ ) {
+                        bj[i*NL+l] -= ck[i*NL+l] * u[l];
+                    }
+                }
+            }
+            /* Solve U*X = B, overwriting B with X */
+            for( k = n-1; k >= 0; k-- ) {
+                ck = w + (size_t)k*n*NL;
+                for( l = 0; l < NL; l++ ) {
+                    u[l] = bj[k*NL+l] / ck[k*NL+l];
+                    bj[k*NL+l] = u[l];
+                }
+                for( i = 0; i < k; i++ ) {
+                    for( l = 0; l < NL; l++ ) {
+                        bj[i*NL+l] -= ck[i*NL+l] * u[l];
+                    }
+                }
+            }
+        } else {
+            /* Solve U**T*X = B, overwriting B with X */
+            for( k = 0; k < n; k++ ) {
+                ck = w + (size_t)k*n*NL;
+                for( l = 0; l < NL; l++ ) {
+                    u[l] = bj[k*NL+l];
+                }
+                for( i = 0; i < k; i++ ) {
+                    for( l = 0; l < NL; l++ ) {
+                        u[l] -= ck[i*NL+l] * bj[i*NL+l];
+                    }
+                }
+                for( l = 0; l < NL; l++ ) {
+                    bj[k*NL+l] = u[l] / ck[k*NL+l];
+                }
+            }
+            /* Solve L**T*X = B, overwriting B with X */
+            for( k = n-1; k >= 0; k-- ) {
+                ck = w + (size_t)k*n*NL;
+                for( l = 0; l < NL; l++ ) {
+                    u[l] = bj[k*NL+l];
+                }
+                for( i = k+1; i < n; i++ ) {
+                    for( l = 0; l < NL; l++ ) {
+                        u[l] -= ck[i*NL+l] * bj[i*NL+l];
+                    }
+                }
+                for( l = 0; l < NL; l++ ) {
+                    bj[k*NL+l] = u[l];
+                }
+            }
+        }
+    }
+    if( !notran ) {
+        /* Apply the row interchanges to the solution, in reverse order */
+        for( l = 0; l < NL; l++ ) {
+            bl = b + l;
+            for( i = n-1; i >= 0; i-- ) {
+                p = piv[i*NL+l] - 1;
+                for( j = 0; j < nrhs; j++ ) {
+                    t = bl[(size_t)(i+j*n)*NL];
+                    bl[(size_t)(i+j*n)*NL] = bl[(size_t)(p+j*n)*NL];
+                    bl[(size_t)(p+j*n)*NL] = t;
+                }
+            }
+        }
+    }
+}
+
+lapack_int API_SUFFIX(LAPACKE_dgetrs_batch_strided)( int matrix_layout,
+                                  char trans, lapack_int n, lapack_int nrhs,
+                                  const double* a, lapack_int lda,
+                                  lapack_int stridea, const lapack_int* ipiv,
+                                  lapack_int strideipiv, double* b,
+                                  lapack_int ldb, lapack_int strideb,
+                                  lapack_int batch_size )
+{
+    lapack_int k, rs, cs, rsb, csb, nchunk;
+    lapack_logical notran;
+    double work;
+#ifdef _OPENMP
+    lapack_int nt;
+#endif
+    if( matrix_layout == LAPACK_COL_MAJOR ) {
+        rs = 1;
+        cs = lda;
+        rsb = 1;
+        csb = ldb;
+    } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
+        rs = lda;
+        cs = 1;
+        rsb = ldb;
+        csb = 1;
+    } else {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch.  A stride of 0 for A
+     * and ipiv uses the same factorization for all right-hand sides. */
+    notran = API_SUFFIX(LAPACKE_lsame)( trans, 'n' );
+    if( !notran && !API_SUFFIX(LAPACKE_lsame)( trans, 't' ) &&
+        !API_SUFFIX(LAPACKE_lsame)( trans, 'c' ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -3 );
+        return -3;
+    }
+    if( nrhs < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -4 );
+        return -4;
+    }
+    if( lda < MAX(1,n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -6 );
+        return -6;
+    }
+    if( stridea != 0 && stridea < lda*n ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -7 );
+        return -7;
+    }
+    if( strideipiv != 0 && strideipiv < n ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -9 );
+        return -9;
+    }
+    if( ldb < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? n : nrhs) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -11 );
+        return -11;
+    }
+    if( strideb < ldb * ( matrix_layout == LAPACK_COL_MAJOR ? nrhs : n ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -12 );
+        return -12;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetrs_batch_strided", -13 );
+        return -13;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( ( k == 0 || stridea != 0 ) &&
+                API_SUFFIX(LAPACKE_dge_nancheck)( matrix_layout, n, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -5;
+            }
+            if( API_SUFFIX(LAPACKE_dge_nancheck)( matrix_layout, n, nrhs,
+                                                  b + (size_t)k*strideb,
+                                                  ldb ) ) {
+                return -10;
+            }
+        }
+    }
+#endif
+    if( n == 0 || nrhs == 0 ) {
+        return 0;
+    }
+    /* Number of multiply-adds per right-hand side block */
+    work = (double)n*n*nrhs;
+    if( n <= LAPACKE_BATCH_NMAX ) {
+        /* NL right-hand side blocks at a time in an interleaved copy, in
+         * blocks of at most LAPACKE_BATCH_NMAX columns */
+        nchunk = ( batch_size + NL - 1 ) / NL;
+#ifdef _OPENMP
+        nt = API_SUFFIX(LAPACKE_batch_threads)( nchunk, NL*work );
+        #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+        for( k = 0; k < nchunk; k++ ) {
+            double w[LAPACKE_BATCH_NMAX*LAPACKE_BATCH_NMAX*NL];
+            double x[LAPACKE_BATCH_NMAX*LAPACKE_BATCH_NMAX*NL];
+            lapack_int piv[LAPACKE_BATCH_NMAX*NL];
+            lapack_int i, j, jb, l, cnt = MIN( NL, batch_size - k*NL );
+            const double* ak = a + (size_t)k*NL*stridea;
+            const lapack_int* pk = ipiv + (size_t)k*NL*strideipiv;
+            double* bk = b + (size_t)k*NL*strideb;
+
+            for( l = 0; l < NL; l++ ) {
+                API_SUFFIX(LAPACKE_dge_interleave)( n, n,
+                        l < cnt ? ak + (size_t)l*stridea : NULL, rs, cs,
+                        NL, l, w );
+                for( i = 0; i < n; i++ ) {
+                    piv[i*NL+l] = l < cnt ?
+                                  pk[(size_t)l*strideipiv + i] : i + 1;
+                }
+            }
+            for( j = 0; j < nrhs; j += LAPACKE_BATCH_NMAX ) {
+                jb = MIN( LAPACKE_BATCH_NMAX, nrhs - j );
+                for( l = 0; l < NL; l++ ) {
+                    API_SUFFIX(LAPACKE_dge_interleave)( n, jb,
+                            l < cnt ? bk + (size_t)l*strideb +
+                                      (size_t)j*csb : NULL,
+                            rsb, csb, NL, l, x );
+                }
+                dgetrs_interleaved( notran, n, jb, w, piv, x );
+                for( l = 0; l < cnt; l++ ) {
+                    API_SUFFIX(LAPACKE_dge_deinterleave)( 'g', n, jb, NL, l,
+                            x, bk + (size_t)l*strideb + (size_t)j*csb,
+                            rsb, csb );
+                }
+            }
+        }
+        return 0;
+    }
+    /* One right-hand side block at a time */
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+    for( k = 0; k < batch_size; k++ ) {
+        lapack_int info;
+        if( matrix_layout == LAPACK_COL_MAJOR ) {
+            LAPACK_dgetrs( &trans, &n, &nrhs, a + (size_t)k*stridea, &lda,
+                           ipiv + (size_t)k*strideipiv,
+                           b + (size_t)k*strideb, &ldb, &info );
+        } else {
+            API_SUFFIX(LAPACKE_dgetrs_rowmajor)( trans, n, nrhs,
+                        a + (size_t)k*stridea, lda,
+                        ipiv + (size_t)k*strideipiv,
+                        b + (size_t)k*strideb, ldb );
+        }
+    }
+    return 0;
+}
@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_dgetsqrhrt)( int matrix_layout, lapack_int m, lapa
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_dgetsqrhrt)( int matrix_layout, lapack_int m, lapa
     info = API_SUFFIX(LAPACKE_dgetsqrhrt_work)( matrix_layout, m, n, mb1, nb1, nb2,
                                     a, lda, t, ldt, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgetsqrhrt", info );
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_dgges)( int matrix_layout, char jobvsl, char jobvs
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_dgges)( int matrix_layout, char jobvsl, char jobvs
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -87,10 +87,10 @@ lapack_int API_SUFFIX(LAPACKE_dgges)( int matrix_layout, char jobvsl, char jobvs
                                lda, b, ldb, sdim, alphar, alphai, beta, vsl,
                                ldvsl, vsr, ldvsr, work, lwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -88,19 +88,19 @@ lapack_int API_SUFFIX(LAPACKE_dgges_work)( int matrix_layout, char jobvsl, char
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
+        a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        b_t = (double*)LAPACKE_malloc( sizeof(double) * ldb_t * MAX(1,n) );
+        b_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvsl, 'v' ) ) {
             vsl_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvsl_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvsl_t * MAX(1,n) );
             if( vsl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -108,7 +108,7 @@ lapack_int API_SUFFIX(LAPACKE_dgges_work)( int matrix_layout, char jobvsl, char
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobvsr, 'v' ) ) {
             vsr_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvsr_t * MAX(1,n) );
+                LAPACKE_work_malloc( sizeof(double) * ldvsr_t * MAX(1,n) );
             if( vsr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_3;
@@ -137,16 +137,16 @@ lapack_int API_SUFFIX(LAPACKE_dgges_work)( int matrix_layout, char jobvsl, char
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobvsr, 'v' ) ) {
-            LAPACKE_free( vsr_t );
+            LAPACKE_work_free( vsr_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( jobvsl, 'v' ) ) {
-            LAPACKE_free( vsl_t );
+            LAPACKE_work_free( vsl_t );
         }
 exit_level_2:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgges_work", info );
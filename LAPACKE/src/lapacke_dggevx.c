@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_dggevx)( int matrix_layout, char balanc, char jobv
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'e' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_dggevx)( int matrix_layout, char balanc, char jobv
     }
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'n' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n+6) );
+        iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n+6) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_1;
@@ -91,7 +91,7 @@ lapack_int API_SUFFIX(LAPACKE_dggevx)( int matrix_layout, char balanc, char jobv
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -102,16 +102,16 @@ lapack_int API_SUFFIX(LAPACKE_dggevx)( int matrix_layout, char balanc, char jobv
                                 ldvr, ilo, ihi, lscale, rscale, abnrm, bbnrm,
                                 rconde, rcondv, work, lwork, iwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'n' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'e' ) ||
         API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_dggglm)( int matrix_layout, lapack_int n, lapack_i
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_dggglm)( int matrix_layout, lapack_int n, lapack_i
     info = API_SUFFIX(LAPACKE_dggglm_work)( matrix_layout, n, m, p, a, lda, b, ldb, d, x, y,
                                 work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dggglm", info );
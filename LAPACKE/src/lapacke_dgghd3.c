@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_dgghd3)( int matrix_layout, char compq, char compz
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -86,7 +86,7 @@ lapack_int API_SUFFIX(LAPACKE_dgghd3)( int matrix_layout, char compq, char compz
     info = API_SUFFIX(LAPACKE_dgghd3_work)( matrix_layout, compq, compz, n, ilo, ihi,
                                 a, lda, b, ldb, q, ldq, z, ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dgghd3", info );
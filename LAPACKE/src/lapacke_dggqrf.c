@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_dggqrf)( int matrix_layout, lapack_int n, lapack_i
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_dggqrf)( int matrix_layout, lapack_int n, lapack_i
     info = API_SUFFIX(LAPACKE_dggqrf_work)( matrix_layout, n, m, p, a, lda, taua, b, ldb,
                                 taub, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dggqrf", info );
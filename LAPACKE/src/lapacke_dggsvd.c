@@ -58,7 +58,7 @@ lapack_int API_SUFFIX(LAPACKE_dggsvd)( int matrix_layout, char jobu, char jobv,
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,MAX3(3*n,m,p)+n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,MAX3(3*n,m,p)+n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_dggsvd)( int matrix_layout, char jobu, char jobv,
                                 a, lda, b, ldb, alpha, beta, u, ldu, v, ldv, q,
                                 ldq, work, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dggsvd", info );
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_dggsvd3)( int matrix_layout, char jobu, char jobv,
       goto exit_level_0;
     lwork = work_query;
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_dggsvd3)( int matrix_layout, char jobu, char jobv,
                                  a, lda, b, ldb, alpha, beta, u, ldu, v, ldv, q,
                                  ldq, work, lwork, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dggsvd3", info );
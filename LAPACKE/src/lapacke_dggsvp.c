@@ -65,17 +65,17 @@ lapack_int API_SUFFIX(LAPACKE_dggsvp)( int matrix_layout, char jobu, char jobv,
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    tau = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    tau = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( tau == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,MAX3(3*n,m,p)) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,MAX3(3*n,m,p)) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -85,11 +85,11 @@ lapack_int API_SUFFIX(LAPACKE_dggsvp)( int matrix_layout, char jobu, char jobv,
                                 b, ldb, tola, tolb, k, l, u, ldu, v, ldv, q,
                                 ldq, iwork, tau, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
-    LAPACKE_free( tau );
+    LAPACKE_work_free( tau );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dggsvp", info );
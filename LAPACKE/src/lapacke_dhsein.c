@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dhsein)( int matrix_layout, char job, char eigsrc,
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) * MAX(1,n+2) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) * MAX(1,n+2) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -81,7 +81,7 @@ lapack_int API_SUFFIX(LAPACKE_dhsein)( int matrix_layout, char job, char eigsrc,
                                 ldh, wr, wi, vl, ldvl, vr, ldvr, mm, m, work,
                                 ifaill, ifailr );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dhsein", info );
@@ -72,14 +72,14 @@ lapack_int API_SUFFIX(LAPACKE_dhsein_work)( int matrix_layout, char job, char ei
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        h_t = (double*)LAPACKE_malloc( sizeof(double) * ldh_t * MAX(1,n) );
+        h_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldh_t * MAX(1,n) );
         if( h_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'l' ) ) {
             vl_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvl_t * MAX(1,mm) );
+                LAPACKE_work_malloc( sizeof(double) * ldvl_t * MAX(1,mm) );
             if( vl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -87,7 +87,7 @@ lapack_int API_SUFFIX(LAPACKE_dhsein_work)( int matrix_layout, char job, char ei
         }
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'r' ) ) {
             vr_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvr_t * MAX(1,mm) );
+                LAPACKE_work_malloc( sizeof(double) * ldvr_t * MAX(1,mm) );
             if( vr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -121,14 +121,14 @@ lapack_int API_SUFFIX(LAPACKE_dhsein_work)( int matrix_layout, char job, char ei
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'r' ) ) {
-            LAPACKE_free( vr_t );
+            LAPACKE_work_free( vr_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'l' ) ) {
-            LAPACKE_free( vl_t );
+            LAPACKE_work_free( vl_t );
         }
 exit_level_1:
-        LAPACKE_free( h_t );
+        LAPACKE_work_free( h_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dhsein_work", info );
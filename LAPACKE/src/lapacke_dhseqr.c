@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_dhseqr)( int matrix_layout, char job, char compz,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_dhseqr)( int matrix_layout, char job, char compz,
     info = API_SUFFIX(LAPACKE_dhseqr_work)( matrix_layout, job, compz, n, ilo, ihi, h, ldh,
                                 wr, wi, z, ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dhseqr", info );
@@ -51,7 +51,7 @@ lapack_int API_SUFFIX(LAPACKE_dlagge)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,m+n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,m+n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_dlagge)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_dlagge_work)( matrix_layout, m, n, kl, ku, d, a, lda, iseed,
                                 work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dlagge", info );
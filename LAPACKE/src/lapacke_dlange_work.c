@@ -59,7 +59,7 @@ double API_SUFFIX(LAPACKE_dlange_work)( int matrix_layout, char norm, lapack_int
         }
         /* Allocate memory for work array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( norm_lapack, 'i' ) ) {
-            work_lapack = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+            work_lapack = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
             if( work_lapack == NULL ) {
                 info = LAPACK_WORK_MEMORY_ERROR;
                 goto exit_level_0;
@@ -69,7 +69,7 @@ double API_SUFFIX(LAPACKE_dlange_work)( int matrix_layout, char norm, lapack_int
         res = LAPACK_dlange( &norm_lapack, &n, &m, a, &lda, work_lapack );
         /* Release memory and exit */
         if( work_lapack ) {
-            LAPACKE_free( work_lapack );
+            LAPACKE_work_free( work_lapack );
         }
 exit_level_0:
         if( info == LAPACK_WORK_MEMORY_ERROR ) {
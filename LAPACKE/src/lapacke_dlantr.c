@@ -53,7 +53,7 @@ double API_SUFFIX(LAPACKE_dlantr)( int matrix_layout, char norm, char uplo, char
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,MAX(m,n)) );
+        work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,MAX(m,n)) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -64,7 +64,7 @@ double API_SUFFIX(LAPACKE_dlantr)( int matrix_layout, char norm, char uplo, char
                                 work );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
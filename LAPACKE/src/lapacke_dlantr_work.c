@@ -65,7 +65,7 @@ double API_SUFFIX(LAPACKE_dlantr_work)( int matrix_layout, char norm, char uplo,
         }
         /* Allocate memory for work array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( norm_lapack, 'i' ) ) {
-            work_lapack = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+            work_lapack = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
             if( work_lapack == NULL ) {
                 info = LAPACK_WORK_MEMORY_ERROR;
                 goto exit_level_0;
@@ -75,7 +75,7 @@ double API_SUFFIX(LAPACKE_dlantr_work)( int matrix_layout, char norm, char uplo,
         res = LAPACK_dlantr( &norm_lapack, &uplo_lapack, &diag, &n, &m, a, &lda, work_lapack );
         /* Release memory and exit */
         if( work_lapack ) {
-            LAPACKE_free( work_lapack );
+            LAPACKE_work_free( work_lapack );
         }
 exit_level_0:
         if( info == LAPACK_WORK_MEMORY_ERROR ) {
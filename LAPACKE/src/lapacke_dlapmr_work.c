@@ -53,7 +53,7 @@ lapack_int API_SUFFIX(LAPACKE_dlapmr_work)( int matrix_layout, lapack_logical fo
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        x_t = (double*)LAPACKE_malloc( sizeof(double) * ldx_t * MAX(1,n) );
+        x_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldx_t * MAX(1,n) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_dlapmr_work)( int matrix_layout, lapack_logical fo
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, m, n, x_t, ldx_t, x, ldx );
         /* Release memory and exit */
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dlapmr_work", info );
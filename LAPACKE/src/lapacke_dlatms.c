@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_dlatms)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,3*(MAX(n,m))) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,3*(MAX(n,m))) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dlatms)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_dlatms_work)( matrix_layout, m, n, dist, iseed, sym, d, mode,
                                 cond, dmax, kl, ku, pack, a, lda, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dlatms", info );
@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_dopgtr)( int matrix_layout, char uplo, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n-1) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n-1) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_dopgtr)( int matrix_layout, char uplo, lapack_int
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_dopgtr_work)( matrix_layout, uplo, n, ap, tau, q, ldq, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dopgtr", info );
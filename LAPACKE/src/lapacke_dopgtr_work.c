@@ -54,13 +54,13 @@ lapack_int API_SUFFIX(LAPACKE_dopgtr_work)( int matrix_layout, char uplo, lapack
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        q_t = (double*)LAPACKE_malloc( sizeof(double) * ldq_t * MAX(1,n) );
+        q_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldq_t * MAX(1,n) );
         if( q_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         ap_t = (double*)
-            LAPACKE_malloc( sizeof(double) * ( MAX(1,n) * MAX(2,n+1) ) / 2 );
+            LAPACKE_work_malloc( sizeof(double) * ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( ap_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
@@ -75,9 +75,9 @@ lapack_int API_SUFFIX(LAPACKE_dopgtr_work)( int matrix_layout, char uplo, lapack
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, n, n, q_t, ldq_t, q, ldq );
         /* Release memory and exit */
-        LAPACKE_free( ap_t );
+        LAPACKE_work_free( ap_t );
 exit_level_1:
-        LAPACKE_free( q_t );
+        LAPACKE_work_free( q_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dopgtr_work", info );
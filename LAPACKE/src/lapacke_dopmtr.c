@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_dopmtr)( int matrix_layout, char side, char uplo,
         lwork = 1; /* Any value */
     }
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -78,7 +78,7 @@ lapack_int API_SUFFIX(LAPACKE_dopmtr)( int matrix_layout, char side, char uplo,
     info = API_SUFFIX(LAPACKE_dopmtr_work)( matrix_layout, side, uplo, trans, m, n, ap, tau,
                                 c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dopmtr", info );
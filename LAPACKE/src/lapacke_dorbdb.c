@@ -81,7 +81,7 @@ lapack_int API_SUFFIX(LAPACKE_dorbdb)( int matrix_layout, char trans, char signs
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -91,7 +91,7 @@ lapack_int API_SUFFIX(LAPACKE_dorbdb)( int matrix_layout, char trans, char signs
                                 x12, ldx12, x21, ldx21, x22, ldx22, theta, phi,
                                 taup1, taup2, tauq1, tauq2, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dorbdb", info );
@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_dorgtsqr_row)( int matrix_layout, lapack_int m, la
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_dorgtsqr_row)( int matrix_layout, lapack_int m, la
     info = API_SUFFIX(LAPACKE_dorgtsqr_row_work)( matrix_layout, m, n, mb, nb,
                                       a, lda, t, ldt, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dorgtsqr_row", info );
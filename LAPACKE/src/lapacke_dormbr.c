@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dormbr)( int matrix_layout, char vect, char side,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_dormbr)( int matrix_layout, char vect, char side,
     info = API_SUFFIX(LAPACKE_dormbr_work)( matrix_layout, vect, side, trans, m, n, k, a,
                                 lda, tau, c, ldc, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dormbr", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_dpbstf_work)( int matrix_layout, char uplo, lapack
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        bb_t = (double*)LAPACKE_malloc( sizeof(double) * ldbb_t * MAX(1,n) );
+        bb_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldbb_t * MAX(1,n) );
         if( bb_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_dpbstf_work)( int matrix_layout, char uplo, lapack
         API_SUFFIX(LAPACKE_dpb_trans)( LAPACK_COL_MAJOR, uplo, n, kb, bb_t, ldbb_t, bb,
                            ldbb );
         /* Release memory and exit */
-        LAPACKE_free( bb_t );
+        LAPACKE_work_free( bb_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpbstf_work", info );
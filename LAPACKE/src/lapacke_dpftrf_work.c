@@ -46,7 +46,7 @@ lapack_int API_SUFFIX(LAPACKE_dpftrf_work)( int matrix_layout, char transr, char
         double* a_t = NULL;
         /* Allocate memory for temporary array(s) */
         a_t = (double*)
-            LAPACKE_malloc( sizeof(double) * ( MAX(1,n) * MAX(2,n+1) ) / 2 );
+            LAPACKE_work_malloc( sizeof(double) * ( MAX(1,n) * MAX(2,n+1) ) / 2 );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_dpftrf_work)( int matrix_layout, char transr, char
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_dpf_trans)( LAPACK_COL_MAJOR, transr, uplo, n, a_t, a );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpftrf_work", info );
@@ -0,0 +1,194 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function dpotrf for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include <math.h>
+#include "lapacke_utils.h"
+
+/* Cholesky factorization L*L**T of the NL n-by-n matrices interleaved in
+ * w, left-looking as in DPOTF2, from and into their lower triangles.
+ * info[l] is set as by DPOTRF; the factorization of a matrix that is not
+ * positive definite is continued with a unit pivot, and must be redone. */
+
+#define NL LAPACKE_BATCH_DLANES
+
+static void dpotrf_interleaved( lapack_int n, double* w, lapack_int* info )
+{
+    lapack_int i, j, k, l;
+    double r[NL], u[NL], t;
+    double *cj, *ck;
+
+    for( l = 0; l < NL; l++ ) {
+        info[l] = 0;
+    }
+    for( j = 0; j < n; j++ ) {
+        cj = w + (size_t)j*n*NL;
+        /* Update column j with the previous columns */
+        for( k = 0; k < j; k++ ) {
+            ck = w + (size_t)k*n*NL;
+            for( l = 0; l < NL; l++ ) {
+                u[l] = ck[j*NL+l];
+            }
+            for( i = j; i < n; i++ ) {
+                for( l = 0; l < NL; l++ ) {
+                    cj[i*NL+l] -= ck[i*NL+l] * u[l];
+                }
+            }
+        }
+        /* Compute L(j,j), testing for non-positive-definiteness */
+        for( l = 0; l < NL; l++ ) {
+            t = cj[j*NL+l];
+            info[l] = ( info[l] == 0 && !( t > 0.0 ) ) ? j + 1 : info[l];
+            t = sqrt( ( t > 0.0 ) ? t : 1.0 );
+            cj[j*NL+l] = t;
+            r[l] = 1.0 / t;
+        }
+        /* Compute elements j+1:n-1 of column j */
+        for( i = j+1; i < n; i++ ) {
+            for( l = 0; l < NL; l++ ) {
+                cj[i*NL+l] *= r[l];
+            }
+        }
+    }
+}
+
+lapack_int API_SUFFIX(LAPACKE_dpotrf_batch_strided)( int matrix_layout,
+                                  char uplo, lapack_int n, double* a,
+                                  lapack_int lda, lapack_int stridea,
+                                  lapack_int batch_size, lapack_int* info )
+{
+    lapack_int k, rs, cs, nchunk;
+    lapack_logical lower;
+    char uplo_t;
+    double work;
+#ifdef _OPENMP
+    lapack_int nt;
+#endif
+    if( matrix_layout != LAPACK_COL_MAJOR &&
+        matrix_layout != LAPACK_ROW_MAJOR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrf_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch */
+    lower = API_SUFFIX(LAPACKE_lsame)( uplo, 'l' );
+    if( !lower && !API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrf_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrf_batch_strided", -3 );
+        return -3;
+    }
+    if( lda < MAX(1,n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrf_batch_strided", -5 );
+        return -5;
+    }
+    if( stridea < lda*n ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrf_batch_strided", -6 );
+        return -6;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrf_batch_strided", -7 );
+        return -7;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( API_SUFFIX(LAPACKE_dpo_nancheck)( matrix_layout, uplo, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -4;
+            }
+        }
+    }
+#endif
+    /* The column-major view of a row-major A is A**T, whose Cholesky
+     * factor in the other triangle is the transpose of the requested one */
+    uplo_t = uplo;
+    if( matrix_layout == LAPACK_ROW_MAJOR ) {
+        uplo_t = lower ? 'u' : 'l';
+    }
+    /* Number of multiply-adds per matrix */
+    work = (double)n*n*n/6.0;
+    if( n <= LAPACKE_BATCH_NMAX && n > 0 ) {
+        /* NL matrices at a time in an interleaved copy of L, or of U**T
+         * for UPLO = 'U' */
+        if( API_SUFFIX(LAPACKE_lsame)( uplo_t, 'l' ) ) {
+            rs = 1;
+            cs = lda;
+        } else {
+            rs = lda;
+            cs = 1;
+        }
+        nchunk = ( batch_size + NL - 1 ) / NL;
+#ifdef _OPENMP
+        nt = API_SUFFIX(LAPACKE_batch_threads)( nchunk, NL*work );
+        #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+        for( k = 0; k < nchunk; k++ ) {
+            double w[LAPACKE_BATCH_NMAX*LAPACKE_BATCH_NMAX*NL];
+            lapack_int inf[NL];
+            lapack_int l, cnt = MIN( NL, batch_size - k*NL );
+            double* ak = a + (size_t)k*NL*stridea;
+
+            for( l = 0; l < NL; l++ ) {
+                API_SUFFIX(LAPACKE_dge_interleave)( n, n,
+                        l < cnt ? ak + (size_t)l*stridea : NULL, rs, cs,
+                        NL, l, w );
+            }
+            dpotrf_interleaved( n, w, inf );
+            for( l = 0; l < cnt; l++ ) {
+                if( inf[l] == 0 ) {
+                    API_SUFFIX(LAPACKE_dge_deinterleave)( 'l', n, n, NL, l,
+                            w, ak + (size_t)l*stridea, rs, cs );
+                } else {
+                    /* A is untouched; leave it as DPOTRF2 would */
+                    LAPACK_dpotrf2( &uplo_t, &n, ak + (size_t)l*stridea,
+                                    &lda, &inf[l] );
+                }
+                info[k*NL+l] = inf[l];
+            }
+        }
+        return 0;
+    }
+    /* One matrix at a time, by the recursive Cholesky factorization of
+     * DPOTRF2, which does not call ILAENV */
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+    for( k = 0; k < batch_size; k++ ) {
+        LAPACK_dpotrf2( &uplo_t, &n, a + (size_t)k*stridea, &lda, &info[k] );
+    }
+    return 0;
+}
@@ -0,0 +1,226 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function dpotrs for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+/* Solves L*L**T*X = B for the NL n-by-nrhs right-hand sides interleaved
+ * in b, with the Cholesky factors L interleaved in w. */
+
+#define NL LAPACKE_BATCH_DLANES
+
+static void dpotrs_interleaved( lapack_int n, lapack_int nrhs,
+                                const double* w, double* b )
+{
+    lapack_int i, j, k, l;
+    double u[NL];
+    const double* ck;
+    double* bj;
+
+    for( j = 0; j < nrhs; j++ ) {
+        bj = b + (size_t)j*n*NL;
+        /* Solve L*X = B, overwriting B with X */
+        for( k = 0; k < n; k++ ) {
+            ck = w + (size_t)k*n*NL;
+            for( l = 0; l < NL; l++ ) {
+                u[l] = bj[k*NL+l] / ck[k*NL+l];
+                bj[k*NL+l] = u[l];
+            }
+            for( i = k+1; i < n; i++ ) {
+                for( l = 0; l < NL; l++ ) {
+                    bj[i*NL+l] -= ck[i*NL+l] * u[l];
+                }
+            }
+        }
+        /* Solve L**T*X = B, overwriting B with X */
+        for( k = n-1; k >= 0; k-- ) {
+            ck = w + (size_t)k*n*NL;
+            for( l = 0; l < NL; l++ ) {
+                u[l] = bj[k*NL+l];
+            }
+            for( i = k+1; i < n; i++ ) {
+                for( l = 0; l < NL; l++ ) {
+                    u[l] -= ck[i*NL+l] * bj[i*NL+l];
+                }
+            }
+            for( l = 0; l < NL; l++ ) {
+                bj[k*NL+l] = u[l] / ck[k*NL+l];
+            }
+        }
+    }
+}
+
+lapack_int API_SUFFIX(LAPACKE_dpotrs_batch_strided)( int matrix_layout,
+                                  char uplo, lapack_int n, lapack_int nrhs,
+                                  const double* a, lapack_int lda,
+                                  lapack_int stridea, double* b,
+                                  lapack_int ldb, lapack_int strideb,
+                                  lapack_int batch_size )
+{
+    lapack_int k, rs, cs, rsb, csb, nchunk;
+    lapack_logical lower;
+    double work;
+#ifdef _OPENMP
+    lapack_int nt;
+#endif
+    if( matrix_layout == LAPACK_COL_MAJOR ) {
+        rsb = 1;
+        csb = ldb;
+    } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
+        rsb = ldb;
+        csb = 1;
+    } else {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch.  A stride of 0 for A
+     * uses the same factorization for all right-hand sides. */
+    lower = API_SUFFIX(LAPACKE_lsame)( uplo, 'l' );
+    if( !lower && !API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -3 );
+        return -3;
+    }
+    if( nrhs < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -4 );
+        return -4;
+    }
+    if( lda < MAX(1,n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -6 );
+        return -6;
+    }
+    if( stridea != 0 && stridea < lda*n ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -7 );
+        return -7;
+    }
+    if( ldb < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? n : nrhs) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -9 );
+        return -9;
+    }
+    if( strideb < ldb * ( matrix_layout == LAPACK_COL_MAJOR ? nrhs : n ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -10 );
+        return -10;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_batch_strided", -11 );
+        return -11;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( ( k == 0 || stridea != 0 ) &&
+                API_SUFFIX(LAPACKE_dpo_nancheck)( matrix_layout, uplo, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -5;
+            }
+            if( API_SUFFIX(LAPACKE_dge_nancheck)( matrix_layout, n, nrhs,
+                                                  b + (size_t)k*strideb,
+                                                  ldb ) ) {
+                return -8;
+            }
+        }
+    }
+#endif
+    if( n == 0 || nrhs == 0 ) {
+        return 0;
+    }
+    /* Number of multiply-adds per right-hand side block */
+    work = (double)n*n*nrhs;
+    if( n <= LAPACKE_BATCH_NMAX ) {
+        /* NL right-hand side blocks at a time in an interleaved copy, in
+         * blocks of at most LAPACKE_BATCH_NMAX columns, with the factor
+         * L, or U**T for UPLO = 'U' */
+        if( lower == ( matrix_layout == LAPACK_COL_MAJOR ) ) {
+            rs = 1;
+            cs = lda;
+        } else {
+            rs = lda;
+            cs = 1;
+        }
+        nchunk = ( batch_size + NL - 1 ) / NL;
+#ifdef _OPENMP
+        nt = API_SUFFIX(LAPACKE_batch_threads)( nchunk, NL*work );
+        #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+        for( k = 0; k < nchunk; k++ ) {
+            double w[LAPACKE_BATCH_NMAX*LAPACKE_BATCH_NMAX*NL];
+            double x[LAPACKE_BATCH_NMAX*LAPACKE_BATCH_NMAX*NL];
+            lapack_int j, jb, l, cnt = MIN( NL, batch_size - k*NL );
+            const double* ak = a + (size_t)k*NL*stridea;
+            double* bk = b + (size_t)k*NL*strideb;
+
+            for( l = 0; l < NL; l++ ) {
+                API_SUFFIX(LAPACKE_dge_interleave)( n, n,
+                        l < cnt ? ak + (size_t)l*stridea : NULL, rs, cs,
+                        NL, l, w );
+            }
+            for( j = 0; j < nrhs; j += LAPACKE_BATCH_NMAX ) {
+                jb = MIN( LAPACKE_BATCH_NMAX, nrhs - j );
+                for( l = 0; l < NL; l++ ) {
+                    API_SUFFIX(LAPACKE_dge_interleave)( n, jb,
+                            l < cnt ? bk + (size_t)l*strideb +
+                                      (size_t)j*csb : NULL,
+                            rsb, csb, NL, l, x );
+                }
+                dpotrs_interleaved( n, jb, w, x );
+                for( l = 0; l < cnt; l++ ) {
+                    API_SUFFIX(LAPACKE_dge_deinterleave)( 'g', n, jb, NL, l,
+                            x, bk + (size_t)l*strideb + (size_t)j*csb,
+                            rsb, csb );
+                }
+            }
+        }
+        return 0;
+    }
+    /* One right-hand side block at a time */
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+    for( k = 0; k < batch_size; k++ ) {
+        lapack_int info;
+        if( matrix_layout == LAPACK_COL_MAJOR ) {
+            LAPACK_dpotrs( &uplo, &n, &nrhs, a + (size_t)k*stridea, &lda,
+                           b + (size_t)k*strideb, &ldb, &info );
+        } else {
+            API_SUFFIX(LAPACKE_dpotrs_rowmajor)( uplo, n, nrhs,
+                        a + (size_t)k*stridea, lda,
+                        b + (size_t)k*strideb, ldb );
+        }
+    }
+    return 0;
+}
@@ -44,50 +44,34 @@ lapack_int API_SUFFIX(LAPACKE_dpotrs_work)( int matrix_layout, char uplo, lapack
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        lapack_int ldb_t = MAX(1,n);
-        double* a_t = NULL;
-        double* b_t = NULL;
-        /* Check leading dimension(s) */
-        if( lda < n ) {
-            info = -6;
+        /* Solve in place, see LAPACKE_dpotrs_rowmajor */
+        if( !API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) &&
+            !API_SUFFIX(LAPACKE_lsame)( uplo, 'l' ) ) {
+            info = -2;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_work", info );
             return info;
         }
-        if( ldb < nrhs ) {
-            info = -8;
+        if( n < 0 ) {
+            info = -3;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        b_t = (double*)LAPACKE_malloc( sizeof(double) * ldb_t * MAX(1,nrhs) );
-        if( b_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_1;
+        if( nrhs < 0 ) {
+            info = -4;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_work", info );
+            return info;
         }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_dpo_trans)( matrix_layout, uplo, n, a, lda, a_t, lda_t );
-        API_SUFFIX(LAPACKE_dge_trans)( matrix_layout, n, nrhs, b, ldb, b_t, ldb_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_dpotrs( &uplo, &n, &nrhs, a_t, &lda_t, b_t, &ldb_t, &info );
-        if( info < 0 ) {
-            info = info - 1;
+        if( lda < n ) {
+            info = -6;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_work", info );
+            return info;
         }
-        /* Transpose output matrices */
-        API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, n, nrhs, b_t, ldb_t, b, ldb );
-        /* Release memory and exit */
-        LAPACKE_free( b_t );
-exit_level_1:
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
+        if( ldb < nrhs ) {
+            info = -8;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_work", info );
+            return info;
         }
+        API_SUFFIX(LAPACKE_dpotrs_rowmajor)( uplo, n, nrhs, a, lda, b, ldb );
     } else {
         info = -1;
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpotrs_work", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_dptcon)( lapack_int n, const double* d, const doub
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_dptcon)( lapack_int n, const double* d, const doub
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_dptcon_work)( n, d, e, anorm, rcond, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dptcon", info );
@@ -53,7 +53,7 @@ lapack_int API_SUFFIX(LAPACKE_dpteqr_work)( int matrix_layout, char compz, lapac
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        z_t = (double*)LAPACKE_malloc( sizeof(double) * ldz_t * MAX(1,n) );
+        z_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldz_t * MAX(1,n) );
         if( z_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_dpteqr_work)( int matrix_layout, char compz, lapac
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, n, n, z_t, ldz_t, z, ldz );
         /* Release memory and exit */
-        LAPACKE_free( z_t );
+        LAPACKE_work_free( z_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dpteqr_work", info );
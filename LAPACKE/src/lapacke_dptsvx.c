@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_dptsvx)( int matrix_layout, char fact, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -78,7 +78,7 @@ lapack_int API_SUFFIX(LAPACKE_dptsvx)( int matrix_layout, char fact, lapack_int
     info = API_SUFFIX(LAPACKE_dptsvx_work)( matrix_layout, fact, n, nrhs, d, e, df, ef, b,
                                 ldb, x, ldx, rcond, ferr, berr, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dptsvx", info );
@@ -51,7 +51,7 @@ lapack_int API_SUFFIX(LAPACKE_dsbev)( int matrix_layout, char jobz, char uplo, l
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,3*n-2) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,3*n-2) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_dsbev)( int matrix_layout, char jobz, char uplo, l
     info = API_SUFFIX(LAPACKE_dsbev_work)( matrix_layout, jobz, uplo, n, kd, ab, ldab, w, z,
                                ldz, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsbev", info );
@@ -55,7 +55,7 @@ lapack_int API_SUFFIX(LAPACKE_dsbgst)( int matrix_layout, char vect, char uplo,
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_dsbgst)( int matrix_layout, char vect, char uplo,
     info = API_SUFFIX(LAPACKE_dsbgst_work)( matrix_layout, vect, uplo, n, ka, kb, ab, ldab,
                                 bb, ldbb, x, ldx, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsbgst", info );
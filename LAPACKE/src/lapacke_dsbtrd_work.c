@@ -62,13 +62,13 @@ lapack_int API_SUFFIX(LAPACKE_dsbtrd_work)( int matrix_layout, char vect, char u
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        ab_t = (double*)LAPACKE_malloc( sizeof(double) * ldab_t * MAX(1,n) );
+        ab_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'u' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
-            q_t = (double*)LAPACKE_malloc( sizeof(double) * ldq_t * MAX(1,n) );
+            q_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldq_t * MAX(1,n) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -93,10 +93,10 @@ lapack_int API_SUFFIX(LAPACKE_dsbtrd_work)( int matrix_layout, char vect, char u
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'u' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsbtrd_work", info );
@@ -56,12 +56,12 @@ lapack_int API_SUFFIX(LAPACKE_dsgesv)( int matrix_layout, lapack_int n, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    swork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) * MAX(1,n+nrhs) );
+    swork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) * MAX(1,n+nrhs) );
     if( swork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) * MAX(1,nrhs) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) * MAX(1,nrhs) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -70,9 +70,9 @@ lapack_int API_SUFFIX(LAPACKE_dsgesv)( int matrix_layout, lapack_int n, lapack_i
     info = API_SUFFIX(LAPACKE_dsgesv_work)( matrix_layout, n, nrhs, a, lda, ipiv, b, ldb, x,
                                 ldx, work, swork, iter );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( swork );
+    LAPACKE_work_free( swork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsgesv", info );
@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_dspgv)( int matrix_layout, lapack_int itype, char
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,3*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,3*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_dspgv)( int matrix_layout, lapack_int itype, char
     info = API_SUFFIX(LAPACKE_dspgv_work)( matrix_layout, itype, jobz, uplo, n, ap, bp, w, z,
                                ldz, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dspgv", info );
@@ -56,12 +56,12 @@ lapack_int API_SUFFIX(LAPACKE_dsposv)( int matrix_layout, char uplo, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    swork = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) * MAX(1,n+nrhs) );
+    swork = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) * MAX(1,n+nrhs) );
     if( swork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) * MAX(1,nrhs) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) * MAX(1,nrhs) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -70,9 +70,9 @@ lapack_int API_SUFFIX(LAPACKE_dsposv)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_dsposv_work)( matrix_layout, uplo, n, nrhs, a, lda, b, ldb, x,
                                 ldx, work, swork, iter );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( swork );
+    LAPACKE_work_free( swork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsposv", info );
@@ -50,7 +50,7 @@ lapack_int API_SUFFIX(LAPACKE_dsptri)( int matrix_layout, char uplo, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -58,7 +58,7 @@ lapack_int API_SUFFIX(LAPACKE_dsptri)( int matrix_layout, char uplo, lapack_int
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_dsptri_work)( matrix_layout, uplo, n, ap, ipiv, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsptri", info );
@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_dstev)( int matrix_layout, char jobz, lapack_int n
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-        work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*n-2) );
+        work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*n-2) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_dstev)( int matrix_layout, char jobz, lapack_int n
     info = API_SUFFIX(LAPACKE_dstev_work)( matrix_layout, jobz, n, d, e, z, ldz, work );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_dsyev_2stage)( int matrix_layout, char jobz, char
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_dsyev_2stage)( int matrix_layout, char jobz, char
     info = API_SUFFIX(LAPACKE_dsyev_2stage_work)( matrix_layout, jobz, uplo, n, a, lda, w, work,
                                lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsyev_2stage", info );
@@ -44,9 +44,11 @@ lapack_int API_SUFFIX(LAPACKE_dsyev_work)( int matrix_layout, char jobz, char up
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        double* a_t = NULL;
-        /* Check leading dimension(s) */
+        lapack_int lda_t = MAX(1,lda);
+        char uplo_t = API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ? 'l' :
+                      ( API_SUFFIX(LAPACKE_lsame)( uplo, 'l' ) ? 'u' : uplo );
+        /* The column-major view of A is A**T = A, which is stored in the
+         * other triangle; the eigenvectors are transposed back in place */
         if( lda < n ) {
             info = -6;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsyev_work", info );
@@ -54,33 +56,19 @@ lapack_int API_SUFFIX(LAPACKE_dsyev_work)( int matrix_layout, char jobz, char up
         }
         /* Query optimal working array(s) size if requested */
         if( lwork == -1 ) {
-            LAPACK_dsyev( &jobz, &uplo, &n, a, &lda_t, w, work, &lwork, &info );
+            LAPACK_dsyev( &jobz, &uplo_t, &n, a, &lda_t, w, work, &lwork,
+                          &info );
             return (info < 0) ? (info - 1) : info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_dsy_trans)( matrix_layout, uplo, n, a, lda, a_t, lda_t );
         /* Call LAPACK function and adjust info */
-        LAPACK_dsyev( &jobz, &uplo, &n, a_t, &lda_t, w, work, &lwork, &info );
+        LAPACK_dsyev( &jobz, &uplo_t, &n, a, &lda_t, w, work, &lwork,
+                      &info );
         if( info < 0 ) {
             info = info - 1;
         }
         /* Transpose output matrices */
-        if ( jobz == 'V' || jobz == 'v' ) {
-            API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, n, n, a_t, lda_t, a, lda );
-        } else {
-            API_SUFFIX(LAPACKE_dsy_trans)( LAPACK_COL_MAJOR, uplo, n, a_t, lda_t, a, lda );
-        }
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsyev_work", info );
+        if( info >= 0 && API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
+            API_SUFFIX(LAPACKE_dge_trans_inplace)( n, a, lda );
         }
     } else {
         info = -1;
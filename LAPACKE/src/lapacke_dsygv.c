@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_dsygv)( int matrix_layout, lapack_int itype, char
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_dsygv)( int matrix_layout, lapack_int itype, char
     info = API_SUFFIX(LAPACKE_dsygv_work)( matrix_layout, itype, jobz, uplo, n, a, lda, b,
                                ldb, w, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsygv", info );
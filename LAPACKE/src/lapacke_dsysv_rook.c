@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_dsysv_rook)( int matrix_layout, char uplo, lapack_
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_dsysv_rook)( int matrix_layout, char uplo, lapack_
     info = API_SUFFIX(LAPACKE_dsysv_rook_work)( matrix_layout, uplo, n, nrhs, a, lda, ipiv,
                                     b, ldb, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsysv_rook", info );
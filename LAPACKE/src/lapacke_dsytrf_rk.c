@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytrf_rk)( int matrix_layout, char uplo, lapack_i
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytrf_rk)( int matrix_layout, char uplo, lapack_i
     info = API_SUFFIX(LAPACKE_dsytrf_rk_work)( matrix_layout, uplo, n, a, lda, e, ipiv, work,
                                 lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsytrf_rk", info );
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytri2)( int matrix_layout, char uplo, lapack_int
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (double*)
-        LAPACKE_malloc( sizeof(double) * lwork );
+        LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytri2)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_dsytri2_work)( matrix_layout, uplo, n, a, lda, ipiv, work,
                                  lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsytri2", info );
@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytrs2)( int matrix_layout, char uplo, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytrs2)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_dsytrs2_work)( matrix_layout, uplo, n, nrhs, a, lda, ipiv, b,
                                  ldb, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsytrs2", info );
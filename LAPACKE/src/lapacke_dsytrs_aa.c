@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytrs_aa)( int matrix_layout, char uplo, lapack_i
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
     work = (double*)
-        LAPACKE_malloc( sizeof(double) * lwork );
+        LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_dsytrs_aa)( int matrix_layout, char uplo, lapack_i
     info = API_SUFFIX(LAPACKE_dsytrs_aa_work)( matrix_layout, uplo, n, nrhs, a, lda, ipiv, b,
                                  ldb, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dsytrs_aa", info );
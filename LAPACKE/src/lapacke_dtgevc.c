@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgevc)( int matrix_layout, char side, char howmny
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,6*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,6*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgevc)( int matrix_layout, char side, char howmny
     info = API_SUFFIX(LAPACKE_dtgevc_work)( matrix_layout, side, howmny, select, n, s, lds,
                                 p, ldp, vl, ldvl, vr, ldvr, mm, m, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtgevc", info );
@@ -78,19 +78,19 @@ lapack_int API_SUFFIX(LAPACKE_dtgevc_work)( int matrix_layout, char side, char h
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        s_t = (double*)LAPACKE_malloc( sizeof(double) * lds_t * MAX(1,n) );
+        s_t = (double*)LAPACKE_work_malloc( sizeof(double) * lds_t * MAX(1,n) );
         if( s_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        p_t = (double*)LAPACKE_malloc( sizeof(double) * ldp_t * MAX(1,n) );
+        p_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldp_t * MAX(1,n) );
         if( p_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'l' ) ) {
             vl_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvl_t * MAX(1,mm) );
+                LAPACKE_work_malloc( sizeof(double) * ldvl_t * MAX(1,mm) );
             if( vl_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -98,7 +98,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgevc_work)( int matrix_layout, char side, char h
         }
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'r' ) ) {
             vr_t = (double*)
-                LAPACKE_malloc( sizeof(double) * ldvr_t * MAX(1,mm) );
+                LAPACKE_work_malloc( sizeof(double) * ldvr_t * MAX(1,mm) );
             if( vr_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_3;
@@ -132,16 +132,16 @@ lapack_int API_SUFFIX(LAPACKE_dtgevc_work)( int matrix_layout, char side, char h
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'r' ) ) {
-            LAPACKE_free( vr_t );
+            LAPACKE_work_free( vr_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( side, 'b' ) || API_SUFFIX(LAPACKE_lsame)( side, 'l' ) ) {
-            LAPACKE_free( vl_t );
+            LAPACKE_work_free( vl_t );
         }
 exit_level_2:
-        LAPACKE_free( p_t );
+        LAPACKE_work_free( p_t );
 exit_level_1:
-        LAPACKE_free( s_t );
+        LAPACKE_work_free( s_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtgevc_work", info );
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgexc)( int matrix_layout, lapack_logical wantq,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -85,7 +85,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgexc)( int matrix_layout, lapack_logical wantq,
     info = API_SUFFIX(LAPACKE_dtgexc_work)( matrix_layout, wantq, wantz, n, a, lda, b, ldb,
                                 q, ldq, z, ldz, ifst, ilst, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtgexc", info );
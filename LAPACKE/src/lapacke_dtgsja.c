@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgsja)( int matrix_layout, char jobu, char jobv,
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -90,7 +90,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgsja)( int matrix_layout, char jobu, char jobv,
                                 a, lda, b, ldb, tola, tolb, alpha, beta, u, ldu,
                                 v, ldv, q, ldq, work, ncycle );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtgsja", info );
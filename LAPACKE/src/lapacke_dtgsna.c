@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgsna)( int matrix_layout, char job, char howmny,
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,n+6) );
+        iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,n+6) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -87,7 +87,7 @@ lapack_int API_SUFFIX(LAPACKE_dtgsna)( int matrix_layout, char job, char howmny,
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+        work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_1;
@@ -99,11 +99,11 @@ lapack_int API_SUFFIX(LAPACKE_dtgsna)( int matrix_layout, char job, char howmny,
                                 lwork, iwork );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
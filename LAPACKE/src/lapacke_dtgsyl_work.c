@@ -102,32 +102,32 @@ lapack_int API_SUFFIX(LAPACKE_dtgsyl_work)( int matrix_layout, char trans, lapac
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (double*)LAPACKE_malloc( sizeof(double) * lda_t * MAX(1,m) );
+        a_t = (double*)LAPACKE_work_malloc( sizeof(double) * lda_t * MAX(1,m) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        b_t = (double*)LAPACKE_malloc( sizeof(double) * ldb_t * MAX(1,n) );
+        b_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
-        c_t = (double*)LAPACKE_malloc( sizeof(double) * ldc_t * MAX(1,n) );
+        c_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldc_t * MAX(1,n) );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
-        d_t = (double*)LAPACKE_malloc( sizeof(double) * ldd_t * MAX(1,m) );
+        d_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldd_t * MAX(1,m) );
         if( d_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_3;
         }
-        e_t = (double*)LAPACKE_malloc( sizeof(double) * lde_t * MAX(1,n) );
+        e_t = (double*)LAPACKE_work_malloc( sizeof(double) * lde_t * MAX(1,n) );
         if( e_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_4;
         }
-        f_t = (double*)LAPACKE_malloc( sizeof(double) * ldf_t * MAX(1,n) );
+        f_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldf_t * MAX(1,n) );
         if( f_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_5;
@@ -150,17 +150,17 @@ lapack_int API_SUFFIX(LAPACKE_dtgsyl_work)( int matrix_layout, char trans, lapac
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc );
         API_SUFFIX(LAPACKE_dge_trans)( LAPACK_COL_MAJOR, m, n, f_t, ldf_t, f, ldf );
         /* Release memory and exit */
-        LAPACKE_free( f_t );
+        LAPACKE_work_free( f_t );
 exit_level_5:
-        LAPACKE_free( e_t );
+        LAPACKE_work_free( e_t );
 exit_level_4:
-        LAPACKE_free( d_t );
+        LAPACKE_work_free( d_t );
 exit_level_3:
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_2:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtgsyl_work", info );
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_dtpmqrt)( int matrix_layout, char side, char trans
     /* Allocate memory for working array(s) */
     lwork = API_SUFFIX(LAPACKE_lsame)( side, 'L' ) ? MAX(1,nb) * MAX(1,n) :
                        ( API_SUFFIX(LAPACKE_lsame)( side, 'R' ) ? MAX(1,m) * MAX(1,nb) : 0 );
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -83,7 +83,7 @@ lapack_int API_SUFFIX(LAPACKE_dtpmqrt)( int matrix_layout, char side, char trans
     info = API_SUFFIX(LAPACKE_dtpmqrt_work)( matrix_layout, side, trans, m, n, k, l, nb, v,
                                  ldv, t, ldt, a, lda, b, ldb, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtpmqrt", info );
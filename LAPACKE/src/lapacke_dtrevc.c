@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_dtrevc)( int matrix_layout, char side, char howmny
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,3*n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,3*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_dtrevc)( int matrix_layout, char side, char howmny
     info = API_SUFFIX(LAPACKE_dtrevc_work)( matrix_layout, side, howmny, select, n, t, ldt,
                                 vl, ldvl, vr, ldvr, mm, m, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtrevc", info );
@@ -56,7 +56,7 @@ lapack_int API_SUFFIX(LAPACKE_dtrexc)( int matrix_layout, char compq, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_dtrexc)( int matrix_layout, char compq, lapack_int
     info = API_SUFFIX(LAPACKE_dtrexc_work)( matrix_layout, compq, n, t, ldt, q, ldq, ifst,
                                 ilst, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtrexc", info );
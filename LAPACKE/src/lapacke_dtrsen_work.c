@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_dtrsen_work)( int matrix_layout, char job, char co
             return info;
         }
         /* Allocate memory for temporary array T */
-        t_t = (double*)LAPACKE_malloc( sizeof(double) * ldt_t * MAX(1,n) );
+        t_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldt_t * MAX(1,n) );
         if( t_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -76,12 +76,12 @@ lapack_int API_SUFFIX(LAPACKE_dtrsen_work)( int matrix_layout, char job, char co
         if( liwork == -1 || lwork == -1 ) {
             LAPACK_dtrsen( &job, &compq, select, &n, t_t, &ldt_t, q, &ldq_t, wr,
                            wi, m, s, sep, work, &lwork, iwork, &liwork, &info );
-            LAPACKE_free( t_t );
+            LAPACKE_work_free( t_t );
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'v' ) ) {
-            q_t = (double*)LAPACKE_malloc( sizeof(double) * ldq_t * MAX(1,n) );
+            q_t = (double*)LAPACKE_work_malloc( sizeof(double) * ldq_t * MAX(1,n) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -104,10 +104,10 @@ lapack_int API_SUFFIX(LAPACKE_dtrsen_work)( int matrix_layout, char job, char co
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'v' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( t_t );
+        LAPACKE_work_free( t_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_dtrsen_work", info );
@@ -68,14 +68,14 @@ lapack_int API_SUFFIX(LAPACKE_dtrsna)( int matrix_layout, char job, char howmny,
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
         iwork = (lapack_int*)
-            LAPACKE_malloc( sizeof(lapack_int) * MAX(1,2*(n-1)) );
+            LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,2*(n-1)) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
         }
     }
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        work = (double*)LAPACKE_malloc( sizeof(double) * ldwork * MAX(1,n+6) );
+        work = (double*)LAPACKE_work_malloc( sizeof(double) * ldwork * MAX(1,n+6) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_1;
@@ -87,11 +87,11 @@ lapack_int API_SUFFIX(LAPACKE_dtrsna)( int matrix_layout, char job, char howmny,
                                 iwork );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
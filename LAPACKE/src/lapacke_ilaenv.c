@@ -0,0 +1,113 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************
+* Contents: Native C interface to the ILAENV tuning table
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+/* The tuning table of ILAENV holds values of the ILAENV parameters that
+ * replace the built-in ones: an entry (ispec, name) is returned by
+ * ILAENV( ispec, name, ... ) whatever the other arguments.  name is the
+ * routine name ILAENV is called with, e.g. "DGETRF", and ispec is 1 to 16
+ * as in ILAENV, or 17 and 18 for KD and IB of the 2-stage reductions.
+ *
+ * The table is loaded when it is first used from the file named by the
+ * environment variable LAPACK_ILAENV_FILE, if any; see SRC/ilaenvtab.F for
+ * the file format.  The table is global to the process.
+ */
+
+static lapack_int lapacke_ilaenvtab( char job, lapack_int ispec,
+                                     const char* name, lapack_int* value )
+{
+    lapack_int info = 0;
+    LAPACK_ilaenvtab( &job, &ispec, name, value, &info );
+    return info;
+}
+
+/* Returns the value of the entry, or -1 if there is none */
+lapack_int API_SUFFIX(LAPACKE_ilaenv_get)( lapack_int ispec,
+                                           const char* name )
+{
+    lapack_int value = -1;
+    if( lapacke_ilaenvtab( 'G', ispec, name, &value ) != 0 ) return -1;
+    return value;
+}
+
+/* Adds or replaces an entry; returns 2 if the table is full.  There is no
+ * entry (1, name) for xGEQR and xGELQ, whose block sizes ILAENV chooses
+ * with n3: the call returns 4 */
+lapack_int API_SUFFIX(LAPACKE_ilaenv_set)( lapack_int ispec,
+                                           const char* name,
+                                           lapack_int value )
+{
+    if( ispec < 1 || ispec > 18 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ilaenv_set", -1 );
+        return -1;
+    }
+    return lapacke_ilaenvtab( 'S', ispec, name, &value );
+}
+
+/* Removes an entry, so that ILAENV returns its built-in value again */
+lapack_int API_SUFFIX(LAPACKE_ilaenv_unset)( lapack_int ispec,
+                                             const char* name )
+{
+    lapack_int value = 0;
+    return lapacke_ilaenvtab( 'D', ispec, name, &value );
+}
+
+/* Removes all the entries */
+void API_SUFFIX(LAPACKE_ilaenv_reset)( void )
+{
+    lapack_int value = 0;
+    lapacke_ilaenvtab( 'R', 0, " ", &value );
+}
+
+/* Adds the entries of a file; returns 1 if it cannot be read, 2 if the
+ * table is full and 3 if lines were skipped */
+lapack_int API_SUFFIX(LAPACKE_ilaenv_load)( const char* file )
+{
+    lapack_int value = 0;
+    if( file == NULL ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ilaenv_load", -1 );
+        return -1;
+    }
+    return lapacke_ilaenvtab( 'L', 0, file, &value );
+}
+
+/* Writes the table to a file; returns 1 if it cannot be written */
+lapack_int API_SUFFIX(LAPACKE_ilaenv_save)( const char* file )
+{
+    lapack_int value = 0;
+    if( file == NULL ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ilaenv_save", -1 );
+        return -1;
+    }
+    return lapacke_ilaenvtab( 'W', 0, file, &value );
+}
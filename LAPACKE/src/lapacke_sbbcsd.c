@@ -96,7 +96,7 @@ lapack_int API_SUFFIX(LAPACKE_sbbcsd)( int matrix_layout, char jobu1, char jobu2
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -107,7 +107,7 @@ lapack_int API_SUFFIX(LAPACKE_sbbcsd)( int matrix_layout, char jobu1, char jobu2
                                 v1t, ldv1t, v2t, ldv2t, b11d, b11e, b12d, b12e,
                                 b21d, b21e, b22d, b22e, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sbbcsd", info );
@@ -64,14 +64,14 @@ lapack_int API_SUFFIX(LAPACKE_sbdsdc_work)( int matrix_layout, char uplo, char c
         }
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            u_t = (float*)LAPACKE_malloc( sizeof(float) * ldu_t * MAX(1,n) );
+            u_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldu_t * MAX(1,n) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_0;
             }
         }
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            vt_t = (float*)LAPACKE_malloc( sizeof(float) * ldvt_t * MAX(1,n) );
+            vt_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldvt_t * MAX(1,n) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -92,11 +92,11 @@ lapack_int API_SUFFIX(LAPACKE_sbdsdc_work)( int matrix_layout, char uplo, char c
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_1:
         if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -72,21 +72,21 @@ lapack_int API_SUFFIX(LAPACKE_sbdsqr_work)( int matrix_layout, char uplo, lapack
         /* Allocate memory for temporary array(s) */
         if( ncvt != 0 ) {
             vt_t = (float*)
-                LAPACKE_malloc( sizeof(float) * ldvt_t * MAX(1,ncvt) );
+                LAPACKE_work_malloc( sizeof(float) * ldvt_t * MAX(1,ncvt) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_0;
             }
         }
         if( nru != 0 ) {
-            u_t = (float*)LAPACKE_malloc( sizeof(float) * ldu_t * MAX(1,n) );
+            u_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldu_t * MAX(1,n) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
             }
         }
         if( ncc != 0 ) {
-            c_t = (float*)LAPACKE_malloc( sizeof(float) * ldc_t * MAX(1,ncc) );
+            c_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldc_t * MAX(1,ncc) );
             if( c_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -121,15 +121,15 @@ lapack_int API_SUFFIX(LAPACKE_sbdsqr_work)( int matrix_layout, char uplo, lapack
         }
         /* Release memory and exit */
         if( ncc != 0 ) {
-            LAPACKE_free( c_t );
+            LAPACKE_work_free( c_t );
         }
 exit_level_2:
         if( nru != 0 ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_1:
         if( ncvt != 0 ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
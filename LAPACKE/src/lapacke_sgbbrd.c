@@ -58,7 +58,7 @@ lapack_int API_SUFFIX(LAPACKE_sgbbrd)( int matrix_layout, char vect, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*MAX(m,n)) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*MAX(m,n)) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_sgbbrd)( int matrix_layout, char vect, lapack_int
     info = API_SUFFIX(LAPACKE_sgbbrd_work)( matrix_layout, vect, m, n, ncc, kl, ku, ab, ldab,
                                 d, e, q, ldq, pt, ldpt, c, ldc, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgbbrd", info );
@@ -78,27 +78,27 @@ lapack_int API_SUFFIX(LAPACKE_sgbbrd_work)( int matrix_layout, char vect, lapack
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        ab_t = (float*)LAPACKE_malloc( sizeof(float) * ldab_t * MAX(1,n) );
+        ab_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'q' ) ) {
-            q_t = (float*)LAPACKE_malloc( sizeof(float) * ldq_t * MAX(1,m) );
+            q_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldq_t * MAX(1,m) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
             }
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'p' ) ) {
-            pt_t = (float*)LAPACKE_malloc( sizeof(float) * ldpt_t * MAX(1,n) );
+            pt_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldpt_t * MAX(1,n) );
             if( pt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
             }
         }
         if( ncc != 0 ) {
-            c_t = (float*)LAPACKE_malloc( sizeof(float) * ldc_t * MAX(1,ncc) );
+            c_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldc_t * MAX(1,ncc) );
             if( c_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_3;
@@ -129,18 +129,18 @@ lapack_int API_SUFFIX(LAPACKE_sgbbrd_work)( int matrix_layout, char vect, lapack
         }
         /* Release memory and exit */
         if( ncc != 0 ) {
-            LAPACKE_free( c_t );
+            LAPACKE_work_free( c_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'p' ) ) {
-            LAPACKE_free( pt_t );
+            LAPACKE_work_free( pt_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'q' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgbbrd_work", info );
@@ -106,32 +106,32 @@ lapack_int API_SUFFIX(LAPACKE_sgedmd_work)( int matrix_layout, char jobs, char j
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        x_t = (float*)LAPACKE_malloc( sizeof(float) * ldx_t * MAX(1,n) );
+        x_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldx_t * MAX(1,n) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        y_t = (float*)LAPACKE_malloc( sizeof(float) * ldy_t * MAX(1,n) );
+        y_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldy_t * MAX(1,n) );
         if( y_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
-        z_t = (float*)LAPACKE_malloc( sizeof(float) * ldz_t * MAX(1,n) );
+        z_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldz_t * MAX(1,n) );
         if( z_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
-        b_t = (float*)LAPACKE_malloc( sizeof(float) * ldb_t * MAX(1,n) );
+        b_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_3;
         }
-        w_t = (float*)LAPACKE_malloc( sizeof(float) * ldw_t * MAX(1,n) );
+        w_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldw_t * MAX(1,n) );
         if( w_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_4;
         }
-        s_t = (float*)LAPACKE_malloc( sizeof(float) * lds_t * MAX(1,n) );
+        s_t = (float*)LAPACKE_work_malloc( sizeof(float) * lds_t * MAX(1,n) );
         if( s_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_5;
@@ -159,17 +159,17 @@ lapack_int API_SUFFIX(LAPACKE_sgedmd_work)( int matrix_layout, char jobs, char j
         API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, m, n, w_t, ldw_t, w, ldw );
         API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, m, n, s_t, lds_t, s, lds );
         /* Release memory and exit */
-        LAPACKE_free( s_t );
+        LAPACKE_work_free( s_t );
 exit_level_5:
-        LAPACKE_free( w_t );
+        LAPACKE_work_free( w_t );
 exit_level_4:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_3:
-        LAPACKE_free( z_t );
+        LAPACKE_work_free( z_t );
 exit_level_2:
-        LAPACKE_free( y_t );
+        LAPACKE_work_free( y_t );
 exit_level_1:
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgedmd_work", info );
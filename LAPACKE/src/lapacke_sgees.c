@@ -57,7 +57,7 @@ lapack_int API_SUFFIX(LAPACKE_sgees)( int matrix_layout, char jobvs, char sort,
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_sgees)( int matrix_layout, char jobvs, char sort,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -81,10 +81,10 @@ lapack_int API_SUFFIX(LAPACKE_sgees)( int matrix_layout, char jobvs, char sort,
     info = API_SUFFIX(LAPACKE_sgees_work)( matrix_layout, jobvs, sort, select, n, a, lda,
                                sdim, wr, wi, vs, ldvs, work, lwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
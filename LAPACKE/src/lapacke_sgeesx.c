@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeesx)( int matrix_layout, char jobvs, char sort,
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
         bwork = (lapack_logical*)
-            LAPACKE_malloc( sizeof(lapack_logical) * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_logical) * MAX(1,n) );
         if( bwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -79,16 +79,16 @@ lapack_int API_SUFFIX(LAPACKE_sgeesx)( int matrix_layout, char jobvs, char sort,
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+        iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     }
     else {
-        iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * 1 );
+        iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * 1 );
     }
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -98,12 +98,12 @@ lapack_int API_SUFFIX(LAPACKE_sgeesx)( int matrix_layout, char jobvs, char sort,
                                 lda, sdim, wr, wi, vs, ldvs, rconde, rcondv,
                                 work, lwork, iwork, liwork, bwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sort, 's' ) ) {
-        LAPACKE_free( bwork );
+        LAPACKE_work_free( bwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
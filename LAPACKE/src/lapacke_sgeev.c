@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeev)( int matrix_layout, char jobvl, char jobvr,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeev)( int matrix_layout, char jobvl, char jobvr,
     info = API_SUFFIX(LAPACKE_sgeev_work)( matrix_layout, jobvl, jobvr, n, a, lda, wr, wi,
                                vl, ldvl, vr, ldvr, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgeev", info );
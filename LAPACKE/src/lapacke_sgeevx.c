@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeevx)( int matrix_layout, char balanc, char jobv
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
         iwork = (lapack_int*)
-            LAPACKE_malloc( sizeof(lapack_int) * MAX(1,2*n-2) );
+            LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,2*n-2) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeevx)( int matrix_layout, char balanc, char jobv
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -86,10 +86,10 @@ lapack_int API_SUFFIX(LAPACKE_sgeevx)( int matrix_layout, char balanc, char jobv
                                 scale, abnrm, rconde, rcondv, work, lwork,
                                 iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( sense, 'b' ) || API_SUFFIX(LAPACKE_lsame)( sense, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
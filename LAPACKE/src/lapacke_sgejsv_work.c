@@ -77,14 +77,14 @@ lapack_int API_SUFFIX(LAPACKE_sgejsv_work)( int matrix_layout, char joba, char j
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
+        a_t = (float*)LAPACKE_work_malloc( sizeof(float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobu, 'f' ) || API_SUFFIX(LAPACKE_lsame)( jobu, 'u' ) ||
             API_SUFFIX(LAPACKE_lsame)( jobu, 'w' ) ) {
-            u_t = (float*)LAPACKE_malloc( sizeof(float) * ldu_t * MAX(1,ncols_u) );
+            u_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldu_t * MAX(1,ncols_u) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -92,7 +92,7 @@ lapack_int API_SUFFIX(LAPACKE_sgejsv_work)( int matrix_layout, char joba, char j
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobv, 'j' ) || API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ||
             API_SUFFIX(LAPACKE_lsame)( jobv, 'w' ) ) {
-            v_t = (float*)LAPACKE_malloc( sizeof(float) * ldv_t * MAX(1,n) );
+            v_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldv_t * MAX(1,n) );
             if( v_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -119,15 +119,15 @@ lapack_int API_SUFFIX(LAPACKE_sgejsv_work)( int matrix_layout, char joba, char j
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobv, 'j' ) || API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ||
             API_SUFFIX(LAPACKE_lsame)( jobv, 'w' ) ) {
-            LAPACKE_free( v_t );
+            LAPACKE_work_free( v_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( jobu, 'f' ) || API_SUFFIX(LAPACKE_lsame)( jobu, 'u' ) ||
             API_SUFFIX(LAPACKE_lsame)( jobu, 'w' ) ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgejsv_work", info );
@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_sgelsy)( int matrix_layout, lapack_int m, lapack_i
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_sgelsy)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_sgelsy_work)( matrix_layout, m, n, nrhs, a, lda, b, ldb, jpvt,
                                 rcond, rank, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgelsy", info );
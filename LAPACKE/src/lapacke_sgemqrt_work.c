@@ -70,17 +70,17 @@ lapack_int API_SUFFIX(LAPACKE_sgemqrt_work)( int matrix_layout, char side, char
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        v_t = (float*)LAPACKE_malloc( sizeof(float) * ldv_t * MAX(1,k) );
+        v_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldv_t * MAX(1,k) );
         if( v_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        t_t = (float*)LAPACKE_malloc( sizeof(float) * ldt_t * MAX(1,nb) );
+        t_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldt_t * MAX(1,nb) );
         if( t_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
-        c_t = (float*)LAPACKE_malloc( sizeof(float) * ldc_t * MAX(1,n) );
+        c_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldc_t * MAX(1,n) );
         if( c_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
@@ -98,11 +98,11 @@ lapack_int API_SUFFIX(LAPACKE_sgemqrt_work)( int matrix_layout, char side, char
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc );
         /* Release memory and exit */
-        LAPACKE_free( c_t );
+        LAPACKE_work_free( c_t );
 exit_level_2:
-        LAPACKE_free( t_t );
+        LAPACKE_work_free( t_t );
 exit_level_1:
-        LAPACKE_free( v_t );
+        LAPACKE_work_free( v_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgemqrt_work", info );
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeqr_work)( int matrix_layout, lapack_int m, lapa
         }
         /* Allocate memory for temporary array(s) */
         a_t = (float*)
-            LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_sgeqr_work)( int matrix_layout, lapack_int m, lapa
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, m, n, a_t, lda_t, a, lda );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgeqr_work", info );
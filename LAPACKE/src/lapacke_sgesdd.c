@@ -56,7 +56,7 @@ lapack_int API_SUFFIX(LAPACKE_sgesdd)( int matrix_layout, char jobz, lapack_int
 #endif
     /* Allocate memory for working array(s) */
     iwork = (lapack_int*)
-        LAPACKE_malloc( sizeof(lapack_int) * MAX(1,8*MIN(m,n)) );
+        LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,8*MIN(m,n)) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_sgesdd)( int matrix_layout, char jobz, lapack_int
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -78,9 +78,9 @@ lapack_int API_SUFFIX(LAPACKE_sgesdd)( int matrix_layout, char jobz, lapack_int
     info = API_SUFFIX(LAPACKE_sgesdd_work)( matrix_layout, jobz, m, n, a, lda, s, u, ldu, vt,
                                 ldvt, work, lwork, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgesdd", info );
@@ -44,11 +44,17 @@ lapack_int API_SUFFIX(LAPACKE_sgesv_work)( int matrix_layout, lapack_int n, lapa
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,n);
-        lapack_int ldb_t = MAX(1,n);
-        float* a_t = NULL;
-        float* b_t = NULL;
-        /* Check leading dimension(s) */
+        /* Factor and solve in place, see LAPACKE_sgetrf_rowmajor */
+        if( n < 0 ) {
+            info = -2;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgesv_work", info );
+            return info;
+        }
+        if( nrhs < 0 ) {
+            info = -3;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgesv_work", info );
+            return info;
+        }
         if( lda < n ) {
             info = -5;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgesv_work", info );
@@ -59,35 +65,10 @@ lapack_int API_SUFFIX(LAPACKE_sgesv_work)( int matrix_layout, lapack_int n, lapa
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgesv_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        b_t = (float*)LAPACKE_malloc( sizeof(float) * ldb_t * MAX(1,nrhs) );
-        if( b_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_1;
-        }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_sge_trans)( matrix_layout, n, n, a, lda, a_t, lda_t );
-        API_SUFFIX(LAPACKE_sge_trans)( matrix_layout, n, nrhs, b, ldb, b_t, ldb_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_sgesv( &n, &nrhs, a_t, &lda_t, ipiv, b_t, &ldb_t, &info );
-        if( info < 0 ) {
-            info = info - 1;
-        }
-        /* Transpose output matrices */
-        API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, n, n, a_t, lda_t, a, lda );
-        API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, n, nrhs, b_t, ldb_t, b, ldb );
-        /* Release memory and exit */
-        LAPACKE_free( b_t );
-exit_level_1:
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
-            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgesv_work", info );
+        info = API_SUFFIX(LAPACKE_sgetrf_rowmajor)( n, n, a, lda, ipiv );
+        if( info == 0 ) {
+            API_SUFFIX(LAPACKE_sgetrs_rowmajor)( 'n', n, nrhs, a, lda, ipiv, b,
+                                               ldb );
         }
     } else {
         info = -1;
@@ -0,0 +1,235 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function sgetrf for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include <math.h>
+#include "lapacke_utils.h"
+
+/* LU factorization with partial pivoting of the NL m-by-n matrices
+ * interleaved in w, right-looking as in SGETF2.  piv[k*NL+l] is the
+ * pivot row of step k in matrix l, and info[l] is set as by SGETRF. */
+
+#define NL LAPACKE_BATCH_SLANES
+
+static void sgetrf_interleaved( lapack_int m, lapack_int n, float sfmin,
+                                float* w, lapack_int* piv,
+                                lapack_int* info )
+{
+    lapack_int i, j, k, l, mn = MIN(m,n);
+    lapack_int p[NL];
+    float amax[NL], r[NL], u[NL], t;
+    float *ck, *cj;
+    int tiny;
+
+    for( l = 0; l < NL; l++ ) {
+        info[l] = 0;
+    }
+    for( k = 0; k < mn; k++ ) {
+        ck = w + (size_t)k*m*NL;
+        /* Find the pivots and interchange the rows, without branches on
+         * the data, which differ from one matrix to the next */
+        for( l = 0; l < NL; l++ ) {
+            amax[l] = fabsf( ck[k*NL+l] );
+            p[l] = k;
+        }
+        for( i = k+1; i < m; i++ ) {
+            for( l = 0; l < NL; l++ ) {
+                t = fabsf( ck[i*NL+l] );
+                p[l] = ( t > amax[l] ) ? i : p[l];
+                amax[l] = ( t > amax[l] ) ? t : amax[l];
+            }
+        }
+        for( l = 0; l < NL; l++ ) {
+            piv[k*NL+l] = p[l] + 1;
+            for( j = 0; j < n; j++ ) {
+                cj = w + (size_t)j*m*NL + l;
+                t = cj[k*NL];
+                cj[k*NL] = cj[p[l]*NL];
+                cj[p[l]*NL] = t;
+            }
+        }
+        /* Compute the elements of L, dividing by pivots below sfmin */
+        tiny = 0;
+        for( l = 0; l < NL; l++ ) {
+            t = ck[k*NL+l];
+            if( t == 0.0f ) {
+                if( info[l] == 0 ) info[l] = k + 1;
+                r[l] = 1.0f;
+            } else if( fabsf( t ) >= sfmin ) {
+                r[l] = 1.0f / t;
+            } else {
+                r[l] = 1.0f;
+                tiny = 1;
+            }
+        }
+        for( i = k+1; i < m; i++ ) {
+            for( l = 0; l < NL; l++ ) {
+                ck[i*NL+l] *= r[l];
+            }
+        }
+        if( tiny ) {
+            for( l = 0; l < NL; l++ ) {
+                t = ck[k*NL+l];
+                if( t != 0.0f && fabsf( t ) < sfmin ) {
+                    for( i = k+1; i < m; i++ ) {
+                        ck[i*NL+l] /= t;
+                    }
+                }
+            }
+        }
+        /* Update the trailing submatrix */
+        for( j = k+1; j < n; j++ ) {
+            cj = w + (size_t)j*m*NL;
+            for( l = 0; l < NL; l++ ) {
+                u[l] = cj[k*NL+l];
+            }
+            for( i = k+1; i < m; i++ ) {
+                for( l = 0; l < NL; l++ ) {
+                    cj[i*NL+l] -= ck[i*NL+l] * u[l];
+                }
+            }
+        }
+    }
+}
+
+lapack_int API_SUFFIX(LAPACKE_sgetrf_batch_strided)( int matrix_layout,
+                                  lapack_int m, lapack_int n, float* a,
+                                  lapack_int lda, lapack_int stridea,
+                                  lapack_int* ipiv, lapack_int strideipiv,
+                                  lapack_int batch_size, lapack_int* info )
+{
+    lapack_int k, mn = MIN(m,n);
+    lapack_int rs, cs, nchunk;
+    float sfmin;
+    double work;
+#ifdef _OPENMP
+    lapack_int nt;
+#endif
+    if( matrix_layout == LAPACK_COL_MAJOR ) {
+        rs = 1;
+        cs = lda;
+    } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
+        rs = lda;
+        cs = 1;
+    } else {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch */
+    if( m < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -3 );
+        return -3;
+    }
+    if( lda < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? m : n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -5 );
+        return -5;
+    }
+    if( stridea < lda * ( matrix_layout == LAPACK_COL_MAJOR ? n : m ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -6 );
+        return -6;
+    }
+    if( strideipiv < mn ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -8 );
+        return -8;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_batch_strided", -9 );
+        return -9;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( API_SUFFIX(LAPACKE_sge_nancheck)( matrix_layout, m, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -4;
+            }
+        }
+    }
+#endif
+    /* Number of multiply-adds per matrix */
+    work = (double)m*n*mn - 0.5*(double)(m+n)*mn*mn + (double)mn*mn*mn/3.0;
+    if( MAX(m,n) <= LAPACKE_BATCH_NMAX && mn > 0 ) {
+        /* NL matrices at a time in an interleaved copy */
+        sfmin = API_SUFFIX(LAPACKE_slamch)( 's' );
+        nchunk = ( batch_size + NL - 1 ) / NL;
+#ifdef _OPENMP
+        nt = API_SUFFIX(LAPACKE_batch_threads)( nchunk, NL*work );
+        #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+        for( k = 0; k < nchunk; k++ ) {
+            float w[LAPACKE_BATCH_NMAX*LAPACKE_BATCH_NMAX*NL];
+            lapack_int piv[LAPACKE_BATCH_NMAX*NL], inf[NL];
+            lapack_int i, l, cnt = MIN( NL, batch_size - k*NL );
+            float* ak = a + (size_t)k*NL*stridea;
+            lapack_int* pk = ipiv + (size_t)k*NL*strideipiv;
+
+            for( l = 0; l < NL; l++ ) {
+                API_SUFFIX(LAPACKE_sge_interleave)( m, n,
+                        l < cnt ? ak + (size_t)l*stridea : NULL, rs, cs,
+                        NL, l, w );
+            }
+            sgetrf_interleaved( m, n, sfmin, w, piv, inf );
+            for( l = 0; l < cnt; l++ ) {
+                API_SUFFIX(LAPACKE_sge_deinterleave)( 'g', m, n, NL, l, w,
+                        ak + (size_t)l*stridea, rs, cs );
+                for( i = 0; i < mn; i++ ) {
+                    pk[(size_t)l*strideipiv + i] = piv[i*NL+l];
+                }
+                info[k*NL+l] = inf[l];
+            }
+        }
+        return 0;
+    }
+    /* One matrix at a time, by the recursive LU of SGETRF2, which calls
+     * neither ILAENV nor the blocked code */
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+    for( k = 0; k < batch_size; k++ ) {
+        if( matrix_layout == LAPACK_COL_MAJOR ) {
+            LAPACK_sgetrf2( &m, &n, a + (size_t)k*stridea, &lda,
+                            ipiv + (size_t)k*strideipiv, &info[k] );
+        } else {
+            info[k] = API_SUFFIX(LAPACKE_sgetrf_rowmajor)( m, n,
+                        a + (size_t)k*stridea, lda,
+                        ipiv + (size_t)k*strideipiv );
+        }
+    }
+    return 0;
+}
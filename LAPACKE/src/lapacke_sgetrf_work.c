@@ -43,35 +43,23 @@ lapack_int API_SUFFIX(LAPACKE_sgetrf_work)( int matrix_layout, lapack_int m, lap
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,m);
-        float* a_t = NULL;
-        /* Check leading dimension(s) */
-        if( lda < n ) {
-            info = -5;
+        /* Factor in place, see LAPACKE_sgetrf_rowmajor */
+        if( m < 0 ) {
+            info = -2;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_work", info );
             return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
-        }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_sge_trans)( matrix_layout, m, n, a, lda, a_t, lda_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_sgetrf( &m, &n, a_t, &lda_t, ipiv, &info );
-        if( info < 0 ) {
-            info = info - 1;
+        if( n < 0 ) {
+            info = -3;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_work", info );
+            return info;
         }
-        /* Transpose output matrices */
-        API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, m, n, a_t, lda_t, a, lda );
-        /* Release memory and exit */
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
+        if( lda < n ) {
+            info = -5;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_work", info );
+            return info;
         }
+        info = API_SUFFIX(LAPACKE_sgetrf_rowmajor)( m, n, a, lda, ipiv );
     } else {
         info = -1;
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetrf_work", info );
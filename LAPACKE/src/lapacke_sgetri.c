@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_sgetri)( int matrix_layout, lapack_int n, float* a
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_sgetri)( int matrix_layout, lapack_int n, float* a
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_sgetri_work)( matrix_layout, n, a, lda, ipiv, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetri", info );
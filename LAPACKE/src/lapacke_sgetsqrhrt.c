@@ -61,7 +61,7 @@ lapack_int API_SUFFIX(LAPACKE_sgetsqrhrt)( int matrix_layout, lapack_int m, lapa
     }
     lwork = (lapack_int)work_query;
         /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_sgetsqrhrt)( int matrix_layout, lapack_int m, lapa
     info = API_SUFFIX(LAPACKE_sgetsqrhrt_work)( matrix_layout, m, n, mb1, nb1, nb2,
                                     a, lda, t, ldt, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgetsqrhrt", info );
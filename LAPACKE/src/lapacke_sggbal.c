@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_sggbal)( int matrix_layout, char job, lapack_int n
         lwork = 1;
     }
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -78,7 +78,7 @@ lapack_int API_SUFFIX(LAPACKE_sggbal)( int matrix_layout, char job, lapack_int n
     info = API_SUFFIX(LAPACKE_sggbal_work)( matrix_layout, job, n, a, lda, b, ldb, ilo, ihi,
                                 lscale, rscale, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sggbal", info );
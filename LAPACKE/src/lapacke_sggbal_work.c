@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_sggbal_work)( int matrix_layout, char job, lapack_
         /* Allocate memory for temporary array(s) */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
-            a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
+            a_t = (float*)LAPACKE_work_malloc( sizeof(float) * lda_t * MAX(1,n) );
             if( a_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_sggbal_work)( int matrix_layout, char job, lapack_
         }
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
-            b_t = (float*)LAPACKE_malloc( sizeof(float) * ldb_t * MAX(1,n) );
+            b_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldb_t * MAX(1,n) );
             if( b_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_1;
@@ -106,12 +106,12 @@ lapack_int API_SUFFIX(LAPACKE_sggbal_work)( int matrix_layout, char job, lapack_
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
-            LAPACKE_free( b_t );
+            LAPACKE_work_free( b_t );
         }
 exit_level_1:
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
-            LAPACKE_free( a_t );
+            LAPACKE_work_free( a_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -75,7 +75,7 @@ lapack_int API_SUFFIX(LAPACKE_sgghd3)( int matrix_layout, char compq, char compz
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -84,7 +84,7 @@ lapack_int API_SUFFIX(LAPACKE_sgghd3)( int matrix_layout, char compq, char compz
     info = API_SUFFIX(LAPACKE_sgghd3_work)( matrix_layout, compq, compz, n, ilo, ihi,
                                 a, lda, b, ldb, q, ldq, z, ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgghd3", info );
@@ -84,25 +84,25 @@ lapack_int API_SUFFIX(LAPACKE_sgghd3_work)( int matrix_layout, char compq, char
       return info;
     }
     /* Allocate memory for temporary array(s) */
-    a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
+    a_t = (float*)LAPACKE_work_malloc( sizeof(float) * lda_t * MAX(1,n) );
     if( a_t == NULL ) {
       info = LAPACK_TRANSPOSE_MEMORY_ERROR;
       goto exit_level_0;
     }
-    b_t = (float*)LAPACKE_malloc( sizeof(float) * ldb_t * MAX(1,n) );
+    b_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldb_t * MAX(1,n) );
     if( b_t == NULL ) {
       info = LAPACK_TRANSPOSE_MEMORY_ERROR;
       goto exit_level_1;
     }
     if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) || API_SUFFIX(LAPACKE_lsame)( compq, 'v' ) ) {
-      q_t = (float*)LAPACKE_malloc( sizeof(float) * ldq_t * MAX(1,n) );
+      q_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldq_t * MAX(1,n) );
       if( q_t == NULL ) {
         info = LAPACK_TRANSPOSE_MEMORY_ERROR;
         goto exit_level_2;
       }
     }
     if( API_SUFFIX(LAPACKE_lsame)( compz, 'i' ) || API_SUFFIX(LAPACKE_lsame)( compz, 'v' ) ) {
-      z_t = (float*)LAPACKE_malloc( sizeof(float) * ldz_t * MAX(1,n) );
+      z_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldz_t * MAX(1,n) );
       if( z_t == NULL ) {
         info = LAPACK_TRANSPOSE_MEMORY_ERROR;
         goto exit_level_3;
@@ -134,16 +134,16 @@ lapack_int API_SUFFIX(LAPACKE_sgghd3_work)( int matrix_layout, char compq, char
     }
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( compz, 'i' ) || API_SUFFIX(LAPACKE_lsame)( compz, 'v' ) ) {
-      LAPACKE_free( z_t );
+      LAPACKE_work_free( z_t );
     }
   exit_level_3:
     if( API_SUFFIX(LAPACKE_lsame)( compq, 'i' ) || API_SUFFIX(LAPACKE_lsame)( compq, 'v' ) ) {
-      LAPACKE_free( q_t );
+      LAPACKE_work_free( q_t );
     }
   exit_level_2:
-    LAPACKE_free( b_t );
+    LAPACKE_work_free( b_t );
   exit_level_1:
-    LAPACKE_free( a_t );
+    LAPACKE_work_free( a_t );
   exit_level_0:
     if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
       API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sgghd3_work", info );
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_shgeqz)( int matrix_layout, char job, char compq,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -86,7 +86,7 @@ lapack_int API_SUFFIX(LAPACKE_shgeqz)( int matrix_layout, char job, char compq,
                                 ldh, t, ldt, alphar, alphai, beta, q, ldq, z,
                                 ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_shgeqz", info );
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_shsein)( int matrix_layout, char job, char eigsrc,
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) * MAX(1,n+2) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) * MAX(1,n+2) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -80,7 +80,7 @@ lapack_int API_SUFFIX(LAPACKE_shsein)( int matrix_layout, char job, char eigsrc,
                                 ldh, wr, wi, vl, ldvl, vr, ldvr, mm, m, work,
                                 ifaill, ifailr );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_shsein", info );
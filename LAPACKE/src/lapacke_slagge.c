@@ -51,7 +51,7 @@ lapack_int API_SUFFIX(LAPACKE_slagge)( int matrix_layout, lapack_int m, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,m+n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,m+n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_slagge)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_slagge_work)( matrix_layout, m, n, kl, ku, d, a, lda, iseed,
                                 work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_slagge", info );
@@ -53,7 +53,7 @@ float API_SUFFIX(LAPACKE_slangb)( int matrix_layout, char norm, lapack_int n,
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+        work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -63,7 +63,7 @@ float API_SUFFIX(LAPACKE_slangb)( int matrix_layout, char norm, lapack_int n,
     res = API_SUFFIX(LAPACKE_slangb_work)( matrix_layout, norm, n, kl, ku, ab, ldab, work );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
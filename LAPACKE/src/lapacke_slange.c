@@ -52,7 +52,7 @@ float API_SUFFIX(LAPACKE_slange)( int matrix_layout, char norm, lapack_int m,
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,m) );
+        work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,m) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -62,7 +62,7 @@ float API_SUFFIX(LAPACKE_slange)( int matrix_layout, char norm, lapack_int m,
     res = API_SUFFIX(LAPACKE_slange_work)( matrix_layout, norm, m, n, a, lda, work );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
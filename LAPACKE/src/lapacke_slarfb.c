@@ -83,7 +83,7 @@ lapack_int API_SUFFIX(LAPACKE_slarfb)( int matrix_layout, char side, char trans,
         ldwork = 1;
     }
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * ldwork * MAX(1,k) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * ldwork * MAX(1,k) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -92,7 +92,7 @@ lapack_int API_SUFFIX(LAPACKE_slarfb)( int matrix_layout, char side, char trans,
     info = API_SUFFIX(LAPACKE_slarfb_work)( matrix_layout, side, trans, direct, storev, m, n,
                                 k, v, ldv, t, ldt, c, ldc, work, ldwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_slarfb", info );
@@ -102,19 +102,19 @@ lapack_int API_SUFFIX(LAPACKE_sorcsd2by1_work)( int matrix_layout, char jobu1, c
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        x11_t = (float*)LAPACKE_malloc( sizeof(float) * ldx11_t * MAX(1,q) );
+        x11_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldx11_t * MAX(1,q) );
         if( x11_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        x21_t = (float*)LAPACKE_malloc( sizeof(float) * ldx21_t * MAX(1,q) );
+        x21_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldx21_t * MAX(1,q) );
         if( x21_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobu1, 'y' ) ) {
             u1_t = (float*)
-                LAPACKE_malloc( sizeof(float) * ldu1_t * MAX(1,p) );
+                LAPACKE_work_malloc( sizeof(float) * ldu1_t * MAX(1,p) );
             if( u1_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -122,7 +122,7 @@ lapack_int API_SUFFIX(LAPACKE_sorcsd2by1_work)( int matrix_layout, char jobu1, c
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobu2, 'y' ) ) {
             u2_t = (float*)
-                LAPACKE_malloc( sizeof(float) * ldu2_t * MAX(1,m-p) );
+                LAPACKE_work_malloc( sizeof(float) * ldu2_t * MAX(1,m-p) );
             if( u2_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_3;
@@ -130,7 +130,7 @@ lapack_int API_SUFFIX(LAPACKE_sorcsd2by1_work)( int matrix_layout, char jobu1, c
         }
         if( API_SUFFIX(LAPACKE_lsame)( jobv1t, 'y' ) ) {
             v1t_t = (float*)
-                LAPACKE_malloc( sizeof(float) * ldv1t_t * MAX(1,q) );
+                LAPACKE_work_malloc( sizeof(float) * ldv1t_t * MAX(1,q) );
             if( v1t_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_4;
@@ -168,20 +168,20 @@ lapack_int API_SUFFIX(LAPACKE_sorcsd2by1_work)( int matrix_layout, char jobu1, c
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobv1t, 'y' ) ) {
-            LAPACKE_free( v1t_t );
+            LAPACKE_work_free( v1t_t );
         }
 exit_level_4:
         if( API_SUFFIX(LAPACKE_lsame)( jobu2, 'y' ) ) {
-            LAPACKE_free( u2_t );
+            LAPACKE_work_free( u2_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( jobu1, 'y' ) ) {
-            LAPACKE_free( u1_t );
+            LAPACKE_work_free( u1_t );
         }
 exit_level_2:
-        LAPACKE_free( x21_t );
+        LAPACKE_work_free( x21_t );
 exit_level_1:
-        LAPACKE_free( x11_t );
+        LAPACKE_work_free( x11_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sorcsd2by1_work", info );
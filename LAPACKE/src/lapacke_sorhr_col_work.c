@@ -30,13 +30,13 @@ lapack_int API_SUFFIX(LAPACKE_sorhr_col_work)( int matrix_layout, lapack_int m,
         }
         /* Allocate memory for temporary array(s) */
         a_t = (float*)
-            LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         t_t = (float*)
-            LAPACKE_malloc( sizeof(float) *
+            LAPACKE_work_malloc( sizeof(float) *
                             ldt_t * MAX(1,n) );
         if( t_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -54,9 +54,9 @@ lapack_int API_SUFFIX(LAPACKE_sorhr_col_work)( int matrix_layout, lapack_int m,
         API_SUFFIX(LAPACKE_sge_trans)( LAPACK_COL_MAJOR, ldt, n, t_t, ldt_t, t,
                            ldt );
         /* Release memory and exit */
-        LAPACKE_free( t_t );
+        LAPACKE_work_free( t_t );
 exit_level_1:
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sorhr_col_work", info );
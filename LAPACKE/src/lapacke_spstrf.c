@@ -54,7 +54,7 @@ lapack_int API_SUFFIX(LAPACKE_spstrf)( int matrix_layout, char uplo, lapack_int
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_spstrf)( int matrix_layout, char uplo, lapack_int
     info = API_SUFFIX(LAPACKE_spstrf_work)( matrix_layout, uplo, n, a, lda, piv, rank, tol,
                                 work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_spstrf", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_sptcon)( lapack_int n, const float* d, const float
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_sptcon)( lapack_int n, const float* d, const float
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_sptcon_work)( n, d, e, anorm, rcond, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sptcon", info );
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_spteqr)( int matrix_layout, char compz, lapack_int
         lwork = MAX(1,4*n-4);
     }
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_spteqr)( int matrix_layout, char compz, lapack_int
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_spteqr_work)( matrix_layout, compz, n, d, e, z, ldz, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_spteqr", info );
@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_sptrfs)( int matrix_layout, lapack_int n, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,2*n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_sptrfs)( int matrix_layout, lapack_int n, lapack_i
     info = API_SUFFIX(LAPACKE_sptrfs_work)( matrix_layout, n, nrhs, d, e, df, ef, b, ldb, x,
                                 ldx, ferr, berr, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_sptrfs", info );
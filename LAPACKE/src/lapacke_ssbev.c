@@ -51,7 +51,7 @@ lapack_int API_SUFFIX(LAPACKE_ssbev)( int matrix_layout, char jobz, char uplo, l
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,3*n-2) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,3*n-2) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_ssbev)( int matrix_layout, char jobz, char uplo, l
     info = API_SUFFIX(LAPACKE_ssbev_work)( matrix_layout, jobz, uplo, n, kd, ab, ldab, w, z,
                                ldz, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssbev", info );
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_ssbev_2stage)( int matrix_layout, char jobz, char
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_ssbev_2stage)( int matrix_layout, char jobz, char
     info = API_SUFFIX(LAPACKE_ssbev_2stage_work)( matrix_layout, jobz, uplo, n, kd, ab, ldab, w, z,
                                ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssbev_2stage", info );
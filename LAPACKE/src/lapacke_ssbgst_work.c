@@ -70,18 +70,18 @@ lapack_int API_SUFFIX(LAPACKE_ssbgst_work)( int matrix_layout, char vect, char u
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        ab_t = (float*)LAPACKE_malloc( sizeof(float) * ldab_t * MAX(1,n) );
+        ab_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        bb_t = (float*)LAPACKE_malloc( sizeof(float) * ldbb_t * MAX(1,n) );
+        bb_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldbb_t * MAX(1,n) );
         if( bb_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
-            x_t = (float*)LAPACKE_malloc( sizeof(float) * ldx_t * MAX(1,n) );
+            x_t = (float*)LAPACKE_work_malloc( sizeof(float) * ldx_t * MAX(1,n) );
             if( x_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
                 goto exit_level_2;
@@ -104,12 +104,12 @@ lapack_int API_SUFFIX(LAPACKE_ssbgst_work)( int matrix_layout, char vect, char u
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'v' ) ) {
-            LAPACKE_free( x_t );
+            LAPACKE_work_free( x_t );
         }
 exit_level_2:
-        LAPACKE_free( bb_t );
+        LAPACKE_work_free( bb_t );
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssbgst_work", info );
@@ -72,12 +72,12 @@ lapack_int API_SUFFIX(LAPACKE_ssbgvx)( int matrix_layout, char jobz, char range,
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(1,5*n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,5*n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,7*n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,7*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -87,9 +87,9 @@ lapack_int API_SUFFIX(LAPACKE_ssbgvx)( int matrix_layout, char jobz, char range,
                                 ldab, bb, ldbb, q, ldq, vl, vu, il, iu, abstol,
                                 m, w, z, ldz, work, iwork, ifail );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssbgvx", info );
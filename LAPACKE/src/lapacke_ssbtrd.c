@@ -56,7 +56,7 @@ lapack_int API_SUFFIX(LAPACKE_ssbtrd)( int matrix_layout, char vect, char uplo,
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_ssbtrd)( int matrix_layout, char vect, char uplo,
     info = API_SUFFIX(LAPACKE_ssbtrd_work)( matrix_layout, vect, uplo, n, kd, ab, ldab, d, e,
                                 q, ldq, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssbtrd", info );
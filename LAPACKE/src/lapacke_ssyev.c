@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_ssyev)( int matrix_layout, char jobz, char uplo, l
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_ssyev)( int matrix_layout, char jobz, char uplo, l
     info = API_SUFFIX(LAPACKE_ssyev_work)( matrix_layout, jobz, uplo, n, a, lda, w, work,
                                lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssyev", info );
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_ssysv_aa_2stage)( int matrix_layout, char uplo, la
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
     work = (float*)
-        LAPACKE_malloc( sizeof(float) * lwork );
+        LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -79,7 +79,7 @@ lapack_int API_SUFFIX(LAPACKE_ssysv_aa_2stage)( int matrix_layout, char uplo, la
                                a, lda, tb, ltb, ipiv, ipiv2, b,
                                ldb, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssysv_aa_2stage", info );
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytrf_aa_2stage)( int matrix_layout, char uplo, l
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
     work = (float*)
-        LAPACKE_malloc( sizeof(float) * lwork );
+        LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytrf_aa_2stage)( int matrix_layout, char uplo, l
                                  a, lda, tb, ltb, ipiv, ipiv2,
                                  work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssytrf_aa_2stage", info );
@@ -51,7 +51,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytri2x)( int matrix_layout, char uplo, lapack_in
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,n+nb+1)*(+1) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,n+nb+1)*(+1) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -60,7 +60,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytri2x)( int matrix_layout, char uplo, lapack_in
     info = API_SUFFIX(LAPACKE_ssytri2x_work)( matrix_layout, uplo, n, a, lda, ipiv, work,
                                   nb );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssytri2x", info );
@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytri_3)( int matrix_layout, char uplo, lapack_in
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytri_3)( int matrix_layout, char uplo, lapack_in
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_ssytri_3_work)( matrix_layout, uplo, n, a, lda, e, ipiv, work, lwork);
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssytri_3", info );
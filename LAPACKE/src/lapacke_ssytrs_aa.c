@@ -64,7 +64,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytrs_aa)( int matrix_layout, char uplo, lapack_i
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
     work = (float*)
-        LAPACKE_malloc( sizeof(float) * lwork );
+        LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_ssytrs_aa)( int matrix_layout, char uplo, lapack_i
     info = API_SUFFIX(LAPACKE_ssytrs_aa_work)( matrix_layout, uplo, n, nrhs, a, lda, ipiv, b,
                                  ldb, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ssytrs_aa", info );
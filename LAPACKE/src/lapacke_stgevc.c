@@ -67,7 +67,7 @@ lapack_int API_SUFFIX(LAPACKE_stgevc)( int matrix_layout, char side, char howmny
     }
 #endif
     /* Allocate memory for working array(s) */
-    work = (float*)LAPACKE_malloc( sizeof(float) * MAX(1,6*n) );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * MAX(1,6*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_stgevc)( int matrix_layout, char side, char howmny
     info = API_SUFFIX(LAPACKE_stgevc_work)( matrix_layout, side, howmny, select, n, s, lds,
                                 p, ldp, vl, ldvl, vr, ldvr, mm, m, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_stgevc", info );
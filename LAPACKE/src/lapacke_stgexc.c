@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_stgexc)( int matrix_layout, lapack_logical wantq,
     }
     lwork = (lapack_int)work_query;
     /* Allocate memory for work arrays */
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -85,7 +85,7 @@ lapack_int API_SUFFIX(LAPACKE_stgexc)( int matrix_layout, lapack_logical wantq,
     info = API_SUFFIX(LAPACKE_stgexc_work)( matrix_layout, wantq, wantz, n, a, lda, b, ldb,
                                 q, ldq, z, ldz, ifst, ilst, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_stgexc", info );
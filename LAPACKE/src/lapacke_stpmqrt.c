@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_stpmqrt)( int matrix_layout, char side, char trans
     /* Allocate memory for working array(s) */
     lwork = API_SUFFIX(LAPACKE_lsame)( side, 'L' ) ? MAX(1,nb) * MAX(1,n) :
         ( API_SUFFIX(LAPACKE_lsame)( side, 'R' ) ? MAX(1,m) * MAX(1,nb) : 0 );
-    work = (float*)LAPACKE_malloc( sizeof(float) * lwork );
+    work = (float*)LAPACKE_work_malloc( sizeof(float) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -82,7 +82,7 @@ lapack_int API_SUFFIX(LAPACKE_stpmqrt)( int matrix_layout, char side, char trans
     info = API_SUFFIX(LAPACKE_stpmqrt_work)( matrix_layout, side, trans, m, n, k, l, nb, v,
                                  ldv, t, ldt, a, lda, b, ldb, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_stpmqrt", info );
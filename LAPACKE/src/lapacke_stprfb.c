@@ -99,7 +99,7 @@ lapack_int API_SUFFIX(LAPACKE_stprfb)( int matrix_layout, char side, char trans,
     }
     /* Allocate memory for working array(s) */
     work = (float*)
-        LAPACKE_malloc( sizeof(float) * work_size );
+        LAPACKE_work_malloc( sizeof(float) * work_size );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -109,7 +109,7 @@ lapack_int API_SUFFIX(LAPACKE_stprfb)( int matrix_layout, char side, char trans,
                                 k, l, v, ldv, t, ldt, a, lda, b, ldb, work,
                                 ldwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_stprfb", info );
@@ -67,14 +67,14 @@ lapack_int API_SUFFIX(LAPACKE_strsna)( int matrix_layout, char job, char howmny,
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
         iwork = (lapack_int*)
-            LAPACKE_malloc( sizeof(lapack_int) * MAX(1,2*(n-1)) );
+            LAPACKE_work_malloc( sizeof(lapack_int) * MAX(1,2*(n-1)) );
         if( iwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
         }
     }
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        work = (float*)LAPACKE_malloc( sizeof(float) * ldwork * MAX(1,n+6) );
+        work = (float*)LAPACKE_work_malloc( sizeof(float) * ldwork * MAX(1,n+6) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_1;
@@ -86,11 +86,11 @@ lapack_int API_SUFFIX(LAPACKE_strsna)( int matrix_layout, char job, char howmny,
                                 iwork );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( iwork );
+        LAPACKE_work_free( iwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -41,13 +41,13 @@ lapack_int API_SUFFIX(LAPACKE_strsyl3)( int matrix_layout, char trana, char tran
     }
     ldswork = swork_query[0];
     swork_size = ldswork * swork_query[1];
-    swork = (float*)LAPACKE_malloc( sizeof(float) * swork_size);
+    swork = (float*)LAPACKE_work_malloc( sizeof(float) * swork_size);
     if( swork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     liwork = iwork_query;
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if ( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -57,9 +57,9 @@ lapack_int API_SUFFIX(LAPACKE_strsyl3)( int matrix_layout, char trana, char tran
                                  lda, b, ldb, c, ldc, scale, iwork, liwork,
                                  swork, ldswork );
     /* Release memory and exit */
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_1:
-    LAPACKE_free( swork );
+    LAPACKE_work_free( swork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_strsyl3", info );
@@ -52,7 +52,7 @@ lapack_int API_SUFFIX(LAPACKE_strtri_work)( int matrix_layout, char uplo, char d
             return info;
         }
         /* Allocate memory for temporary array(s) */
-        a_t = (float*)LAPACKE_malloc( sizeof(float) * lda_t * MAX(1,n) );
+        a_t = (float*)LAPACKE_work_malloc( sizeof(float) * lda_t * MAX(1,n) );
         if( a_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_strtri_work)( int matrix_layout, char uplo, char d
         API_SUFFIX(LAPACKE_str_trans)( LAPACK_COL_MAJOR, uplo, diag, n, a_t, lda_t, a,
                            lda );
         /* Release memory and exit */
-        LAPACKE_free( a_t );
+        LAPACKE_work_free( a_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_strtri_work", info );
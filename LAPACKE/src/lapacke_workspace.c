@@ -0,0 +1,301 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+******************************************************************************
+******************************************************************************
+* Contents: Native C interface to control workspace allocation
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+/* All the workspace of the high-level LAPACKE routines is allocated with
+ * LAPACKE_work_malloc and released with LAPACKE_work_free, that is with
+ * LAPACKE_workspace_malloc and LAPACKE_workspace_free unless LAPACKE_malloc
+ * and LAPACKE_free are defined when LAPACKE is compiled (lapacke_utils.h).
+ *
+ * The memory comes from malloc, or from the functions installed with
+ * LAPACKE_set_workspace_allocator, aligned to 64 bytes or the alignment
+ * given there.  The allocator, its alignment and the arena flag are
+ * global and should be set before LAPACKE is called from several threads.
+ *
+ * If the arena is enabled with LAPACKE_set_workspace_arena( 1 ) or with the
+ * environment variable LAPACKE_WORKSPACE_ARENA=1, each thread carves its
+ * workspace out of a buffer of its own, which is only returned to the
+ * allocator by LAPACKE_release_workspace_arena.  The buffer is resized, when
+ * it is empty, to the largest amount of workspace that was in use at one
+ * time, so that a sequence of calls with similar sizes allocates from the
+ * allocator only in the first calls.  A block must then be freed by the
+ * thread that allocated it.
+ *
+ * The statistics returned by LAPACKE_get_workspace_stats are those of the
+ * calling thread.  The arena and the statistics need thread-local storage;
+ * without it the arena is never used and the statistics stay zero.
+ */
+
+#if defined(_MSC_VER)
+#define LAPACKE_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define LAPACKE_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define LAPACKE_THREAD_LOCAL __thread
+#endif
+
+/* Default alignment of the workspace, in bytes */
+#define LAPACKE_WORKSPACE_ALIGN 64
+
+/* Header stored just in front of each block */
+typedef struct {
+    void* base;               /* start of the block */
+    size_t size;              /* bytes requested */
+    size_t total;             /* bytes taken, header included */
+    lapacke_free_fn free_fn;  /* releases base, NULL in the arena */
+    void* context;
+    int counted;              /* the block counts in the arena demand */
+} lapacke_block;
+
+/* Per-thread arena */
+typedef struct {
+    char* buf;
+    size_t size;              /* bytes in buf */
+    size_t top;               /* bytes of buf in use */
+    size_t live;              /* blocks allocated while the arena is on */
+    size_t demand;            /* bytes of these blocks */
+    size_t need;              /* largest demand since buf was resized */
+    lapacke_free_fn free_fn;  /* releases buf */
+    void* context;
+    lapacke_workspace_stats stats;
+} lapacke_arena;
+
+/* Aligned malloc, the address of the memory from malloc is kept in front
+ * of the returned block */
+static void* lapacke_default_malloc( size_t size, size_t alignment,
+                                     void* context )
+{
+    char *p, *q;
+
+    (void)context;
+    if( size > (size_t)-1 - alignment - sizeof(void*) ) return NULL;
+    p = (char*)malloc( size + alignment + sizeof(void*) );
+    if( p == NULL ) return NULL;
+    q = p + sizeof(void*) + alignment - 1;
+    q -= (size_t)q % alignment;
+    ((void**)q)[-1] = p;
+    return q;
+}
+
+static void lapacke_default_free( void* p, void* context )
+{
+    (void)context;
+    if( p != NULL ) free( ((void**)p)[-1] );
+}
+
+static lapacke_malloc_fn workspace_malloc = lapacke_default_malloc;
+static lapacke_free_fn workspace_free = lapacke_default_free;
+static void* workspace_context = NULL;
+static size_t workspace_alignment = LAPACKE_WORKSPACE_ALIGN;
+static int arena_flag = -1;
+
+#ifdef LAPACKE_THREAD_LOCAL
+static LAPACKE_THREAD_LOCAL lapacke_arena arena;
+#endif
+
+void LAPACKE_set_workspace_allocator( lapacke_malloc_fn malloc_fn,
+                                      lapacke_free_fn free_fn,
+                                      size_t alignment, void* context )
+{
+    size_t a = 2*sizeof(void*);
+
+    if( malloc_fn == NULL || free_fn == NULL ) {
+        /* Back to malloc and free */
+        workspace_malloc = lapacke_default_malloc;
+        workspace_free = lapacke_default_free;
+        workspace_context = NULL;
+    } else {
+        workspace_malloc = malloc_fn;
+        workspace_free = free_fn;
+        workspace_context = context;
+    }
+    if( alignment == 0 ) alignment = LAPACKE_WORKSPACE_ALIGN;
+    /* Power of two, at least twice the size of a pointer */
+    while( a < alignment && a <= ( (size_t)-1 )/4 ) a *= 2;
+    workspace_alignment = a;
+}
+
+void LAPACKE_set_workspace_arena( int flag )
+{
+    arena_flag = ( flag ) ? 1 : 0;
+}
+
+int LAPACKE_get_workspace_arena( void )
+{
+    char* env;
+    if ( arena_flag != -1 ) {
+        return arena_flag;
+    }
+
+    /* Check environment variable, once and only once */
+    env = getenv( "LAPACKE_WORKSPACE_ARENA" );
+    if ( !env ) {
+        /* By default, the arena is not used */
+        arena_flag = 0;
+    } else {
+        arena_flag = atoi( env ) ? 1 : 0;
+    }
+
+    return arena_flag;
+}
+
+void* LAPACKE_workspace_malloc( size_t size )
+{
+    size_t align = workspace_alignment, hsize, total;
+    char* p = NULL;
+    lapacke_block* b;
+
+    /* The header takes a multiple of the alignment, the block is rounded
+     * up to one so that the next block of the arena stays aligned */
+    hsize = ( sizeof(lapacke_block) + align - 1 ) / align * align;
+    if( size > (size_t)-1 - hsize - align ) return NULL;
+    total = hsize + ( size + align - 1 ) / align * align;
+
+#ifdef LAPACKE_THREAD_LOCAL
+    if( LAPACKE_get_workspace_arena() ) {
+        if( arena.live == 0 ) {
+            arena.top = 0;
+            arena.need = MAX( arena.need, total );
+            if( arena.need > arena.size ) {
+                /* Resize the empty arena to the largest demand seen */
+                if( arena.buf != NULL ) {
+                    arena.free_fn( arena.buf, arena.context );
+                }
+                arena.buf = (char*)workspace_malloc( arena.need, align,
+                                                     workspace_context );
+                arena.size = ( arena.buf != NULL ) ? arena.need : 0;
+                arena.free_fn = workspace_free;
+                arena.context = workspace_context;
+                arena.stats.arena = arena.size;
+            }
+        }
+        if( total <= arena.size - arena.top &&
+            (size_t)( arena.buf + arena.top ) % align == 0 ) {
+            p = arena.buf + arena.top;
+            arena.top += total;
+            b = (lapacke_block*)( p + hsize ) - 1;
+            b->free_fn = NULL;
+        }
+    }
+#endif
+    if( p == NULL ) {
+        p = (char*)workspace_malloc( total, align, workspace_context );
+        if( p == NULL ) return NULL;
+        b = (lapacke_block*)( p + hsize ) - 1;
+        b->free_fn = workspace_free;
+        b->context = workspace_context;
+    }
+    b->base = p;
+    b->size = size;
+    b->total = total;
+    b->counted = 0;
+
+#ifdef LAPACKE_THREAD_LOCAL
+    if( LAPACKE_get_workspace_arena() ) {
+        b->counted = 1;
+        arena.live++;
+        arena.demand += total;
+        arena.need = MAX( arena.need, arena.demand );
+    }
+    arena.stats.count++;
+    arena.stats.bytes += size;
+    arena.stats.in_use += size;
+    arena.stats.peak = MAX( arena.stats.peak, arena.stats.in_use );
+#endif
+    return p + hsize;
+}
+
+void LAPACKE_workspace_free( void* p )
+{
+    lapacke_block* b;
+
+    if( p == NULL ) return;
+    b = (lapacke_block*)p - 1;
+
+#ifdef LAPACKE_THREAD_LOCAL
+    arena.stats.in_use -= MIN( b->size, arena.stats.in_use );
+    if( b->counted ) {
+        arena.live--;
+        arena.demand -= b->total;
+        if( arena.live == 0 ) {
+            arena.top = 0;
+        } else if( b->free_fn == NULL &&
+                   (char*)b->base + b->total == arena.buf + arena.top ) {
+            /* Last block of the arena, the space can be reused at once */
+            arena.top -= b->total;
+        }
+    }
+#endif
+    if( b->free_fn != NULL ) {
+        b->free_fn( b->base, b->context );
+    }
+}
+
+void LAPACKE_release_workspace_arena( void )
+{
+#ifdef LAPACKE_THREAD_LOCAL
+    /* The arena can only be released when all its blocks are free */
+    if( arena.live == 0 && arena.buf != NULL ) {
+        arena.free_fn( arena.buf, arena.context );
+        arena.buf = NULL;
+        arena.size = 0;
+        arena.top = 0;
+        arena.need = 0;
+        arena.stats.arena = 0;
+    }
+#endif
+}
+
+void LAPACKE_get_workspace_stats( lapacke_workspace_stats* stats )
+{
+    if( stats == NULL ) return;
+#ifdef LAPACKE_THREAD_LOCAL
+    *stats = arena.stats;
+#else
+    stats->count = 0;
+    stats->bytes = 0;
+    stats->in_use = 0;
+    stats->peak = 0;
+    stats->arena = 0;
+#endif
+}
+
+void LAPACKE_reset_workspace_stats( void )
+{
+#ifdef LAPACKE_THREAD_LOCAL
+    /* The bytes in use and the arena size are kept */
+    arena.stats.count = 0;
+    arena.stats.bytes = 0;
+    arena.stats.peak = arena.stats.in_use;
+#endif
+}
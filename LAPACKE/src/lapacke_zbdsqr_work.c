@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_zbdsqr_work)( int matrix_layout, char uplo, lapack
         /* Allocate memory for temporary array(s) */
         if( ncvt != 0 ) {
             vt_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldvt_t * MAX(1,ncvt) );
             if( vt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -82,7 +82,7 @@ lapack_int API_SUFFIX(LAPACKE_zbdsqr_work)( int matrix_layout, char uplo, lapack
         }
         if( nru != 0 ) {
             u_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldu_t * MAX(1,n) );
             if( u_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -91,7 +91,7 @@ lapack_int API_SUFFIX(LAPACKE_zbdsqr_work)( int matrix_layout, char uplo, lapack
         }
         if( ncc != 0 ) {
             c_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldc_t * MAX(1,ncc) );
             if( c_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -127,15 +127,15 @@ lapack_int API_SUFFIX(LAPACKE_zbdsqr_work)( int matrix_layout, char uplo, lapack
         }
         /* Release memory and exit */
         if( ncc != 0 ) {
-            LAPACKE_free( c_t );
+            LAPACKE_work_free( c_t );
         }
 exit_level_2:
         if( nru != 0 ) {
-            LAPACKE_free( u_t );
+            LAPACKE_work_free( u_t );
         }
 exit_level_1:
         if( ncvt != 0 ) {
-            LAPACKE_free( vt_t );
+            LAPACKE_work_free( vt_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -58,20 +58,20 @@ lapack_int API_SUFFIX(LAPACKE_zcgesv)( int matrix_layout, lapack_int n, lapack_i
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+    rwork = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     swork = (lapack_complex_float*)
-        LAPACKE_malloc( sizeof(lapack_complex_float) *
+        LAPACKE_work_malloc( sizeof(lapack_complex_float) *
                         MAX(1,n) * MAX(1,n+nrhs) );
     if( swork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) *
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                         MAX(1,n) * MAX(1,nrhs) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
@@ -81,11 +81,11 @@ lapack_int API_SUFFIX(LAPACKE_zcgesv)( int matrix_layout, lapack_int n, lapack_i
     info = API_SUFFIX(LAPACKE_zcgesv_work)( matrix_layout, n, nrhs, a, lda, ipiv, b, ldb, x,
                                 ldx, work, swork, rwork, iter );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_2:
-    LAPACKE_free( swork );
+    LAPACKE_work_free( swork );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zcgesv", info );
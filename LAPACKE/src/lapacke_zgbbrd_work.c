@@ -81,14 +81,14 @@ lapack_int API_SUFFIX(LAPACKE_zgbbrd_work)( int matrix_layout, char vect, lapack
         }
         /* Allocate memory for temporary array(s) */
         ab_t = (lapack_complex_double*)
-            LAPACKE_malloc( sizeof(lapack_complex_double) * ldab_t * MAX(1,n) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldab_t * MAX(1,n) );
         if( ab_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'q' ) ) {
             q_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldq_t * MAX(1,m) );
             if( q_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -97,7 +97,7 @@ lapack_int API_SUFFIX(LAPACKE_zgbbrd_work)( int matrix_layout, char vect, lapack
         }
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'p' ) ) {
             pt_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldpt_t * MAX(1,n) );
             if( pt_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -106,7 +106,7 @@ lapack_int API_SUFFIX(LAPACKE_zgbbrd_work)( int matrix_layout, char vect, lapack
         }
         if( ncc != 0 ) {
             c_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldc_t * MAX(1,ncc) );
             if( c_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -138,18 +138,18 @@ lapack_int API_SUFFIX(LAPACKE_zgbbrd_work)( int matrix_layout, char vect, lapack
         }
         /* Release memory and exit */
         if( ncc != 0 ) {
-            LAPACKE_free( c_t );
+            LAPACKE_work_free( c_t );
         }
 exit_level_3:
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'p' ) ) {
-            LAPACKE_free( pt_t );
+            LAPACKE_work_free( pt_t );
         }
 exit_level_2:
         if( API_SUFFIX(LAPACKE_lsame)( vect, 'b' ) || API_SUFFIX(LAPACKE_lsame)( vect, 'q' ) ) {
-            LAPACKE_free( q_t );
+            LAPACKE_work_free( q_t );
         }
 exit_level_1:
-        LAPACKE_free( ab_t );
+        LAPACKE_work_free( ab_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgbbrd_work", info );
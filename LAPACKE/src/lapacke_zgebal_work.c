@@ -57,7 +57,7 @@ lapack_int API_SUFFIX(LAPACKE_zgebal_work)( int matrix_layout, char job, lapack_
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'p' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 's' ) ) {
             a_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 lda_t * MAX(1,n) );
             if( a_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -82,7 +82,7 @@ lapack_int API_SUFFIX(LAPACKE_zgebal_work)( int matrix_layout, char job, lapack_
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'p' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 's' ) ) {
-            LAPACKE_free( a_t );
+            LAPACKE_work_free( a_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
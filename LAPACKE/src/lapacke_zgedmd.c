@@ -94,17 +94,17 @@ lapack_int API_SUFFIX(LAPACKE_zgedmd)( int matrix_layout, char jobs, char jobz,
     liwork = iwork_query;
     lzwork = LAPACK_Z2INT( zwork_query );
     /* Allocate memory for work arrays */
-    zwork  = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * lzwork );
+    zwork  = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * lzwork );
     if( zwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    work  = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work  = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * liwork );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * liwork );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -115,11 +115,11 @@ lapack_int API_SUFFIX(LAPACKE_zgedmd)( int matrix_layout, char jobs, char jobz,
 				res, b, ldb, w, ldw, s, lds, zwork, lzwork,
 				work, lwork, iwork, liwork );
     /* Release memory and exit */
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_2:
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( zwork );
+    LAPACKE_work_free( zwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgedmd", info );
@@ -110,32 +110,32 @@ lapack_int API_SUFFIX(LAPACKE_zgedmd_work)( int matrix_layout, char jobs, char j
             return (info < 0) ? (info - 1) : info;
         }
         /* Allocate memory for temporary array(s) */
-        x_t = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * ldx_t * MAX(1,n) );
+        x_t = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldx_t * MAX(1,n) );
         if( x_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
         }
-        y_t = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * ldy_t * MAX(1,n) );
+        y_t = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldy_t * MAX(1,n) );
         if( y_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_1;
         }
-        z_t = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * ldz_t * MAX(1,n) );
+        z_t = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldz_t * MAX(1,n) );
         if( z_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_2;
         }
-        b_t = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * ldb_t * MAX(1,n) );
+        b_t = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldb_t * MAX(1,n) );
         if( b_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_3;
         }
-        w_t = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * ldw_t * MAX(1,n) );
+        w_t = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldw_t * MAX(1,n) );
         if( w_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_4;
         }
-        s_t = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * lds_t * MAX(1,n) );
+        s_t = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * lds_t * MAX(1,n) );
         if( s_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_5;
@@ -163,17 +163,17 @@ lapack_int API_SUFFIX(LAPACKE_zgedmd_work)( int matrix_layout, char jobs, char j
         API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, m, n, w_t, ldw_t, w, ldw );
         API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, m, n, s_t, lds_t, s, lds );
         /* Release memory and exit */
-        LAPACKE_free( s_t );
+        LAPACKE_work_free( s_t );
 exit_level_5:
-        LAPACKE_free( w_t );
+        LAPACKE_work_free( w_t );
 exit_level_4:
-        LAPACKE_free( b_t );
+        LAPACKE_work_free( b_t );
 exit_level_3:
-        LAPACKE_free( z_t );
+        LAPACKE_work_free( z_t );
 exit_level_2:
-        LAPACKE_free( y_t );
+        LAPACKE_work_free( y_t );
 exit_level_1:
-        LAPACKE_free( x_t );
+        LAPACKE_work_free( x_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgedmd_work", info );
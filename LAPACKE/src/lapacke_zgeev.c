@@ -56,7 +56,7 @@ lapack_int API_SUFFIX(LAPACKE_zgeev)( int matrix_layout, char jobvl, char jobvr,
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*n) );
+    rwork = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_zgeev)( int matrix_layout, char jobvl, char jobvr,
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -79,9 +79,9 @@ lapack_int API_SUFFIX(LAPACKE_zgeev)( int matrix_layout, char jobvl, char jobvr,
     info = API_SUFFIX(LAPACKE_zgeev_work)( matrix_layout, jobvl, jobvr, n, a, lda, w, vl,
                                ldvl, vr, ldvr, work, lwork, rwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeev", info );
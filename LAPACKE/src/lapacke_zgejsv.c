@@ -136,7 +136,7 @@ lapack_int API_SUFFIX(LAPACKE_zgejsv)( int matrix_layout, char joba, char jobu,
     }
 #endif
     /* Allocate memory for working array(s) */
-    iwork = (lapack_int*)LAPACKE_malloc( sizeof(lapack_int) * MAX(3,m+2*n) );
+    iwork = (lapack_int*)LAPACKE_work_malloc( sizeof(lapack_int) * MAX(3,m+2*n) );
     if( iwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -151,13 +151,13 @@ lapack_int API_SUFFIX(LAPACKE_zgejsv)( int matrix_layout, char joba, char jobu,
         if( want_u && API_SUFFIX(LAPACKE_lsame)( jobv, 'v' ) ) lwork = MAX( lwork, 5*n+2*n*n ); // 4.1
         if( want_u && API_SUFFIX(LAPACKE_lsame)( jobv, 'j' ) ) lwork = MAX( lwork, 4*n+n*n ); // 4.2
     }
-    cwork = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+    cwork = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( cwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
     }
     lrwork = MAX3( lrwork, 7, n+2*m );
-    rwork = (double*)LAPACKE_malloc( sizeof(double) * lrwork );
+    rwork = (double*)LAPACKE_work_malloc( sizeof(double) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_2;
@@ -174,11 +174,11 @@ lapack_int API_SUFFIX(LAPACKE_zgejsv)( int matrix_layout, char joba, char jobu,
         istat[i] = iwork[i];
     }
     /* Release memory and exit */
-    LAPACKE_free( cwork );
+    LAPACKE_work_free( cwork );
 exit_level_2:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_1:
-    LAPACKE_free( iwork );
+    LAPACKE_work_free( iwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgejsv", info );
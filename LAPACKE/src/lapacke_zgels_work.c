@@ -47,62 +47,47 @@ lapack_int API_SUFFIX(LAPACKE_zgels_work)( int matrix_layout, char trans, lapack
             info = info - 1;
         }
     } else if( matrix_layout == LAPACK_ROW_MAJOR ) {
-        lapack_int lda_t = MAX(1,m);
-        lapack_int ldb_t = MAX(1,MAX(m,n));
-        lapack_complex_double* a_t = NULL;
-        lapack_complex_double* b_t = NULL;
-        /* Check leading dimension(s) */
-        if( lda < n ) {
-            info = -7;
+        /* Solve in place with the LQ (QR) factorization of A**T, see
+         * LAPACKE_zgels_rowmajor */
+        if( !API_SUFFIX(LAPACKE_lsame)( trans, 'n' ) &&
+            !API_SUFFIX(LAPACKE_lsame)( trans, 'c' ) ) {
+            info = -2;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
             return info;
         }
-        if( ldb < nrhs ) {
-            info = -9;
+        if( m < 0 ) {
+            info = -3;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
             return info;
         }
-        /* Query optimal working array(s) size if requested */
-        if( lwork == -1 ) {
-            LAPACK_zgels( &trans, &m, &n, &nrhs, a, &lda_t, b, &ldb_t, work,
-                          &lwork, &info );
-            return (info < 0) ? (info - 1) : info;
+        if( n < 0 ) {
+            info = -4;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
+            return info;
         }
-        /* Allocate memory for temporary array(s) */
-        a_t = (lapack_complex_double*)
-            LAPACKE_malloc( sizeof(lapack_complex_double) * lda_t * MAX(1,n) );
-        if( a_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_0;
+        if( nrhs < 0 ) {
+            info = -5;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
+            return info;
         }
-        b_t = (lapack_complex_double*)
-            LAPACKE_malloc( sizeof(lapack_complex_double) *
-                            ldb_t * MAX(1,nrhs) );
-        if( b_t == NULL ) {
-            info = LAPACK_TRANSPOSE_MEMORY_ERROR;
-            goto exit_level_1;
+        if( lda < n ) {
+            info = -7;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
+            return info;
         }
-        /* Transpose input matrices */
-        API_SUFFIX(LAPACKE_zge_trans)( matrix_layout, m, n, a, lda, a_t, lda_t );
-        API_SUFFIX(LAPACKE_zge_trans)( matrix_layout, MAX(m,n), nrhs, b, ldb, b_t, ldb_t );
-        /* Call LAPACK function and adjust info */
-        LAPACK_zgels( &trans, &m, &n, &nrhs, a_t, &lda_t, b_t, &ldb_t, work,
-                      &lwork, &info );
-        if( info < 0 ) {
-            info = info - 1;
+        if( ldb < nrhs ) {
+            info = -9;
+            API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
+            return info;
         }
-        /* Transpose output matrices */
-        API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, m, n, a_t, lda_t, a, lda );
-        API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, MAX(m,n), nrhs, b_t, ldb_t, b,
-                           ldb );
-        /* Release memory and exit */
-        LAPACKE_free( b_t );
-exit_level_1:
-        LAPACKE_free( a_t );
-exit_level_0:
-        if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
+        if( lwork < MAX( 1, MIN(m,n) + MAX( MIN(m,n), nrhs ) ) &&
+            lwork != -1 ) {
+            info = -11;
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
+            return info;
         }
+        info = API_SUFFIX(LAPACKE_zgels_rowmajor)( trans, m, n, nrhs, a, lda, b,
+                                                 ldb, work, lwork );
     } else {
         info = -1;
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgels_work", info );
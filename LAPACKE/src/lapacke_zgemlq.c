@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_zgemlq)( int matrix_layout, char side, char trans,
     }
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
-    work = (lapack_complex_double*)LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+    work = (lapack_complex_double*)LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_zgemlq)( int matrix_layout, char side, char trans,
     info = API_SUFFIX(LAPACKE_zgemlq_work)( matrix_layout, side, trans, m, n, k, a, lda,
                                 t, tsize, c, ldc, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgemlq", info );
@@ -0,0 +1,161 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************
+* Contents: Native high-level C interface to LAPACK function zgeqrf for a
+*           batch of matrices
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+lapack_int API_SUFFIX(LAPACKE_zgeqrf_batch_strided)( int matrix_layout,
+                                  lapack_int m, lapack_int n,
+                                  lapack_complex_double* a, lapack_int lda,
+                                  lapack_int stridea,
+                                  lapack_complex_double* tau,
+                                  lapack_int stridetau,
+                                  lapack_int batch_size )
+{
+    lapack_int k, info = 0, lwork = -1, mn = MIN(m,n);
+    lapack_int lda_t = MAX(1,m), nbuf;
+    lapack_logical blocked;
+    lapack_complex_double work_query;
+    double work;
+#ifdef _OPENMP
+    lapack_int nt = 1;
+#endif
+    if( matrix_layout != LAPACK_COL_MAJOR &&
+        matrix_layout != LAPACK_ROW_MAJOR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -1 );
+        return -1;
+    }
+    /* Check the arguments once for the whole batch */
+    if( m < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -2 );
+        return -2;
+    }
+    if( n < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -3 );
+        return -3;
+    }
+    if( lda < MAX(1, matrix_layout == LAPACK_COL_MAJOR ? m : n) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -5 );
+        return -5;
+    }
+    if( stridea < lda * ( matrix_layout == LAPACK_COL_MAJOR ? n : m ) ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -6 );
+        return -6;
+    }
+    if( stridetau < mn ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -8 );
+        return -8;
+    }
+    if( batch_size < 0 ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", -9 );
+        return -9;
+    }
+#ifndef LAPACK_DISABLE_NAN_CHECK
+    if( LAPACKE_get_nancheck() ) {
+        /* Optionally check input matrices for NaNs */
+        for( k = 0; k < batch_size; k++ ) {
+            if( API_SUFFIX(LAPACKE_zge_nancheck)( matrix_layout, m, n,
+                                                  a + (size_t)k*stridea,
+                                                  lda ) ) {
+                return -4;
+            }
+        }
+    }
+#endif
+    if( mn == 0 || batch_size == 0 ) {
+        return 0;
+    }
+    /* Query the workspace once for the whole batch; the unblocked code,
+     * which does not call ILAENV, is used when ZGEQRF would use it.  In
+     * row-major layout each thread also needs a column-major copy of A. */
+    LAPACK_zgeqrf( &m, &n, a, &lda_t, tau, &work_query, &lwork, &info );
+    lwork = MAX( n, LAPACK_Z2INT( work_query ) );
+    blocked = ( mn > lwork / n );
+    if( !blocked ) {
+        lwork = n;
+    }
+    nbuf = lwork;
+    if( matrix_layout == LAPACK_ROW_MAJOR ) {
+        nbuf += lda_t*n;
+    }
+    /* Number of real multiply-adds per matrix */
+    work = 4.0*(double)mn*mn*( MAX(m,n) - mn/3.0 );
+#ifdef _OPENMP
+    nt = API_SUFFIX(LAPACKE_batch_threads)( batch_size, work );
+    #pragma omp parallel num_threads(nt) if(nt > 1)
+#endif
+    {
+        /* Workspace of each thread */
+        lapack_complex_double* w = (lapack_complex_double*)
+            LAPACKE_work_malloc( sizeof(lapack_complex_double) * nbuf );
+        lapack_int j, ldj, iinfo;
+
+        if( w == NULL ) {
+#ifdef _OPENMP
+            #pragma omp atomic write
+#endif
+            info = LAPACK_WORK_MEMORY_ERROR;
+        }
+#ifdef _OPENMP
+        #pragma omp for schedule(static)
+#endif
+        for( j = 0; j < batch_size; j++ ) {
+            lapack_complex_double* aj = a + (size_t)j*stridea;
+            lapack_complex_double* tj = tau + (size_t)j*stridetau;
+            if( w == NULL ) {
+                continue;
+            }
+            ldj = lda;
+            if( matrix_layout == LAPACK_ROW_MAJOR ) {
+                API_SUFFIX(LAPACKE_zge_trans)( matrix_layout, m, n, aj, lda,
+                                               w + lwork, lda_t );
+                aj = w + lwork;
+                ldj = lda_t;
+            }
+            if( blocked ) {
+                LAPACK_zgeqrf( &m, &n, aj, &ldj, tj, w, &lwork, &iinfo );
+            } else {
+                LAPACK_zgeqr2( &m, &n, aj, &ldj, tj, w, &iinfo );
+            }
+            if( matrix_layout == LAPACK_ROW_MAJOR ) {
+                API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, m, n, aj,
+                                               ldj, a + (size_t)j*stridea,
+                                               lda );
+            }
+        }
+        LAPACKE_work_free( w );
+    }
+    if( info == LAPACK_WORK_MEMORY_ERROR ) {
+        API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgeqrf_batch_strided", info );
+    }
+    return info;
+}
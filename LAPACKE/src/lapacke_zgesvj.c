@@ -66,12 +66,12 @@ lapack_int API_SUFFIX(LAPACKE_zgesvj)( int matrix_layout, char joba, char jobu,
 #endif
     /* Allocate memory for working array(s) */
     cwork = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double)  * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double)  * lwork );
     if( cwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
-    rwork = (double*)LAPACKE_malloc( sizeof(double) * lrwork );
+    rwork = (double*)LAPACKE_work_malloc( sizeof(double) * lrwork );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_1;
@@ -86,9 +86,9 @@ lapack_int API_SUFFIX(LAPACKE_zgesvj)( int matrix_layout, char joba, char jobu,
     }
 
     /* Release memory and exit */
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_1:
-    LAPACKE_free( cwork );
+    LAPACKE_work_free( cwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgesvj", info );
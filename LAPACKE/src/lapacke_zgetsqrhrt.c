@@ -62,7 +62,7 @@ lapack_int API_SUFFIX(LAPACKE_zgetsqrhrt)( int matrix_layout, lapack_int m, lapa
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -71,7 +71,7 @@ lapack_int API_SUFFIX(LAPACKE_zgetsqrhrt)( int matrix_layout, lapack_int m, lapa
     info = API_SUFFIX(LAPACKE_zgetsqrhrt_work)( matrix_layout, m, n, mb1, nb1, nb2,
                                     a, lda, t, ldt, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgetsqrhrt", info );
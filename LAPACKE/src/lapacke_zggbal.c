@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_zggbal)( int matrix_layout, char job, lapack_int n
         lwork = 1;
     }
     /* Allocate memory for working array(s) */
-    work = (double*)LAPACKE_malloc( sizeof(double) * lwork );
+    work = (double*)LAPACKE_work_malloc( sizeof(double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -79,7 +79,7 @@ lapack_int API_SUFFIX(LAPACKE_zggbal)( int matrix_layout, char job, lapack_int n
     info = API_SUFFIX(LAPACKE_zggbal_work)( matrix_layout, job, n, a, lda, b, ldb, ilo, ihi,
                                 lscale, rscale, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zggbal", info );
@@ -66,7 +66,7 @@ lapack_int API_SUFFIX(LAPACKE_zggbal_work)( int matrix_layout, char job, lapack_
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
             a_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 lda_t * MAX(1,n) );
             if( a_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_zggbal_work)( int matrix_layout, char job, lapack_
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
             b_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldb_t * MAX(1,n) );
             if( b_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -110,12 +110,12 @@ lapack_int API_SUFFIX(LAPACKE_zggbal_work)( int matrix_layout, char job, lapack_
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
-            LAPACKE_free( b_t );
+            LAPACKE_work_free( b_t );
         }
 exit_level_1:
         if( API_SUFFIX(LAPACKE_lsame)( job, 'p' ) || API_SUFFIX(LAPACKE_lsame)( job, 's' ) ||
             API_SUFFIX(LAPACKE_lsame)( job, 'b' ) ) {
-            LAPACKE_free( a_t );
+            LAPACKE_work_free( a_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -69,7 +69,7 @@ lapack_int API_SUFFIX(LAPACKE_zggglm)( int matrix_layout, lapack_int n, lapack_i
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -78,7 +78,7 @@ lapack_int API_SUFFIX(LAPACKE_zggglm)( int matrix_layout, lapack_int n, lapack_i
     info = API_SUFFIX(LAPACKE_zggglm_work)( matrix_layout, n, m, p, a, lda, b, ldb, d, x, y,
                                 work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zggglm", info );
@@ -79,7 +79,7 @@ lapack_int API_SUFFIX(LAPACKE_zgghd3)( int matrix_layout, char compq, char compz
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -89,7 +89,7 @@ lapack_int API_SUFFIX(LAPACKE_zgghd3)( int matrix_layout, char compq, char compz
                                  a, lda, b, ldb, q, ldq, z, ldz, work,
                                  lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zgghd3", info );
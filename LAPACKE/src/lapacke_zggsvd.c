@@ -62,13 +62,13 @@ lapack_int API_SUFFIX(LAPACKE_zggsvd)( int matrix_layout, char jobu, char jobv,
     }
 #endif
     /* Allocate memory for working array(s) */
-    rwork = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,2*n) );
+    rwork = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,2*n) );
     if( rwork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
     }
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) *
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                         MAX(1,MAX3(3*n,m,p)+n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
@@ -79,9 +79,9 @@ lapack_int API_SUFFIX(LAPACKE_zggsvd)( int matrix_layout, char jobu, char jobv,
                                 a, lda, b, ldb, alpha, beta, u, ldu, v, ldv, q,
                                 ldq, work, rwork, iwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_1:
-    LAPACKE_free( rwork );
+    LAPACKE_work_free( rwork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zggsvd", info );
@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_zhetri_3)( int matrix_layout, char uplo, lapack_in
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for working array(s) */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_zhetri_3)( int matrix_layout, char uplo, lapack_in
     /* Call middle-level interface */
     info = API_SUFFIX(LAPACKE_zhetri_3_work)( matrix_layout, uplo, n, a, lda, e, ipiv, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zhetri_3", info );
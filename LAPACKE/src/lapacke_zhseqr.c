@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_zhseqr)( int matrix_layout, char job, char compz,
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -77,7 +77,7 @@ lapack_int API_SUFFIX(LAPACKE_zhseqr)( int matrix_layout, char job, char compz,
     info = API_SUFFIX(LAPACKE_zhseqr_work)( matrix_layout, job, compz, n, ilo, ihi, h, ldh,
                                 w, z, ldz, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zhseqr", info );
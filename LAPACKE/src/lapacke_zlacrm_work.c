@@ -67,11 +67,11 @@ lapack_int API_SUFFIX(LAPACKE_zlacrm_work)(int matrix_layout, lapack_int m, lapa
         }
         /* Allocate memory for temporary array(s) */
         a_t = (lapack_complex_double*)
-            LAPACKE_malloc(sizeof(lapack_complex_double) * lda_t * MAX(1,n));
+            LAPACKE_work_malloc(sizeof(lapack_complex_double) * lda_t * MAX(1,n));
         b_t = (double*)
-            LAPACKE_malloc(sizeof(double) * ldb_t * MAX(1,n));
+            LAPACKE_work_malloc(sizeof(double) * ldb_t * MAX(1,n));
         c_t = (lapack_complex_double*)
-            LAPACKE_malloc((sizeof(lapack_complex_double) * ldc_t * MAX(1,n)));
+            LAPACKE_work_malloc((sizeof(lapack_complex_double) * ldc_t * MAX(1,n)));
         if (a_t == NULL) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -92,11 +92,11 @@ lapack_int API_SUFFIX(LAPACKE_zlacrm_work)(int matrix_layout, lapack_int m, lapa
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_zge_trans)(LAPACK_COL_MAJOR, m, n, c_t, ldc_t, c, ldc);
         /* Release memory and exit */
-        LAPACKE_free(c_t);
+        LAPACKE_work_free(c_t);
 exit_level_2:
-        LAPACKE_free(b_t);
+        LAPACKE_work_free(b_t);
 exit_level_1:
-        LAPACKE_free(a_t);
+        LAPACKE_work_free(a_t);
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zlacrm_work", info );
@@ -53,7 +53,7 @@ double API_SUFFIX(LAPACKE_zlangb)( int matrix_layout, char norm, lapack_int n,
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+        work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -63,7 +63,7 @@ double API_SUFFIX(LAPACKE_zlangb)( int matrix_layout, char norm, lapack_int n,
     res = API_SUFFIX(LAPACKE_zlangb_work)( matrix_layout, norm, n, kl, ku, ab, ldab, work );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -53,7 +53,7 @@ double API_SUFFIX(LAPACKE_zlanhe)( int matrix_layout, char norm, char uplo, lapa
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) || API_SUFFIX(LAPACKE_lsame)( norm, '1' ) ||
         API_SUFFIX(LAPACKE_lsame)( norm, 'O' ) ) {
-        work = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+        work = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -64,7 +64,7 @@ double API_SUFFIX(LAPACKE_zlanhe)( int matrix_layout, char norm, char uplo, lapa
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( norm, 'i' ) || API_SUFFIX(LAPACKE_lsame)( norm, '1' ) ||
         API_SUFFIX(LAPACKE_lsame)( norm, 'O' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
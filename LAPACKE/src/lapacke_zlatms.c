@@ -63,7 +63,7 @@ lapack_int API_SUFFIX(LAPACKE_zlatms)( int matrix_layout, lapack_int m, lapack_i
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * MAX(1,3*(MAX(n,m))) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * MAX(1,3*(MAX(n,m))) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -72,7 +72,7 @@ lapack_int API_SUFFIX(LAPACKE_zlatms)( int matrix_layout, lapack_int m, lapack_i
     info = API_SUFFIX(LAPACKE_zlatms_work)( matrix_layout, m, n, dist, iseed, sym, d, mode,
                                 cond, dmax, kl, ku, pack, a, lda, work );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zlatms", info );
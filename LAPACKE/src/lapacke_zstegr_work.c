@@ -70,7 +70,7 @@ lapack_int API_SUFFIX(LAPACKE_zstegr_work)( int matrix_layout, char jobz, char r
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
             /* Let be always 'n' instead of 'm' */
             z_t = (lapack_complex_double*)
-                LAPACKE_malloc( sizeof(lapack_complex_double) *
+                LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                                 ldz_t * MAX(1,n) );
             if( z_t == NULL ) {
                 info = LAPACK_TRANSPOSE_MEMORY_ERROR;
@@ -90,7 +90,7 @@ lapack_int API_SUFFIX(LAPACKE_zstegr_work)( int matrix_layout, char jobz, char r
         }
         /* Release memory and exit */
         if( API_SUFFIX(LAPACKE_lsame)( jobz, 'v' ) ) {
-            LAPACKE_free( z_t );
+            LAPACKE_work_free( z_t );
         }
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
@@ -59,7 +59,7 @@ lapack_int API_SUFFIX(LAPACKE_zstein_work)( int matrix_layout, lapack_int n, con
         }
         /* Allocate memory for temporary array(s) */
         z_t = (lapack_complex_double*)
-            LAPACKE_malloc( sizeof(lapack_complex_double) * ldz_t * MAX(1,m) );
+            LAPACKE_work_malloc( sizeof(lapack_complex_double) * ldz_t * MAX(1,m) );
         if( z_t == NULL ) {
             info = LAPACK_TRANSPOSE_MEMORY_ERROR;
             goto exit_level_0;
@@ -73,7 +73,7 @@ lapack_int API_SUFFIX(LAPACKE_zstein_work)( int matrix_layout, lapack_int n, con
         /* Transpose output matrices */
         API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, n, m, z_t, ldz_t, z, ldz );
         /* Release memory and exit */
-        LAPACKE_free( z_t );
+        LAPACKE_work_free( z_t );
 exit_level_0:
         if( info == LAPACK_TRANSPOSE_MEMORY_ERROR ) {
             API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zstein_work", info );
@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_zsysv_rook)( int matrix_layout, char uplo, lapack_
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_zsysv_rook)( int matrix_layout, char uplo, lapack_
     info = API_SUFFIX(LAPACKE_zsysv_rook_work)( matrix_layout, uplo, n, nrhs, a, lda, ipiv,
                                     b, ldb, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zsysv_rook", info );
@@ -83,7 +83,7 @@ lapack_int API_SUFFIX(LAPACKE_ztgsja)( int matrix_layout, char jobu, char jobv,
 #endif
     /* Allocate memory for working array(s) */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * MAX(1,2*n) );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * MAX(1,2*n) );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -93,7 +93,7 @@ lapack_int API_SUFFIX(LAPACKE_ztgsja)( int matrix_layout, char jobu, char jobv,
                                 a, lda, b, ldb, tola, tolb, alpha, beta, u, ldu,
                                 v, ldv, q, ldq, work, ncycle );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ztgsja", info );
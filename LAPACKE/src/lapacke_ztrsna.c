@@ -68,7 +68,7 @@ lapack_int API_SUFFIX(LAPACKE_ztrsna)( int matrix_layout, char job, char howmny,
 #endif
     /* Allocate memory for working array(s) */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        rwork = (double*)LAPACKE_malloc( sizeof(double) * MAX(1,n) );
+        rwork = (double*)LAPACKE_work_malloc( sizeof(double) * MAX(1,n) );
         if( rwork == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
             goto exit_level_0;
@@ -76,7 +76,7 @@ lapack_int API_SUFFIX(LAPACKE_ztrsna)( int matrix_layout, char job, char howmny,
     }
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
         work = (lapack_complex_double*)
-            LAPACKE_malloc( sizeof(lapack_complex_double) *
+            LAPACKE_work_malloc( sizeof(lapack_complex_double) *
                             ldwork * MAX(1,n+6) );
         if( work == NULL ) {
             info = LAPACK_WORK_MEMORY_ERROR;
@@ -89,11 +89,11 @@ lapack_int API_SUFFIX(LAPACKE_ztrsna)( int matrix_layout, char job, char howmny,
                                 rwork );
     /* Release memory and exit */
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( work );
+        LAPACKE_work_free( work );
     }
 exit_level_1:
     if( API_SUFFIX(LAPACKE_lsame)( job, 'b' ) || API_SUFFIX(LAPACKE_lsame)( job, 'v' ) ) {
-        LAPACKE_free( rwork );
+        LAPACKE_work_free( rwork );
     }
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
@@ -38,7 +38,7 @@ lapack_int API_SUFFIX(LAPACKE_ztrsyl3)( int matrix_layout, char trana, char tran
     }
     ldswork = swork_query[0];
     swork_size = ldswork * swork_query[1];
-    swork = (double*)LAPACKE_malloc( sizeof(double) * swork_size);
+    swork = (double*)LAPACKE_work_malloc( sizeof(double) * swork_size);
     if( swork == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -47,7 +47,7 @@ lapack_int API_SUFFIX(LAPACKE_ztrsyl3)( int matrix_layout, char trana, char tran
     info = API_SUFFIX(LAPACKE_ztrsyl3_work)( matrix_layout, trana, tranb, isgn, m, n, a,
                                  lda, b, ldb, c, ldc, scale, swork, ldswork );
     /* Release memory and exit */
-    LAPACKE_free( swork );
+    LAPACKE_work_free( swork );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_ztrsyl3", info );
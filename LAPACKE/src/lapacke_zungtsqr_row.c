@@ -65,7 +65,7 @@ lapack_int API_SUFFIX(LAPACKE_zungtsqr_row)( int matrix_layout, lapack_int m, la
     lwork = LAPACK_Z2INT( work_query );
     /* Allocate memory for work arrays */
     work = (lapack_complex_double*)
-        LAPACKE_malloc( sizeof(lapack_complex_double) * lwork );
+        LAPACKE_work_malloc( sizeof(lapack_complex_double) * lwork );
     if( work == NULL ) {
         info = LAPACK_WORK_MEMORY_ERROR;
         goto exit_level_0;
@@ -74,7 +74,7 @@ lapack_int API_SUFFIX(LAPACKE_zungtsqr_row)( int matrix_layout, lapack_int m, la
     info = API_SUFFIX(LAPACKE_zungtsqr_row_work)( matrix_layout, m, n, mb, nb,
                                       a, lda, t, ldt, work, lwork );
     /* Release memory and exit */
-    LAPACKE_free( work );
+    LAPACKE_work_free( work );
 exit_level_0:
     if( info == LAPACK_WORK_MEMORY_ERROR ) {
         API_SUFFIX(LAPACKE_xerbla)( "LAPACKE_zungtsqr_row", info );
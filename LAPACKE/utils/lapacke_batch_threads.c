@@ -0,0 +1,70 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+#include "lapacke_blas.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Returns the number of threads among which a batched routine shares a
+ * batch of count problems of work flops each.
+ *
+ * The result is 1 without OpenMP, inside an active parallel region, or
+ * when the batch is too small for the synchronization to pay off.
+ * Otherwise each thread gets at least LAPACKE_BATCH_MINWORK flops, and at
+ * most BLAS_GET_NUM_THREADS() threads are used (LAPACK_NUM_THREADS), or
+ * omp_get_max_threads() if the BLAS library is not the reference one.
+ * Each problem is then solved serially, since the BLAS does not thread
+ * calls made from a parallel region.
+ */
+
+lapack_int API_SUFFIX(LAPACKE_batch_threads)( lapack_int count, double work )
+{
+#ifdef _OPENMP
+    lapack_int nt;
+
+    if( count < 2 || omp_in_parallel() ) return 1;
+#ifdef LAPACKE_HAVE_BLAS_THREADS
+    nt = BLAS_get_num_threads();
+#else
+    nt = omp_get_max_threads();
+#endif
+    if( (double)nt * LAPACKE_BATCH_MINWORK > work * count ) {
+        nt = (lapack_int)( work * count / LAPACKE_BATCH_MINWORK );
+    }
+    if( nt > count ) nt = count;
+    return ( nt > 1 ) ? nt : 1;
+#else
+    return 1;
+#endif
+}
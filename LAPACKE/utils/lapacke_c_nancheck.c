@@ -31,7 +31,10 @@
 *****************************************************************************/
 #include "lapacke_utils.h"
 
-/* Check a vector for NaN entries. */
+/* Check a vector for NaN entries.
+ * A contiguous vector is checked as a vector of 2*n real numbers by
+ * LAPACKE_s_nancheck, which scans it in SIMD registers.
+ */
 
 lapack_logical API_SUFFIX(LAPACKE_c_nancheck)( lapack_int n,
                                     const lapack_complex_float *x,
@@ -42,6 +45,10 @@ lapack_logical API_SUFFIX(LAPACKE_c_nancheck)( lapack_int n,
     if( incx == 0 ) return (lapack_logical) LAPACK_CISNAN( x[0] );
     inc = ( incx > 0 ) ? incx : -incx ;
 
+    if( inc == 1 ) {
+        return API_SUFFIX(LAPACKE_s_nancheck)( 2*n, (const float*)x, 1 );
+    }
+
     for( i = 0; i < n*inc; i+=inc ) {
         if( LAPACK_CISNAN( x[i] ) )
             return (lapack_logical) 1;
@@ -0,0 +1,54 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+/* Transposes a square n-by-n matrix in place, so that a matrix stored in
+ * row-major layout is converted to column-major layout or vice versa
+ * without a second buffer.
+ */
+
+void API_SUFFIX(LAPACKE_cge_trans_inplace)( lapack_int n, lapack_complex_float* a,
+                                  lapack_int lda )
+{
+    lapack_int i, j;
+    lapack_complex_float t;
+
+    if( a == NULL ) return;
+
+    for( i = 0; i < n; i++ ) {
+        for( j = 0; j < i; j++ ) {
+            t = a[ (size_t)i*lda + j ];
+            a[ (size_t)i*lda + j ] = a[ (size_t)j*lda + i ];
+            a[ (size_t)j*lda + i ] = t;
+        }
+    }
+}
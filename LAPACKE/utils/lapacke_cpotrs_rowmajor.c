@@ -0,0 +1,64 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+#include "lapacke_blas.h"
+
+/* Solves A*X = B with the Cholesky factorization A = U**H*U or
+ * A = L*L**H of a Hermitian positive definite matrix A, where A, B and X
+ * are stored in row-major layout.  B is overwritten by X in place.
+ *
+ * The column-major view of the factor is U**T (lower triangular) or L**T
+ * (upper triangular), and that of B is B**T, so both triangular solves
+ * are done on the right of B**T.  No workspace is needed.
+ *
+ * The arguments are not checked.
+ */
+
+void API_SUFFIX(LAPACKE_cpotrs_rowmajor)( char uplo, lapack_int n, lapack_int nrhs,
+                                const lapack_complex_float* a, lapack_int lda,
+                                lapack_complex_float* b, lapack_int ldb )
+{
+    const lapack_complex_float one = lapack_make_complex_float( 1.0, 0.0 );
+
+    if( n == 0 || nrhs == 0 ) {
+        return;
+    }
+    if( API_SUFFIX(LAPACKE_lsame)( uplo, 'u' ) ) {
+        /* B**T := B**T*inv( conjg( U ) )*inv( U**T ) */
+        BLAS_ctrsm( "R", "L", "C", "N", &nrhs, &n, &one, a, &lda, b, &ldb );
+        BLAS_ctrsm( "R", "L", "N", "N", &nrhs, &n, &one, a, &lda, b, &ldb );
+    } else {
+        /* B**T := B**T*inv( L**T )*inv( conjg( L ) ) */
+        BLAS_ctrsm( "R", "U", "N", "N", &nrhs, &n, &one, a, &lda, b, &ldb );
+        BLAS_ctrsm( "R", "U", "C", "N", &nrhs, &n, &one, a, &lda, b, &ldb );
+    }
+}
@@ -32,6 +32,9 @@
 
 #include "lapacke_utils.h"
 
+/* Number of columns of a panel */
+#define LAPACKE_TR_NB 32
+
 /* Converts input triangular matrix from row-major(C) to column-major(Fortran)
  * layout or vice versa.
  */
@@ -40,7 +43,7 @@ void API_SUFFIX(LAPACKE_ctr_trans)( int matrix_layout, char uplo, char diag, lap
                         const lapack_complex_float *in, lapack_int ldin,
                         lapack_complex_float *out, lapack_int ldout )
 {
-    lapack_int i, j, st;
+    lapack_int i, j, jb, je, jmax, r, st;
     lapack_logical colmaj, lower, unit;
 
     if( in == NULL || out == NULL ) return ;
@@ -67,17 +70,40 @@ void API_SUFFIX(LAPACKE_ctr_trans)( int matrix_layout, char uplo, char diag, lap
      * Since col_major upper and row_major lower are equal,
      * and col_major lower and row_major upper are equals too -
      * using one code for equal cases. XOR( colmaj, upper )
+     *
+     * The columns of in are taken in panels of LAPACKE_TR_NB: the part of
+     * a panel that lies completely in the triangle is transposed by
+     * LAPACKE_cge_trans, and only the triangle on the diagonal is copied
+     * element by element.
      */
     if( ( colmaj || lower ) && !( colmaj && lower ) ) {
-        for( j = st; j < MIN( n, ldout ); j++ ) {
-            for( i = 0; i < MIN( j+1-st, ldin ); i++ ) {
-                out[ j+i*ldout ] = in[ i+j*ldin ];
+        jmax = MIN( n, ldout );
+        for( jb = st; jb < jmax; jb += LAPACKE_TR_NB ) {
+            je = MIN( jb + LAPACKE_TR_NB, jmax );
+            /* Rows 0:r-1 belong to all the columns of the panel */
+            r = MIN( jb+1-st, ldin );
+            API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, r, je-jb,
+                                       &in[ (size_t)jb*ldin ], ldin,
+                                       &out[ jb ], ldout );
+            for( j = jb; j < je; j++ ) {
+                for( i = r; i < MIN( j+1-st, ldin ); i++ ) {
+                    out[ j+(size_t)i*ldout ] = in[ i+(size_t)j*ldin ];
+                }
             }
         }
     } else {
-        for( j = 0; j < MIN( n-st, ldout ); j++ ) {
-            for( i = j+st; i < MIN( n, ldin ); i++ ) {
-                out[ j+i*ldout ] = in[ i+j*ldin ];
+        jmax = MIN( n-st, ldout );
+        for( jb = 0; jb < jmax; jb += LAPACKE_TR_NB ) {
+            je = MIN( jb + LAPACKE_TR_NB, jmax );
+            /* Rows r:n-1 belong to all the columns of the panel */
+            r = MIN( je-1+st, MIN( n, ldin ) );
+            API_SUFFIX(LAPACKE_cge_trans)( LAPACK_COL_MAJOR, MIN( n, ldin )-r,
+                                       je-jb, &in[ r+(size_t)jb*ldin ], ldin,
+                                       &out[ jb+(size_t)r*ldout ], ldout );
+            for( j = jb; j < je; j++ ) {
+                for( i = j+st; i < r; i++ ) {
+                    out[ j+(size_t)i*ldout ] = in[ i+(size_t)j*ldin ];
+                }
             }
         }
     }
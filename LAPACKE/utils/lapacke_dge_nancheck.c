@@ -31,7 +31,10 @@
 *****************************************************************************/
 #include "lapacke_utils.h"
 
-/* Check a matrix for NaN entries. */
+/* Check a matrix for NaN entries.
+ * The columns (column-major) or rows (row-major) are checked in memory
+ * order by LAPACKE_d_nancheck.
+ */
 
 lapack_logical API_SUFFIX(LAPACKE_dge_nancheck)( int matrix_layout, lapack_int m,
                                       lapack_int n,
@@ -44,17 +47,15 @@ lapack_logical API_SUFFIX(LAPACKE_dge_nancheck)( int matrix_layout, lapack_int m
 
     if( matrix_layout == LAPACK_COL_MAJOR ) {
         for( j = 0; j < n; j++ ) {
-            for( i = 0; i < MIN( m, lda ); i++ ) {
-                if( LAPACK_DISNAN( a[i+(size_t)j*lda] ) )
-                    return (lapack_logical) 1;
-            }
+            if( API_SUFFIX(LAPACKE_d_nancheck)( MIN( m, lda ),
+                                                &a[(size_t)j*lda], 1 ) )
+                return (lapack_logical) 1;
         }
     } else if ( matrix_layout == LAPACK_ROW_MAJOR ) {
         for( i = 0; i < m; i++ ) {
-            for( j = 0; j < MIN( n, lda ); j++ ) {
-                if( LAPACK_DISNAN( a[(size_t)i*lda+j] ) )
-                    return (lapack_logical) 1;
-            }
+            if( API_SUFFIX(LAPACKE_d_nancheck)( MIN( n, lda ),
+                                                &a[(size_t)i*lda], 1 ) )
+                return (lapack_logical) 1;
         }
     }
     return (lapack_logical) 0;
@@ -0,0 +1,197 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+#include "lapacke_blas.h"
+
+/* Solves the overdetermined or underdetermined linear systems of ?GELS
+ * with a full-rank general m-by-n matrix A, where A and B are stored in
+ * row-major layout.  A and B are overwritten as by ?GELS, in place.
+ *
+ * The column-major view of the buffer of A is A**T, so the QR
+ * factorization of A (m >= n) is computed as the LQ factorization of
+ * A**T, and the LQ factorization of A (m < n) as the QR factorization
+ * of A**T.  The column-major view of B is B**T, to which Q and the
+ * triangular solves are applied from the right.
+ *
+ * lwork must be at least max( 1, mn + max( mn, nrhs ) ), mn = min(m,n).
+ * If lwork = -1, only the optimal size of work is returned in work[0].
+ *
+ * Returns 0, or i > 0 if the i-th diagonal element of the triangular
+ * factor of A is zero.  The arguments are not checked.
+ */
+
+lapack_int API_SUFFIX(LAPACKE_dgels_rowmajor)( char trans, lapack_int m,
+                                     lapack_int n, lapack_int nrhs,
+                                     double* a, lapack_int lda, double* b,
+                                     lapack_int ldb, double* work,
+                                     lapack_int lwork )
+{
+    const double zero = 0.0;
+    const double one = 1.0;
+    lapack_logical tpsd = !API_SUFFIX(LAPACKE_lsame)( trans, 'n' );
+    lapack_int info = 0, iinfo, i, mn = MIN( m, n ), mx = MAX( m, n );
+    lapack_int lquery = -1, lw, nz, brow, scllen, iascl = 0, ibscl = 0;
+    lapack_int izero = 0, wsize;
+    lapack_int lda_t = MAX( 1, lda ), ldb_t = MAX( 1, ldb );
+    double anrm, bnrm, smlnum, bignum;
+    double wq;
+
+    /* Optimal workspace: tau, then the factorization or the update */
+    if( m >= n ) {
+        LAPACK_dgelqf( &n, &m, a, &lda_t, &wq, &wq, &lquery, &iinfo );
+        wsize = (lapack_int)wq;
+        LAPACK_dormlq( "R", tpsd ? "N" : "T", &nrhs, &m, &n, a, &lda_t, &wq, b,
+                       &ldb_t, &wq, &lquery, &iinfo );
+    } else {
+        LAPACK_dgeqrf( &n, &m, a, &lda_t, &wq, &wq, &lquery, &iinfo );
+        wsize = (lapack_int)wq;
+        LAPACK_dormqr( "R", tpsd ? "N" : "T", &nrhs, &n, &m, a, &lda_t, &wq, b,
+                       &ldb_t, &wq, &lquery, &iinfo );
+    }
+    wsize = MAX( wsize, (lapack_int)wq );
+    wsize = MAX( 1, mn + MAX( wsize, MAX( mn, nrhs ) ) );
+    if( lwork == -1 ) {
+        work[0] = (double)wsize;
+        return 0;
+    }
+    lw = lwork - mn;
+
+    /* Quick return if possible */
+    if( MIN3( m, n, nrhs ) == 0 ) {
+        LAPACK_dlaset( "F", &nrhs, &mx, &zero, &zero, b, &ldb_t );
+        return 0;
+    }
+
+    /* Scale A, B if max element outside range [SMLNUM,BIGNUM] */
+    smlnum = API_SUFFIX(LAPACKE_dlamch)( 's' ) / API_SUFFIX(LAPACKE_dlamch)( 'p' );
+    bignum = 1 / smlnum;
+    anrm = LAPACK_dlange( "M", &n, &m, a, &lda_t, NULL );
+    if( anrm > 0 && anrm < smlnum ) {
+        LAPACK_dlascl( "G", &izero, &izero, &anrm, &smlnum, &n, &m, a, &lda_t,
+                      &iinfo );
+        iascl = 1;
+    } else if( anrm > bignum ) {
+        LAPACK_dlascl( "G", &izero, &izero, &anrm, &bignum, &n, &m, a, &lda_t,
+                      &iinfo );
+        iascl = 2;
+    } else if( anrm == 0 ) {
+        /* Matrix all zero. Return zero solution. */
+        LAPACK_dlaset( "F", &nrhs, &mx, &zero, &zero, b, &ldb_t );
+        work[0] = (double)wsize;
+        return 0;
+    }
+    brow = tpsd ? n : m;
+    bnrm = LAPACK_dlange( "M", &nrhs, &brow, b, &ldb_t, NULL );
+    if( bnrm > 0 && bnrm < smlnum ) {
+        LAPACK_dlascl( "G", &izero, &izero, &bnrm, &smlnum, &nrhs, &brow, b,
+                      &ldb_t, &iinfo );
+        ibscl = 1;
+    } else if( bnrm > bignum ) {
+        LAPACK_dlascl( "G", &izero, &izero, &bnrm, &bignum, &nrhs, &brow, b,
+                      &ldb_t, &iinfo );
+        ibscl = 2;
+    }
+
+    if( m >= n ) {
+        /* A = Q*R, computed as A**T = R**T*Q**T */
+        LAPACK_dgelqf( &n, &m, a, &lda_t, work, &work[mn], &lw, &iinfo );
+        for( i = 0; i < n; i++ ) {
+            if( !IS_D_NONZERO( a[(size_t)i*lda+i] ) ) {
+                return i + 1;
+            }
+        }
+        if( !tpsd ) {
+            /* Least-squares problem min || A*X - B ||:
+             * B**T := B**T*Q, then B(1:n,:)**T := B(1:n,:)**T*inv( R**T ) */
+            LAPACK_dormlq( "R", "T", &nrhs, &m, &n, a, &lda_t, work, b, &ldb_t,
+                           &work[mn], &lw, &iinfo );
+            BLAS_dtrsm( "R", "L", "N", "N", &nrhs, &n, &one, a, &lda_t, b, &ldb_t );
+            scllen = n;
+        } else {
+            /* Minimum norm solution of A**T*X = B:
+             * B(1:n,:)**T := B(1:n,:)**T*inv( R ), B(n+1:m,:) := 0,
+             * then B**T := B**T*Q**T */
+            BLAS_dtrsm( "R", "L", "T", "N", &nrhs, &n, &one, a, &lda_t, b, &ldb_t );
+            nz = m - n;
+            LAPACK_dlaset( "F", &nrhs, &nz, &zero, &zero, &b[(size_t)n*ldb],
+                          &ldb_t );
+            LAPACK_dormlq( "R", "N", &nrhs, &m, &n, a, &lda_t, work, b, &ldb_t,
+                           &work[mn], &lw, &iinfo );
+            scllen = m;
+        }
+    } else {
+        /* A = L*Q, computed as A**T = Q**T*L**T */
+        LAPACK_dgeqrf( &n, &m, a, &lda_t, work, &work[mn], &lw, &iinfo );
+        for( i = 0; i < m; i++ ) {
+            if( !IS_D_NONZERO( a[(size_t)i*lda+i] ) ) {
+                return i + 1;
+            }
+        }
+        if( !tpsd ) {
+            /* Minimum norm solution of A*X = B:
+             * B(1:m,:)**T := B(1:m,:)**T*inv( L**T ), B(m+1:n,:) := 0,
+             * then B**T := B**T*Q**T */
+            BLAS_dtrsm( "R", "U", "N", "N", &nrhs, &m, &one, a, &lda_t, b, &ldb_t );
+            nz = n - m;
+            LAPACK_dlaset( "F", &nrhs, &nz, &zero, &zero, &b[(size_t)m*ldb],
+                          &ldb_t );
+            LAPACK_dormqr( "R", "T", &nrhs, &n, &m, a, &lda_t, work, b, &ldb_t,
+                           &work[mn], &lw, &iinfo );
+            scllen = n;
+        } else {
+            /* Least-squares problem min || A**T*X - B ||:
+             * B**T := B**T*Q**T, then B(1:m,:)**T := B(1:m,:)**T*inv( L ) */
+            LAPACK_dormqr( "R", "N", &nrhs, &n, &m, a, &lda_t, work, b, &ldb_t,
+                           &work[mn], &lw, &iinfo );
+            BLAS_dtrsm( "R", "U", "T", "N", &nrhs, &m, &one, a, &lda_t, b, &ldb_t );
+            scllen = m;
+        }
+    }
+
+    /* Undo scaling */
+    if( iascl == 1 ) {
+        LAPACK_dlascl( "G", &izero, &izero, &anrm, &smlnum, &nrhs, &scllen, b,
+                      &ldb_t, &iinfo );
+    } else if( iascl == 2 ) {
+        LAPACK_dlascl( "G", &izero, &izero, &anrm, &bignum, &nrhs, &scllen, b,
+                      &ldb_t, &iinfo );
+    }
+    if( ibscl == 1 ) {
+        LAPACK_dlascl( "G", &izero, &izero, &smlnum, &bnrm, &nrhs, &scllen, b,
+                      &ldb_t, &iinfo );
+    } else if( ibscl == 2 ) {
+        LAPACK_dlascl( "G", &izero, &izero, &bignum, &bnrm, &nrhs, &scllen, b,
+                      &ldb_t, &iinfo );
+    }
+    work[0] = (double)wsize;
+    return info;
+}
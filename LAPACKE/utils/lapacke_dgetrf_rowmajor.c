@@ -0,0 +1,134 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+#include "lapacke_blas.h"
+
+/* Computes the LU factorization A = P*L*U of a general m-by-n matrix A
+ * stored in row-major layout, in place, with the output of ?GETRF: L is
+ * unit lower triangular, U is upper triangular and row i of A was
+ * interchanged with row ipiv(i).
+ *
+ * The column-major view of the buffer is A**T, so the recursive algorithm
+ * of ?GETRF2 is applied with rows and columns exchanged: the pivot is
+ * searched along a row of A**T, row interchanges of A swap contiguous
+ * rows of the buffer, and the updates are Level 3 BLAS calls on A**T.
+ * No workspace is needed.
+ *
+ * Returns 0, or i > 0 if U(i,i) is exactly zero.  The arguments are not
+ * checked.
+ */
+
+lapack_int API_SUFFIX(LAPACKE_dgetrf_rowmajor)( lapack_int m, lapack_int n,
+                                    double* a, lapack_int lda,
+                                    lapack_int* ipiv )
+{
+    const double one = 1.0, mone = -1.0;
+    lapack_int info, iinfo, i, ip, k, n1, n2, m2, ione = 1;
+    double sfmin, r;
+
+    if( m == 0 || n == 0 ) {
+        return 0;
+    }
+    if( m == 1 ) {
+        /* One row: no interchange */
+        ipiv[0] = 1;
+        return ( a[0] == 0.0 ) ? 1 : 0;
+    }
+    if( n == 1 ) {
+        /* One column: find the pivot and scale the column by it */
+        ip = BLAS_idamax( &m, a, &lda );
+        ipiv[0] = ip;
+        ip--;
+        if( a[(size_t)ip*lda] == 0.0 ) {
+            return 1;
+        }
+        if( ip != 0 ) {
+            r = a[0];
+            a[0] = a[(size_t)ip*lda];
+            a[(size_t)ip*lda] = r;
+        }
+        k = m - 1;
+        sfmin = API_SUFFIX(LAPACKE_dlamch)( 's' );
+        if( ABS(a[0]) >= sfmin ) {
+            r = one / a[0];
+            BLAS_dscal( &k, &r, &a[lda], &lda );
+        } else {
+            for( i = 1; i < m; i++ ) {
+                a[(size_t)i*lda] = a[(size_t)i*lda] / a[0];
+            }
+        }
+        return 0;
+    }
+    n1 = MIN( m, n ) / 2;
+    n2 = n - n1;
+    m2 = m - n1;
+
+    /* Factor [ A11; A21 ] */
+    info = API_SUFFIX(LAPACKE_dgetrf_rowmajor)( m, n1, a, lda, ipiv );
+
+    /* Apply the interchanges to [ A12; A22 ] */
+    for( i = 0; i < n1; i++ ) {
+        ip = ipiv[i] - 1;
+        if( ip != i ) {
+            BLAS_dswap( &n2, &a[(size_t)i*lda+n1], &ione,
+                        &a[(size_t)ip*lda+n1], &ione );
+        }
+    }
+
+    /* A12 := inv( L11 )*A12, that is A12**T := A12**T*inv( L11**T ) */
+    BLAS_dtrsm( "R", "U", "N", "U", &n2, &n1, &one, a, &lda, &a[n1], &lda );
+
+    /* A22 := A22 - A21*A12, that is A22**T := A22**T - A12**T*A21**T */
+    BLAS_dgemm( "N", "N", &n2, &m2, &n1, &mone, &a[n1], &lda,
+                &a[(size_t)n1*lda], &lda, &one, &a[(size_t)n1*lda+n1], &lda );
+
+    /* Factor A22 */
+    iinfo = API_SUFFIX(LAPACKE_dgetrf_rowmajor)( m2, n2, &a[(size_t)n1*lda+n1],
+                                            lda, &ipiv[n1] );
+    if( info == 0 && iinfo > 0 ) {
+        info = iinfo + n1;
+    }
+    k = MIN( m, n );
+    for( i = n1; i < k; i++ ) {
+        ipiv[i] += n1;
+    }
+
+    /* Apply the interchanges to A21 */
+    for( i = n1; i < k; i++ ) {
+        ip = ipiv[i] - 1;
+        if( ip != i ) {
+            BLAS_dswap( &n1, &a[(size_t)i*lda], &ione, &a[(size_t)ip*lda],
+                        &ione );
+        }
+    }
+    return info;
+}
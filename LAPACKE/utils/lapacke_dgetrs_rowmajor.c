@@ -0,0 +1,83 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: LAPACK contributors
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+#include "lapacke_blas.h"
+
+/* Solves A*X = B, A**T*X = B or A**H*X = B with the LU factorization
+ * computed by LAPACKE_dgetrf_rowmajor, where A, B and X are stored in
+ * row-major layout.  B is overwritten by X in place.
+ *
+ * The column-major views of the buffers are A**T and B**T, so each
+ * triangular solve with L or U on the left is done as a solve with
+ * L**T or U**T on the right of B**T.  The row interchanges swap
+ * contiguous rows of B.  No workspace is needed.
+ *
+ * The arguments are not checked.
+ */
+
+void API_SUFFIX(LAPACKE_dgetrs_rowmajor)( char trans, lapack_int n, lapack_int nrhs,
+                                const double* a, lapack_int lda,
+                                const lapack_int* ipiv, double* b,
+                                lapack_int ldb )
+{
+    const double one = 1.0;
+    lapack_int i, ip, ione = 1;
+
+    if( n == 0 || nrhs == 0 ) {
+        return;
+    }
+    if( API_SUFFIX(LAPACKE_lsame)( trans, 'n' ) ) {
+        /* B := P**T*B */
+        for( i = 0; i < n; i++ ) {
+            ip = ipiv[i] - 1;
+            if( ip != i ) {
+                BLAS_dswap( &nrhs, &b[(size_t)i*ldb], &ione,
+                            &b[(size_t)ip*ldb], &ione );
+            }
+        }
+        /* B**T := B**T*inv( L**T )*inv( U**T ) */
+        BLAS_dtrsm( "R", "U", "N", "U", &nrhs, &n, &one, a, &lda, b, &ldb );
+        BLAS_dtrsm( "R", "L", "N", "N", &nrhs, &n, &one, a, &lda, b, &ldb );
+    } else {
+        /* B**T := B**T*inv( U )*inv( L ) */
+        BLAS_dtrsm( "R", "L", &trans, "N", &nrhs, &n, &one, a, &lda, b, &ldb );
+        BLAS_dtrsm( "R", "U", &trans, "U", &nrhs, &n, &one, a, &lda, b, &ldb );
+        /* B := P*B */
+        for( i = n - 1; i >= 0; i-- ) {
+            ip = ipiv[i] - 1;
+            if( ip != i ) {
+                BLAS_dswap( &nrhs, &b[(size_t)i*ldb], &ione,
+                            &b[(size_t)ip*ldb], &ione );
+            }
+        }
+    }
+}
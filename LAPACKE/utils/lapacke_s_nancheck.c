@@ -30,18 +30,63 @@
 * Author: Intel Corporation
 *****************************************************************************/
 #include "lapacke_utils.h"
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
-/* Check a vector for NaN entries. */
+/* Check a vector for NaN entries.
+ *
+ * A contiguous vector is loaded four SSE2 or AVX registers at a time; the
+ * registers are compared unordered in pairs, which flags a NaN in either
+ * of them, the two masks are ORed, and the scan stops at the first block
+ * that holds a NaN.
+ */
 
 lapack_logical API_SUFFIX(LAPACKE_s_nancheck)( lapack_int n,
                                     const float *x,
                                     lapack_int incx )
 {
     lapack_int i, inc;
+#if defined(__AVX__)
+    __m256 r;
+#elif defined(__SSE2__)
+    __m128 r;
+#endif
 
     if( incx == 0 ) return (lapack_logical) LAPACK_SISNAN( x[0] );
     inc = ( incx > 0 ) ? incx : -incx ;
 
+    if( inc == 1 ) {
+        i = 0;
+#if defined(__AVX__)
+        for( ; i + 32 <= n; i += 32 ) {
+            r = _mm256_or_ps(
+                _mm256_cmp_ps( _mm256_loadu_ps( &x[i] ),
+                               _mm256_loadu_ps( &x[i+8] ), _CMP_UNORD_Q ),
+                _mm256_cmp_ps( _mm256_loadu_ps( &x[i+16] ),
+                               _mm256_loadu_ps( &x[i+24] ), _CMP_UNORD_Q ) );
+            if( _mm256_movemask_ps( r ) )
+                return (lapack_logical) 1;
+        }
+#elif defined(__SSE2__)
+        for( ; i + 16 <= n; i += 16 ) {
+            r = _mm_or_ps( _mm_cmpunord_ps( _mm_loadu_ps( &x[i] ),
+                                            _mm_loadu_ps( &x[i+4] ) ),
+                           _mm_cmpunord_ps( _mm_loadu_ps( &x[i+8] ),
+                                            _mm_loadu_ps( &x[i+12] ) ) );
+            if( _mm_movemask_ps( r ) )
+                return (lapack_logical) 1;
+        }
+#endif
+        for( ; i < n; i++ ) {
+            if( LAPACK_SISNAN( x[i] ) )
+                return (lapack_logical) 1;
+        }
+        return (lapack_logical) 0;
+    }
+
     for( i = 0; i < n*inc; i+=inc ) {
         if( LAPACK_SISNAN( x[i] ) )
             return (lapack_logical) 1;
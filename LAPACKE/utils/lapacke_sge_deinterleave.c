@@ -0,0 +1,54 @@
+/*****************************************************************************
+  Copyright (c) 2026, Intel Corp.
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Intel Corporation nor the names of its contributors
+      may be used to endorse or promote products derived from this software
+      without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+  THE POSSIBILITY OF SUCH DAMAGE.
+******************************************************************************
+* Contents: Native C interface to LAPACK utility function
+* Author: Intel Corporation
+*****************************************************************************/
+
+#include "lapacke_utils.h"
+
+/* Copies lane l of the interleaved array w back into the m-by-n matrix A;
+ * the inverse of LAPACKE_sge_interleave.  If uplo is 'L', only the lower
+ * trapezoid (i >= j) is copied, otherwise the whole matrix.
+ */
+
+void API_SUFFIX(LAPACKE_sge_deinterleave)( char uplo, lapack_int m,
+                                 lapack_int n, lapack_int nl, lapack_int l,
+                                 const float* w, float* a,
+                                 lapack_int rs, lapack_int cs )
+{
+    lapack_int i, j;
+    lapack_logical lower = API_SUFFIX(LAPACKE_lsame)( uplo, 'l' );
+
+    w += l;
+    for( j = 0; j < n; j++ ) {
+        for( i = lower ? j : 0; i < m; i++ ) {
+            a[ (size_t)i*rs + (size_t)j*cs ] = w[ (size_t)(i+j*m)*nl ];
+        }
+    }
+}
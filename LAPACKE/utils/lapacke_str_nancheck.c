@@ -38,7 +38,7 @@ lapack_logical API_SUFFIX(LAPACKE_str_nancheck)( int matrix_layout, char uplo, c
                                       const float *a,
                                       lapack_int lda )
 {
-    lapack_int i, j, st;
+    lapack_int j, st;
     lapack_logical colmaj, lower, unit;
 
     if( a == NULL ) return (lapack_logical) 0;
@@ -64,20 +64,20 @@ lapack_logical API_SUFFIX(LAPACKE_str_nancheck)( int matrix_layout, char uplo, c
     /* Since col_major upper and row_major lower are equal,
      * and col_major lower and row_major upper are equals too -
      * using one code for equal cases. XOR( colmaj, upper )
+     * Each column (row) of the triangle is contiguous in memory and is
+     * checked by LAPACKE_s_nancheck.
      */
     if( ( colmaj || lower ) && !( colmaj && lower ) ) {
         for( j = st; j < n; j++ ) {
-            for( i = 0; i < MIN( j+1-st, lda ); i++ ) {
-                if( LAPACK_SISNAN( a[i+j*lda] ) )
-                    return (lapack_logical) 1;
-            }
+            if( API_SUFFIX(LAPACKE_s_nancheck)( MIN( j+1-st, lda ),
+                                                &a[(size_t)j*lda], 1 ) )
+                return (lapack_logical) 1;
         }
     } else {
         for( j = 0; j < n-st; j++ ) {
-            for( i = j+st; i < MIN( n, lda ); i++ ) {
-                if( LAPACK_SISNAN( a[i+j*lda] ) )
-                    return (lapack_logical) 1;
-            }
+            if( API_SUFFIX(LAPACKE_s_nancheck)( MIN( n, lda )-j-st,
+                                                &a[j+st+(size_t)j*lda], 1 ) )
+                return (lapack_logical) 1;
         }
     }
     return (lapack_logical) 0;
@@ -31,7 +31,10 @@
 *****************************************************************************/
 #include "lapacke_utils.h"
 
-/* Check a vector for NaN entries. */
+/* Check a vector for NaN entries.
+ * A contiguous vector is checked as a vector of 2*n real numbers by
+ * LAPACKE_d_nancheck, which scans it in SIMD registers.
+ */
 
 lapack_logical API_SUFFIX(LAPACKE_z_nancheck)( lapack_int n,
                                     const lapack_complex_double *x,
@@ -42,6 +45,10 @@ lapack_logical API_SUFFIX(LAPACKE_z_nancheck)( lapack_int n,
     if( incx == 0 ) return (lapack_logical) LAPACK_ZISNAN( x[0] );
     inc = ( incx > 0 ) ? incx : -incx ;
 
+    if( inc == 1 ) {
+        return API_SUFFIX(LAPACKE_d_nancheck)( 2*n, (const double*)x, 1 );
+    }
+
     for( i = 0; i < n*inc; i+=inc ) {
         if( LAPACK_ZISNAN( x[i] ) )
             return (lapack_logical) 1;
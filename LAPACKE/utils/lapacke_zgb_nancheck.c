@@ -45,18 +45,19 @@ lapack_logical API_SUFFIX(LAPACKE_zgb_nancheck)( int matrix_layout, lapack_int m
 
     if( matrix_layout == LAPACK_COL_MAJOR ) {
         for( j = 0; j < n; j++ ) {
-            for( i = MAX( ku-j, 0 ); i < MIN( m+ku-j, kl+ku+1 );
-                 i++ ) {
-                if( LAPACK_ZISNAN( ab[i+(size_t)j*ldab] ) )
-                     return (lapack_logical) 1;
-            }
+            i = MAX( ku-j, 0 );
+            if( API_SUFFIX(LAPACKE_z_nancheck)( MIN( m+ku-j, kl+ku+1 ) - i,
+                                                &ab[i+(size_t)j*ldab], 1 ) )
+                return (lapack_logical) 1;
         }
     } else if ( matrix_layout == LAPACK_ROW_MAJOR ) {
-        for( j = 0; j < n; j++ ) {
-            for( i = MAX( ku-j, 0 ); i < MIN( m+ku-j, kl+ku+1 ); i++ ) {
-                if( LAPACK_ZISNAN( ab[(size_t)i*ldab+j] ) )
-                     return (lapack_logical) 1;
-            }
+        /* Row i of ab holds the elements of columns MAX( ku-i, 0 ) to
+         * MIN( n, m+ku-i )-1 that are in the band, contiguously */
+        for( i = 0; i < kl+ku+1; i++ ) {
+            j = MAX( ku-i, 0 );
+            if( API_SUFFIX(LAPACKE_z_nancheck)( MIN( n, m+ku-i ) - j,
+                                                &ab[(size_t)i*ldab+j], 1 ) )
+                return (lapack_logical) 1;
         }
     }
     return (lapack_logical) 0;
@@ -32,6 +32,9 @@
 
 #include "lapacke_utils.h"
 
+/* Number of columns of a panel */
+#define LAPACKE_GB_NB 8
+
 /* Converts input general band matrix from row-major(C) to
  * column-major(Fortran) layout or vice versa.
  */
@@ -41,25 +44,51 @@ void API_SUFFIX(LAPACKE_zgb_trans)( int matrix_layout, lapack_int m, lapack_int
                         const lapack_complex_double *in, lapack_int ldin,
                         lapack_complex_double *out, lapack_int ldout )
 {
-    lapack_int i, j;
+    lapack_int i, j, ie, jb, je, jmax, lo, hi;
 
     if( in == NULL || out == NULL ) return;
 
+    /* The columns are taken in panels of LAPACKE_GB_NB: the rows of the
+     * band array that are inside the band for all the columns of a panel
+     * are transposed by LAPACKE_zge_trans, and only the triangles at the
+     * ends of the band are copied element by element.
+     */
     if( matrix_layout == LAPACK_COL_MAJOR ) {
-        for( j = 0; j < MIN( ldout, n ); j++ ) {
-            for( i = MAX( ku-j, 0 ); i < MIN3( ldin, m+ku-j, kl+ku+1 );
-                 i++ ) {
-                out[(size_t)i*ldout+j] = in[i+(size_t)j*ldin];
+        jmax = MIN( ldout, n );
+        for( jb = 0; jb < jmax; jb += LAPACKE_GB_NB ) {
+            je = MIN( jb + LAPACKE_GB_NB, jmax );
+            lo = MAX( ku-jb, 0 );
+            hi = MAX( lo, MIN3( ldin, m+ku-(je-1), kl+ku+1 ) );
+            API_SUFFIX(LAPACKE_zge_trans)( LAPACK_COL_MAJOR, hi-lo, je-jb,
+                                       &in[ lo+(size_t)jb*ldin ], ldin,
+                                       &out[ (size_t)lo*ldout+jb ], ldout );
+            for( j = jb; j < je; j++ ) {
+                ie = MIN3( ldin, m+ku-j, kl+ku+1 );
+                for( i = MAX( ku-j, 0 ); i < MIN( lo, ie ); i++ ) {
+                    out[(size_t)i*ldout+j] = in[i+(size_t)j*ldin];
+                }
+                for( i = MAX( hi, ku-j ); i < ie; i++ ) {
+                    out[(size_t)i*ldout+j] = in[i+(size_t)j*ldin];
+                }
             }
         }
     } else if ( matrix_layout == LAPACK_ROW_MAJOR ) {
-        /* TODO: interchange loops for performance.
-         * This is just reference implementation
-         */
-        for( j = 0; j < MIN( n, ldin ); j++ ) {
-            for( i = MAX( ku-j, 0 ); i < MIN3( ldout, m+ku-j, kl+ku+1 );
-                 i++ ) {
-                out[i+(size_t)j*ldout] = in[(size_t)i*ldin+j];
+        jmax = MIN( n, ldin );
+        for( jb = 0; jb < jmax; jb += LAPACKE_GB_NB ) {
+            je = MIN( jb + LAPACKE_GB_NB, jmax );
+            lo = MAX( ku-jb, 0 );
+            hi = MAX( lo, MIN3( ldout, m+ku-(je-1), kl+ku+1 ) );
+            API_SUFFIX(LAPACKE_zge_trans)( LAPACK_ROW_MAJOR, hi-lo, je-jb,
+                                       &in[ (size_t)lo*ldin+jb ], ldin,
+                                       &out[ lo+(size_t)jb*ldout ], ldout );
+            for( j = jb; j < je; j++ ) {
+                ie = MIN3( ldout, m+ku-j, kl+ku+1 );
+                for( i = MAX( ku-j, 0 ); i < MIN( lo, ie ); i++ ) {
+                    out[i+(size_t)j*ldout] = in[(size_t)i*ldin+j];
+                }
+                for( i = MAX( hi, ku-j ); i < ie; i++ ) {
+                    out[i+(size_t)j*ldout] = in[(size_t)i*ldin+j];
+                }
             }
         }
     }
@@ -34,13 +34,60 @@
 
 /* Converts input general matrix from row-major(C) to column-major(Fortran)
  * layout or vice versa.
+ *
+ * The matrix is split recursively along its larger dimension until the
+ * pieces fit in the L1 cache, so that the strided side of the copy stays
+ * in cache for any shape.  A piece is written one row of out at a time,
+ * which keeps the stores contiguous.
  */
 
+/* Largest dimension of a piece that is transposed directly */
+#define LAPACKE_TRANS_NB 32
+
+/* out[ j + i*ldout ] = in[ i + j*ldin ], i < m, j < n, for m, n at most
+ * LAPACKE_TRANS_NB */
+static void zge_trans_tile( lapack_int m, lapack_int n,
+                            const lapack_complex_double* in, lapack_int ldin,
+                            lapack_complex_double* out, lapack_int ldout )
+{
+    lapack_int i, j;
+
+    for( i = 0; i < m; i++ ) {
+        for( j = 0; j < n; j++ ) {
+            out[ j + (size_t)i*ldout ] = in[ i + (size_t)j*ldin ];
+        }
+    }
+}
+
+/* out[ j + i*ldout ] = in[ i + j*ldin ], i < m, j < n */
+static void zge_trans_rec( lapack_int m, lapack_int n,
+                           const lapack_complex_double* in, lapack_int ldin,
+                           lapack_complex_double* out, lapack_int ldout )
+{
+    lapack_int h;
+
+    if( m <= LAPACKE_TRANS_NB && n <= LAPACKE_TRANS_NB ) {
+        zge_trans_tile( m, n, in, ldin, out, ldout );
+    } else if( m >= n ) {
+        /* Split the rows */
+        h = m/2;
+        zge_trans_rec( h, n, in, ldin, out, ldout );
+        zge_trans_rec( m-h, n, &in[ h ], ldin, &out[ (size_t)h*ldout ],
+                       ldout );
+    } else {
+        /* Split the columns */
+        h = n/2;
+        zge_trans_rec( m, h, in, ldin, out, ldout );
+        zge_trans_rec( m, n-h, &in[ (size_t)h*ldin ], ldin, &out[ h ],
+                       ldout );
+    }
+}
+
 void API_SUFFIX(LAPACKE_zge_trans)( int matrix_layout, lapack_int m, lapack_int n,
                         const lapack_complex_double* in, lapack_int ldin,
                         lapack_complex_double* out, lapack_int ldout )
 {
-    lapack_int i, j, x, y;
+    lapack_int x, y;
 
     if( in == NULL || out == NULL ) return;
 
@@ -56,9 +103,8 @@ void API_SUFFIX(LAPACKE_zge_trans)( int matrix_layout, lapack_int m, lapack_int
     }
 
     /* In case of incorrect m, n, ldin or ldout the function does nothing */
-    for( i = 0; i < MIN( y, ldin ); i++ ) {
-        for( j = 0; j < MIN( x, ldout ); j++ ) {
-            out[ (size_t)i*ldout + j ] = in[ (size_t)j*ldin + i ];
-        }
-    }
+    x = MIN( x, ldout );
+    y = MIN( y, ldin );
+    if( x <= 0 || y <= 0 ) return;
+    zge_trans_rec( y, x, in, ldin, out, ldout );
 }
@@ -0,0 +1,160 @@
+C> \brief \b SPOTRF VARIANT: task-parallel block version of the algorithm, with lookahead.
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE SPOTRF ( UPLO, N, A, LDA, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          UPLO
+*       INTEGER            INFO, LDA, N
+*       ..
+*       .. Array Arguments ..
+*       REAL               A( LDA, * )
+*       ..
+*
+*  Purpose
+*  =======
+*
+C>\details \b Purpose:
+C>\verbatim
+C>
+C> SPOTRF computes the Cholesky factorization of a real symmetric
+C> positive definite matrix A.
+C>
+C> The factorization has the form
+C>    A = U**T * U,  if UPLO = 'U', or
+C>    A = L  * L**T,  if UPLO = 'L',
+C> where U is an upper triangular matrix and L is lower triangular.
+C>
+C> This is the task-parallel right looking block version of the
+C> algorithm of SPOTRF_TASK, with a lookahead of one block.  Unlike
+C> SPOTRF, which calls SPOTRF_TASK only when ILAENV( 7, 'SPOTRF', ... )
+C> returns more than one thread, it is always used, and its tasks are
+C> run by that many OpenMP threads.
+C>
+C>\endverbatim
+*
+*  Arguments:
+*  ==========
+*
+C> \param[in] UPLO
+C> \verbatim
+C>          UPLO is CHARACTER*1
+C>          = 'U':  Upper triangle of A is stored;
+C>          = 'L':  Lower triangle of A is stored.
+C> \endverbatim
+C>
+C> \param[in] N
+C> \verbatim
+C>          N is INTEGER
+C>          The order of the matrix A.  N >= 0.
+C> \endverbatim
+C>
+C> \param[in,out] A
+C> \verbatim
+C>          A is REAL array, dimension (LDA,N)
+C>          On entry, the symmetric matrix A.  If UPLO = 'U', the leading
+C>          N-by-N upper triangular part of A contains the upper
+C>          triangular part of the matrix A, and the strictly lower
+C>          triangular part of A is not referenced.  If UPLO = 'L', the
+C>          leading N-by-N lower triangular part of A contains the lower
+C>          triangular part of the matrix A, and the strictly upper
+C>          triangular part of A is not referenced.
+C> \endverbatim
+C> \verbatim
+C>          On exit, if INFO = 0, the factor U or L from the Cholesky
+C>          factorization A = U**T*U or A = L*L**T.
+C> \endverbatim
+C>
+C> \param[in] LDA
+C> \verbatim
+C>          LDA is INTEGER
+C>          The leading dimension of the array A.  LDA >= max(1,N).
+C> \endverbatim
+C>
+C> \param[out] INFO
+C> \verbatim
+C>          INFO is INTEGER
+C>          = 0:  successful exit
+C>          < 0:  if INFO = -i, the i-th argument had an illegal value
+C>          > 0:  if INFO = i, the leading principal minor of order i
+C>                is not positive, and the factorization could not be
+C>                completed.
+C> \endverbatim
+C>
+*
+*  Authors:
+*  ========
+*
+C> \author Univ. of Tennessee
+C> \author Univ. of California Berkeley
+C> \author Univ. of Colorado Denver
+C> \author NAG Ltd.
+*
+C> \ingroup variantsPOcomputational
+*
+*  =====================================================================
+      SUBROUTINE SPOTRF ( UPLO, N, A, LDA, INFO )
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          UPLO
+      INTEGER            INFO, LDA, N
+*     ..
+*     .. Array Arguments ..
+      REAL               A( LDA, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Local Scalars ..
+      LOGICAL            UPPER
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      EXTERNAL           LSAME
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           SPOTRF_TASK, XERBLA
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          MAX
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input parameters.
+*
+      INFO = 0
+      UPPER = LSAME( UPLO, 'U' )
+      IF( .NOT.UPPER .AND. .NOT.LSAME( UPLO, 'L' ) ) THEN
+         INFO = -1
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( LDA.LT.MAX( 1, N ) ) THEN
+         INFO = -4
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'SPOTRF', -INFO )
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( N.EQ.0 )
+     $   RETURN
+*
+      CALL SPOTRF_TASK( UPLO, N, A, LDA, INFO )
+      RETURN
+*
+*     End of SPOTRF
+*
+      END
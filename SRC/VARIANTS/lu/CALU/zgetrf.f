@@ -0,0 +1,330 @@
+C> \brief \b ZGETRF VARIANT: communication-avoiding LU with tournament pivoting (CALU).
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE ZGETRF( M, N, A, LDA, IPIV, INFO )
+*
+*       .. Scalar Arguments ..
+*       INTEGER            INFO, LDA, M, N
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            IPIV( * )
+*       COMPLEX*16         A( LDA, * )
+*       ..
+*
+*  Purpose
+*  =======
+*
+C>\details \b Purpose:
+C>\verbatim
+C>
+C> ZGETRF computes an LU factorization of a general M-by-N matrix A
+C> using tournament pivoting with row interchanges.
+C>
+C> The factorization has the form
+C>    A = P * L * U
+C> where P is a permutation matrix, L is lower triangular with unit
+C> diagonal elements (lower trapezoidal if m > n), and U is upper
+C> triangular (upper trapezoidal if m < n).
+C>
+C> This is the communication-avoiding LU (CALU) of [1].  It is the
+C> right-looking Level 3 BLAS algorithm of the reference ZGETRF, except
+C> that the pivot rows of each panel of NB columns are chosen by a
+C> tournament instead of one IZAMAX and one row interchange per column.
+C>
+C> The rows of the panel are split into blocks of 2*NB rows.  NB
+C> candidate pivot rows are chosen in each block by Gaussian
+C> elimination with partial pivoting (ZGETRF2) on a copy of the block,
+C> and the candidates are then merged in pairs along a binary tree,
+C> each merge choosing NB rows from the 2*NB rows of its two children
+C> in the same way.  The NB rows chosen at the root are moved to the
+C> top of the panel and are factored without further pivoting, and
+C> L21 is computed by ZTRSM with U11.  The whole panel is read twice,
+C> once for the leaves of the tournament and once for ZTRSM, instead of
+C> once per column.
+C>
+C> Each element of L is bounded in practice but may exceed one in
+C> magnitude, so that the factorization is not always the one of the
+C> reference ZGETRF.  A panel whose U11 is exactly singular is
+C> factored by ZGETRF2 instead, so that INFO has the same meaning as in
+C> the reference ZGETRF.  NB is at most NBMAX = 64.
+C>
+C> [1] Grigori, L., Demmel, J. W., and Xiang, H. 2011.  CALU: A
+C> Communication Optimal LU Factorization Algorithm. SIAM J. Matrix
+C> Anal. Appl. 32, 4, 1317-1350. http://dx.doi.org/10.1137/100788926
+C>
+C>\endverbatim
+*
+*  Arguments:
+*  ==========
+*
+C> \param[in] M
+C> \verbatim
+C>          M is INTEGER
+C>          The number of rows of the matrix A.  M >= 0.
+C> \endverbatim
+C>
+C> \param[in] N
+C> \verbatim
+C>          N is INTEGER
+C>          The number of columns of the matrix A.  N >= 0.
+C> \endverbatim
+C>
+C> \param[in,out] A
+C> \verbatim
+C>          A is COMPLEX*16 array, dimension (LDA,N)
+C>          On entry, the M-by-N matrix to be factored.
+C>          On exit, the factors L and U from the factorization
+C>          A = P*L*U; the unit diagonal elements of L are not stored.
+C> \endverbatim
+C>
+C> \param[in] LDA
+C> \verbatim
+C>          LDA is INTEGER
+C>          The leading dimension of the array A.  LDA >= max(1,M).
+C> \endverbatim
+C>
+C> \param[out] IPIV
+C> \verbatim
+C>          IPIV is INTEGER array, dimension (min(M,N))
+C>          The pivot indices; for 1 <= i <= min(M,N), row i of the
+C>          matrix was interchanged with row IPIV(i).
+C> \endverbatim
+C>
+C> \param[out] INFO
+C> \verbatim
+C>          INFO is INTEGER
+C>          = 0:  successful exit
+C>          < 0:  if INFO = -i, the i-th argument had an illegal value
+C>          > 0:  if INFO = i, U(i,i) is exactly zero. The factorization
+C>                has been completed, but the factor U is exactly
+C>                singular, and division by zero will occur if it is used
+C>                to solve a system of equations.
+C> \endverbatim
+C>
+*
+*  Authors:
+*  ========
+*
+C> \author Univ. of Tennessee
+C> \author Univ. of California Berkeley
+C> \author Univ. of Colorado Denver
+C> \author NAG Ltd.
+*
+C> \ingroup variantsGEcomputational
+*
+*  =====================================================================
+      SUBROUTINE ZGETRF( M, N, A, LDA, IPIV, INFO )
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      INTEGER            INFO, LDA, M, N
+*     ..
+*     .. Array Arguments ..
+      INTEGER            IPIV( * )
+      COMPLEX*16         A( LDA, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      COMPLEX*16         ONE
+      PARAMETER          ( ONE = ( 1.0D+0, 0.0D+0 ) )
+      INTEGER            NBMAX, LDWORK, MAXLVL
+      PARAMETER          ( NBMAX = 64, LDWORK = 2*NBMAX, MAXLVL = 40 )
+*     ..
+*     .. Local Scalars ..
+      INTEGER            I, I0, IINFO, IP, ITMP, J, JB, JJ, K, LEVEL,
+     $                   NB, NC, NS
+*     ..
+*     .. Local Arrays ..
+      INTEGER            ICAND( LDWORK ), IPW( LDWORK ),
+     $                   IWIN( NBMAX, MAXLVL ), LVL( MAXLVL ),
+     $                   NWIN( MAXLVL )
+      COMPLEX*16         WORK( LDWORK, NBMAX )
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           ZGEMM, ZGETRF2, ZLACPY, ZLASWP, ZTRSM,
+     $                   XERBLA
+*     ..
+*     .. External Functions ..
+      INTEGER            ILAENV
+      EXTERNAL           ILAENV
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          MAX, MIN
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input parameters.
+*
+      INFO = 0
+      IF( M.LT.0 ) THEN
+         INFO = -1
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -4
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'ZGETRF', -INFO )
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( M.EQ.0 .OR. N.EQ.0 )
+     $   RETURN
+*
+*     Determine the block size for this environment.  Tall and skinny
+*     matrices are factored as one panel, by tournament pivoting too.
+*
+      NB = MIN( ILAENV( 1, 'ZGETRF', ' ', M, N, -1, -1 ), NBMAX )
+      IF( NB.LE.1 ) THEN
+*
+*        Use unblocked code.
+*
+         CALL ZGETRF2( M, N, A, LDA, IPIV, INFO )
+         RETURN
+      END IF
+*
+      DO 90 J = 1, MIN( M, N ), NB
+         JB = MIN( MIN( M, N )-J+1, NB )
+*
+*        Choose the JB pivot rows of the panel A(J:M,J:J+JB-1) by a
+*        tournament.  The stack holds the rows chosen in subtrees of
+*        the tournament, a pair of subtrees at the same level being
+*        merged as soon as the second one is complete.  Each node
+*        copies its candidate rows into WORK and keeps the first JB
+*        rows chosen by ZGETRF2.
+*
+         NS = 0
+         I0 = J
+   10    CONTINUE
+         IF( NS.GE.2 .AND. ( I0.GT.M .OR. LVL( NS ).EQ.LVL( NS-1 ) ) )
+     $        THEN
+*
+*           Merge the two subtrees on top of the stack.
+*
+            NC = 0
+            DO 30 K = NS - 1, NS
+               DO 20 I = 1, NWIN( K )
+                  ICAND( NC+I ) = IWIN( I, K )
+   20          CONTINUE
+               NC = NC + NWIN( K )
+   30       CONTINUE
+            LEVEL = LVL( NS-1 ) + 1
+            NS = NS - 2
+         ELSE IF( I0.LE.M ) THEN
+*
+*           Start a new leaf with the next block of rows.
+*
+            NC = MIN( LDWORK, M-I0+1 )
+            DO 40 I = 1, NC
+               ICAND( I ) = I0 + I - 1
+   40       CONTINUE
+            I0 = I0 + NC
+            LEVEL = 0
+         ELSE
+            GO TO 70
+         END IF
+*
+         DO 60 JJ = 1, JB
+            DO 50 I = 1, NC
+               WORK( I, JJ ) = A( ICAND( I ), J+JJ-1 )
+   50       CONTINUE
+   60    CONTINUE
+         CALL ZGETRF2( NC, JB, WORK, LDWORK, IPW, IINFO )
+         NS = NS + 1
+         NWIN( NS ) = MIN( NC, JB )
+         LVL( NS ) = LEVEL
+         DO 65 I = 1, NWIN( NS )
+            ITMP = ICAND( I )
+            ICAND( I ) = ICAND( IPW( I ) )
+            ICAND( IPW( I ) ) = ITMP
+            IWIN( I, NS ) = ICAND( I )
+   65    CONTINUE
+         GO TO 10
+   70    CONTINUE
+*
+*        The last node factored is the root: WORK(1:JB,1:JB) holds the
+*        LU factors of the rows IWIN(1:JB,1), in the order chosen.
+*
+         IF( IINFO.EQ.0 ) THEN
+*
+*           Move the chosen rows to the top of the panel, as the
+*           interchanges IPIV(J:J+JB-1), and copy their factors.
+*
+            DO 80 I = 1, JB
+               IP = IWIN( I, 1 )
+               DO 75 K = J, J + I - 2
+                  IF( IP.EQ.K )
+     $               IP = IPIV( K )
+   75          CONTINUE
+               IPIV( J+I-1 ) = IP
+   80       CONTINUE
+            CALL ZLASWP( JB, A( 1, J ), LDA, J, J+JB-1, IPIV, 1 )
+            CALL ZLACPY( 'Full', JB, JB, WORK, LDWORK, A( J, J ),
+     $                   LDA )
+*
+*           Compute L21 = A21 * inv(U11).
+*
+            IF( J+JB.LE.M )
+     $         CALL ZTRSM( 'Right', 'Upper', 'No transpose',
+     $                     'Non-unit', M-J-JB+1, JB, ONE, A( J, J ),
+     $                     LDA, A( J+JB, J ), LDA )
+         ELSE
+*
+*           U11 is exactly singular: factor the panel with partial
+*           pivoting, adjust INFO and the pivot indices.
+*
+            CALL ZGETRF2( M-J+1, JB, A( J, J ), LDA, IPIV( J ),
+     $                    IINFO )
+            IF( INFO.EQ.0 .AND. IINFO.GT.0 )
+     $         INFO = IINFO + J - 1
+            DO 85 I = J, MIN( M, J+JB-1 )
+               IPIV( I ) = J - 1 + IPIV( I )
+   85       CONTINUE
+         END IF
+*
+*        Apply interchanges to columns 1:J-1.
+*
+         CALL ZLASWP( J-1, A, LDA, J, J+JB-1, IPIV, 1 )
+*
+         IF( J+JB.LE.N ) THEN
+*
+*           Apply interchanges to columns J+JB:N.
+*
+            CALL ZLASWP( N-J-JB+1, A( 1, J+JB ), LDA, J, J+JB-1,
+     $                   IPIV, 1 )
+*
+*           Compute block row of U.
+*
+            CALL ZTRSM( 'Left', 'Lower', 'No transpose', 'Unit', JB,
+     $                  N-J-JB+1, ONE, A( J, J ), LDA, A( J, J+JB ),
+     $                  LDA )
+            IF( J+JB.LE.M ) THEN
+*
+*              Update trailing submatrix.
+*
+               CALL ZGEMM( 'No transpose', 'No transpose', M-J-JB+1,
+     $                     N-J-JB+1, JB, -ONE, A( J+JB, J ), LDA,
+     $                     A( J, J+JB ), LDA, ONE, A( J+JB, J+JB ),
+     $                     LDA )
+            END IF
+         END IF
+   90 CONTINUE
+      RETURN
+*
+*     End of ZGETRF
+*
+      END
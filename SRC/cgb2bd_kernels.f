@@ -0,0 +1,238 @@
+*> \brief \b CGB2BD_KERNELS
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE  CGB2BD_KERNELS( TTYPE, ST, ED, SWEEP, N, NB,
+*                                   A, LDA, V, TAU, WORK )
+*
+*       IMPLICIT NONE
+*
+*       .. Scalar Arguments ..
+*       INTEGER            TTYPE, ST, ED, SWEEP, N, NB, LDA
+*       ..
+*       .. Array Arguments ..
+*       COMPLEX            A( LDA, * ), V( * ),
+*                          TAU( * ), WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> CGB2BD_KERNELS is an internal routine used by the CGEBRD_GB2BD
+*> subroutine.  It performs one step of the bulge chasing that
+*> reduces an upper band matrix to upper bidiagonal form.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] TTYPE
+*> \verbatim
+*>          TTYPE is INTEGER
+*>          = 1: the first step of a sweep, which annihilates the row
+*>               ST-1 of the band;
+*>          = 2: a later step, which annihilates the row ST-NB of the
+*>               bulge created by the previous step.
+*> \endverbatim
+*>
+*> \param[in] ST
+*> \verbatim
+*>          ST is INTEGER
+*>          The first row and column of the diagonal block of the step.
+*> \endverbatim
+*>
+*> \param[in] ED
+*> \verbatim
+*>          ED is INTEGER
+*>          The last row and column of the diagonal block of the step,
+*>          ED = min( ST+NB-1, N ).
+*> \endverbatim
+*>
+*> \param[in] SWEEP
+*> \verbatim
+*>          SWEEP is INTEGER
+*>          The sweep the step belongs to.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER. The order of the matrix A.
+*> \endverbatim
+*>
+*> \param[in] NB
+*> \verbatim
+*>          NB is INTEGER. The number of superdiagonals of the band.
+*> \endverbatim
+*>
+*> \param[in, out] A
+*> \verbatim
+*>          A is COMPLEX array, dimension (LDA,N)
+*>          The band matrix, with its element A(i,j) stored in
+*>          A(2*NB+1+i-j,j) for j-2*NB <= i <= j+NB, which leaves room
+*>          for the bulges.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER. The leading dimension of the array A.
+*>          LDA >= 3*NB+1.
+*> \endverbatim
+*>
+*> \param[out] V
+*> \verbatim
+*>          V is COMPLEX array, dimension (2*N).
+*>          The Householder vectors of the step are stored in
+*>          V( MOD( SWEEP-1, 2 )*N + ST ).
+*> \endverbatim
+*>
+*> \param[out] TAU
+*> \verbatim
+*>          TAU is COMPLEX array, dimension (2*N).
+*>          The scalar factors of the Householder reflectors are stored
+*>          in TAU( MOD( SWEEP-1, 2 )*N + ST ).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is COMPLEX array. Workspace of size NB.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gb2bd_kernels
+*
+*> \par Further Details:
+*  =====================
+*>
+*> \verbatim
+*>
+*>  Let R be the row annihilated by the step, R = ST-1 if TTYPE = 1
+*>  and R = ST-NB if TTYPE = 2.  The step
+*>
+*>  1. annihilates A(R,ST+1:ED) by a reflector applied from the right
+*>     to the columns ST:ED, which fills in the lower triangle of the
+*>     diagonal block A(ST:ED,ST:ED);
+*>
+*>  2. annihilates A(ST+1:ED,ST) by a reflector applied from the left
+*>     to the rows ST:ED, which creates a bulge in A(ST:ED,ED+1:ED+NB)
+*>     that the next step of the sweep chases down.
+*>
+*>  The rest of the fill-in of the diagonal block is annihilated by
+*>  the following sweeps, so that a sweep that starts at row I leaves
+*>  row I and column I+1 in bidiagonal form.
+*> \endverbatim
+*>
+*  =====================================================================
+      SUBROUTINE  CGB2BD_KERNELS( TTYPE, ST, ED, SWEEP, N, NB,
+     $                            A, LDA, V, TAU, WORK )
+*
+      IMPLICIT NONE
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      INTEGER            TTYPE, ST, ED, SWEEP, N, NB, LDA
+*     ..
+*     .. Array Arguments ..
+      COMPLEX            A( LDA, * ), V( * ),
+     $                   TAU( * ), WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      COMPLEX            ZERO, ONE
+      PARAMETER          ( ZERO = ( 0.0E+0, 0.0E+0 ),
+     $                   ONE  = ( 1.0E+0, 0.0E+0 ) )
+*     ..
+*     .. Local Scalars ..
+      INTEGER            I, IR, J1, J2, LM, LN, VPOS, TAUPOS, DPOS
+      COMPLEX            CTMP
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           CLARFG, CLARFX
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          CONJG, MIN, MOD
+*     ..
+*     .. Executable Statements ..
+*
+      DPOS   = 2 * NB + 1
+      VPOS   = MOD( SWEEP-1, 2 ) * N + ST
+      TAUPOS = MOD( SWEEP-1, 2 ) * N + ST
+      LM     = ED - ST + 1
+      IF( TTYPE.EQ.1 ) THEN
+         IR = ST - 1
+      ELSE
+         IR = ST - NB
+      END IF
+*
+*     Annihilate A(IR,ST+1:ED) from the right.
+*
+      V( VPOS ) = ONE
+      DO 10 I = 1, LM-1
+         V( VPOS+I )              = CONJG( A( DPOS+IR-ST-I, ST+I ) )
+         A( DPOS+IR-ST-I, ST+I ) = ZERO
+   10 CONTINUE
+      CTMP = CONJG( A( DPOS+IR-ST, ST ) )
+      CALL CLARFG( LM, CTMP, V( VPOS+1 ), 1, TAU( TAUPOS ) )
+      A( DPOS+IR-ST, ST ) = CTMP
+*
+*     Apply it to the rows IR+1:ST-1 of the previous bulge and to the
+*     diagonal block.
+*
+      IF( ST-1.GT.IR ) THEN
+         CALL CLARFX( 'Right', ST-1-IR, LM, V( VPOS ), TAU( TAUPOS ),
+     $                A( DPOS+IR+1-ST, ST ), LDA-1, WORK )
+      END IF
+      CALL CLARFX( 'Right', LM, LM, V( VPOS ), TAU( TAUPOS ),
+     $             A( DPOS, ST ), LDA-1, WORK )
+*
+*     Annihilate A(ST+1:ED,ST) from the left.
+*
+      V( VPOS ) = ONE
+      DO 20 I = 1, LM-1
+         V( VPOS+I )        = A( DPOS+I, ST )
+         A( DPOS+I, ST ) = ZERO
+   20 CONTINUE
+      CALL CLARFG( LM, A( DPOS, ST ), V( VPOS+1 ), 1, TAU( TAUPOS ) )
+*
+*     Apply it to the rest of the diagonal block and to the columns
+*     ED+1:ED+NB, where it creates the next bulge.
+*
+      IF( LM.GT.1 ) THEN
+         CALL CLARFX( 'Left', LM, LM-1, V( VPOS ),
+     $                CONJG( TAU( TAUPOS ) ), A( DPOS-1, ST+1 ),
+     $                LDA-1, WORK )
+      END IF
+      J1 = ED + 1
+      J2 = MIN( ED+NB, N )
+      LN = J2 - J1 + 1
+      IF( LN.GT.0 ) THEN
+         CALL CLARFX( 'Left', LM, LN, V( VPOS ),
+     $                CONJG( TAU( TAUPOS ) ), A( DPOS+ST-J1, J1 ),
+     $                LDA-1, WORK )
+      END IF
+*
+      RETURN
+*
+*     End of CGB2BD_KERNELS
+*
+      END
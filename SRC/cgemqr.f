@@ -154,6 +154,7 @@
 *>
 *>          T(2): row block size (MB)
 *>          T(3): column block size (NB)
+*>          T(4): arity of the reduction tree (KT), or 0
 *>          T(6:TSIZE): data structure needed for Q, computed by
 *>                           CLATSQR or CGEQRT
 *>
@@ -163,6 +164,10 @@
 *>  the QR factorization.
 *>  This version of CGEMQR will use either CLAMTSQR or CGEMQRT to
 *>  multiply matrix Q by another matrix.
+*>  If T(4) is not 0, CGEQR used CLATSQR_TREE, and CGEMQR uses
+*>  CLAMTSQR_TREE, which shares the work among the threads given by
+*>  ILAENV( 7, 'CGEMQR', ... ).  A workspace query then returns
+*>  enough WORK for all of them.
 *>  Further Details in CLAMTSQR or CGEMQRT.
 *>
 *> \endverbatim
@@ -190,15 +195,19 @@
 *     ..
 *     .. Local Scalars ..
       LOGICAL            LEFT, RIGHT, TRAN, NOTRAN, LQUERY
-      INTEGER            MB, NB, LW, NBLCKS, MN, MINMNK, LWMIN
+      INTEGER            MB, NB, LW, NBLCKS, MN, MINMNK, LWMIN, KT,
+     $                   NTHR
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
       REAL               SROUNDUP_LWORK
       EXTERNAL           LSAME, SROUNDUP_LWORK
+      INTEGER            ILAENV
+      EXTERNAL           ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CGEMQRT, CLAMTSQR, XERBLA
+      EXTERNAL           CGEMQRT, CLAMTSQR, CLAMTSQR_TREE,
+     $                   XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          INT, MAX, MIN, MOD
@@ -215,9 +224,13 @@
 *
       MB = INT( T( 2 ) )
       NB = INT( T( 3 ) )
+      KT = INT( T( 4 ) )
       IF( LEFT ) THEN
         LW = N * NB
         MN = M
+      ELSE IF( KT.GT.0 ) THEN
+        LW = M * NB
+        MN = N
       ELSE
         LW = MB * NB
         MN = N
@@ -229,6 +242,9 @@
       ELSE
          LWMIN = MAX( 1, LW )
       END IF
+      NTHR = 1
+      IF( KT.GT.0 .AND. MINMNK.GT.0 )
+     $   NTHR = MAX( 1, ILAENV( 7, 'CGEMQR', ' ', M, N, K, -1 ) )
 *
       IF( ( MB.GT.K ) .AND. ( MN.GT.K ) ) THEN
         IF( MOD( MN - K, MB - K ).EQ.0 ) THEN
@@ -262,7 +278,7 @@
       END IF
 *
       IF( INFO.EQ.0 ) THEN
-        WORK( 1 ) = SROUNDUP_LWORK( LWMIN )
+        WORK( 1 ) = SROUNDUP_LWORK( NTHR*LWMIN )
       END IF
 *
       IF( INFO.NE.0 ) THEN
@@ -282,12 +298,15 @@
      $     .OR. ( MB.LE.K ) .OR. ( MB.GE.MAX( M, N, K ) ) ) THEN
         CALL CGEMQRT( SIDE, TRANS, M, N, K, NB, A, LDA, T( 6 ),
      $                NB, C, LDC, WORK, INFO )
+      ELSE IF( KT.GT.0 ) THEN
+        CALL CLAMTSQR_TREE( SIDE, TRANS, M, N, K, MB, NB, KT, A, LDA,
+     $                      T( 6 ), NB, C, LDC, WORK, LWORK, INFO )
       ELSE
         CALL CLAMTSQR( SIDE, TRANS, M, N, K, MB, NB, A, LDA, T( 6 ),
      $                 NB, C, LDC, WORK, LWORK, INFO )
       END IF
 *
-      WORK( 1 ) = SROUNDUP_LWORK( LWMIN )
+      WORK( 1 ) = SROUNDUP_LWORK( NTHR*LWMIN )
 *
       RETURN
 *
@@ -158,6 +158,7 @@
 *>
 *>          T(2): row block size (MB)
 *>          T(3): column block size (NB)
+*>          T(4): arity of the reduction tree (KT), or 0
 *>          T(6:TSIZE): data structure needed for Q, computed by
 *>                           CLATSQR or CGEQRT
 *>
@@ -166,6 +167,12 @@
 *>  CLATSQR (if the matrix is tall-and-skinny) or CGEQRT to compute
 *>  the QR factorization.
 *>
+*>  If ILAENV( 7, 'CGEQR', ... ) returns more than one thread, and if
+*>  TSIZE allows it, a tall-and-skinny matrix is factored along a
+*>  KT-ary reduction tree by CLATSQR_TREE instead, with the leaves and
+*>  the nodes of each level of the tree shared among the threads.  KT
+*>  is ILAENV( 1, 'CGEQR', ' ', M, N, 3, -1 ), at least 2.
+*>
 *> \endverbatim
 *>
 *> \ingroup geqr
@@ -190,7 +197,8 @@
 *     ..
 *     .. Local Scalars ..
       LOGICAL            LQUERY, LMINWS, MINT, MINW
-      INTEGER            MB, NB, MINTSZ, NBLCKS, LWMIN, LWREQ
+      INTEGER            MB, NB, MINTSZ, NBLCKS, LWMIN, LWREQ, KT,
+     $                   NTHR
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
@@ -198,7 +206,8 @@
       EXTERNAL           LSAME, SROUNDUP_LWORK
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CLATSQR, CGEQRT, XERBLA
+      EXTERNAL           CLATSQR, CLATSQR_TREE, CGEQRT,
+     $                   XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, MIN, MOD
@@ -245,6 +254,23 @@
         NBLCKS = 1
       END IF
 *
+*     Use a reduction tree with several threads and at least two row
+*     blocks, unless T is too small for it.  The tree has M/MB leaves
+*     and M/MB-1 inner nodes.
+*
+      KT = 0
+      NTHR = 1
+      IF( MB.GT.N .AND. M.GE.2*MB ) THEN
+        NTHR = ILAENV( 7, 'CGEQR ', ' ', M, N, -1, -1 )
+        IF( NTHR.GT.1 .AND. ( LQUERY .OR.
+     $      TSIZE.GE.NB*N*( 2*( M / MB )-1 ) + 5 ) ) THEN
+          KT = MAX( 2, ILAENV( 1, 'CGEQR ', ' ', M, N, 3, -1 ) )
+          NBLCKS = 2*( M / MB ) - 1
+        ELSE
+          NTHR = 1
+        END IF
+      END IF
+*
 *     Determine if the workspace size satisfies minimal size
 *
       LWMIN = MAX( 1, N )
@@ -286,10 +312,11 @@
         END IF
         T( 2 ) = CMPLX( MB )
         T( 3 ) = CMPLX( NB )
+        T( 4 ) = CMPLX( KT )
         IF( MINW ) THEN
           WORK( 1 ) = SROUNDUP_LWORK( LWMIN )
         ELSE
-          WORK( 1 ) = SROUNDUP_LWORK( LWREQ )
+          WORK( 1 ) = SROUNDUP_LWORK( NTHR*LWREQ )
         END IF
       END IF
       IF( INFO.NE.0 ) THEN
@@ -309,12 +336,15 @@
 *
       IF( ( M.LE.N ) .OR. ( MB.LE.N ) .OR. ( MB.GE.M ) ) THEN
         CALL CGEQRT( M, N, NB, A, LDA, T( 6 ), NB, WORK, INFO )
+      ELSE IF( KT.GT.0 ) THEN
+        CALL CLATSQR_TREE( M, N, MB, NB, KT, A, LDA, T( 6 ), NB,
+     $                     WORK, LWORK, INFO )
       ELSE
         CALL CLATSQR( M, N, MB, NB, A, LDA, T( 6 ), NB, WORK,
      $                LWORK, INFO )
       END IF
 *
-      WORK( 1 ) = SROUNDUP_LWORK( LWREQ )
+      WORK( 1 ) = SROUNDUP_LWORK( NTHR*LWREQ )
 *
       RETURN
 *
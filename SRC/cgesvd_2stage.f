@@ -0,0 +1,423 @@
+*> \brief <b> CGESVD_2STAGE computes the singular values of a GE matrix using the 2stage reduction to bidiagonal form</b>
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE CGESVD_2STAGE( JOBU, JOBVT, M, N, A, LDA, S, U, LDU,
+*                                 VT, LDVT, WORK, LWORK, RWORK, INFO )
+*
+*       IMPLICIT NONE
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          JOBU, JOBVT
+*       INTEGER            INFO, LDA, LDU, LDVT, LWORK, M, N
+*       ..
+*       .. Array Arguments ..
+*       REAL               RWORK( * ), S( * )
+*       COMPLEX            A( LDA, * ), U( LDU, * ), VT( LDVT, * ),
+*      $                   WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> CGESVD_2STAGE computes the singular values and, optionally, the
+*> left and/or right singular vectors of a complex M-by-N matrix A, using
+*> the 2stage technique for the reduction to bidiagonal form.  The
+*> singular values are computed from the bidiagonal form by the
+*> implicit zero-shift QR algorithm, as in CGESVD.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] JOBU
+*> \verbatim
+*>          JOBU is CHARACTER*1
+*>          Specifies options for computing all or part of the matrix U:
+*>          = 'N':  no columns of U (no left singular vectors) are
+*>                  computed.
+*>          The other options of CGESVD are not available in this
+*>          release.
+*> \endverbatim
+*>
+*> \param[in] JOBVT
+*> \verbatim
+*>          JOBVT is CHARACTER*1
+*>          Specifies options for computing all or part of the matrix
+*>          V**H:
+*>          = 'N':  no rows of V**H (no right singular vectors) are
+*>                  computed.
+*>          The other options of CGESVD are not available in this
+*>          release.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows of the input matrix A.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the input matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is COMPLEX array, dimension (LDA,N)
+*>          On entry, the M-by-N matrix A.
+*>          On exit, the contents of A are destroyed.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] S
+*> \verbatim
+*>          S is REAL array, dimension (min(M,N))
+*>          The singular values of A, sorted so that S(i) >= S(i+1).
+*> \endverbatim
+*>
+*> \param[out] U
+*> \verbatim
+*>          U is COMPLEX array, dimension (LDU,1)
+*>          Not referenced.
+*> \endverbatim
+*>
+*> \param[in] LDU
+*> \verbatim
+*>          LDU is INTEGER
+*>          The leading dimension of the array U.  LDU >= 1.
+*> \endverbatim
+*>
+*> \param[out] VT
+*> \verbatim
+*>          VT is COMPLEX array, dimension (LDVT,1)
+*>          Not referenced.
+*> \endverbatim
+*>
+*> \param[in] LDVT
+*> \verbatim
+*>          LDVT is INTEGER
+*>          The leading dimension of the array VT.  LDVT >= 1.
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is COMPLEX array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.
+*>          LWORK >= MAX(1,2*MIN(M,N) + LHOUS2 + LWBRD),
+*>          where LHOUS2 and LWBRD are the sizes of the arrays HOUS2 and
+*>          WORK of CGEBRD_2STAGE, applied to A or, if M or N is much
+*>          larger than the other, to its R or L factor.
+*>
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] RWORK
+*> \verbatim
+*>          RWORK is REAL array, dimension (5*min(M,N))
+*>          On exit, if INFO > 0, RWORK(1:MIN(M,N)-1) contains the
+*>          unconverged superdiagonal elements of an upper bidiagonal
+*>          matrix B whose diagonal is in S (not necessarily sorted).
+*>          B has the same singular values as A.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit.
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value.
+*>          > 0:  if CBDSQR did not converge, INFO specifies how many
+*>                superdiagonals of an intermediate bidiagonal form B
+*>                did not converge to zero. See the description of RWORK
+*>                above for details.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gesvd_2stage
+*
+*> \par Further Details:
+*  =====================
+*>
+*> \verbatim
+*>
+*>  All details about the 2stage techniques are available in:
+*>
+*>  A. Haidar, J. Kurzak, P. Luszczek, 2013.
+*>  An improved parallel singular value algorithm and its implementation
+*>  for multicore hardware, In Proceedings of 2013 International Conference
+*>  for High Performance Computing, Networking, Storage and Analysis (SC '13).
+*>  Denver, Colorado, USA, 2013.
+*>  Article 90, 12 pages.
+*>  http://doi.acm.org/10.1145/2503210.2503292
+*>
+*> \endverbatim
+*
+*  =====================================================================
+      SUBROUTINE CGESVD_2STAGE( JOBU, JOBVT, M, N, A, LDA, S, U, LDU,
+     $                          VT, LDVT, WORK, LWORK, RWORK, INFO )
+*
+      IMPLICIT NONE
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          JOBU, JOBVT
+      INTEGER            INFO, LDA, LDU, LDVT, LWORK, M, N
+*     ..
+*     .. Array Arguments ..
+      REAL               RWORK( * ), S( * )
+      COMPLEX            A( LDA, * ), U( LDU, * ), VT( LDVT, * ),
+     $                   WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      COMPLEX            CZERO
+      PARAMETER          ( CZERO = ( 0.0E0, 0.0E0 ) )
+      REAL               ZERO, ONE
+      PARAMETER          ( ZERO = 0.0E0, ONE = 1.0E0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            LQUERY, QRFRST
+      INTEGER            IE, IERR, IHOUS, IRWORK, ISCL, ITAU, ITAUP,
+     $                   ITAUQ, IWORK, KD, IB, LHBRD, LWBRD,
+     $                   LWORK_CGEQRF, MAXWRK, MINMN, MINWRK, MNTHR, MR,
+     $                   NR
+      REAL               ANRM, BIGNUM, EPS, SMLNUM
+*     ..
+*     .. Local Arrays ..
+      REAL               DUM( 1 )
+      COMPLEX            CDUM( 1 )
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           SLASCL, XERBLA, CBDSQR,
+     $                   CGEBRD_2STAGE, CGELQF, CGEQRF,
+     $                   CLASCL, CLASET
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      INTEGER            ILAENV, ILAENV2STAGE
+      REAL               SLAMCH, CLANGE
+      EXTERNAL           LSAME, ILAENV, ILAENV2STAGE,
+     $                   SLAMCH, CLANGE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          INT, MAX, MIN, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input arguments
+*
+      INFO = 0
+      MINMN = MIN( M, N )
+      LQUERY = ( LWORK.EQ.-1 )
+*
+      IF( .NOT.LSAME( JOBU, 'N' ) ) THEN
+         INFO = -1
+      ELSE IF( .NOT.LSAME( JOBVT, 'N' ) ) THEN
+         INFO = -2
+      ELSE IF( M.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -4
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -6
+      ELSE IF( LDU.LT.1 ) THEN
+         INFO = -9
+      ELSE IF( LDVT.LT.1 ) THEN
+         INFO = -11
+      END IF
+*
+*     Compute workspace
+*
+      QRFRST = .FALSE.
+      IF( INFO.EQ.0 ) THEN
+         MINWRK = 1
+         MAXWRK = 1
+         IF( MINMN.GT.0 ) THEN
+*
+*           If A has sufficiently more rows than columns, or columns
+*           than rows, it is first reduced by the QR or LQ
+*           decomposition, as in CGESVD.
+*
+            MNTHR = ILAENV( 6, 'CGESVD', JOBU // JOBVT, M, N, 0, 0 )
+            QRFRST = MAX( M, N ).GE.MNTHR
+            IF( QRFRST ) THEN
+               IF( M.GE.N ) THEN
+                  CALL CGEQRF( M, N, A, LDA, CDUM(1), CDUM(1), -1,
+     $                         IERR )
+               ELSE
+                  CALL CGELQF( M, N, A, LDA, CDUM(1), CDUM(1), -1,
+     $                         IERR )
+               END IF
+               LWORK_CGEQRF = INT( CDUM(1) )
+               MR = MINMN
+               NR = MINMN
+            ELSE
+               MR = M
+               NR = N
+            END IF
+*
+*           Compute space needed for CGEBRD_2STAGE
+*
+            KD    = ILAENV2STAGE( 1, 'CGEBRD_2STAGE', 'N', MINMN, -1,
+     $                            -1, -1 )
+            IB    = ILAENV2STAGE( 2, 'CGEBRD_2STAGE', 'N', MINMN, KD,
+     $                            -1, -1 )
+            LHBRD = ILAENV2STAGE( 3, 'CGEBRD_2STAGE', 'N', MINMN, KD,
+     $                            IB, -1 )
+            LWBRD = ILAENV2STAGE( 4, 'CGEBRD_2STAGE', 'N',
+     $                            MAX( MR, NR ), KD, IB, -1 )
+            MINWRK = 2*MINMN + LHBRD + LWBRD
+            MAXWRK = MINWRK
+            IF( QRFRST )
+     $         MAXWRK = MAX( MAXWRK, MINMN + LWORK_CGEQRF )
+         END IF
+         WORK( 1 ) = MAXWRK
+*
+         IF( LWORK.LT.MINWRK .AND. .NOT.LQUERY ) THEN
+            INFO = -13
+         END IF
+      END IF
+*
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'CGESVD_2STAGE', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( M.EQ.0 .OR. N.EQ.0 ) THEN
+         RETURN
+      END IF
+*
+*     Get machine constants
+*
+      EPS = SLAMCH( 'P' )
+      SMLNUM = SQRT( SLAMCH( 'S' ) ) / EPS
+      BIGNUM = ONE / SMLNUM
+*
+*     Scale A if max element outside range [SMLNUM,BIGNUM]
+*
+      ANRM = CLANGE( 'M', M, N, A, LDA, DUM )
+      ISCL = 0
+      IF( ANRM.GT.ZERO .AND. ANRM.LT.SMLNUM ) THEN
+         ISCL = 1
+         CALL CLASCL( 'G', 0, 0, ANRM, SMLNUM, M, N, A, LDA, IERR )
+      ELSE IF( ANRM.GT.BIGNUM ) THEN
+         ISCL = 1
+         CALL CLASCL( 'G', 0, 0, ANRM, BIGNUM, M, N, A, LDA, IERR )
+      END IF
+*
+      IF( QRFRST ) THEN
+         ITAU = 1
+         IWORK = ITAU + MINMN
+         IF( M.GE.N ) THEN
+*
+*           Compute A=Q*R and zero out below R
+*           (Workspace: need 2*N, prefer N + N*NB)
+*
+            CALL CGEQRF( M, N, A, LDA, WORK( ITAU ), WORK( IWORK ),
+     $                   LWORK-IWORK+1, IERR )
+            IF( N.GT.1 ) THEN
+               CALL CLASET( 'L', N-1, N-1, CZERO, CZERO, A( 2, 1 ),
+     $                      LDA )
+            END IF
+         ELSE
+*
+*           Compute A=L*Q and zero out above L
+*           (Workspace: need 2*M, prefer M + M*NB)
+*
+            CALL CGELQF( M, N, A, LDA, WORK( ITAU ), WORK( IWORK ),
+     $                   LWORK-IWORK+1, IERR )
+            IF( M.GT.1 ) THEN
+               CALL CLASET( 'U', M-1, M-1, CZERO, CZERO, A( 1, 2 ),
+     $                      LDA )
+            END IF
+         END IF
+      END IF
+*
+*     Reduce the MR-by-NR matrix in A to upper bidiagonal form
+*     (CWorkspace: need 2*MINMN + LHBRD + LWBRD)
+*     (RWorkspace: need MINMN)
+*
+      IE = 1
+      ITAUQ = 1
+      ITAUP = ITAUQ + MINMN
+      IHOUS = ITAUP + MINMN
+      IWORK = IHOUS + LHBRD
+      CALL CGEBRD_2STAGE( 'N', MR, NR, A, LDA, S, RWORK( IE ),
+     $                    WORK( ITAUQ ), WORK( ITAUP ), WORK( IHOUS ),
+     $                    LHBRD, WORK( IWORK ), LWORK-IWORK+1, IERR )
+      IRWORK = IE + MINMN
+*
+*     Perform bidiagonal QR iteration, computing the singular values
+*     only
+*     (CWorkspace: 0)
+*     (RWorkspace: need 5*MINMN)
+*
+      CALL CBDSQR( 'U', MINMN, 0, 0, 0, S, RWORK( IE ), CDUM,
+     $             1, CDUM, 1, CDUM, 1, RWORK( IRWORK ), INFO )
+*
+*     Undo scaling if necessary
+*
+      IF( ISCL.EQ.1 ) THEN
+         IF( ANRM.GT.BIGNUM )
+     $      CALL SLASCL( 'G', 0, 0, BIGNUM, ANRM, MINMN, 1, S, MINMN,
+     $                   IERR )
+         IF( INFO.NE.0 .AND. ANRM.GT.BIGNUM )
+     $      CALL SLASCL( 'G', 0, 0, BIGNUM, ANRM, MINMN-1, 1,
+     $                   RWORK( IE ), MINMN, IERR )
+         IF( ANRM.LT.SMLNUM )
+     $      CALL SLASCL( 'G', 0, 0, SMLNUM, ANRM, MINMN, 1, S, MINMN,
+     $                   IERR )
+         IF( INFO.NE.0 .AND. ANRM.LT.SMLNUM )
+     $      CALL SLASCL( 'G', 0, 0, SMLNUM, ANRM, MINMN-1, 1,
+     $                   RWORK( IE ), MINMN, IERR )
+      END IF
+*
+*     Return optimal workspace in WORK(1)
+*
+      WORK( 1 ) = MAXWRK
+*
+      RETURN
+*
+*     End of CGESVD_2STAGE
+*
+      END
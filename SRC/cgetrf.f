@@ -42,6 +42,8 @@
 *> triangular (upper trapezoidal if m < n).
 *>
 *> This is the right-looking Level 3 BLAS version of the algorithm.
+*> If ILAENV( 7, 'CGETRF', ... ) returns more than one thread, the
+*> factorization is done by the task-parallel CGETRF_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -126,8 +128,8 @@
       INTEGER            I, IINFO, J, JB, NB
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CGEMM, CGETRF2, CLASWP, CTRSM,
-     $                   XERBLA
+      EXTERNAL           CGEMM, CGETRF2, CGETRF_TASK,
+     $                   CLASWP, CTRSM, XERBLA
 *     ..
 *     .. External Functions ..
       INTEGER            ILAENV
@@ -166,6 +168,12 @@
 *        Use unblocked code.
 *
          CALL CGETRF2( M, N, A, LDA, IPIV, INFO )
+      ELSE IF( ILAENV( 7, 'CGETRF', ' ', M, N, -1, -1 ).GT.1 )
+     $         THEN
+*
+*        Use the task-parallel blocked code.
+*
+         CALL CGETRF_TASK( M, N, A, LDA, IPIV, INFO )
       ELSE
 *
 *        Use blocked code.
@@ -38,6 +38,10 @@
 *>
 *>    CLAQR5 called by CLAQR0 performs a
 *>    single small-bulge multi-shift QR sweep.
+*>
+*>    If KACC22 = 1 or 2 and ILAENV( 7, 'CLAQR5', ... ) returns more
+*>    than one thread, the sweep is made by CLAQR5_TASK, which chases
+*>    several chains of bulges in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -284,12 +288,13 @@
       INTEGER            I2, I4, INCOL, J, JBOT, JCOL, JLEN,
      $                   JROW, JTOP, K, K1, KDU, KMS, KRCOL,
      $                   M, M22, MBOT, MTOP, NBMPS, NDCOL,
-     $                   NS, NU
+     $                   NS, NTHR, NU
       LOGICAL            ACCUM, BMP22
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SLAMCH
-      EXTERNAL           SLAMCH
+      EXTERNAL           ILAENV, SLAMCH
 *     ..
 *     .. Intrinsic Functions ..
 *
@@ -299,8 +304,8 @@
       COMPLEX            VT( 3 )
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CGEMM, CLACPY, CLAQR1, CLARFG, CLASET,
-     $                   CTRMM
+      EXTERNAL           CGEMM, CLACPY, CLAQR1, CLAQR5_TASK,
+     $                   CLARFG, CLASET, CTRMM
 *     ..
 *     .. Statement Functions ..
       REAL               CABS1
@@ -321,6 +326,19 @@
       IF( KTOP.GE.KBOT )
      $   RETURN
 *
+*     ==== With more than one thread, chase several chains of
+*     .    bulges at the same time. ====
+*
+      IF( ( KACC22.EQ.1 .OR. KACC22.EQ.2 ) .AND. NSHFTS.GE.4 ) THEN
+         NTHR = ILAENV( 7, 'CLAQR5', ' ', N, KTOP, KBOT, NSHFTS )
+         IF( NTHR.GT.1 ) THEN
+            CALL CLAQR5_TASK( WANTT, WANTZ, N, KTOP, KBOT, NSHFTS,
+     $                        S, H, LDH, ILOZ, IHIZ, Z, LDZ, V, LDV, U,
+     $                        LDU, NV, WV, LDWV, NH, WH, LDWH )
+            RETURN
+         END IF
+      END IF
+*
 *     ==== NSHFTS is supposed to be even, but if it is odd,
 *     .    then simply reduce it by one.  ====
 *
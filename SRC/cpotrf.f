@@ -41,6 +41,8 @@
 *> where U is an upper triangular matrix and L is lower triangular.
 *>
 *> This is the block version of the algorithm, calling Level 3 BLAS.
+*> If ILAENV( 7, 'CPOTRF', ... ) returns more than one thread, the
+*> factorization is done by the task-parallel CPOTRF_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -132,8 +134,8 @@
       EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CGEMM, CHERK, CPOTRF2, CTRSM,
-     $                   XERBLA
+      EXTERNAL           CGEMM, CHERK, CPOTRF2, CPOTRF_TASK,
+     $                   CTRSM, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, MIN
@@ -169,6 +171,12 @@
 *        Use unblocked code.
 *
          CALL CPOTRF2( UPLO, N, A, LDA, INFO )
+      ELSE IF( ILAENV( 7, 'CPOTRF', UPLO, N, -1, -1, -1 ).GT.1 )
+     $         THEN
+*
+*        Use the task-parallel blocked code.
+*
+         CALL CPOTRF_TASK( UPLO, N, A, LDA, INFO )
       ELSE
 *
 *        Use blocked code.
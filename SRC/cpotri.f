@@ -35,6 +35,8 @@
 *> CPOTRI computes the inverse of a complex Hermitian positive definite
 *> matrix A using the Cholesky factorization A = U**H*U or A = L*L**H
 *> computed by CPOTRF.
+*> If ILAENV( 7, 'CPOTRI', ... ) returns more than one thread, the
+*> inverse is computed by the task-parallel CPOTRI_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -107,10 +109,11 @@
 *
 *     .. External Functions ..
       LOGICAL            LSAME
-      EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CLAUUM, CTRTRI, XERBLA
+      EXTERNAL           CLAUUM, CPOTRI_TASK, CTRTRI, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX
@@ -137,6 +140,14 @@
 *
       IF( N.EQ.0 )
      $   RETURN
+*
+      IF( ILAENV( 7, 'CPOTRI', UPLO, N, -1, -1, -1 ).GT.1 ) THEN
+*
+*        Use the task-parallel code.
+*
+         CALL CPOTRI_TASK( UPLO, N, A, LDA, INFO )
+         RETURN
+      END IF
 *
 *     Invert the triangular Cholesky factor U or L.
 *
@@ -35,6 +35,8 @@
 *> CPOTRS solves a system of linear equations A*X = B with a Hermitian
 *> positive definite matrix A using the Cholesky factorization
 *> A = U**H*U or A = L*L**H computed by CPOTRF.
+*> If ILAENV( 7, 'CPOTRS', ... ) returns more than one thread, the
+*> right-hand sides are solved concurrently by CPOTRS_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -129,10 +131,11 @@
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
-      EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CTRSM, XERBLA
+      EXTERNAL           CPOTRS_TASK, CTRSM, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX
@@ -164,7 +167,13 @@
       IF( N.EQ.0 .OR. NRHS.EQ.0 )
      $   RETURN
 *
-      IF( UPPER ) THEN
+      IF( NRHS.GT.1 .AND.
+     $    ILAENV( 7, 'CPOTRS', UPLO, N, NRHS, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for blocks of right-hand sides concurrently.
+*
+         CALL CPOTRS_TASK( UPLO, N, NRHS, A, LDA, B, LDB, INFO )
+      ELSE IF( UPPER ) THEN
 *
 *        Solve A*X = B where A = U**H *U.
 *
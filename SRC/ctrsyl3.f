@@ -32,7 +32,9 @@
 *>  M-by-N; and scale is an output scale factor, set <= 1 to avoid
 *>  overflow in X.
 *>
-*>  This is the block version of the algorithm.
+*>  This is the block version of the algorithm.  If ILAENV( 7,
+*>  'CTRSYL3', ... ) returns more than one thread, the blocks of X are
+*>  solved in parallel by CTRSYL3_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -203,7 +205,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           CSSCAL, CGEMM, CLASCL, CTRSYL,
-     $                   XERBLA
+     $                   CTRSYL3_TASK, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, AIMAG, EXPONENT, MAX, MIN, REAL
@@ -331,7 +333,14 @@
       SGN = REAL( ISGN )
       CSGN = CMPLX( SGN, ZERO )
 *
-      IF( NOTRNA .AND. NOTRNB ) THEN
+      IF( ILAENV( 7, 'CTRSYL3', ' ', M, N, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for the blocks of X by anti-diagonals of the block grid,
+*        in parallel.
+*
+         CALL CTRSYL3_TASK( TRANA, TRANB, ISGN, M, N, NB, A, LDA, B,
+     $                      LDB, C, LDC, SWORK, LDSWORK, BUF, INFO )
+      ELSE IF( NOTRNA .AND. NOTRNB ) THEN
 *
 *        Solve    A*X + ISGN*X*B = scale*C.
 *
@@ -0,0 +1,420 @@
+*> \brief <b> DGESVD_2STAGE computes the singular values of a GE matrix using the 2stage reduction to bidiagonal form</b>
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DGESVD_2STAGE( JOBU, JOBVT, M, N, A, LDA, S, U, LDU,
+*                                 VT, LDVT, WORK, LWORK, INFO )
+*
+*       IMPLICIT NONE
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          JOBU, JOBVT
+*       INTEGER            INFO, LDA, LDU, LDVT, LWORK, M, N
+*       ..
+*       .. Array Arguments ..
+*       DOUBLE PRECISION   A( LDA, * ), S( * ), U( LDU, * ),
+*      $                   VT( LDVT, * ), WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DGESVD_2STAGE computes the singular values and, optionally, the
+*> left and/or right singular vectors of a real M-by-N matrix A, using
+*> the 2stage technique for the reduction to bidiagonal form.  The
+*> singular values are computed from the bidiagonal form by the
+*> implicit zero-shift QR algorithm, as in DGESVD.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] JOBU
+*> \verbatim
+*>          JOBU is CHARACTER*1
+*>          Specifies options for computing all or part of the matrix U:
+*>          = 'N':  no columns of U (no left singular vectors) are
+*>                  computed.
+*>          The other options of DGESVD are not available in this
+*>          release.
+*> \endverbatim
+*>
+*> \param[in] JOBVT
+*> \verbatim
+*>          JOBVT is CHARACTER*1
+*>          Specifies options for computing all or part of the matrix
+*>          V**T:
+*>          = 'N':  no rows of V**T (no right singular vectors) are
+*>                  computed.
+*>          The other options of DGESVD are not available in this
+*>          release.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows of the input matrix A.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the input matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is DOUBLE PRECISION array, dimension (LDA,N)
+*>          On entry, the M-by-N matrix A.
+*>          On exit, the contents of A are destroyed.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] S
+*> \verbatim
+*>          S is DOUBLE PRECISION array, dimension (min(M,N))
+*>          The singular values of A, sorted so that S(i) >= S(i+1).
+*> \endverbatim
+*>
+*> \param[out] U
+*> \verbatim
+*>          U is DOUBLE PRECISION array, dimension (LDU,1)
+*>          Not referenced.
+*> \endverbatim
+*>
+*> \param[in] LDU
+*> \verbatim
+*>          LDU is INTEGER
+*>          The leading dimension of the array U.  LDU >= 1.
+*> \endverbatim
+*>
+*> \param[out] VT
+*> \verbatim
+*>          VT is DOUBLE PRECISION array, dimension (LDVT,1)
+*>          Not referenced.
+*> \endverbatim
+*>
+*> \param[in] LDVT
+*> \verbatim
+*>          LDVT is INTEGER
+*>          The leading dimension of the array VT.  LDVT >= 1.
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is DOUBLE PRECISION array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK;
+*>          if INFO > 0, WORK(2:MIN(M,N)) contains the unconverged
+*>          superdiagonal elements of an upper bidiagonal matrix B
+*>          whose diagonal is in S (not necessarily sorted). B
+*>          has the same singular values as A.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.
+*>          LWORK >= MAX(1,3*MIN(M,N) + LHOUS2 + LWBRD, 5*MIN(M,N)),
+*>          where LHOUS2 and LWBRD are the sizes of the arrays HOUS2 and
+*>          WORK of DGEBRD_2STAGE, applied to A or, if M or N is much
+*>          larger than the other, to its R or L factor.
+*>
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit.
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value.
+*>          > 0:  if DBDSQR did not converge, INFO specifies how many
+*>                superdiagonals of an intermediate bidiagonal form B
+*>                did not converge to zero. See the description of WORK
+*>                above for details.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gesvd_2stage
+*
+*> \par Further Details:
+*  =====================
+*>
+*> \verbatim
+*>
+*>  All details about the 2stage techniques are available in:
+*>
+*>  A. Haidar, J. Kurzak, P. Luszczek, 2013.
+*>  An improved parallel singular value algorithm and its implementation
+*>  for multicore hardware, In Proceedings of 2013 International Conference
+*>  for High Performance Computing, Networking, Storage and Analysis (SC '13).
+*>  Denver, Colorado, USA, 2013.
+*>  Article 90, 12 pages.
+*>  http://doi.acm.org/10.1145/2503210.2503292
+*>
+*> \endverbatim
+*
+*  =====================================================================
+      SUBROUTINE DGESVD_2STAGE( JOBU, JOBVT, M, N, A, LDA, S, U, LDU,
+     $                          VT, LDVT, WORK, LWORK, INFO )
+*
+      IMPLICIT NONE
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          JOBU, JOBVT
+      INTEGER            INFO, LDA, LDU, LDVT, LWORK, M, N
+*     ..
+*     .. Array Arguments ..
+      DOUBLE PRECISION   A( LDA, * ), S( * ), U( LDU, * ),
+     $                   VT( LDVT, * ), WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      DOUBLE PRECISION   ZERO, ONE
+      PARAMETER          ( ZERO = 0.0D0, ONE = 1.0D0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            LQUERY, QRFRST
+      INTEGER            I, IE, IERR, IHOUS, ISCL, ITAU, ITAUP, ITAUQ,
+     $                   IWORK, KD, IB, LHBRD, LWBRD, LWORK_DGEQRF,
+     $                   MAXWRK, MINMN, MINWRK, MNTHR, MR, NR
+      DOUBLE PRECISION   ANRM, BIGNUM, EPS, SMLNUM
+*     ..
+*     .. Local Arrays ..
+      DOUBLE PRECISION   DUM( 1 )
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           DBDSQR, DGEBRD_2STAGE, DGELQF,
+     $                   DGEQRF, DLASCL, DLASET, XERBLA
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      INTEGER            ILAENV, ILAENV2STAGE
+      DOUBLE PRECISION   DLAMCH, DLANGE
+      EXTERNAL           LSAME, ILAENV, ILAENV2STAGE,
+     $                   DLAMCH, DLANGE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          INT, MAX, MIN, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input arguments
+*
+      INFO = 0
+      MINMN = MIN( M, N )
+      LQUERY = ( LWORK.EQ.-1 )
+*
+      IF( .NOT.LSAME( JOBU, 'N' ) ) THEN
+         INFO = -1
+      ELSE IF( .NOT.LSAME( JOBVT, 'N' ) ) THEN
+         INFO = -2
+      ELSE IF( M.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -4
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -6
+      ELSE IF( LDU.LT.1 ) THEN
+         INFO = -9
+      ELSE IF( LDVT.LT.1 ) THEN
+         INFO = -11
+      END IF
+*
+*     Compute workspace
+*
+      QRFRST = .FALSE.
+      IF( INFO.EQ.0 ) THEN
+         MINWRK = 1
+         MAXWRK = 1
+         IF( MINMN.GT.0 ) THEN
+*
+*           If A has sufficiently more rows than columns, or columns
+*           than rows, it is first reduced by the QR or LQ
+*           decomposition, as in DGESVD.
+*
+            MNTHR = ILAENV( 6, 'DGESVD', JOBU // JOBVT, M, N, 0, 0 )
+            QRFRST = MAX( M, N ).GE.MNTHR
+            IF( QRFRST ) THEN
+               IF( M.GE.N ) THEN
+                  CALL DGEQRF( M, N, A, LDA, DUM(1), DUM(1), -1,
+     $                         IERR )
+               ELSE
+                  CALL DGELQF( M, N, A, LDA, DUM(1), DUM(1), -1,
+     $                         IERR )
+               END IF
+               LWORK_DGEQRF = INT( DUM(1) )
+               MR = MINMN
+               NR = MINMN
+            ELSE
+               MR = M
+               NR = N
+            END IF
+*
+*           Compute space needed for DGEBRD_2STAGE
+*
+            KD    = ILAENV2STAGE( 1, 'DGEBRD_2STAGE', 'N', MINMN, -1,
+     $                            -1, -1 )
+            IB    = ILAENV2STAGE( 2, 'DGEBRD_2STAGE', 'N', MINMN, KD,
+     $                            -1, -1 )
+            LHBRD = ILAENV2STAGE( 3, 'DGEBRD_2STAGE', 'N', MINMN, KD,
+     $                            IB, -1 )
+            LWBRD = ILAENV2STAGE( 4, 'DGEBRD_2STAGE', 'N',
+     $                            MAX( MR, NR ), KD, IB, -1 )
+            MINWRK = MAX( 3*MINMN + LHBRD + LWBRD, 5*MINMN )
+            MAXWRK = MINWRK
+            IF( QRFRST )
+     $         MAXWRK = MAX( MAXWRK, MINMN + LWORK_DGEQRF )
+         END IF
+         WORK( 1 ) = MAXWRK
+*
+         IF( LWORK.LT.MINWRK .AND. .NOT.LQUERY ) THEN
+            INFO = -13
+         END IF
+      END IF
+*
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'DGESVD_2STAGE', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( M.EQ.0 .OR. N.EQ.0 ) THEN
+         RETURN
+      END IF
+*
+*     Get machine constants
+*
+      EPS = DLAMCH( 'P' )
+      SMLNUM = SQRT( DLAMCH( 'S' ) ) / EPS
+      BIGNUM = ONE / SMLNUM
+*
+*     Scale A if max element outside range [SMLNUM,BIGNUM]
+*
+      ANRM = DLANGE( 'M', M, N, A, LDA, DUM )
+      ISCL = 0
+      IF( ANRM.GT.ZERO .AND. ANRM.LT.SMLNUM ) THEN
+         ISCL = 1
+         CALL DLASCL( 'G', 0, 0, ANRM, SMLNUM, M, N, A, LDA, IERR )
+      ELSE IF( ANRM.GT.BIGNUM ) THEN
+         ISCL = 1
+         CALL DLASCL( 'G', 0, 0, ANRM, BIGNUM, M, N, A, LDA, IERR )
+      END IF
+*
+      IF( QRFRST ) THEN
+         ITAU = 1
+         IWORK = ITAU + MINMN
+         IF( M.GE.N ) THEN
+*
+*           Compute A=Q*R and zero out below R
+*           (Workspace: need 2*N, prefer N + N*NB)
+*
+            CALL DGEQRF( M, N, A, LDA, WORK( ITAU ), WORK( IWORK ),
+     $                   LWORK-IWORK+1, IERR )
+            IF( N.GT.1 ) THEN
+               CALL DLASET( 'L', N-1, N-1, ZERO, ZERO, A( 2, 1 ),
+     $                      LDA )
+            END IF
+         ELSE
+*
+*           Compute A=L*Q and zero out above L
+*           (Workspace: need 2*M, prefer M + M*NB)
+*
+            CALL DGELQF( M, N, A, LDA, WORK( ITAU ), WORK( IWORK ),
+     $                   LWORK-IWORK+1, IERR )
+            IF( M.GT.1 ) THEN
+               CALL DLASET( 'U', M-1, M-1, ZERO, ZERO, A( 1, 2 ),
+     $                      LDA )
+            END IF
+         END IF
+      END IF
+*
+*     Reduce the MR-by-NR matrix in A to upper bidiagonal form
+*     (Workspace: need 3*MINMN + LHBRD + LWBRD)
+*
+      IE = 1
+      ITAUQ = IE + MINMN
+      ITAUP = ITAUQ + MINMN
+      IHOUS = ITAUP + MINMN
+      IWORK = IHOUS + LHBRD
+      CALL DGEBRD_2STAGE( 'N', MR, NR, A, LDA, S, WORK( IE ),
+     $                    WORK( ITAUQ ), WORK( ITAUP ), WORK( IHOUS ),
+     $                    LHBRD, WORK( IWORK ), LWORK-IWORK+1, IERR )
+      IWORK = IE + MINMN
+*
+*     Perform bidiagonal QR iteration, computing the singular values
+*     only
+*     (Workspace: need 5*MINMN)
+*
+      CALL DBDSQR( 'U', MINMN, 0, 0, 0, S, WORK( IE ), DUM, 1,
+     $             DUM, 1, DUM, 1, WORK( IWORK ), INFO )
+*
+*     If DBDSQR failed to converge, copy unconverged superdiagonals
+*     to WORK( 2:MINMN )
+*
+      IF( INFO.NE.0 ) THEN
+         DO 10 I = MINMN - 1, 1, -1
+            WORK( I+1 ) = WORK( I+IE-1 )
+   10    CONTINUE
+      END IF
+*
+*     Undo scaling if necessary
+*
+      IF( ISCL.EQ.1 ) THEN
+         IF( ANRM.GT.BIGNUM )
+     $      CALL DLASCL( 'G', 0, 0, BIGNUM, ANRM, MINMN, 1, S, MINMN,
+     $                   IERR )
+         IF( INFO.NE.0 .AND. ANRM.GT.BIGNUM )
+     $      CALL DLASCL( 'G', 0, 0, BIGNUM, ANRM, MINMN-1, 1,
+     $                   WORK( 2 ),
+     $                   MINMN, IERR )
+         IF( ANRM.LT.SMLNUM )
+     $      CALL DLASCL( 'G', 0, 0, SMLNUM, ANRM, MINMN, 1, S, MINMN,
+     $                   IERR )
+         IF( INFO.NE.0 .AND. ANRM.LT.SMLNUM )
+     $      CALL DLASCL( 'G', 0, 0, SMLNUM, ANRM, MINMN-1, 1,
+     $                   WORK( 2 ),
+     $                   MINMN, IERR )
+      END IF
+*
+*     Return optimal workspace in WORK(1)
+*
+      WORK( 1 ) = MAXWRK
+*
+      RETURN
+*
+*     End of DGESVD_2STAGE
+*
+      END
@@ -42,6 +42,8 @@
 *> triangular (upper trapezoidal if m < n).
 *>
 *> This is the right-looking Level 3 BLAS version of the algorithm.
+*> If ILAENV( 7, 'DGETRF', ... ) returns more than one thread, the
+*> factorization is done by the task-parallel DGETRF_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -126,8 +128,8 @@
       INTEGER            I, IINFO, J, JB, NB
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DGEMM, DGETRF2, DLASWP, DTRSM,
-     $                   XERBLA
+      EXTERNAL           DGEMM, DGETRF2, DGETRF_TASK,
+     $                   DLASWP, DTRSM, XERBLA
 *     ..
 *     .. External Functions ..
       INTEGER            ILAENV
@@ -166,6 +168,12 @@
 *        Use unblocked code.
 *
          CALL DGETRF2( M, N, A, LDA, IPIV, INFO )
+      ELSE IF( ILAENV( 7, 'DGETRF', ' ', M, N, -1, -1 ).GT.1 )
+     $         THEN
+*
+*        Use the task-parallel blocked code.
+*
+         CALL DGETRF_TASK( M, N, A, LDA, IPIV, INFO )
       ELSE
 *
 *        Use blocked code.
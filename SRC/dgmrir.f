@@ -0,0 +1,447 @@
+*> \brief \b DGMRIR refines the solution of a linear system by GMRES preconditioned with a factorization of lower accuracy.
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DGMRIR( TYPE, UPLO, N, NRHS, M, MAXCYC, A, LDA, AF,
+*                          LDAF, IPIV, B, LDB, X, LDX, CTE, WORK, ITER,
+*                          INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          TYPE, UPLO
+*       INTEGER            INFO, ITER, LDA, LDAF, LDB, LDX, M, MAXCYC, N,
+*      $                   NRHS
+*       DOUBLE PRECISION   CTE
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            IPIV( * )
+*       DOUBLE PRECISION   A( LDA, * ), AF( LDAF, * ), B( LDB, * ),
+*      $                   WORK( * ), X( LDX, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DGMRIR improves the solution X of the real system of linear
+*> equations A * X = B by iterative refinement, where the correction of
+*> each refinement step is computed by GMRES on the system
+*>    A * inv(M) * U = R,   C = inv(M) * U,
+*> with R = B - A * X the residual and M = AF a factorization of A
+*> computed in a lower precision, as in DSGESV_GMRES and DSPOSV_GMRES
+*> where the factors computed in single precision are applied in
+*> double precision.  The preconditioned operator A * inv(M) is close
+*> to the identity even when A is too ill-conditioned for the
+*> corrections inv(M) * R of DSGESV to converge, so that the refinement
+*> still reaches a double precision backward error for condition
+*> numbers up to about 1/EPS.
+*>
+*> GMRES is restarted after M iterations.  The right hand sides are
+*> handled together: each GMRES iteration applies inv(M) and A to one
+*> basis vector of every right hand side that has not converged, with
+*> one call to DGETRS (or DPOTRS) and to DGEMM (or DSYMM), while the
+*> orthogonalization, by classical Gram-Schmidt applied twice, and the
+*> Givens rotations of the Hessenberg matrices are done column by
+*> column.  A column stops when the residual estimated by GMRES is
+*> below the stopping criterion, when its Krylov space is invariant or
+*> when the basis is full.
+*>
+*> The refinement stops when for all the right hand sides
+*>    RNRM <= XNRM * CTE
+*> where RNRM and XNRM are the infinity-norms of the residual and of
+*> the solution, or after MAXCYC restarts.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] TYPE
+*> \verbatim
+*>          TYPE is CHARACTER*1
+*>          = 'G':  A is a general matrix, AF contains an LU
+*>                  factorization of A in the format of DGETRF;
+*>          = 'P':  A is symmetric positive definite, AF contains a
+*>                  Cholesky factorization of A in the format of
+*>                  DPOTRF.
+*> \endverbatim
+*>
+*> \param[in] UPLO
+*> \verbatim
+*>          UPLO is CHARACTER*1
+*>          If TYPE = 'P', the triangle of A and AF that is referenced:
+*>          = 'U':  Upper triangle;
+*>          = 'L':  Lower triangle.
+*>          Not referenced if TYPE = 'G'.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The order of the matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] NRHS
+*> \verbatim
+*>          NRHS is INTEGER
+*>          The number of right hand sides.  NRHS >= 0.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of GMRES iterations between two restarts.
+*>          1 <= M <= N.
+*> \endverbatim
+*>
+*> \param[in] MAXCYC
+*> \verbatim
+*>          MAXCYC is INTEGER
+*>          The largest number of restarts.  MAXCYC >= 0.
+*> \endverbatim
+*>
+*> \param[in] A
+*> \verbatim
+*>          A is DOUBLE PRECISION array, dimension (LDA,N)
+*>          The N-by-N matrix A.  If TYPE = 'P', only the triangle of A
+*>          given by UPLO is referenced.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,N).
+*> \endverbatim
+*>
+*> \param[in] AF
+*> \verbatim
+*>          AF is DOUBLE PRECISION array, dimension (LDAF,N)
+*>          The factorization of A used as preconditioner.
+*> \endverbatim
+*>
+*> \param[in] LDAF
+*> \verbatim
+*>          LDAF is INTEGER
+*>          The leading dimension of the array AF.  LDAF >= max(1,N).
+*> \endverbatim
+*>
+*> \param[in] IPIV
+*> \verbatim
+*>          IPIV is INTEGER array, dimension (N)
+*>          If TYPE = 'G', the pivot indices of the LU factorization.
+*>          Not referenced if TYPE = 'P'.
+*> \endverbatim
+*>
+*> \param[in] B
+*> \verbatim
+*>          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+*>          The right hand side matrix B.
+*> \endverbatim
+*>
+*> \param[in] LDB
+*> \verbatim
+*>          LDB is INTEGER
+*>          The leading dimension of the array B.  LDB >= max(1,N).
+*> \endverbatim
+*>
+*> \param[in,out] X
+*> \verbatim
+*>          X is DOUBLE PRECISION array, dimension (LDX,NRHS)
+*>          On entry, the initial solution.
+*>          On exit, the refined solution.
+*> \endverbatim
+*>
+*> \param[in] LDX
+*> \verbatim
+*>          LDX is INTEGER
+*>          The leading dimension of the array X.  LDX >= max(1,N).
+*> \endverbatim
+*>
+*> \param[in] CTE
+*> \verbatim
+*>          CTE is DOUBLE PRECISION
+*>          The constant of the stopping criterion, usually
+*>          ANRM*EPS*SQRT(N) with ANRM the infinity-norm of A.
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is DOUBLE PRECISION array, dimension
+*>          (N*NRHS*(M+3) + NRHS*((M+1)*(M+3)+3))
+*> \endverbatim
+*>
+*> \param[out] ITER
+*> \verbatim
+*>          ITER is INTEGER
+*>          The number of GMRES iterations.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  the stopping criterion is satisfied;
+*>          = 1:  the stopping criterion is not satisfied after MAXCYC
+*>                restarts.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gesv_mixed
+*
+*  =====================================================================
+      SUBROUTINE DGMRIR( TYPE, UPLO, N, NRHS, M, MAXCYC, A, LDA, AF,
+     $                   LDAF, IPIV, B, LDB, X, LDX, CTE, WORK, ITER,
+     $                   INFO )
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          TYPE, UPLO
+      INTEGER            INFO, ITER, LDA, LDAF, LDB, LDX, M, MAXCYC, N,
+     $                   NRHS
+      DOUBLE PRECISION   CTE
+*     ..
+*     .. Array Arguments ..
+      INTEGER            IPIV( * )
+      DOUBLE PRECISION   A( LDA, * ), AF( LDAF, * ), B( LDB, * ),
+     $                   WORK( * ), X( LDX, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      DOUBLE PRECISION   NEGONE, ZERO, ONE
+      PARAMETER          ( NEGONE = -1.0D+0, ZERO = 0.0D+0,
+     $                   ONE = 1.0D+0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            GE
+      INTEGER            I, IA, IB, IC, ICYC, IG, IH, IINFO, IR, IS,
+     $                   IT, IV, IZ, J, JC, JG, JH, JR, JS, JV, JW, K,
+     $                   KJ, KMAX, LDH, LDV, NACT
+      DOUBLE PRECISION   HNRM, RNRM, TEMP, XNRM
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      INTEGER            IDAMAX
+      DOUBLE PRECISION   DNRM2
+      EXTERNAL           LSAME, IDAMAX, DNRM2
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           DAXPY, DCOPY, DGEMM, DGEMV,
+     $                   DGETRS, DLACPY, DLARTG, DLASCL,
+     $                   DLASET, DPOTRS, DROT, DRSCL,
+     $                   DSYMM, DTRSV
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          ABS
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      ITER = 0
+      IF( N.EQ.0 .OR. NRHS.EQ.0 )
+     $   RETURN
+      GE = LSAME( TYPE, 'G' )
+*
+*     Partition WORK: the residuals R (N-by-NRHS), the preconditioned
+*     vectors Z (N-by-NRHS), the M+1 blocks of basis vectors V (each
+*     N-by-NRHS), the Hessenberg matrices H ((M+1)-by-M for each right
+*     hand side), the right hand sides G of the least squares problems,
+*     the cosines C and sines S of the rotations, the norms BETA of the
+*     residuals, the tolerances TOL on the GMRES residuals and the
+*     flags of the active right hand sides.
+*
+      LDV = N*NRHS
+      LDH = M + 1
+      IR = 1
+      IZ = IR + LDV
+      IV = IZ + LDV
+      IH = IV + LDV*( M+1 )
+      IG = IH + LDH*M*NRHS
+      IC = IG + LDH*NRHS
+      IS = IC + LDH*NRHS
+      IB = IS + LDH*NRHS
+      IT = IB + NRHS
+      IA = IT + NRHS
+*
+      DO 60 ICYC = 0, MAXCYC
+*
+*        Compute R = B - A*X.
+*
+         CALL DLACPY( 'All', N, NRHS, B, LDB, WORK( IR ), N )
+         IF( GE ) THEN
+            CALL DGEMM( 'No Transpose', 'No Transpose', N, NRHS, N,
+     $                  NEGONE, A, LDA, X, LDX, ONE, WORK( IR ), N )
+         ELSE
+            CALL DSYMM( 'Left', UPLO, N, NRHS, NEGONE, A, LDA, X,
+     $                  LDX, ONE, WORK( IR ), N )
+         END IF
+*
+*        Start GMRES for the right hand sides whose normwise backward
+*        error does not satisfy the stopping criterion, with the first
+*        basis vector R/BETA.
+*
+         NACT = 0
+         CALL DLASET( 'All', LDH, NRHS, ZERO, ZERO, WORK( IG ), LDH )
+         DO 10 J = 1, NRHS
+            JR = IR + ( J-1 )*N
+            JV = IV + ( J-1 )*N
+            XNRM = ABS( X( IDAMAX( N, X( 1, J ), 1 ), J ) )
+            RNRM = ABS( WORK( JR-1+IDAMAX( N, WORK( JR ), 1 ) ) )
+            IF( RNRM.LE.XNRM*CTE ) THEN
+               WORK( IA+J-1 ) = ZERO
+               WORK( IB+J-1 ) = ZERO
+               CALL DLASET( 'All', N, 1, ZERO, ZERO, WORK( JV ), N )
+            ELSE
+               NACT = NACT + 1
+               WORK( IA+J-1 ) = ONE
+               WORK( IB+J-1 ) = DNRM2( N, WORK( JR ), 1 )
+               WORK( IT+J-1 ) = XNRM*CTE / WORK( IB+J-1 )
+               CALL DCOPY( N, WORK( JR ), 1, WORK( JV ), 1 )
+               CALL DLASCL( 'General', 0, 0, WORK( IB+J-1 ), ONE, N,
+     $                      1, WORK( JV ), N, IINFO )
+               WORK( IG+( J-1 )*LDH ) = ONE
+            END IF
+   10    CONTINUE
+         IF( NACT.EQ.0 )
+     $      RETURN
+         IF( ICYC.EQ.MAXCYC )
+     $      GO TO 70
+*
+         KMAX = 0
+         DO 40 K = 1, M
+            IF( NACT.EQ.0 )
+     $         GO TO 50
+            ITER = ITER + 1
+            KMAX = K
+*
+*           Z = inv(M)*V(K), then V(K+1) = A*Z, for all the right
+*           hand sides at once.
+*
+            JV = IV + ( K-1 )*LDV
+            CALL DLACPY( 'All', N, NRHS, WORK( JV ), N, WORK( IZ ),
+     $                   N )
+            IF( GE ) THEN
+               CALL DGETRS( 'No transpose', N, NRHS, AF, LDAF, IPIV,
+     $                      WORK( IZ ), N, IINFO )
+               CALL DGEMM( 'No Transpose', 'No Transpose', N, NRHS,
+     $                     N, ONE, A, LDA, WORK( IZ ), N, ZERO,
+     $                     WORK( JV+LDV ), N )
+            ELSE
+               CALL DPOTRS( UPLO, N, NRHS, AF, LDAF, WORK( IZ ), N,
+     $                      IINFO )
+               CALL DSYMM( 'Left', UPLO, N, NRHS, ONE, A, LDA,
+     $                     WORK( IZ ), N, ZERO, WORK( JV+LDV ), N )
+            END IF
+*
+            DO 30 J = 1, NRHS
+               IF( WORK( IA+J-1 ).EQ.ZERO )
+     $            GO TO 30
+               JV = IV + ( J-1 )*N
+               JW = JV + K*LDV
+               JH = IH + ( J-1 )*LDH*M + ( K-1 )*LDH
+               JG = IG + ( J-1 )*LDH
+               JC = IC + ( J-1 )*LDH
+               JS = IS + ( J-1 )*LDH
+               JR = IZ + ( J-1 )*N
+*
+*              Orthogonalize the new vector against the basis of the
+*              column, twice; Z, no longer needed, holds the second
+*              projection.
+*
+               CALL DGEMV( 'Transpose', N, K, ONE, WORK( JV ), LDV,
+     $                     WORK( JW ), 1, ZERO, WORK( JH ), 1 )
+               CALL DGEMV( 'No transpose', N, K, NEGONE, WORK( JV ),
+     $                     LDV, WORK( JH ), 1, ONE, WORK( JW ), 1 )
+               CALL DGEMV( 'Transpose', N, K, ONE, WORK( JV ), LDV,
+     $                     WORK( JW ), 1, ZERO, WORK( JR ), 1 )
+               CALL DGEMV( 'No transpose', N, K, NEGONE, WORK( JV ),
+     $                     LDV, WORK( JR ), 1, ONE, WORK( JW ), 1 )
+               CALL DAXPY( K, ONE, WORK( JR ), 1, WORK( JH ), 1 )
+               HNRM = DNRM2( N, WORK( JW ), 1 )
+               WORK( JH+K ) = HNRM
+               IF( HNRM.GT.ZERO )
+     $            CALL DRSCL( N, HNRM, WORK( JW ), 1 )
+*
+*              Apply the previous rotations to the new column of H,
+*              and annihilate H(K+1,K).
+*
+               DO 20 I = 1, K - 1
+                  CALL DROT( 1, WORK( JH+I-1 ), 1, WORK( JH+I ), 1,
+     $                       WORK( JC+I-1 ), WORK( JS+I-1 ) )
+   20          CONTINUE
+               CALL DLARTG( WORK( JH+K-1 ), WORK( JH+K ),
+     $                      WORK( JC+K-1 ), WORK( JS+K-1 ), TEMP )
+               WORK( JH+K-1 ) = TEMP
+               WORK( JH+K ) = ZERO
+               WORK( JG+K ) = -WORK( JS+K-1 )*WORK( JG+K-1 )
+               WORK( JG+K-1 ) = WORK( JC+K-1 )*WORK( JG+K-1 )
+*
+*              |G(K+1)| is the norm of the residual of GMRES relative
+*              to BETA.  Once the column stops, solve the triangular
+*              system for the coefficients Y of the correction, stored
+*              in G, and clear its next basis vector.
+*
+               IF( ABS( WORK( JG+K ) ).LE.WORK( IT+J-1 ) .OR.
+     $             HNRM.EQ.ZERO .OR. K.EQ.M ) THEN
+                  KJ = K
+                  IF( TEMP.EQ.ZERO )
+     $               KJ = K - 1
+                  CALL DTRSV( 'Upper', 'No transpose', 'Non-unit',
+     $                        KJ, WORK( IH+( J-1 )*LDH*M ), LDH,
+     $                        WORK( JG ), 1 )
+                  DO 25 I = KJ, K
+                     WORK( JG+I ) = ZERO
+   25             CONTINUE
+                  CALL DLASET( 'All', N, 1, ZERO, ZERO, WORK( JW ),
+     $                         N )
+                  WORK( IA+J-1 ) = ZERO
+                  NACT = NACT - 1
+               END IF
+   30       CONTINUE
+   40    CONTINUE
+   50    CONTINUE
+*
+*        Update X = X + BETA*inv(M)*(V*Y).
+*
+         DO 55 J = 1, NRHS
+            CALL DGEMV( 'No transpose', N, KMAX, ONE,
+     $                  WORK( IV+( J-1 )*N ), LDV,
+     $                  WORK( IG+( J-1 )*LDH ), 1, ZERO,
+     $                  WORK( IR+( J-1 )*N ), 1 )
+   55    CONTINUE
+         IF( GE ) THEN
+            CALL DGETRS( 'No transpose', N, NRHS, AF, LDAF, IPIV,
+     $                   WORK( IR ), N, IINFO )
+         ELSE
+            CALL DPOTRS( UPLO, N, NRHS, AF, LDAF, WORK( IR ), N,
+     $                   IINFO )
+         END IF
+         DO 58 J = 1, NRHS
+            CALL DAXPY( N, WORK( IB+J-1 ), WORK( IR+( J-1 )*N ), 1,
+     $                  X( 1, J ), 1 )
+   58    CONTINUE
+   60 CONTINUE
+*
+   70 CONTINUE
+      INFO = 1
+      RETURN
+*
+*     End of DGMRIR
+*
+      END
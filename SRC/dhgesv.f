@@ -0,0 +1,431 @@
+*> \brief <b> DHGESV computes the solution to system of linear equations A * X = B for GE matrices</b> (mixed precision with 16-bit storage of the factors)
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DHGESV( FMT, N, NRHS, A, LDA, IPIV, B, LDB, X, LDX,
+*                          WORK, LWORK, SWORK, LSWORK, HWORK, ITER,
+*                          INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          FMT
+*       INTEGER            INFO, ITER, LDA, LDB, LDX, LSWORK, LWORK, N,
+*      $                   NRHS
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            IPIV( * )
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
+*       REAL               SWORK( * )
+*       DOUBLE PRECISION   A( LDA, * ), B( LDB, * ), WORK( * ),
+*      $                   X( LDX, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DHGESV computes the solution to a real system of linear equations
+*>    A * X = B,
+*> where A is an N-by-N matrix and X and B are N-by-NRHS matrices.
+*>
+*> DHGESV works in three precisions.  The matrix is stored in a 16-bit
+*> floating-point format, bfloat16 or IEEE half precision (see SLAG2H),
+*> and factorized by SHGETRF, which keeps the factors in that format
+*> and accumulates the updates in SINGLE PRECISION.  The solution is
+*> then refined to a DOUBLE PRECISION normwise backward error by GMRES
+*> preconditioned by the factors (see DGMRIR), which are copied to
+*> DOUBLE PRECISION for that purpose.  If the approach fails the
+*> method switches to a DOUBLE PRECISION factorization and solve.
+*>
+*> Before the conversion, the matrix is scaled so that its largest
+*> entry is SCLMAX = 1024, which keeps the factors in the range of
+*> half precision for growth factors up to 64.  The scaling is undone
+*> on the factor U before the refinement.
+*>
+*> GMRES is restarted every MIN(N,100) iterations when LWORK is large
+*> enough (see LWORK), and the refinement is stopped after
+*> MAXCYC = 10 restarts or when for all the RHS we have:
+*>     RNRM < SQRT(N)*XNRM*ANRM*EPS*BWDMAX
+*> where
+*>     o RNRM is the infinity-norm of the residual
+*>     o XNRM is the infinity-norm of the solution
+*>     o ANRM is the infinity-operator-norm of the matrix A
+*>     o EPS is the machine epsilon returned by DLAMCH('Epsilon')
+*> The value BWDMAX is fixed to 1.0D+00.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] FMT
+*> \verbatim
+*>          FMT is CHARACTER*1
+*>          Specifies the 16-bit format of the factors:
+*>          = 'B':  bfloat16;
+*>          = 'H':  IEEE half precision.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of linear equations, i.e., the order of the
+*>          matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] NRHS
+*> \verbatim
+*>          NRHS is INTEGER
+*>          The number of right hand sides, i.e., the number of columns
+*>          of the matrix B.  NRHS >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is DOUBLE PRECISION array,
+*>          dimension (LDA,N)
+*>          On entry, the N-by-N coefficient matrix A.
+*>          On exit, if iterative refinement has been successfully used
+*>          (INFO = 0 and ITER >= 0, see description below), then A is
+*>          unchanged, if double precision factorization has been used
+*>          (INFO = 0 and ITER < 0, see description below), then the
+*>          array A contains the factors L and U from the factorization
+*>          A = P*L*U; the unit diagonal elements of L are not stored.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] IPIV
+*> \verbatim
+*>          IPIV is INTEGER array, dimension (N)
+*>          The pivot indices that define the permutation matrix P;
+*>          row i of the matrix was interchanged with row IPIV(i).
+*>          Corresponds either to the 16-bit factorization (if INFO = 0
+*>          and ITER >= 0) or the double precision factorization (if
+*>          INFO = 0 and ITER < 0).
+*> \endverbatim
+*>
+*> \param[in] B
+*> \verbatim
+*>          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+*>          The N-by-NRHS right hand side matrix B.
+*> \endverbatim
+*>
+*> \param[in] LDB
+*> \verbatim
+*>          LDB is INTEGER
+*>          The leading dimension of the array B.  LDB >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] X
+*> \verbatim
+*>          X is DOUBLE PRECISION array, dimension (LDX,NRHS)
+*>          If INFO = 0, the N-by-NRHS solution matrix X.
+*> \endverbatim
+*>
+*> \param[in] LDX
+*> \verbatim
+*>          LDX is INTEGER
+*>          The leading dimension of the array X.  LDX >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is DOUBLE PRECISION array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.  If N = 0, LWORK >= 1,
+*>          else
+*>          LWORK >= N*(N+NRHS*(K+3)) + NRHS*((K+1)*(K+3)+3)
+*>          with K = MIN(N,10).  GMRES is restarted every K iterations,
+*>          where K is the largest value up to MIN(N,100) for which
+*>          WORK is large enough; K = MIN(N,100) gives the optimal
+*>          LWORK.
+*>
+*>          If LWORK = -1 or LSWORK = -1, then a workspace query is
+*>          assumed; the routine only calculates the optimal sizes of
+*>          the WORK and SWORK arrays, returns these values as the first
+*>          entries of the WORK and SWORK arrays, and no error message
+*>          related to LWORK or LSWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] SWORK
+*> \verbatim
+*>          SWORK is REAL array, dimension (MAX(1,LSWORK))
+*>          This array holds the blocks of the matrix that SHGETRF
+*>          updates in single precision.
+*>          On exit, if INFO = 0, SWORK(1) returns the optimal LSWORK.
+*> \endverbatim
+*>
+*> \param[in] LSWORK
+*> \verbatim
+*>          LSWORK is INTEGER
+*>          The dimension of the array SWORK.  If N = 0, LSWORK >= 1,
+*>          else LSWORK >= 3*N.  For optimal performance LSWORK is at
+*>          least the optimal LWORK of SHGETRF.
+*>
+*>          If LWORK = -1 or LSWORK = -1, then a workspace query is
+*>          assumed; see LWORK.
+*> \endverbatim
+*>
+*> \param[out] HWORK
+*> \verbatim
+*>          HWORK is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension (N*N)
+*>          This array is used to hold the matrix and its factors in
+*>          the format FMT.
+*> \endverbatim
+*>
+*> \param[out] ITER
+*> \verbatim
+*>          ITER is INTEGER
+*>          < 0: iterative refinement has failed, double precision
+*>               factorization has been performed
+*>               -2 : the matrix could not be converted to the format
+*>                    FMT, the routine fell back to full precision
+*>               -3 : failure of SHGETRF
+*>               -4 : the stopping criterion is not satisfied after
+*>                    MAXCYC restarts of GMRES
+*>          >= 0: iterative refinement has been successfully used.
+*>               Returns the number of GMRES iterations
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*>          > 0:  if INFO = i, U(i,i) computed in DOUBLE PRECISION is
+*>                exactly zero.  The factorization has been completed,
+*>                but the factor U is exactly singular, so the solution
+*>                could not be computed.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gesv_mixed
+*
+*  =====================================================================
+      SUBROUTINE DHGESV( FMT, N, NRHS, A, LDA, IPIV, B, LDB, X, LDX,
+     $                   WORK, LWORK, SWORK, LSWORK, HWORK, ITER,
+     $                   INFO )
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          FMT
+      INTEGER            INFO, ITER, LDA, LDB, LDX, LSWORK, LWORK, N,
+     $                   NRHS
+*     ..
+*     .. Array Arguments ..
+      INTEGER            IPIV( * )
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
+      REAL               SWORK( * )
+      DOUBLE PRECISION   A( LDA, * ), B( LDB, * ), WORK( * ),
+     $                   X( LDX, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      INTEGER            MMIN, MMAX, MAXCYC
+      PARAMETER          ( MMIN = 10, MMAX = 100, MAXCYC = 10 )
+*
+      DOUBLE PRECISION   BWDMAX, SCLMAX, ZERO
+      PARAMETER          ( BWDMAX = 1.0E+00, SCLMAX = 1024.0D+0,
+     $                   ZERO = 0.0D+0 )
+*
+*     .. Local Scalars ..
+      LOGICAL            LQUERY
+      INTEGER            IINFO, J, LSWMIN, LSWOPT, LWMIN, LWOPT, M
+      DOUBLE PRECISION   AMAX, ANRM, CTE, EPS
+*
+*     .. External Subroutines ..
+      EXTERNAL           DGETRF, DGETRS, DGMRIR, DLACPY,
+     $                   DLAG2S, DLASCL, HLAG2S, SHGETRF,
+     $                   SLAG2D, SLAG2H, XERBLA
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      DOUBLE PRECISION   DLAMCH, DLANGE
+      EXTERNAL           LSAME, DLAMCH, DLANGE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          DBLE, INT, MAX, MIN, REAL, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      ITER = 0
+      LQUERY = ( LWORK.EQ.-1 .OR. LSWORK.EQ.-1 )
+*
+*     Compute the minimal and the optimal workspaces.
+*
+      IF( N.LE.0 ) THEN
+         LWMIN = 1
+         LWOPT = 1
+         LSWMIN = 1
+         LSWOPT = 1
+      ELSE
+         M = MIN( N, MMIN )
+         LWMIN = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+         M = MIN( N, MMAX )
+         LWOPT = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+         LSWMIN = 3*N
+         CALL SHGETRF( 'B', N, N, HWORK, N, IPIV, SWORK, -1, IINFO )
+         LSWOPT = MAX( LSWMIN, INT( SWORK( 1 ) ) )
+      END IF
+      WORK( 1 ) = DBLE( LWOPT )
+      SWORK( 1 ) = REAL( LSWOPT )
+*
+*     Test the input parameters.
+*
+      IF( .NOT.LSAME( FMT, 'B' ) .AND.
+     $    .NOT.LSAME( FMT, 'H' ) ) THEN
+         INFO = -1
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( NRHS.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, N ) ) THEN
+         INFO = -5
+      ELSE IF( LDB.LT.MAX( 1, N ) ) THEN
+         INFO = -8
+      ELSE IF( LDX.LT.MAX( 1, N ) ) THEN
+         INFO = -10
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -12
+      ELSE IF( LSWORK.LT.LSWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -14
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'DHGESV', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if (N.EQ.0).
+*
+      IF( N.EQ.0 )
+     $   RETURN
+*
+*     Restart GMRES after as many iterations as WORK allows.
+*
+      M = MIN( N, MMAX )
+   10 CONTINUE
+      IF( N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 ).GT.LWORK )
+     $   THEN
+         M = M - 1
+         GO TO 10
+      END IF
+*
+*     Compute some constants.
+*
+      ANRM = DLANGE( 'I', N, N, A, LDA, WORK )
+      AMAX = DLANGE( 'M', N, N, A, LDA, WORK )
+      EPS = DLAMCH( 'Epsilon' )
+      CTE = ANRM*EPS*SQRT( DBLE( N ) )*BWDMAX
+*
+      IF( .NOT.( AMAX.GT.ZERO .AND. AMAX.LE.DLAMCH( 'Overflow' ) ) )
+     $   THEN
+         ITER = -2
+         GO TO 40
+      END IF
+*
+*     Scale A by SCLMAX/AMAX and convert it to the format FMT (HA is
+*     HWORK), one column at a time through WORK and SWORK.
+*
+      DO 20 J = 1, N
+         CALL DLACPY( 'All', N, 1, A( 1, J ), LDA, WORK, N )
+         CALL DLASCL( 'General', 0, 0, AMAX, SCLMAX, N, 1, WORK, N,
+     $                IINFO )
+         CALL DLAG2S( N, 1, WORK, N, SWORK, N, IINFO )
+         IF( IINFO.EQ.0 )
+     $      CALL SLAG2H( FMT, N, 1, SWORK, N, HWORK( 1+( J-1 )*N ),
+     $                   N, IINFO )
+         IF( IINFO.NE.0 ) THEN
+            ITER = -2
+            GO TO 40
+         END IF
+   20 CONTINUE
+*
+*     Compute the LU factorization of HA.
+*
+      CALL SHGETRF( FMT, N, N, HWORK, N, IPIV, SWORK, LSWORK, IINFO )
+*
+      IF( IINFO.NE.0 ) THEN
+         ITER = -3
+         GO TO 40
+      END IF
+*
+*     Copy the factors of HA to double precision (AF is WORK), undo
+*     the scaling on U and solve the system AF*X = B.
+*
+      DO 30 J = 1, N
+         CALL HLAG2S( FMT, N, 1, HWORK( 1+( J-1 )*N ), N, SWORK, N,
+     $                IINFO )
+         CALL SLAG2D( N, 1, SWORK, N, WORK( 1+( J-1 )*N ), N, IINFO )
+   30 CONTINUE
+      CALL DLASCL( 'Upper', 0, 0, SCLMAX, AMAX, N, N, WORK, N,
+     $             IINFO )
+      CALL DLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL DGETRS( 'No transpose', N, NRHS, WORK, N, IPIV, X, LDX,
+     $             IINFO )
+*
+*     Refine X by GMRES preconditioned with the factors.
+*
+      CALL DGMRIR( 'General', ' ', N, NRHS, M, MAXCYC, A, LDA, WORK,
+     $             N, IPIV, B, LDB, X, LDX, CTE, WORK( N*N+1 ), ITER,
+     $             IINFO )
+*
+      IF( IINFO.EQ.0 ) THEN
+         WORK( 1 ) = DBLE( LWOPT )
+         SWORK( 1 ) = REAL( LSWOPT )
+         RETURN
+      END IF
+      ITER = -4
+*
+   40 CONTINUE
+*
+*     The refinement from the 16-bit factors failed to converge to a
+*     satisfactory solution, so we resort to double precision.
+*
+      CALL DGETRF( N, N, A, LDA, IPIV, INFO )
+*
+      IF( INFO.NE.0 )
+     $   RETURN
+*
+      CALL DLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL DGETRS( 'No transpose', N, NRHS, A, LDA, IPIV, X, LDX,
+     $             INFO )
+*
+      WORK( 1 ) = DBLE( LWOPT )
+      SWORK( 1 ) = REAL( LSWOPT )
+      RETURN
+*
+*     End of DHGESV
+*
+      END
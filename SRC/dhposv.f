@@ -0,0 +1,455 @@
+*> \brief <b> DHPOSV computes the solution to system of linear equations A * X = B for PO matrices</b> (mixed precision with 16-bit storage of the factors)
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DHPOSV( FMT, UPLO, N, NRHS, A, LDA, B, LDB, X, LDX,
+*                          WORK, LWORK, SWORK, LSWORK, HWORK, ITER,
+*                          INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          FMT, UPLO
+*       INTEGER            INFO, ITER, LDA, LDB, LDX, LSWORK, LWORK, N,
+*      $                   NRHS
+*       ..
+*       .. Array Arguments ..
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
+*       REAL               SWORK( * )
+*       DOUBLE PRECISION   A( LDA, * ), B( LDB, * ), WORK( * ),
+*      $                   X( LDX, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DHPOSV computes the solution to a real system of linear equations
+*>    A * X = B,
+*> where A is an N-by-N symmetric positive definite matrix and X and B
+*> are N-by-NRHS matrices.
+*>
+*> DHPOSV works in three precisions.  The matrix is stored in a 16-bit
+*> floating-point format, bfloat16 or IEEE half precision (see SLAG2H),
+*> and factorized by SHPOTRF, which keeps the factor in that format
+*> and accumulates the updates in SINGLE PRECISION.  The solution is
+*> then refined to a DOUBLE PRECISION normwise backward error by GMRES
+*> preconditioned by the factor (see DGMRIR), which is copied to
+*> DOUBLE PRECISION for that purpose.  If the approach fails the
+*> method switches to a DOUBLE PRECISION factorization and solve.
+*>
+*> Before the conversion, the matrix is scaled so that its largest
+*> entry is SCLMAX = 4096, which keeps the factor in the range of half
+*> precision.  The scaling is undone on the factor before the
+*> refinement.
+*>
+*> GMRES is restarted every MIN(N,100) iterations when LWORK is large
+*> enough (see LWORK), and the refinement is stopped after
+*> MAXCYC = 10 restarts or when for all the RHS we have:
+*>     RNRM < SQRT(N)*XNRM*ANRM*EPS*BWDMAX
+*> where
+*>     o RNRM is the infinity-norm of the residual
+*>     o XNRM is the infinity-norm of the solution
+*>     o ANRM is the infinity-operator-norm of the matrix A
+*>     o EPS is the machine epsilon returned by DLAMCH('Epsilon')
+*> The value BWDMAX is fixed to 1.0D+00.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] FMT
+*> \verbatim
+*>          FMT is CHARACTER*1
+*>          Specifies the 16-bit format of the factors:
+*>          = 'B':  bfloat16;
+*>          = 'H':  IEEE half precision.
+*> \endverbatim
+*>
+*> \param[in] UPLO
+*> \verbatim
+*>          UPLO is CHARACTER*1
+*>          = 'U':  Upper triangle of A is stored;
+*>          = 'L':  Lower triangle of A is stored.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of linear equations, i.e., the order of the
+*>          matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] NRHS
+*> \verbatim
+*>          NRHS is INTEGER
+*>          The number of right hand sides, i.e., the number of columns
+*>          of the matrix B.  NRHS >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is DOUBLE PRECISION array,
+*>          dimension (LDA,N)
+*>          On entry, the symmetric matrix A.  If UPLO = 'U', the leading
+*>          N-by-N upper triangular part of A contains the upper
+*>          triangular part of the matrix A, and the strictly lower
+*>          triangular part of A is not referenced.  If UPLO = 'L', the
+*>          leading N-by-N lower triangular part of A contains the lower
+*>          triangular part of the matrix A, and the strictly upper
+*>          triangular part of A is not referenced.
+*>
+*>          On exit, if iterative refinement has been successfully used
+*>          (INFO = 0 and ITER >= 0, see description below), then A is
+*>          unchanged, if double precision factorization has been used
+*>          (INFO = 0 and ITER < 0, see description below), then the
+*>          array A contains the factor U or L from the Cholesky
+*>          factorization A = U**T*U or A = L*L**T.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,N).
+*> \endverbatim
+*>
+*> \param[in] B
+*> \verbatim
+*>          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+*>          The N-by-NRHS right hand side matrix B.
+*> \endverbatim
+*>
+*> \param[in] LDB
+*> \verbatim
+*>          LDB is INTEGER
+*>          The leading dimension of the array B.  LDB >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] X
+*> \verbatim
+*>          X is DOUBLE PRECISION array, dimension (LDX,NRHS)
+*>          If INFO = 0, the N-by-NRHS solution matrix X.
+*> \endverbatim
+*>
+*> \param[in] LDX
+*> \verbatim
+*>          LDX is INTEGER
+*>          The leading dimension of the array X.  LDX >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is DOUBLE PRECISION array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.  If N = 0, LWORK >= 1,
+*>          else
+*>          LWORK >= N*(N+NRHS*(K+3)) + NRHS*((K+1)*(K+3)+3)
+*>          with K = MIN(N,10).  GMRES is restarted every K iterations,
+*>          where K is the largest value up to MIN(N,100) for which
+*>          WORK is large enough; K = MIN(N,100) gives the optimal
+*>          LWORK.
+*>
+*>          If LWORK = -1 or LSWORK = -1, then a workspace query is
+*>          assumed; the routine only calculates the optimal sizes of
+*>          the WORK and SWORK arrays, returns these values as the first
+*>          entries of the WORK and SWORK arrays, and no error message
+*>          related to LWORK or LSWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] SWORK
+*> \verbatim
+*>          SWORK is REAL array, dimension (MAX(1,LSWORK))
+*>          This array holds the blocks of the matrix that SHPOTRF
+*>          updates in single precision.
+*>          On exit, if INFO = 0, SWORK(1) returns the optimal LSWORK.
+*> \endverbatim
+*>
+*> \param[in] LSWORK
+*> \verbatim
+*>          LSWORK is INTEGER
+*>          The dimension of the array SWORK.  If N = 0, LSWORK >= 1,
+*>          else LSWORK >= 2*N.  For optimal performance LSWORK is at
+*>          least the optimal LWORK of SHPOTRF.
+*>
+*>          If LWORK = -1 or LSWORK = -1, then a workspace query is
+*>          assumed; see LWORK.
+*> \endverbatim
+*>
+*> \param[out] HWORK
+*> \verbatim
+*>          HWORK is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension (N*N)
+*>          This array is used to hold the matrix and its factor in
+*>          the format FMT.
+*> \endverbatim
+*>
+*> \param[out] ITER
+*> \verbatim
+*>          ITER is INTEGER
+*>          < 0: iterative refinement has failed, double precision
+*>               factorization has been performed
+*>               -2 : the matrix could not be converted to the format
+*>                    FMT, the routine fell back to full precision
+*>               -3 : failure of SHPOTRF
+*>               -4 : the stopping criterion is not satisfied after
+*>                    MAXCYC restarts of GMRES
+*>          >= 0: iterative refinement has been successfully used.
+*>               Returns the number of GMRES iterations
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*>          > 0:  if INFO = i, the leading principal minor of order i
+*>                of (DOUBLE PRECISION) A is not positive, so the
+*>                factorization could not be completed, and the solution
+*>                has not been computed.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup posv_mixed
+*
+*  =====================================================================
+      SUBROUTINE DHPOSV( FMT, UPLO, N, NRHS, A, LDA, B, LDB, X, LDX,
+     $                   WORK, LWORK, SWORK, LSWORK, HWORK, ITER,
+     $                   INFO )
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          FMT, UPLO
+      INTEGER            INFO, ITER, LDA, LDB, LDX, LSWORK, LWORK, N,
+     $                   NRHS
+*     ..
+*     .. Array Arguments ..
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
+      REAL               SWORK( * )
+      DOUBLE PRECISION   A( LDA, * ), B( LDB, * ), WORK( * ),
+     $                   X( LDX, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      INTEGER            MMIN, MMAX, MAXCYC
+      PARAMETER          ( MMIN = 10, MMAX = 100, MAXCYC = 10 )
+*
+      DOUBLE PRECISION   BWDMAX, SCLMAX, ZERO
+      PARAMETER          ( BWDMAX = 1.0E+00, SCLMAX = 4096.0D+0,
+     $                   ZERO = 0.0D+0 )
+*
+*     .. Local Scalars ..
+      LOGICAL            LQUERY, UPPER
+      INTEGER            I1, I2, IINFO, J, LSWMIN, LSWOPT, LWMIN, LWOPT,
+     $                   M
+      DOUBLE PRECISION   AMAX, ANRM, CTE, EPS
+*
+*     .. Local Arrays ..
+      INTEGER            IDUM( 1 )
+*
+*     .. External Subroutines ..
+      EXTERNAL           DGMRIR, DLACPY, DLAG2S, DLASCL,
+     $                   DPOTRF, DPOTRS, HLAG2S, SHPOTRF,
+     $                   SLAG2D, SLAG2H, XERBLA
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      DOUBLE PRECISION   DLAMCH, DLANSY
+      EXTERNAL           LSAME, DLAMCH, DLANSY
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          DBLE, INT, MAX, MIN, REAL, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      ITER = 0
+      UPPER = LSAME( UPLO, 'U' )
+      LQUERY = ( LWORK.EQ.-1 .OR. LSWORK.EQ.-1 )
+*
+*     Compute the minimal and the optimal workspaces.
+*
+      IF( N.LE.0 ) THEN
+         LWMIN = 1
+         LWOPT = 1
+         LSWMIN = 1
+         LSWOPT = 1
+      ELSE
+         M = MIN( N, MMIN )
+         LWMIN = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+         M = MIN( N, MMAX )
+         LWOPT = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+         LSWMIN = 2*N
+         CALL SHPOTRF( 'B', UPLO, N, HWORK, N, SWORK, -1, IINFO )
+         LSWOPT = MAX( LSWMIN, INT( SWORK( 1 ) ) )
+      END IF
+      WORK( 1 ) = DBLE( LWOPT )
+      SWORK( 1 ) = REAL( LSWOPT )
+*
+*     Test the input parameters.
+*
+      IF( .NOT.LSAME( FMT, 'B' ) .AND.
+     $    .NOT.LSAME( FMT, 'H' ) ) THEN
+         INFO = -1
+      ELSE IF( .NOT.UPPER .AND. .NOT.LSAME( UPLO, 'L' ) ) THEN
+         INFO = -2
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( NRHS.LT.0 ) THEN
+         INFO = -4
+      ELSE IF( LDA.LT.MAX( 1, N ) ) THEN
+         INFO = -6
+      ELSE IF( LDB.LT.MAX( 1, N ) ) THEN
+         INFO = -8
+      ELSE IF( LDX.LT.MAX( 1, N ) ) THEN
+         INFO = -10
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -12
+      ELSE IF( LSWORK.LT.LSWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -14
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'DHPOSV', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if (N.EQ.0).
+*
+      IF( N.EQ.0 )
+     $   RETURN
+*
+*     Restart GMRES after as many iterations as WORK allows.
+*
+      M = MIN( N, MMAX )
+   10 CONTINUE
+      IF( N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 ).GT.LWORK )
+     $   THEN
+         M = M - 1
+         GO TO 10
+      END IF
+*
+*     Compute some constants.
+*
+      ANRM = DLANSY( 'I', UPLO, N, A, LDA, WORK )
+      AMAX = DLANSY( 'M', UPLO, N, A, LDA, WORK )
+      EPS = DLAMCH( 'Epsilon' )
+      CTE = ANRM*EPS*SQRT( DBLE( N ) )*BWDMAX
+*
+      IF( .NOT.( AMAX.GT.ZERO .AND. AMAX.LE.DLAMCH( 'Overflow' ) ) )
+     $   THEN
+         ITER = -2
+         GO TO 40
+      END IF
+*
+*     Scale the triangle of A by SCLMAX/AMAX and convert it to the
+*     format FMT (HA is HWORK), one column at a time through WORK and
+*     SWORK.  Rows I1 to I2 of column J are in the triangle.
+*
+      DO 20 J = 1, N
+         IF( UPPER ) THEN
+            I1 = 1
+            I2 = J
+         ELSE
+            I1 = J
+            I2 = N
+         END IF
+         CALL DLACPY( 'All', I2-I1+1, 1, A( I1, J ), LDA, WORK, N )
+         CALL DLASCL( 'General', 0, 0, AMAX, SCLMAX, I2-I1+1, 1,
+     $                WORK, N, IINFO )
+         CALL DLAG2S( I2-I1+1, 1, WORK, N, SWORK, N, IINFO )
+         IF( IINFO.EQ.0 )
+     $      CALL SLAG2H( FMT, I2-I1+1, 1, SWORK, N,
+     $                   HWORK( I1+( J-1 )*N ), N, IINFO )
+         IF( IINFO.NE.0 ) THEN
+            ITER = -2
+            GO TO 40
+         END IF
+   20 CONTINUE
+*
+*     Compute the Cholesky factorization of HA.
+*
+      CALL SHPOTRF( FMT, UPLO, N, HWORK, N, SWORK, LSWORK, IINFO )
+*
+      IF( IINFO.NE.0 ) THEN
+         ITER = -3
+         GO TO 40
+      END IF
+*
+*     Copy the factor of HA to double precision (AF is WORK), undo the
+*     scaling and solve the system AF*X = B.
+*
+      DO 30 J = 1, N
+         IF( UPPER ) THEN
+            I1 = 1
+            I2 = J
+         ELSE
+            I1 = J
+            I2 = N
+         END IF
+         CALL HLAG2S( FMT, I2-I1+1, 1, HWORK( I1+( J-1 )*N ), N,
+     $                SWORK, N, IINFO )
+         CALL SLAG2D( I2-I1+1, 1, SWORK, N, WORK( I1+( J-1 )*N ), N,
+     $                IINFO )
+   30 CONTINUE
+      CALL DLASCL( UPLO, 0, 0, SQRT( SCLMAX ), SQRT( AMAX ), N, N,
+     $             WORK, N, IINFO )
+      CALL DLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL DPOTRS( UPLO, N, NRHS, WORK, N, X, LDX, IINFO )
+*
+*     Refine X by GMRES preconditioned with the factor.
+*
+      CALL DGMRIR( 'Positive', UPLO, N, NRHS, M, MAXCYC, A, LDA,
+     $             WORK, N, IDUM, B, LDB, X, LDX, CTE, WORK( N*N+1 ),
+     $             ITER, IINFO )
+*
+      IF( IINFO.EQ.0 ) THEN
+         WORK( 1 ) = DBLE( LWOPT )
+         SWORK( 1 ) = REAL( LSWOPT )
+         RETURN
+      END IF
+      ITER = -4
+*
+   40 CONTINUE
+*
+*     The refinement from the 16-bit factors failed to converge to a
+*     satisfactory solution, so we resort to double precision.
+*
+      CALL DPOTRF( UPLO, N, A, LDA, INFO )
+*
+      IF( INFO.NE.0 )
+     $   RETURN
+*
+      CALL DLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL DPOTRS( UPLO, N, NRHS, A, LDA, X, LDX, INFO )
+*
+      WORK( 1 ) = DBLE( LWOPT )
+      SWORK( 1 ) = REAL( LSWOPT )
+      RETURN
+*
+*     End of DHPOSV
+*
+      END
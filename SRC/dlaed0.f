@@ -36,6 +36,10 @@
 *>
 *> DLAED0 computes all eigenvalues and corresponding eigenvectors of a
 *> symmetric tridiagonal matrix using the divide and conquer method.
+*>
+*> If ICOMPQ = 2 and ILAENV( 7, 'DLAED0', ... ) returns more than one
+*> thread, the work is done by DLAED0_TASK, which solves the
+*> independent subproblems of the divide and conquer tree in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -195,9 +199,8 @@
       DOUBLE PRECISION   TEMP
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DCOPY, DGEMM, DLACPY, DLAED1, DLAED7,
-     $                   DSTEQR,
-     $                   XERBLA
+      EXTERNAL           DCOPY, DGEMM, DLACPY, DLAED0_TASK,
+     $                   DLAED1, DLAED7, DSTEQR, XERBLA
 *     ..
 *     .. External Functions ..
       INTEGER            ILAENV
@@ -232,6 +235,16 @@
 *
       IF( N.EQ.0 )
      $   RETURN
+*
+*     With more than one thread, solve the subproblems of the tree in
+*     parallel.
+*
+      IF( ICOMPQ.EQ.2 ) THEN
+         IF( ILAENV( 7, 'DLAED0', ' ', N, -1, -1, -1 ).GT.1 ) THEN
+            CALL DLAED0_TASK( N, D, E, Q, LDQ, WORK, IWORK, INFO )
+            RETURN
+         END IF
+      END IF
 *
       SMLSIZ = ILAENV( 9, 'DLAED0', ' ', 0, 0, 0, 0 )
 *
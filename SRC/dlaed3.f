@@ -42,6 +42,10 @@
 *> being combined by the matrix of eigenvectors of the K-by-K system
 *> which is solved here.
 *>
+*> If ILAENV( 7, 'DLAED3', ... ) returns more than one thread, the
+*> work is done by DLAED3_TASK, which solves the secular equations and
+*> updates the eigenvectors in parallel.
+*>
 *> \endverbatim
 *
 *  Arguments:
@@ -198,12 +202,13 @@
       DOUBLE PRECISION   TEMP
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       DOUBLE PRECISION   DNRM2
-      EXTERNAL           DNRM2
+      EXTERNAL           DNRM2, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DCOPY, DGEMM, DLACPY, DLAED4, DLASET,
-     $                   XERBLA
+      EXTERNAL           DCOPY, DGEMM, DLACPY, DLAED3_TASK,
+     $                   DLAED4, DLASET, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, SIGN, SQRT
@@ -231,6 +236,15 @@
       IF( K.EQ.0 )
      $   RETURN
 *
+*     With more than one thread, solve the secular equations and
+*     update the eigenvectors in parallel.
+*
+      IF( ILAENV( 7, 'DLAED3', ' ', K, N, N1, -1 ).GT.1 ) THEN
+         CALL DLAED3_TASK( K, N, N1, D, Q, LDQ, RHO, DLAMBDA, Q2,
+     $                     INDX, CTOT, W, S, INFO )
+         RETURN
+      END IF
+*
 *
       DO 20 J = 1, K
          CALL DLAED4( K, J, DLAMBDA, W, Q( 1, J ), RHO, D( J ),
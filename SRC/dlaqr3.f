@@ -47,6 +47,10 @@
 *>    an orthogonal similarity transformation of H.  It is to be
 *>    hoped that the final version of H has many zero subdiagonal
 *>    entries.
+*>
+*>    If ILAENV( 7, 'DLAQR3', ... ) returns more than one thread, the
+*>    rows and columns of H outside the deflation window, and Z, are
+*>    updated in parallel by DLAQR3_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -307,7 +311,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           DCOPY, DGEHRD, DGEMM, DLACPY, DLAHQR,
-     $                   DLANV2,
+     $                   DLANV2, DLAQR3_TASK,
      $                   DLAQR4, DLARF1F, DLARFG, DLASET, DORMHR, DTREXC
 *     ..
 *     .. Intrinsic Functions ..
@@ -637,44 +641,56 @@
      $                   LDV,
      $                   WORK( JW+1 ), LWORK-JW, INFO )
 *
-*        ==== Update vertical slab in H ====
+         IF( ILAENV( 7, 'DLAQR3', ' ', N, KWTOP, KBOT, -1 ).GT.1 )
+     $       THEN
+*
+*           ==== Update the slabs of H and Z in parallel ====
 *
-         IF( WANTT ) THEN
-            LTOP = 1
+            CALL DLAQR3_TASK( WANTT, WANTZ, N, KTOP, KBOT, KWTOP, JW,
+     $                        H, LDH, ILOZ, IHIZ, Z, LDZ, V, LDV, NH,
+     $                        T, LDT, NV, WV, LDWV )
          ELSE
-            LTOP = KTOP
-         END IF
-         DO 70 KROW = LTOP, KWTOP - 1, NV
-            KLN = MIN( NV, KWTOP-KROW )
-            CALL DGEMM( 'N', 'N', KLN, JW, JW, ONE, H( KROW, KWTOP ),
-     $                  LDH, V, LDV, ZERO, WV, LDWV )
-            CALL DLACPY( 'A', KLN, JW, WV, LDWV, H( KROW, KWTOP ),
-     $                   LDH )
-   70    CONTINUE
-*
-*        ==== Update horizontal slab in H ====
-*
-         IF( WANTT ) THEN
-            DO 80 KCOL = KBOT + 1, N, NH
-               KLN = MIN( NH, N-KCOL+1 )
-               CALL DGEMM( 'C', 'N', JW, KLN, JW, ONE, V, LDV,
-     $                     H( KWTOP, KCOL ), LDH, ZERO, T, LDT )
-               CALL DLACPY( 'A', JW, KLN, T, LDT, H( KWTOP, KCOL ),
+*
+*           ==== Update vertical slab in H ====
+*
+            IF( WANTT ) THEN
+               LTOP = 1
+            ELSE
+               LTOP = KTOP
+            END IF
+            DO 70 KROW = LTOP, KWTOP - 1, NV
+               KLN = MIN( NV, KWTOP-KROW )
+               CALL DGEMM( 'N', 'N', KLN, JW, JW, ONE,
+     $                     H( KROW, KWTOP ), LDH, V, LDV, ZERO, WV,
+     $                     LDWV )
+               CALL DLACPY( 'A', KLN, JW, WV, LDWV, H( KROW, KWTOP ),
      $                      LDH )
-   80       CONTINUE
-         END IF
+   70       CONTINUE
+*
+*           ==== Update horizontal slab in H ====
+*
+            IF( WANTT ) THEN
+               DO 80 KCOL = KBOT + 1, N, NH
+                  KLN = MIN( NH, N-KCOL+1 )
+                  CALL DGEMM( 'C', 'N', JW, KLN, JW, ONE, V, LDV,
+     $                        H( KWTOP, KCOL ), LDH, ZERO, T, LDT )
+                  CALL DLACPY( 'A', JW, KLN, T, LDT,
+     $                         H( KWTOP, KCOL ), LDH )
+   80          CONTINUE
+            END IF
 *
-*        ==== Update vertical slab in Z ====
-*
-         IF( WANTZ ) THEN
-            DO 90 KROW = ILOZ, IHIZ, NV
-               KLN = MIN( NV, IHIZ-KROW+1 )
-               CALL DGEMM( 'N', 'N', KLN, JW, JW, ONE, Z( KROW,
-     $                     KWTOP ),
-     $                     LDZ, V, LDV, ZERO, WV, LDWV )
-               CALL DLACPY( 'A', KLN, JW, WV, LDWV, Z( KROW, KWTOP ),
-     $                      LDZ )
-   90       CONTINUE
+*           ==== Update vertical slab in Z ====
+*
+            IF( WANTZ ) THEN
+               DO 90 KROW = ILOZ, IHIZ, NV
+                  KLN = MIN( NV, IHIZ-KROW+1 )
+                  CALL DGEMM( 'N', 'N', KLN, JW, JW, ONE,
+     $                        Z( KROW, KWTOP ), LDZ, V, LDV, ZERO, WV,
+     $                        LDWV )
+                  CALL DLACPY( 'A', KLN, JW, WV, LDWV,
+     $                         Z( KROW, KWTOP ), LDZ )
+   90          CONTINUE
+            END IF
          END IF
       END IF
 *
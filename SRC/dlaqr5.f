@@ -39,6 +39,10 @@
 *>
 *>    DLAQR5, called by DLAQR0, performs a
 *>    single small-bulge multi-shift QR sweep.
+*>
+*>    If KACC22 = 1 or 2 and ILAENV( 7, 'DLAQR5', ... ) returns more
+*>    than one thread, the sweep is made by DLAQR5_TASK, which chases
+*>    several chains of bulges in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -289,12 +293,13 @@
       INTEGER            I, I2, I4, INCOL, J, JBOT, JCOL, JLEN,
      $                   JROW, JTOP, K, K1, KDU, KMS, KRCOL,
      $                   M, M22, MBOT, MTOP, NBMPS, NDCOL,
-     $                   NS, NU
+     $                   NS, NTHR, NU
       LOGICAL            ACCUM, BMP22
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       DOUBLE PRECISION   DLAMCH
-      EXTERNAL           DLAMCH
+      EXTERNAL           ILAENV, DLAMCH
 *     ..
 *     .. Intrinsic Functions ..
 *
@@ -304,8 +309,8 @@
       DOUBLE PRECISION   VT( 3 )
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DGEMM, DLACPY, DLAQR1, DLARFG, DLASET,
-     $                   DTRMM
+      EXTERNAL           DGEMM, DLACPY, DLAQR1, DLAQR5_TASK,
+     $                   DLARFG, DLASET, DTRMM
 *     ..
 *     .. Executable Statements ..
 *
@@ -320,6 +325,20 @@
       IF( KTOP.GE.KBOT )
      $   RETURN
 *
+*     ==== With more than one thread, chase several chains of
+*     .    bulges at the same time. ====
+*
+      IF( ( KACC22.EQ.1 .OR. KACC22.EQ.2 ) .AND. NSHFTS.GE.4 ) THEN
+         NTHR = ILAENV( 7, 'DLAQR5', ' ', N, KTOP, KBOT, NSHFTS )
+         IF( NTHR.GT.1 ) THEN
+            CALL DLAQR5_TASK( WANTT, WANTZ, N, KTOP, KBOT, NSHFTS,
+     $                        SR, SI, H, LDH, ILOZ, IHIZ, Z, LDZ, V,
+     $                        LDV, U, LDU, NV, WV, LDWV, NH, WH,
+     $                        LDWH )
+            RETURN
+         END IF
+      END IF
+*
 *     ==== Shuffle shifts into pairs of real shifts and pairs
 *     .    of complex conjugate shifts assuming complex
 *     .    conjugate shifts are already adjacent to one
@@ -44,6 +44,10 @@
 *> and WGAP, respectively. During bisection, intervals
 *> [left, right] are maintained by storing their mid-points and
 *> semi-widths in the arrays W and WERR respectively.
+*>
+*> If ILAENV( 7, 'DLARRB', ... ) returns more than one thread, the
+*> work is done by DLARRB_TASK, which refines the eigenvalues in
+*> parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -221,9 +225,11 @@
      $                   RGAP, RIGHT, TMP, WIDTH
 *     ..
 *     .. External Functions ..
-      INTEGER            DLANEG
-      EXTERNAL           DLANEG
-*
+      INTEGER            DLANEG, ILAENV
+      EXTERNAL           DLANEG, ILAENV
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           DLARRB_TASK
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, MAX, MIN
@@ -237,6 +243,18 @@
       IF( N.LE.0 ) THEN
          RETURN
       END IF
+*
+*     With more than one thread, refine the eigenvalues in parallel.
+*
+      IF( ILAST.GT.IFIRST ) THEN
+         IF( ILAENV( 7, 'DLARRB', ' ', N, IFIRST, ILAST,
+     $               -1 ).GT.1 ) THEN
+            CALL DLARRB_TASK( N, D, LLD, IFIRST, ILAST, RTOL1, RTOL2,
+     $                        OFFSET, W, WGAP, WERR, WORK, IWORK,
+     $                        PIVMIN, SPDIAM, TWIST, INFO )
+            RETURN
+         END IF
+      END IF
 *
       MAXITR = INT( ( LOG( SPDIAM+PIVMIN )-LOG( PIVMIN ) ) /
      $           LOG( TWO ) ) + 2
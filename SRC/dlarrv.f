@@ -43,6 +43,10 @@
 *> DLARRV computes the eigenvectors of the tridiagonal matrix
 *> T = L D L**T given L, D and APPROXIMATIONS to the eigenvalues of L D L**T.
 *> The input eigenvalues should have been computed by DLARRE.
+*>
+*> If ILAENV( 7, 'DLARRV', ... ) returns more than one thread and T
+*> has more than one block, the work is done by DLARRV_TASK, which
+*> computes the eigenvectors of the blocks in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -331,12 +335,13 @@
      $                   SIGMA, SPDIAM, SSIGMA, TAU, TMP, TOL, ZTZ
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       DOUBLE PRECISION   DLAMCH
-      EXTERNAL           DLAMCH
+      EXTERNAL           DLAMCH, ILAENV
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           DCOPY, DLAR1V, DLARRB, DLARRF,
-     $                   DLASET,
+     $                   DLARRV_TASK, DLASET,
      $                   DSCAL
 *     ..
 *     .. Intrinsic Functions ..
@@ -353,6 +358,20 @@
          RETURN
       END IF
 *
+*     With more than one thread, compute the eigenvectors of the
+*     blocks in parallel.
+*
+      IF( IBLOCK( M ).GT.1 ) THEN
+         IF( ILAENV( 7, 'DLARRV', ' ', N, M, IBLOCK( M ),
+     $               -1 ).GT.1 ) THEN
+            CALL DLARRV_TASK( N, VL, VU, D, L, PIVMIN, ISPLIT, M,
+     $                        DOL, DOU, MINRGP, RTOL1, RTOL2, W, WERR,
+     $                        WGAP, IBLOCK, INDEXW, GERS, Z, LDZ,
+     $                        ISUPPZ, WORK, IWORK, INFO )
+            RETURN
+         END IF
+      END IF
+*
 *     The first N entries of WORK are reserved for the eigenvalues
       INDLD = N+1
       INDLLD= 2*N+1
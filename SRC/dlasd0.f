@@ -42,6 +42,10 @@
 *>
 *> A related subroutine, DLASDA, computes only the singular values,
 *> and optionally, the singular vectors in compact form.
+*>
+*> If ILAENV( 7, 'DLASD0', ... ) returns more than one thread, the
+*> work is done by DLASD0_TASK, which solves the independent
+*> subproblems in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -170,8 +174,13 @@
      $                   NL, NLF, NLP1, NLVL, NR, NRF, NRP1, SQREI
       DOUBLE PRECISION   ALPHA, BETA
 *     ..
+*     .. External Functions ..
+      INTEGER            ILAENV
+      EXTERNAL           ILAENV
+*     ..
 *     .. External Subroutines ..
-      EXTERNAL           DLASD1, DLASDQ, DLASDT, XERBLA
+      EXTERNAL           DLASD0_TASK, DLASD1, DLASDQ,
+     $                   DLASDT, XERBLA
 *     ..
 *     .. Executable Statements ..
 *
@@ -208,6 +217,15 @@
          RETURN
       END IF
 *
+*     With more than one thread, solve the subproblems in parallel.
+*
+      IF( ILAENV( 7, 'DLASD0', ' ', N, SQRE, SMLSIZ,
+     $            -1 ).GT.1 ) THEN
+         CALL DLASD0_TASK( N, SQRE, D, E, U, LDU, VT, LDVT,
+     $                     SMLSIZ, IWORK, WORK, INFO )
+         RETURN
+      END IF
+*
 *     Set up the computation tree.
 *
       INODE = 1
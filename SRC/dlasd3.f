@@ -43,6 +43,10 @@
 *> vectors by matrix multiplication.
 *>
 *> DLASD3 is called from DLASD1.
+*>
+*> If ILAENV( 7, 'DLASD3', ... ) returns more than one thread, the
+*> work is done by DLASD3_TASK, which solves the secular equations
+*> and updates the singular vectors in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -241,12 +245,13 @@
       DOUBLE PRECISION   RHO, TEMP
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       DOUBLE PRECISION   DNRM2
-      EXTERNAL           DNRM2
+      EXTERNAL           DNRM2, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DCOPY, DGEMM, DLACPY, DLASCL, DLASD4,
-     $                   XERBLA
+      EXTERNAL           DCOPY, DGEMM, DLACPY, DLASCL,
+     $                   DLASD3_TASK, DLASD4, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, SIGN, SQRT
@@ -303,6 +308,16 @@
          RETURN
       END IF
 *
+*     With more than one thread, find the singular values and update
+*     the singular vectors in parallel.
+*
+      IF( ILAENV( 7, 'DLASD3', ' ', K, NL, NR, SQRE ).GT.1 ) THEN
+         CALL DLASD3_TASK( NL, NR, SQRE, K, D, Q, LDQ, DSIGMA, U,
+     $                     LDU, U2, LDU2, VT, LDVT, VT2, LDVT2, IDXC,
+     $                     CTOT, Z, INFO )
+         RETURN
+      END IF
+*
 *     Keep a copy of Z.
 *
       CALL DCOPY( K, Z, 1, Q, 1 )
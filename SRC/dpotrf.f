@@ -41,6 +41,8 @@
 *> where U is an upper triangular matrix and L is lower triangular.
 *>
 *> This is the block version of the algorithm, calling Level 3 BLAS.
+*> If ILAENV( 7, 'DPOTRF', ... ) returns more than one thread, the
+*> factorization is done by the task-parallel DPOTRF_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -131,8 +133,8 @@
       EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DGEMM, DPOTRF2, DSYRK, DTRSM,
-     $                   XERBLA
+      EXTERNAL           DGEMM, DPOTRF2, DPOTRF_TASK, DSYRK,
+     $                   DTRSM, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, MIN
@@ -168,6 +170,12 @@
 *        Use unblocked code.
 *
          CALL DPOTRF2( UPLO, N, A, LDA, INFO )
+      ELSE IF( ILAENV( 7, 'DPOTRF', UPLO, N, -1, -1, -1 ).GT.1 )
+     $         THEN
+*
+*        Use the task-parallel blocked code.
+*
+         CALL DPOTRF_TASK( UPLO, N, A, LDA, INFO )
       ELSE
 *
 *        Use blocked code.
@@ -35,6 +35,8 @@
 *> DPOTRI computes the inverse of a real symmetric positive definite
 *> matrix A using the Cholesky factorization A = U**T*U or A = L*L**T
 *> computed by DPOTRF.
+*> If ILAENV( 7, 'DPOTRI', ... ) returns more than one thread, the
+*> inverse is computed by the task-parallel DPOTRI_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -107,10 +109,11 @@
 *
 *     .. External Functions ..
       LOGICAL            LSAME
-      EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DLAUUM, DTRTRI, XERBLA
+      EXTERNAL           DLAUUM, DPOTRI_TASK, DTRTRI, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX
@@ -137,6 +140,14 @@
 *
       IF( N.EQ.0 )
      $   RETURN
+*
+      IF( ILAENV( 7, 'DPOTRI', UPLO, N, -1, -1, -1 ).GT.1 ) THEN
+*
+*        Use the task-parallel code.
+*
+         CALL DPOTRI_TASK( UPLO, N, A, LDA, INFO )
+         RETURN
+      END IF
 *
 *     Invert the triangular Cholesky factor U or L.
 *
@@ -0,0 +1,364 @@
+*> \brief <b> DSPOSV_GMRES computes the solution to system of linear equations A * X = B for PO matrices</b> (mixed precision with GMRES-based iterative refinement)
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DSPOSV_GMRES( UPLO, N, NRHS, A, LDA, B, LDB, X, LDX,
+*                                WORK, LWORK, SWORK, ITER, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          UPLO
+*       INTEGER            INFO, ITER, LDA, LDB, LDX, LWORK, N, NRHS
+*       ..
+*       .. Array Arguments ..
+*       REAL               SWORK( * )
+*       DOUBLE PRECISION   A( LDA, * ), B( LDB, * ), WORK( * ),
+*      $                   X( LDX, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DSPOSV_GMRES computes the solution to a real system of linear
+*> equations
+*>    A * X = B,
+*> where A is an N-by-N symmetric positive definite matrix and X and B
+*> are N-by-NRHS matrices.
+*>
+*> Like DSPOSV, DSPOSV_GMRES factorizes the matrix in SINGLE PRECISION
+*> and refines the solution to a DOUBLE PRECISION normwise backward
+*> error, but each refinement step solves for the correction with
+*> GMRES preconditioned by the single precision Cholesky factorization
+*> (see DGMRIR) instead of applying the factorization alone.  The
+*> factor is copied to DOUBLE PRECISION, where GMRES applies it.  The
+*> refinement converges for condition numbers up to about 1/EPS in
+*> double precision, where the refinement of DSPOSV needs them below
+*> about 1/EPS in single precision.  If the approach fails the method
+*> switches to a DOUBLE PRECISION factorization and solve.
+*>
+*> GMRES is restarted every MIN(N,100) iterations when LWORK is large
+*> enough (see LWORK), and the refinement is stopped after
+*> MAXCYC = 10 restarts or when for all the RHS we have:
+*>     RNRM < SQRT(N)*XNRM*ANRM*EPS*BWDMAX
+*> where
+*>     o RNRM is the infinity-norm of the residual
+*>     o XNRM is the infinity-norm of the solution
+*>     o ANRM is the infinity-operator-norm of the matrix A
+*>     o EPS is the machine epsilon returned by DLAMCH('Epsilon')
+*> The value BWDMAX is fixed to 1.0D+00.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] UPLO
+*> \verbatim
+*>          UPLO is CHARACTER*1
+*>          = 'U':  Upper triangle of A is stored;
+*>          = 'L':  Lower triangle of A is stored.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of linear equations, i.e., the order of the
+*>          matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] NRHS
+*> \verbatim
+*>          NRHS is INTEGER
+*>          The number of right hand sides, i.e., the number of columns
+*>          of the matrix B.  NRHS >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is DOUBLE PRECISION array,
+*>          dimension (LDA,N)
+*>          On entry, the symmetric matrix A.  If UPLO = 'U', the leading
+*>          N-by-N upper triangular part of A contains the upper
+*>          triangular part of the matrix A, and the strictly lower
+*>          triangular part of A is not referenced.  If UPLO = 'L', the
+*>          leading N-by-N lower triangular part of A contains the lower
+*>          triangular part of the matrix A, and the strictly upper
+*>          triangular part of A is not referenced.
+*>          On exit, if iterative refinement has been successfully used
+*>          (INFO = 0 and ITER >= 0, see description below), then A is
+*>          unchanged, if double precision factorization has been used
+*>          (INFO = 0 and ITER < 0, see description below), then the
+*>          array A contains the factor U or L from the Cholesky
+*>          factorization A = U**T*U or A = L*L**T.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,N).
+*> \endverbatim
+*>
+*> \param[in] B
+*> \verbatim
+*>          B is DOUBLE PRECISION array, dimension (LDB,NRHS)
+*>          The N-by-NRHS right hand side matrix B.
+*> \endverbatim
+*>
+*> \param[in] LDB
+*> \verbatim
+*>          LDB is INTEGER
+*>          The leading dimension of the array B.  LDB >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] X
+*> \verbatim
+*>          X is DOUBLE PRECISION array, dimension (LDX,NRHS)
+*>          If INFO = 0, the N-by-NRHS solution matrix X.
+*> \endverbatim
+*>
+*> \param[in] LDX
+*> \verbatim
+*>          LDX is INTEGER
+*>          The leading dimension of the array X.  LDX >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is DOUBLE PRECISION array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.  If N = 0, LWORK >= 1,
+*>          else
+*>          LWORK >= N*(N+NRHS*(K+3)) + NRHS*((K+1)*(K+3)+3)
+*>          with K = MIN(N,10).  GMRES is restarted every K iterations,
+*>          where K is the largest value up to MIN(N,100) for which
+*>          WORK is large enough; K = MIN(N,100) gives the optimal
+*>          LWORK.
+*>
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] SWORK
+*> \verbatim
+*>          SWORK is REAL array, dimension (N*N)
+*>          This array is used to hold the single precision matrix.
+*> \endverbatim
+*>
+*> \param[out] ITER
+*> \verbatim
+*>          ITER is INTEGER
+*>          < 0: iterative refinement has failed, double precision
+*>               factorization has been performed
+*>               -2 : narrowing the precision induced an overflow,
+*>                    the routine fell back to full precision
+*>               -3 : failure of SPOTRF
+*>               -4 : the stopping criterion is not satisfied after
+*>                    MAXCYC restarts of GMRES
+*>          >= 0: iterative refinement has been successfully used.
+*>               Returns the number of GMRES iterations
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*>          > 0:  if INFO = i, the leading principal minor of order i
+*>                of (DOUBLE PRECISION) A is not positive, so the
+*>                factorization could not be completed, and the solution
+*>                has not been computed.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup posv_mixed
+*
+*  =====================================================================
+      SUBROUTINE DSPOSV_GMRES( UPLO, N, NRHS, A, LDA, B, LDB, X, LDX,
+     $                         WORK, LWORK, SWORK, ITER, INFO )
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          UPLO
+      INTEGER            INFO, ITER, LDA, LDB, LDX, LWORK, N, NRHS
+*     ..
+*     .. Array Arguments ..
+      REAL               SWORK( * )
+      DOUBLE PRECISION   A( LDA, * ), B( LDB, * ), WORK( * ),
+     $                   X( LDX, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      INTEGER            MMIN, MMAX, MAXCYC
+      PARAMETER          ( MMIN = 10, MMAX = 100, MAXCYC = 10 )
+*
+      DOUBLE PRECISION   BWDMAX
+      PARAMETER          ( BWDMAX = 1.0E+00 )
+*
+*     .. Local Scalars ..
+      LOGICAL            LQUERY
+      INTEGER            IINFO, LWMIN, LWOPT, M
+      DOUBLE PRECISION   ANRM, CTE, EPS
+*
+*     .. Local Arrays ..
+      INTEGER            IDUM( 1 )
+*
+*     .. External Subroutines ..
+      EXTERNAL           DGMRIR, DLACPY, DLAT2S, DPOTRF,
+     $                   DPOTRS, SLAG2D, SPOTRF, XERBLA
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      DOUBLE PRECISION   DLAMCH, DLANSY
+      EXTERNAL           LSAME, DLAMCH, DLANSY
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          DBLE, MAX, MIN, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      ITER = 0
+      LQUERY = ( LWORK.EQ.-1 )
+*
+*     Compute the minimal and the optimal workspace.
+*
+      IF( N.LE.0 ) THEN
+         LWMIN = 1
+         LWOPT = 1
+      ELSE
+         M = MIN( N, MMIN )
+         LWMIN = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+         M = MIN( N, MMAX )
+         LWOPT = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+      END IF
+      WORK( 1 ) = DBLE( LWOPT )
+*
+*     Test the input parameters.
+*
+      IF( .NOT.LSAME( UPLO, 'U' ) .AND.
+     $    .NOT.LSAME( UPLO, 'L' ) ) THEN
+         INFO = -1
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( NRHS.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, N ) ) THEN
+         INFO = -5
+      ELSE IF( LDB.LT.MAX( 1, N ) ) THEN
+         INFO = -7
+      ELSE IF( LDX.LT.MAX( 1, N ) ) THEN
+         INFO = -9
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -11
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'DSPOSV_GMRES', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if (N.EQ.0).
+*
+      IF( N.EQ.0 )
+     $   RETURN
+*
+*     Restart GMRES after as many iterations as WORK allows.
+*
+      M = MIN( N, MMAX )
+   10 CONTINUE
+      IF( N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 ).GT.LWORK )
+     $   THEN
+         M = M - 1
+         GO TO 10
+      END IF
+*
+*     Compute some constants.
+*
+      ANRM = DLANSY( 'I', UPLO, N, A, LDA, WORK )
+      EPS = DLAMCH( 'Epsilon' )
+      CTE = ANRM*EPS*SQRT( DBLE( N ) )*BWDMAX
+*
+*     Convert A from double precision to single precision and store the
+*     result in SA (SWORK).
+*
+      CALL DLAT2S( UPLO, N, A, LDA, SWORK, N, INFO )
+*
+      IF( INFO.NE.0 ) THEN
+         ITER = -2
+         GO TO 40
+      END IF
+*
+*     Compute the Cholesky factorization of SA.
+*
+      CALL SPOTRF( UPLO, N, SWORK, N, INFO )
+*
+      IF( INFO.NE.0 ) THEN
+         ITER = -3
+         GO TO 40
+      END IF
+*
+*     Copy the factor of SA to double precision (AF is WORK) and
+*     solve the system AF*X = B.
+*
+      CALL SLAG2D( N, N, SWORK, N, WORK, N, INFO )
+      CALL DLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL DPOTRS( UPLO, N, NRHS, WORK, N, X, LDX, INFO )
+*
+*     Refine X by GMRES preconditioned with the factor.
+*
+      CALL DGMRIR( 'Positive', UPLO, N, NRHS, M, MAXCYC, A, LDA,
+     $             WORK, N, IDUM, B, LDB, X, LDX, CTE, WORK( N*N+1 ),
+     $             ITER, IINFO )
+*
+      IF( IINFO.EQ.0 ) THEN
+         WORK( 1 ) = DBLE( LWOPT )
+         RETURN
+      END IF
+      ITER = -4
+*
+   40 CONTINUE
+*
+*     Single-precision iterative refinement failed to converge to a
+*     satisfactory solution, so we resort to double precision.
+*
+      CALL DPOTRF( UPLO, N, A, LDA, INFO )
+*
+      IF( INFO.NE.0 )
+     $   RETURN
+*
+      CALL DLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL DPOTRS( UPLO, N, NRHS, A, LDA, X, LDX, INFO )
+*
+      WORK( 1 ) = DBLE( LWOPT )
+      RETURN
+*
+*     End of DSPOSV_GMRES
+*
+      END
@@ -41,7 +41,9 @@
 *>  each 2-by-2 diagonal block has its diagonal elements equal and its
 *>  off-diagonal elements of opposite sign.
 *>
-*>  This is the block version of the algorithm.
+*>  This is the block version of the algorithm.  If ILAENV( 7,
+*>  'DTRSYL3', ... ) returns more than one thread, the blocks of X are
+*>  solved in parallel by DTRSYL3_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -233,7 +235,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           DGEMM, DLASCL, DSCAL, DTRSYL,
-     $                   XERBLA
+     $                   DTRSYL3_TASK, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, DBLE, EXPONENT, MAX, MIN
@@ -435,7 +437,15 @@
 *
       SGN = DBLE( ISGN )
 *
-      IF( NOTRNA .AND. NOTRNB ) THEN
+      IF( ILAENV( 7, 'DTRSYL3', ' ', M, N, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for the blocks of X by anti-diagonals of the block grid,
+*        in parallel.
+*
+         CALL DTRSYL3_TASK( TRANA, TRANB, ISGN, NBA, NBB, NB, IWORK,
+     $                      A, LDA, B, LDB, C, LDC, SWORK, LDSWORK,
+     $                      BUF, INFO )
+      ELSE IF( NOTRNA .AND. NOTRNB ) THEN
 *
 *        Solve    A*X + ISGN*X*B = scale*C.
 *
@@ -0,0 +1,183 @@
+*> \brief \b HLAG2S converts a matrix stored in a 16-bit floating-point format to a single precision matrix.
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE HLAG2S( FMT, M, N, HA, LDHA, SA, LDSA, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          FMT
+*       INTEGER            INFO, LDHA, LDSA, M, N
+*       ..
+*       .. Array Arguments ..
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) HA( LDHA, * )
+*       REAL               SA( LDSA, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> HLAG2S converts a matrix, HA, whose entries are stored in a 16-bit
+*> floating-point format (see SLAG2H), to a SINGLE PRECISION matrix,
+*> SA.  The conversion is exact.
+*>
+*> This is an auxiliary routine so there is no argument checking.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] FMT
+*> \verbatim
+*>          FMT is CHARACTER*1
+*>          Specifies the 16-bit format of HA:
+*>          = 'B':  bfloat16;
+*>          = 'H':  IEEE half precision.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of lines of the matrix HA.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the matrix HA.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] HA
+*> \verbatim
+*>          HA is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension (LDHA,N)
+*>          On entry, the M-by-N coefficient matrix HA in the format
+*>          FMT.
+*> \endverbatim
+*>
+*> \param[in] LDHA
+*> \verbatim
+*>          LDHA is INTEGER
+*>          The leading dimension of the array HA.  LDHA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] SA
+*> \verbatim
+*>          SA is REAL array, dimension (LDSA,N)
+*>          On exit, the M-by-N coefficient matrix SA.
+*> \endverbatim
+*>
+*> \param[in] LDSA
+*> \verbatim
+*>          LDSA is INTEGER
+*>          The leading dimension of the array SA.  LDSA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup _lag2_
+*
+*  =====================================================================
+      SUBROUTINE HLAG2S( FMT, M, N, HA, LDHA, SA, LDSA, INFO )
+*
+*  -- LAPACK auxiliary routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          FMT
+      INTEGER            INFO, LDHA, LDSA, M, N
+*     ..
+*     .. Array Arguments ..
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HA( LDHA, * )
+      REAL               SA( LDSA, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+*     IK is the kind of a 32-bit integer, which holds the bits of a
+*     REAL whatever the size of the default INTEGER.
+*     INFBIT are the bits of Inf in SINGLE PRECISION; TWOM24 is
+*     2**(-24), the smallest subnormal number of half precision.
+      INTEGER            IK
+      PARAMETER          ( IK = SELECTED_INT_KIND( 9 ) )
+      INTEGER            INFBIT
+      PARAMETER          ( INFBIT = 2139095040 )
+      REAL               TWOM24
+      PARAMETER          ( TWOM24 = 5.9604644775390625E-8 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            BF16
+      INTEGER            E, I, IH, J
+      INTEGER( KIND=IK ) IB
+      REAL               S
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      EXTERNAL           LSAME
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          IAND, INT, ISHFT, REAL, SELECTED_INT_KIND,
+     $                   TRANSFER
+*     ..
+*     .. Executable Statements ..
+*
+      BF16 = LSAME( FMT, 'B' )
+      DO 20 J = 1, N
+         DO 10 I = 1, M
+*
+*           IH holds the bits without the sign.
+*
+            IH = HA( I, J )
+            IF( IH.LT.0 )
+     $         IH = IH + 32768
+            IF( BF16 ) THEN
+               IB = INT( ISHFT( IH, 16 ), KIND=IK )
+               S = TRANSFER( IB, S )
+            ELSE
+               E = ISHFT( IH, -10 )
+               IF( E.EQ.0 ) THEN
+                  S = REAL( IH )*TWOM24
+               ELSE IF( E.EQ.31 ) THEN
+                  IB = INT( INFBIT + ISHFT( IAND( IH, 1023 ), 13 ),
+     $                      KIND=IK )
+                  S = TRANSFER( IB, S )
+               ELSE
+                  IB = INT( ISHFT( IH+114688, 13 ), KIND=IK )
+                  S = TRANSFER( IB, S )
+               END IF
+            END IF
+            IF( HA( I, J ).LT.0 ) THEN
+               SA( I, J ) = -S
+            ELSE
+               SA( I, J ) = S
+            END IF
+   10    CONTINUE
+   20 CONTINUE
+      INFO = 0
+      RETURN
+*
+*     End of HLAG2S
+*
+      END
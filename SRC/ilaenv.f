@@ -43,6 +43,12 @@
 *> the tuning parameters for their particular machine using the option
 *> and problem size information in the arguments.
 *>
+*> The parameters can also be set without recompiling, in the table
+*> of ILAENVTAB: if it has an entry (ISPEC, NAME), ILAENV returns its
+*> value.  The table is loaded from the file named by the environment
+*> variable LAPACK_ILAENV_FILE, such as a file written by the tuning
+*> program xilaenvtune.
+*>
 *> This routine will not function correctly if it is converted to all
 *> lower case.  Converting it to all upper case is allowed.
 *> \endverbatim
@@ -71,7 +77,9 @@
 *>               matrix to bidiagonal form, if max(m,n)/min(m,n) exceeds
 *>               this value, a QR factorization is used first to reduce
 *>               the matrix to a triangular form.)
-*>          = 7: the number of processors
+*>          = 7: the number of processors, i.e. the number of threads
+*>               available to the OpenMP code (see ILATHREADS); 1
+*>               unless LAPACK_NUM_THREADS is set
 *>          = 8: the crossover point for the multishift QR method
 *>               for nonsymmetric eigenvalue problems (DEPRECATED)
 *>          = 9: maximum size of the subproblems at the bottom of the
@@ -170,7 +178,7 @@
 *  =====================================================================
 *
 *     .. Local Scalars ..
-      INTEGER            I, IC, IZ, NB, NBMIN, NX
+      INTEGER            I, IC, INFO, IVAL, IZ, NB, NBMIN, NX
       LOGICAL            CNAME, SNAME, TWOSTAGE
       CHARACTER          C1*1, C2*2, C4*2, C3*3, SUBNAM*16
 *     ..
@@ -178,10 +186,23 @@
       INTRINSIC          CHAR, ICHAR, INT, MIN, REAL
 *     ..
 *     .. External Functions ..
-      INTEGER            IEEECK, IPARMQ, IPARAM2STAGE
-      EXTERNAL           IEEECK, IPARMQ, IPARAM2STAGE
+      INTEGER            IEEECK, ILATHREADS, IPARMQ,
+     $                   IPARAM2STAGE
+      EXTERNAL           IEEECK, ILATHREADS, IPARMQ,
+     $                   IPARAM2STAGE
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           ILAENVTAB
 *     ..
 *     .. Executable Statements ..
+*
+*     A value in the table of ILAENVTAB takes precedence
+*
+      CALL ILAENVTAB( 'G', ISPEC, NAME, IVAL, INFO )
+      IF( INFO.EQ.0 ) THEN
+         ILAENV = IVAL
+         RETURN
+      END IF
 *
       GO TO ( 10, 10, 10, 80, 90, 100, 110, 120,
      $        130, 140, 150, 160, 160, 160, 160, 160, 160)ISPEC
@@ -305,6 +326,9 @@
                      NB = 32768/N2
                   END IF
                END IF
+            ELSE IF( N3 .EQ. 3) THEN
+*     arity of the reduction tree of xLATSQR_TREE
+               NB = 2
             ELSE
                IF( SNAME ) THEN
                   NB = 1
@@ -692,9 +716,10 @@
 *
   110 CONTINUE
 *
-*     ISPEC = 7:  number of processors (not used)
+*     ISPEC = 7:  number of threads of the OpenMP code (used by xGETRF,
+*                 xPOTRF, xPOTRS and xPOTRI)
 *
-      ILAENV = 1
+      ILAENV = ILATHREADS( )
       RETURN
 *
   120 CONTINUE
@@ -46,6 +46,9 @@
 *> computers for the 2-stage solvers. Users are encouraged to modify this
 *> subroutine to set the tuning parameters for their particular machine using
 *> the option and problem size information in the arguments.
+*> The values of KD (ISPEC = 1) and IB (ISPEC = 2) can also be set
+*> without recompiling, as the entries 17 and 18 of the table of
+*> ILAENVTAB.
 *>
 *> This routine will not function correctly if it is converted to all
 *> lower case.  Converting it to all upper case is allowed.
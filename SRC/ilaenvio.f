@@ -0,0 +1,263 @@
+*> \brief \b ILAENVIO
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE ILAENVIO( JOB, FILE, MAXTAB, NTAB, TSPEC, TNAME,
+*                            TVAL, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          JOB
+*       CHARACTER*( * )    FILE
+*       INTEGER            INFO, MAXTAB, NTAB
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            TSPEC( * ), TVAL( * )
+*       CHARACTER*16       TNAME( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> ILAENVIO reads the entries of a table of tuning parameters from a
+*> file, or writes them to a file.  It is called by ILAENVTAB, which
+*> describes the format of the file.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] JOB
+*> \verbatim
+*>          JOB is CHARACTER*1
+*>          = 'L': add the entries of the file to the table, replacing
+*>                 the value of the entries already in it;
+*>          = 'W': write the table to the file.
+*> \endverbatim
+*>
+*> \param[in] FILE
+*> \verbatim
+*>          FILE is CHARACTER*(*)
+*>          The name of the file.
+*> \endverbatim
+*>
+*> \param[in] MAXTAB
+*> \verbatim
+*>          MAXTAB is INTEGER
+*>          The largest number of entries of the table.
+*> \endverbatim
+*>
+*> \param[in,out] NTAB
+*> \verbatim
+*>          NTAB is INTEGER
+*>          The number of entries of the table.
+*> \endverbatim
+*>
+*> \param[in,out] TSPEC
+*> \verbatim
+*>          TSPEC is INTEGER array, dimension (MAXTAB)
+*>          The ISPEC of the entries.
+*> \endverbatim
+*>
+*> \param[in,out] TNAME
+*> \verbatim
+*>          TNAME is CHARACTER*16 array, dimension (MAXTAB)
+*>          The routine names of the entries, in upper case.
+*> \endverbatim
+*>
+*> \param[in,out] TVAL
+*> \verbatim
+*>          TVAL is INTEGER array, dimension (MAXTAB)
+*>          The values of the entries.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0: successful exit
+*>          = 1: the file could not be opened.
+*>          = 2: JOB = 'L': the table is full; the rest of the file was
+*>               not read.
+*>          = 3: JOB = 'L': some lines of the file could not be read,
+*>               or were ISPEC = 1 entries of xGEQR or xGELQ, and were
+*>               skipped.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup ilaenv
+*
+*  =====================================================================
+      SUBROUTINE ILAENVIO( JOB, FILE, MAXTAB, NTAB, TSPEC, TNAME,
+     $                     TVAL, INFO )
+*
+*  -- LAPACK auxiliary routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          JOB
+      CHARACTER*( * )    FILE
+      INTEGER            INFO, MAXTAB, NTAB
+*     ..
+*     .. Array Arguments ..
+      INTEGER            TSPEC( * ), TVAL( * )
+      CHARACTER*16       TNAME( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Local Scalars ..
+      INTEGER            I, IC, IOS, K, KVAL, LUN
+      CHARACTER*16       KEY
+      CHARACTER*6        WORD
+      CHARACTER*132      LINE
+*     ..
+*     .. Local Arrays ..
+      CHARACTER*6        MNEM( 18 )
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      EXTERNAL           LSAME
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          ADJUSTL, CHAR, ICHAR, INDEX
+*     ..
+*     .. Data statements ..
+      DATA               MNEM / 'NB', 'NBMIN', 'NX', ' ', ' ', ' ',
+     $                   ' ', ' ', 'SMLSIZ', ' ', ' ', 'NMIN', 'NW',
+     $                   'NIBBLE', 'NS', 'KACC22', 'KD', 'IB' /
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      IF( LSAME( JOB, 'W' ) ) THEN
+         OPEN( NEWUNIT = LUN, FILE = FILE, STATUS = 'UNKNOWN',
+     $         ACTION = 'WRITE', IOSTAT = IOS )
+         IF( IOS.NE.0 ) THEN
+            INFO = 1
+            RETURN
+         END IF
+*
+*        Name the parameter if it has a name.  ISPEC = 17 is KD only
+*        for the 2-stage reductions.
+*
+         WRITE( LUN, FMT = 9999 )
+         DO 10 I = 1, NTAB
+            WORD = MNEM( TSPEC( I ) )
+            IF( TSPEC( I ).GE.17 .AND.
+     $          INDEX( TNAME( I ), '2STAGE' ).EQ.0 )WORD = ' '
+            IF( WORD.EQ.' ' ) THEN
+               WRITE( LUN, FMT = 9998 )TNAME( I ), TSPEC( I ),
+     $            TVAL( I )
+            ELSE
+               WRITE( LUN, FMT = 9997 )TNAME( I ), WORD, TVAL( I )
+            END IF
+   10    CONTINUE
+         CLOSE( LUN )
+         RETURN
+      END IF
+*
+      OPEN( NEWUNIT = LUN, FILE = FILE, STATUS = 'OLD',
+     $      ACTION = 'READ', IOSTAT = IOS )
+      IF( IOS.NE.0 ) THEN
+         INFO = 1
+         RETURN
+      END IF
+*
+*     Read the next line, until the end of the file
+*
+   20 CONTINUE
+      READ( LUN, FMT = '(A)', IOSTAT = IOS )LINE
+      IF( IOS.NE.0 )
+     $   GO TO 70
+      LINE = ADJUSTL( LINE )
+      IF( LINE.EQ.' ' .OR. LINE( 1: 1 ).EQ.'#' .OR.
+     $    LINE( 1: 1 ).EQ.'*' )GO TO 20
+      READ( LINE, FMT = *, IOSTAT = IOS )KEY, WORD, KVAL
+      IF( IOS.NE.0 ) THEN
+         INFO = 3
+         GO TO 20
+      END IF
+*
+*     Convert the name and the parameter to upper case
+*
+      DO 30 I = 1, 16
+         IC = ICHAR( KEY( I: I ) )
+         IF( IC.GE.97 .AND. IC.LE.122 )
+     $      KEY( I: I ) = CHAR( IC-32 )
+         IF( I.LE.6 ) THEN
+            IC = ICHAR( WORD( I: I ) )
+            IF( IC.GE.97 .AND. IC.LE.122 )
+     $         WORD( I: I ) = CHAR( IC-32 )
+         END IF
+   30 CONTINUE
+*
+*     The parameter is a name or an ISPEC
+*
+      K = 0
+      DO 40 I = 1, 18
+         IF( WORD.EQ.MNEM( I ) )
+     $      K = I
+   40 CONTINUE
+      IF( K.EQ.0 ) THEN
+         READ( WORD, FMT = *, IOSTAT = IOS )K
+         IF( IOS.NE.0 )
+     $      K = 0
+      END IF
+      IF( K.LT.1 .OR. K.GT.18 ) THEN
+         INFO = 3
+         GO TO 20
+      END IF
+*
+*     ILAENV uses N3 to choose the block sizes of xGEQR and xGELQ
+*
+      IF( K.EQ.1 .AND.
+     $    ( KEY( 2: ).EQ.'GEQR' .OR. KEY( 2: ).EQ.'GELQ' ) ) THEN
+         INFO = 3
+         GO TO 20
+      END IF
+*
+*     Set the entry (K, KEY), or add it at the end
+*
+      DO 50 I = 1, NTAB
+         IF( TSPEC( I ).EQ.K .AND. TNAME( I ).EQ.KEY )
+     $      GO TO 60
+   50 CONTINUE
+      IF( NTAB.EQ.MAXTAB ) THEN
+         INFO = 2
+         GO TO 70
+      END IF
+      NTAB = NTAB + 1
+      I = NTAB
+      TSPEC( I ) = K
+      TNAME( I ) = KEY
+   60 CONTINUE
+      TVAL( I ) = KVAL
+      GO TO 20
+*
+   70 CONTINUE
+      CLOSE( LUN )
+      RETURN
+*
+ 9999 FORMAT( '# LAPACK ILAENV table' )
+ 9998 FORMAT( A16, 1X, I6, 1X, I8 )
+ 9997 FORMAT( A16, 1X, A6, 1X, I8 )
+*
+*     End of ILAENVIO
+*
+      END
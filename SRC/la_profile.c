@@ -0,0 +1,399 @@
+/*
+ * la_profile.c
+ * Run time of the profiling hooks of LAPACK (see lapack_profile.h).
+ *
+ * With BUILD_PROFILE the computational routines of LAPACK are compiled
+ * with -finstrument-functions, so that the compiler calls
+ * __cyg_profile_func_enter and __cyg_profile_func_exit at the entry and
+ * at the exit of each of them, and the linker redirects their calls to
+ * the Level 2 and Level 3 BLAS to the wrappers of la_profile_blas.c.
+ * Both push the routine on a stack of active routines, kept per
+ * thread, from which the time of a routine is split into the time of
+ * the routines it calls and its own time.  The BLAS wrappers add the
+ * operations of each call to a counter of the thread; a routine is
+ * credited with the growth of this counter between its entry and its
+ * exit.  A routine called recursively only counts the time and the
+ * operations of its outermost call.
+ *
+ * With OpenMP, the BLAS calls of the tasks of a routine run on other
+ * threads.  The operations of the calls made in a parallel region are
+ * therefore also added to a counter shared by all the threads, and a
+ * routine entered outside of the parallel regions is credited with the
+ * operations of its own thread outside of them plus the growth of the
+ * shared counter.  If several threads of the program run LAPACK with
+ * parallel regions at the same time, each one is also credited with
+ * the operations of the regions of the others.
+ *
+ * The routines of LAPACK are identified by their address and named by
+ * dladdr when the counters are read.  The names of a static library
+ * are only found if the program exports its symbols (-rdynamic);
+ * otherwise, and for the routines without an exported symbol such as
+ * the OpenMP regions, the address is printed.
+ */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include "lapack_profile.h"
+#include "la_profile.h"
+
+#define LA_NOINST __attribute__((no_instrument_function))
+
+/* Number of routines (a power of 2) and depth of the stack of a thread */
+#define LA_TABSIZE  2048
+#define LA_MAXDEPTH 256
+
+typedef struct {
+   const void *key;     /* address of the routine, or name if BLAS */
+   const char *name;    /* name of a BLAS routine, NULL for LAPACK */
+   int active;          /* calls of the routine on the stack */
+   long long calls;
+   double time, self, flops;
+   long long hist[LAPACK_PROFILE_NBINS];
+} la_entry;
+
+typedef struct {
+   la_entry *entry;
+   double t0;           /* time at the entry */
+   double child;        /* time of the routines called */
+   double flops0;       /* operations of the thread at the entry */
+   double pflops0;      /* operations of the parallel regions then */
+   int par;             /* entered in a parallel region */
+} la_frame;
+
+typedef struct la_table {
+   struct la_table *next;
+   int depth;
+   int inblas;
+   double flops;        /* operations of the BLAS calls of the thread */
+   double sflops;       /* the same outside of the parallel regions */
+   la_frame stack[LA_MAXDEPTH];
+   la_entry ent[LA_TABSIZE];
+} la_table;
+
+typedef struct {
+   const void *key;
+   lapack_profile_entry e;
+} la_sum_entry;
+
+static __thread la_table *la_tab = NULL;
+static la_table *la_tables = NULL;
+static pthread_mutex_t la_lock = PTHREAD_MUTEX_INITIALIZER;
+static la_sum_entry *la_sum = NULL;
+static int la_nsum = 0;
+static double la_par_flops = 0.0;   /* operations in parallel regions */
+
+static LA_NOINST void la_dump_at_exit( void )
+{
+   const char *out = getenv( "LAPACK_PROFILE_OUTPUT" );
+
+   if( out != NULL && out[0] != '\0' )
+      lapack_profile_dump( out );
+}
+
+/* Table of the calling thread, created at its first call */
+static LA_NOINST la_table *la_thread_table( void )
+{
+   la_table *t = la_tab;
+
+   if( t == NULL ) {
+      t = (la_table *) calloc( 1, sizeof( la_table ) );
+      if( t == NULL ) return NULL;
+      pthread_mutex_lock( &la_lock );
+      if( la_tables == NULL ) atexit( la_dump_at_exit );
+      t->next = la_tables;
+      la_tables = t;
+      pthread_mutex_unlock( &la_lock );
+      la_tab = t;
+   }
+   return t;
+}
+
+/* 1 if the thread runs in an OpenMP parallel region */
+static LA_NOINST int la_in_parallel( void )
+{
+#ifdef _OPENMP
+   return omp_in_parallel();
+#else
+   return 0;
+#endif
+}
+
+static LA_NOINST double la_par_read( void )
+{
+   double v;
+
+#ifdef _OPENMP
+   #pragma omp atomic read
+#endif
+   v = la_par_flops;
+   return v;
+}
+
+static LA_NOINST double la_now( void )
+{
+   struct timespec ts;
+
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (double) ts.tv_sec + 1.0e-9 * (double) ts.tv_nsec;
+}
+
+/* Entry of the routine key, added if it is new; NULL if the table is full */
+static LA_NOINST la_entry *la_lookup( la_table *t, const void *key,
+                                      const char *name )
+{
+   size_t i = (size_t) ( ( (uintptr_t) key >> 3 ) * 2654435761u );
+   int n;
+
+   for( n = 0; n < LA_TABSIZE; n++ ) {
+      la_entry *e = &t->ent[i & ( LA_TABSIZE - 1 )];
+      if( e->key == key ) return e;
+      if( e->key == NULL ) {
+         e->key = key;
+         e->name = name;
+         return e;
+      }
+      i++;
+   }
+   return NULL;
+}
+
+static LA_NOINST void la_push( la_table *t, la_entry *e )
+{
+   if( t->depth < LA_MAXDEPTH ) {
+      la_frame *f = &t->stack[t->depth];
+      f->entry = e;
+      f->child = 0.0;
+      f->par = la_in_parallel();
+      f->flops0 = f->par ? t->flops : t->sflops;
+      f->pflops0 = f->par ? 0.0 : la_par_read();
+      if( e != NULL ) e->active++;
+      f->t0 = la_now();
+   }
+   t->depth++;
+}
+
+static LA_NOINST void la_pop( la_table *t )
+{
+   la_frame *f;
+   la_entry *e;
+   double dt;
+
+   if( t->depth <= 0 ) return;
+   t->depth--;
+   if( t->depth >= LA_MAXDEPTH ) return;
+   f = &t->stack[t->depth];
+   dt = la_now() - f->t0;
+   if( t->depth > 0 ) t->stack[t->depth - 1].child += dt;
+   e = f->entry;
+   if( e == NULL ) return;
+   e->calls++;
+   e->self += dt - f->child;
+   if( --e->active == 0 ) {
+      e->time += dt;
+      if( f->par )
+         e->flops += t->flops - f->flops0;
+      else
+         e->flops += t->sflops - f->flops0 + la_par_read() - f->pflops0;
+   }
+}
+
+LA_NOINST void __cyg_profile_func_enter( void *fn, void *site )
+{
+   la_table *t = la_thread_table();
+
+   (void) site;
+   if( t == NULL ) return;
+   la_push( t, t->depth < LA_MAXDEPTH ? la_lookup( t, fn, NULL ) : NULL );
+}
+
+LA_NOINST void __cyg_profile_func_exit( void *fn, void *site )
+{
+   (void) fn;
+   (void) site;
+   if( la_tab != NULL ) la_pop( la_tab );
+}
+
+int la_profile_blas_enter( const char *name, int64_t dim, double flops )
+{
+   la_table *t = la_thread_table();
+   la_entry *e;
+   int b;
+
+   if( t == NULL || t->inblas ) return 0;
+   e = t->depth < LA_MAXDEPTH ? la_lookup( t, name, name ) : NULL;
+   la_push( t, e );
+   t->flops += flops;
+   if( la_in_parallel() ) {
+#ifdef _OPENMP
+      #pragma omp atomic
+#endif
+      la_par_flops += flops;
+   } else {
+      t->sflops += flops;
+   }
+   t->inblas = 1;
+   if( e != NULL ) {
+      for( b = 0; dim > 0 && b < LAPACK_PROFILE_NBINS - 1; b++ )
+         dim >>= 1;
+      e->hist[b]++;
+   }
+   return 1;
+}
+
+void la_profile_blas_exit( void )
+{
+   la_tab->inblas = 0;
+   la_pop( la_tab );
+}
+
+/* Name of the routine of e, without the trailing underscore */
+static LA_NOINST void la_name( const la_entry *e, char *name )
+{
+   Dl_info info;
+   size_t n;
+
+   if( e->name != NULL ) {
+      snprintf( name, LAPACK_PROFILE_NAMELEN, "%s", e->name );
+   } else if( dladdr( e->key, &info ) != 0 && info.dli_sname != NULL &&
+              info.dli_saddr == e->key ) {
+      snprintf( name, LAPACK_PROFILE_NAMELEN, "%s", info.dli_sname );
+      n = strlen( name );
+      if( n > 1 && name[n - 1] == '_' ) name[n - 1] = '\0';
+   } else {
+      snprintf( name, LAPACK_PROFILE_NAMELEN, "%p", e->key );
+   }
+}
+
+static LA_NOINST int la_compare( const void *a, const void *b )
+{
+   double ta = ( (const la_sum_entry *) a )->e.time;
+   double tb = ( (const la_sum_entry *) b )->e.time;
+
+   return ( ta < tb ) - ( ta > tb );
+}
+
+void lapack_profile_reset( void )
+{
+   la_table *t;
+   int i;
+
+   pthread_mutex_lock( &la_lock );
+   for( t = la_tables; t != NULL; t = t->next ) {
+      for( i = 0; i < LA_TABSIZE; i++ ) {
+         la_entry *e = &t->ent[i];
+         e->calls = 0;
+         e->time = e->self = e->flops = 0.0;
+         memset( e->hist, 0, sizeof( e->hist ) );
+      }
+   }
+   pthread_mutex_unlock( &la_lock );
+}
+
+int lapack_profile_count( void )
+{
+   la_table *t;
+   int i, j, k, n = 0;
+
+   pthread_mutex_lock( &la_lock );
+   for( t = la_tables; t != NULL; t = t->next ) n += LA_TABSIZE;
+   free( la_sum );
+   la_nsum = 0;
+   la_sum = (la_sum_entry *) malloc( ( n > 0 ? n : 1 ) *
+                                     sizeof( la_sum_entry ) );
+   if( la_sum == NULL ) {
+      pthread_mutex_unlock( &la_lock );
+      return 0;
+   }
+   for( t = la_tables; t != NULL; t = t->next ) {
+      for( i = 0; i < LA_TABSIZE; i++ ) {
+         const la_entry *e = &t->ent[i];
+         lapack_profile_entry *s;
+         if( e->key == NULL || e->calls == 0 ) continue;
+         for( j = 0; j < la_nsum && la_sum[j].key != e->key; j++ )
+            ;
+         s = &la_sum[j].e;
+         if( j == la_nsum ) {
+            la_nsum++;
+            la_sum[j].key = e->key;
+            memset( s, 0, sizeof( *s ) );
+            la_name( e, s->name );
+            s->blas = e->name != NULL;
+         }
+         s->calls += e->calls;
+         s->time += e->time;
+         s->self_time += e->self;
+         s->flops += e->flops;
+         for( k = 0; k < LAPACK_PROFILE_NBINS; k++ )
+            s->hist[k] += e->hist[k];
+      }
+   }
+   qsort( la_sum, la_nsum, sizeof( la_sum_entry ), la_compare );
+   pthread_mutex_unlock( &la_lock );
+   return la_nsum;
+}
+
+int lapack_profile_get( int i, lapack_profile_entry *e )
+{
+   if( i < 0 || i >= la_nsum ) return 1;
+   *e = la_sum[i].e;
+   return 0;
+}
+
+int lapack_profile_find( const char *name, lapack_profile_entry *e )
+{
+   int i, n = lapack_profile_count();
+
+   for( i = 0; i < n; i++ ) {
+      if( strcasecmp( la_sum[i].e.name, name ) == 0 ) {
+         *e = la_sum[i].e;
+         return 0;
+      }
+   }
+   return 1;
+}
+
+int lapack_profile_dump( const char *name )
+{
+   FILE *f = stderr;
+   int i, b, n;
+
+   if( name != NULL && strcmp( name, "-" ) != 0 ) {
+      f = fopen( name, "w" );
+      if( f == NULL ) return 1;
+   }
+   n = lapack_profile_count();
+   fprintf( f, "LAPACK profile: %d routines\n", n );
+   fprintf( f, "%-24s %12s %12s %12s %12s %10s\n", "Routine", "Calls",
+            "Time (s)", "Self (s)", "GFLOP", "GFLOP/s" );
+   for( i = 0; i < n; i++ ) {
+      const lapack_profile_entry *e = &la_sum[i].e;
+      fprintf( f, "%-24s %12lld %12.4e %12.4e %12.4e %10.3f\n", e->name,
+               e->calls, e->time, e->self_time, e->flops * 1.0e-9,
+               e->time > 0.0 ? e->flops * 1.0e-9 / e->time : 0.0 );
+      if( !e->blas ) continue;
+      fprintf( f, "%-24s", "  largest dimension" );
+      for( b = 0; b < LAPACK_PROFILE_NBINS; b++ ) {
+         if( e->hist[b] == 0 ) continue;
+         if( b <= 1 )
+            fprintf( f, " %d:%lld", b, e->hist[b] );
+         else if( b == LAPACK_PROFILE_NBINS - 1 )
+            fprintf( f, " >=%lld:%lld", 1LL << ( b - 1 ), e->hist[b] );
+         else
+            fprintf( f, " %lld-%lld:%lld", 1LL << ( b - 1 ),
+                     ( 1LL << b ) - 1, e->hist[b] );
+      }
+      fprintf( f, "\n" );
+   }
+   if( f != stderr ) fclose( f );
+   return 0;
+}
@@ -0,0 +1,22 @@
+/*
+ * la_profile.h
+ * Interface between the BLAS wrappers of la_profile_blas.c and the
+ * profiling run time of la_profile.c.
+ */
+
+#ifndef LA_PROFILE_H
+#define LA_PROFILE_H
+
+#include <stdint.h>
+
+/*
+ * Called by the wrapper of the BLAS routine name before the call:
+ * dim is the largest dimension of the call and flops its number of
+ * operations.  Returns 1 if the call is recorded, in which case
+ * la_profile_blas_exit must be called after it, and 0 if it is not
+ * (a BLAS routine called from another one).
+ */
+int la_profile_blas_enter( const char *name, int64_t dim, double flops );
+void la_profile_blas_exit( void );
+
+#endif
@@ -0,0 +1,188 @@
+/*
+ * la_profile_blas.c
+ * Wrappers of the Level 2 and Level 3 BLAS for the profiling hooks of
+ * LAPACK (see la_profile.c).
+ *
+ * LAPACK is linked with --wrap=<routine> for each routine below, so
+ * that its calls to dgemm_ go to __wrap_dgemm_, which records the call
+ * and calls the BLAS routine as __real_dgemm_.  The number of
+ * operations is the usual count of the routine: 2*m*n*k for xGEMM,
+ * m*m*n for xTRSM with SIDE = 'L', and so on, times 4 for the complex
+ * routines.  The Level 1 BLAS are not wrapped: their time is part of
+ * the self time of their caller.
+ *
+ * When LA_PROFILE_API64 is defined this file provides the wrappers of
+ * the _64 routines called by the _64 API of LAPACK.  The routines of a
+ * precision that is not built are left out by defining
+ * LA_PROFILE_NO_SINGLE, LA_PROFILE_NO_DOUBLE, LA_PROFILE_NO_COMPLEX or
+ * LA_PROFILE_NO_COMPLEX16.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include "la_profile.h"
+
+#ifdef LA_PROFILE_API64
+   #define LA_INT      int64_t
+   #define LA_WRAP(n)  __wrap_##n##_64_
+   #define LA_REAL(n)  __real_##n##_64_
+   #define LA_NAME(n)  #n "_64"
+#else
+   #if defined(LAPACK_ILP64) || defined(WeirdNEC)
+      #define LA_INT   int64_t
+   #else
+      #define LA_INT   int32_t
+   #endif
+   #define LA_WRAP(n)  __wrap_##n##_
+   #define LA_REAL(n)  __real_##n##_
+   #define LA_NAME(n)  #n
+#endif
+
+#define D(x)     ( (double) *(x) )
+#define LEFT(s)  ( *(s) == 'L' || *(s) == 'l' )
+
+static int64_t la_max( LA_INT a, LA_INT b )
+{
+   return a > b ? a : b;
+}
+
+/*
+ * Defines the wrapper of the routine r with the arguments ARGS, passed
+ * on as CALL; dim is the largest dimension and flops the number of
+ * operations of the call.
+ */
+#define LA_PROFILE_WRAP(r, ARGS, CALL, dim, flops) \
+   void LA_REAL(r)( ARGS ); \
+   void LA_WRAP(r)( ARGS ); \
+   void LA_WRAP(r)( ARGS ) \
+   { \
+      int on = la_profile_blas_enter( LA_NAME(r), (dim), (flops) ); \
+      LA_REAL(r) CALL; \
+      if( on ) la_profile_blas_exit(); \
+   }
+
+/* Level 3 */
+
+#define GEMM_ARGS const char *ta, const char *tb, const LA_INT *m, \
+   const LA_INT *n, const LA_INT *k, const void *alpha, const void *a, \
+   const LA_INT *lda, const void *b, const LA_INT *ldb, const void *beta, \
+   void *c, const LA_INT *ldc, size_t lta, size_t ltb
+#define GEMM_CALL ( ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, \
+   lta, ltb )
+#define GEMM(r, cf) LA_PROFILE_WRAP(r, GEMM_ARGS, GEMM_CALL, \
+   la_max( la_max( *m, *n ), *k ), cf * 2.0 * D(m) * D(n) * D(k))
+
+#define GEMMTR_ARGS const char *uplo, const char *ta, const char *tb, \
+   const LA_INT *n, const LA_INT *k, const void *alpha, const void *a, \
+   const LA_INT *lda, const void *b, const LA_INT *ldb, const void *beta, \
+   void *c, const LA_INT *ldc, size_t luplo, size_t lta, size_t ltb
+#define GEMMTR_CALL ( uplo, ta, tb, n, k, alpha, a, lda, b, ldb, beta, c, \
+   ldc, luplo, lta, ltb )
+#define GEMMTR(r, cf) LA_PROFILE_WRAP(r, GEMMTR_ARGS, GEMMTR_CALL, \
+   la_max( *n, *k ), cf * D(n) * D(n) * D(k))
+
+#define SYMM_ARGS const char *side, const char *uplo, const LA_INT *m, \
+   const LA_INT *n, const void *alpha, const void *a, const LA_INT *lda, \
+   const void *b, const LA_INT *ldb, const void *beta, void *c, \
+   const LA_INT *ldc, size_t lside, size_t luplo
+#define SYMM_CALL ( side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc, \
+   lside, luplo )
+#define SYMM(r, cf) LA_PROFILE_WRAP(r, SYMM_ARGS, SYMM_CALL, \
+   la_max( *m, *n ), cf * 2.0 * D(m) * D(n) * ( LEFT(side) ? D(m) : D(n) ))
+
+#define SYRK_ARGS const char *uplo, const char *trans, const LA_INT *n, \
+   const LA_INT *k, const void *alpha, const void *a, const LA_INT *lda, \
+   const void *beta, void *c, const LA_INT *ldc, size_t luplo, \
+   size_t ltrans
+#define SYRK_CALL ( uplo, trans, n, k, alpha, a, lda, beta, c, ldc, luplo, \
+   ltrans )
+#define SYRK(r, cf) LA_PROFILE_WRAP(r, SYRK_ARGS, SYRK_CALL, \
+   la_max( *n, *k ), cf * D(n) * D(n) * D(k))
+
+#define SYR2K_ARGS const char *uplo, const char *trans, const LA_INT *n, \
+   const LA_INT *k, const void *alpha, const void *a, const LA_INT *lda, \
+   const void *b, const LA_INT *ldb, const void *beta, void *c, \
+   const LA_INT *ldc, size_t luplo, size_t ltrans
+#define SYR2K_CALL ( uplo, trans, n, k, alpha, a, lda, b, ldb, beta, c, \
+   ldc, luplo, ltrans )
+#define SYR2K(r, cf) LA_PROFILE_WRAP(r, SYR2K_ARGS, SYR2K_CALL, \
+   la_max( *n, *k ), cf * 2.0 * D(n) * D(n) * D(k))
+
+#define TRMM_ARGS const char *side, const char *uplo, const char *transa, \
+   const char *diag, const LA_INT *m, const LA_INT *n, const void *alpha, \
+   const void *a, const LA_INT *lda, void *b, const LA_INT *ldb, \
+   size_t lside, size_t luplo, size_t ltransa, size_t ldiag
+#define TRMM_CALL ( side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb, \
+   lside, luplo, ltransa, ldiag )
+#define TRMM(r, cf) LA_PROFILE_WRAP(r, TRMM_ARGS, TRMM_CALL, \
+   la_max( *m, *n ), cf * D(m) * D(n) * ( LEFT(side) ? D(m) : D(n) ))
+
+/* Level 2 */
+
+#define GEMV_ARGS const char *trans, const LA_INT *m, const LA_INT *n, \
+   const void *alpha, const void *a, const LA_INT *lda, const void *x, \
+   const LA_INT *incx, const void *beta, void *y, const LA_INT *incy, \
+   size_t ltrans
+#define GEMV_CALL ( trans, m, n, alpha, a, lda, x, incx, beta, y, incy, \
+   ltrans )
+#define GEMV(r, cf) LA_PROFILE_WRAP(r, GEMV_ARGS, GEMV_CALL, \
+   la_max( *m, *n ), cf * 2.0 * D(m) * D(n))
+
+#define GER_ARGS const LA_INT *m, const LA_INT *n, const void *alpha, \
+   const void *x, const LA_INT *incx, const void *y, const LA_INT *incy, \
+   void *a, const LA_INT *lda
+#define GER_CALL ( m, n, alpha, x, incx, y, incy, a, lda )
+#define GER(r, cf) LA_PROFILE_WRAP(r, GER_ARGS, GER_CALL, \
+   la_max( *m, *n ), cf * 2.0 * D(m) * D(n))
+
+#define SYMV_ARGS const char *uplo, const LA_INT *n, const void *alpha, \
+   const void *a, const LA_INT *lda, const void *x, const LA_INT *incx, \
+   const void *beta, void *y, const LA_INT *incy, size_t luplo
+#define SYMV_CALL ( uplo, n, alpha, a, lda, x, incx, beta, y, incy, luplo )
+#define SYMV(r, cf) LA_PROFILE_WRAP(r, SYMV_ARGS, SYMV_CALL, \
+   *n, cf * 2.0 * D(n) * D(n))
+
+#define SYR2_ARGS const char *uplo, const LA_INT *n, const void *alpha, \
+   const void *x, const LA_INT *incx, const void *y, const LA_INT *incy, \
+   void *a, const LA_INT *lda, size_t luplo
+#define SYR2_CALL ( uplo, n, alpha, x, incx, y, incy, a, lda, luplo )
+#define SYR2(r, cf) LA_PROFILE_WRAP(r, SYR2_ARGS, SYR2_CALL, \
+   *n, cf * 2.0 * D(n) * D(n))
+
+#define TRMV_ARGS const char *uplo, const char *trans, const char *diag, \
+   const LA_INT *n, const void *a, const LA_INT *lda, void *x, \
+   const LA_INT *incx, size_t luplo, size_t ltrans, size_t ldiag
+#define TRMV_CALL ( uplo, trans, diag, n, a, lda, x, incx, luplo, ltrans, \
+   ldiag )
+#define TRMV(r, cf) LA_PROFILE_WRAP(r, TRMV_ARGS, TRMV_CALL, \
+   *n, cf * D(n) * D(n))
+
+/* The wrappers */
+
+#define LA_PROFILE_REAL(p) \
+   GEMM(p##gemm, 1.0) GEMMTR(p##gemmtr, 1.0) SYMM(p##symm, 1.0) \
+   SYRK(p##syrk, 1.0) SYR2K(p##syr2k, 1.0) TRMM(p##trmm, 1.0) \
+   TRMM(p##trsm, 1.0) GEMV(p##gemv, 1.0) GER(p##ger, 1.0) \
+   SYMV(p##symv, 1.0) SYR2(p##syr2, 1.0) TRMV(p##trmv, 1.0) \
+   TRMV(p##trsv, 1.0)
+
+#define LA_PROFILE_COMPLEX(p) \
+   GEMM(p##gemm, 4.0) GEMMTR(p##gemmtr, 4.0) SYMM(p##symm, 4.0) \
+   SYMM(p##hemm, 4.0) SYRK(p##syrk, 4.0) SYRK(p##herk, 4.0) \
+   SYR2K(p##syr2k, 4.0) SYR2K(p##her2k, 4.0) TRMM(p##trmm, 4.0) \
+   TRMM(p##trsm, 4.0) GEMV(p##gemv, 4.0) GER(p##geru, 4.0) \
+   GER(p##gerc, 4.0) SYMV(p##hemv, 4.0) SYR2(p##her2, 4.0) \
+   TRMV(p##trmv, 4.0) TRMV(p##trsv, 4.0)
+
+#ifndef LA_PROFILE_NO_SINGLE
+LA_PROFILE_REAL(s)
+#endif
+#ifndef LA_PROFILE_NO_DOUBLE
+LA_PROFILE_REAL(d)
+#endif
+#ifndef LA_PROFILE_NO_COMPLEX
+LA_PROFILE_COMPLEX(c)
+#endif
+#ifndef LA_PROFILE_NO_COMPLEX16
+LA_PROFILE_COMPLEX(z)
+#endif
@@ -22,6 +22,7 @@
 #define CCOPY CCOPY_64
 #define CDOTC CDOTC_64
 #define CDOTU CDOTU_64
+#define CGB2BD_KERNELS CGB2BD_KERNELS_64
 #define CGBBRD CGBBRD_64
 #define CGBCON CGBCON_64
 #define CGBEQU CGBEQU_64
@@ -39,6 +40,9 @@
 #define CGEBAL CGEBAL_64
 #define CGEBD2 CGEBD2_64
 #define CGEBRD CGEBRD_64
+#define CGEBRD_2STAGE CGEBRD_2STAGE_64
+#define CGEBRD_GB2BD CGEBRD_GB2BD_64
+#define CGEBRD_GE2GB CGEBRD_GE2GB_64
 #define CGECON CGECON_64
 #define CGEDMD CGEDMD_64
 #define CGEDMDQ CGEDMDQ_64
@@ -95,8 +99,10 @@
 #define CGERU CGERU_64
 #define CGESC2 CGESC2_64
 #define CGESDD CGESDD_64
+#define CGESDD_2STAGE CGESDD_2STAGE_64
 #define CGESV CGESV_64
 #define CGESVD CGESVD_64
+#define CGESVD_2STAGE CGESVD_2STAGE_64
 #define CGESVDQ CGESVDQ_64
 #define CGESVDX CGESVDX_64
 #define CGESVJ CGESVJ_64
@@ -107,6 +113,7 @@
 #define CGETRF CGETRF_64
 #define CGETRF  CGETRF_64
 #define CGETRF2 CGETRF2_64
+#define CGETRF_TASK CGETRF_TASK_64
 #define CGETRI CGETRI_64
 #define CGETRS CGETRS_64
 #define CGETSLS CGETSLS_64
@@ -280,6 +287,7 @@
 #define CLALSD CLALSD_64
 #define CLAMSWLQ CLAMSWLQ_64
 #define CLAMTSQR CLAMTSQR_64
+#define CLAMTSQR_TREE CLAMTSQR_TREE_64
 #define CLANGB CLANGB_64
 #define CLANGE CLANGE_64
 #define CLANGT CLANGT_64
@@ -315,8 +323,10 @@
 #define CLAQR1 CLAQR1_64
 #define CLAQR2 CLAQR2_64
 #define CLAQR3 CLAQR3_64
+#define CLAQR3_TASK CLAQR3_TASK_64
 #define CLAQR4 CLAQR4_64
 #define CLAQR5 CLAQR5_64
+#define CLAQR5_TASK CLAQR5_TASK_64
 #define CLAQSB CLAQSB_64
 #define CLAQSP CLAQSP_64
 #define CLAQSY CLAQSY_64
@@ -370,6 +380,7 @@
 #define CLATRS3 CLATRS3_64
 #define CLATRZ CLATRZ_64
 #define CLATSQR CLATSQR_64
+#define CLATSQR_TREE CLATSQR_TREE_64
 #define CLATZM CLATZM_64
 #define CLAUNHR_COL_GETRFNP CLAUNHR_COL_GETRFNP_64
 #define CLAUNHR_COL_GETRFNP2 CLAUNHR_COL_GETRFNP2_64
@@ -400,8 +411,11 @@
 #define CPOTRF CPOTRF_64
 #define CPOTRF  CPOTRF_64
 #define CPOTRF2 CPOTRF2_64
+#define CPOTRF_TASK CPOTRF_TASK_64
 #define CPOTRI CPOTRI_64
+#define CPOTRI_TASK CPOTRI_TASK_64
 #define CPOTRS CPOTRS_64
+#define CPOTRS_TASK CPOTRS_TASK_64
 #define CPPCON CPPCON_64
 #define CPPEQU CPPEQU_64
 #define CPPRFS CPPRFS_64
@@ -525,6 +539,7 @@
 #define CTRSV CTRSV_64
 #define CTRSYL CTRSYL_64
 #define CTRSYL3 CTRSYL3_64
+#define CTRSYL3_TASK CTRSYL3_TASK_64
 #define CTRTI2 CTRTI2_64
 #define CTRTRI CTRTRI_64
 #define CTRTRS CTRTRS_64
@@ -580,6 +595,7 @@
 #define DCOPY DCOPY_64
 #define DDISNA DDISNA_64
 #define DDOT DDOT_64
+#define DGB2BD_KERNELS DGB2BD_KERNELS_64
 #define DGBBRD DGBBRD_64
 #define DGBCON DGBCON_64
 #define DGBEQU DGBEQU_64
@@ -597,6 +613,9 @@
 #define DGEBAL DGEBAL_64
 #define DGEBD2 DGEBD2_64
 #define DGEBRD DGEBRD_64
+#define DGEBRD_2STAGE DGEBRD_2STAGE_64
+#define DGEBRD_GB2BD DGEBRD_GB2BD_64
+#define DGEBRD_GE2GB DGEBRD_GE2GB_64
 #define DGECON DGECON_64
 #define DGEDMD DGEDMD_64
 #define DGEDMD  DGEDMD_64
@@ -653,8 +672,10 @@
 #define DGERQF DGERQF_64
 #define DGESC2 DGESC2_64
 #define DGESDD DGESDD_64
+#define DGESDD_2STAGE DGESDD_2STAGE_64
 #define DGESV DGESV_64
 #define DGESVD DGESVD_64
+#define DGESVD_2STAGE DGESVD_2STAGE_64
 #define DGESVDQ DGESVDQ_64
 #define DGESVDX DGESVDX_64
 #define DGESVJ DGESVJ_64
@@ -665,6 +686,7 @@
 #define DGETRF DGETRF_64
 #define DGETRF  DGETRF_64
 #define DGETRF2 DGETRF2_64
+#define DGETRF_TASK DGETRF_TASK_64
 #define DGETRI DGETRI_64
 #define DGETRS DGETRS_64
 #define DGETSLS DGETSLS_64
@@ -687,6 +709,7 @@
 #define DGGSVD3 DGGSVD3_64
 #define DGGSVP DGGSVP_64
 #define DGGSVP3 DGGSVP3_64
+#define DGMRIR DGMRIR_64
 #define DGSVJ0 DGSVJ0_64
 #define DGSVJ1 DGSVJ1_64
 #define DGTCON DGTCON_64
@@ -697,7 +720,9 @@
 #define DGTTRS DGTTRS_64
 #define DGTTS2 DGTTS2_64
 #define DHGEQZ DHGEQZ_64
+#define DHGESV DHGESV_64
 #define DHSEIN DHSEIN_64
+#define DHPOSV DHPOSV_64
 #define DHSEQR DHSEQR_64
 #define DISNAN DISNAN_64
 #define DLABAD DLABAD_64
@@ -711,9 +736,11 @@
 #define DLAE2 DLAE2_64
 #define DLAEBZ DLAEBZ_64
 #define DLAED0 DLAED0_64
+#define DLAED0_TASK DLAED0_TASK_64
 #define DLAED1 DLAED1_64
 #define DLAED2 DLAED2_64
 #define DLAED3 DLAED3_64
+#define DLAED3_TASK DLAED3_TASK_64
 #define DLAED4 DLAED4_64
 #define DLAED5 DLAED5_64
 #define DLAED6 DLAED6_64
@@ -754,6 +781,7 @@
 #define DLAMRG DLAMRG_64
 #define DLAMSWLQ DLAMSWLQ_64
 #define DLAMTSQR DLAMTSQR_64
+#define DLAMTSQR_TREE DLAMTSQR_TREE_64
 #define DLANEG DLANEG_64
 #define DLANGB DLANGB_64
 #define DLANGE DLANGE_64
@@ -788,8 +816,10 @@
 #define DLAQR1 DLAQR1_64
 #define DLAQR2 DLAQR2_64
 #define DLAQR3 DLAQR3_64
+#define DLAQR3_TASK DLAQR3_TASK_64
 #define DLAQR4 DLAQR4_64
 #define DLAQR5 DLAQR5_64
+#define DLAQR5_TASK DLAQR5_TASK_64
 #define DLAQSB DLAQSB_64
 #define DLAQSP DLAQSP_64
 #define DLAQSY DLAQSY_64
@@ -816,6 +846,7 @@
 #define DLARNV DLARNV_64
 #define DLARRA DLARRA_64
 #define DLARRB DLARRB_64
+#define DLARRB_TASK DLARRB_TASK_64
 #define DLARRC DLARRC_64
 #define DLARRD DLARRD_64
 #define DLARRE DLARRE_64
@@ -824,6 +855,7 @@
 #define DLARRK DLARRK_64
 #define DLARRR DLARRR_64
 #define DLARRV DLARRV_64
+#define DLARRV_TASK DLARRV_TASK_64
 #define DLARSCL2  DLARSCL2_64
 #define DLARTG DLARTG_64
 #define DLARTGP DLARTGP_64
@@ -837,9 +869,11 @@
 #define DLASCL DLASCL_64
 #define DLASCL2  DLASCL2_64
 #define DLASD0 DLASD0_64
+#define DLASD0_TASK DLASD0_TASK_64
 #define DLASD1 DLASD1_64
 #define DLASD2 DLASD2_64
 #define DLASD3 DLASD3_64
+#define DLASD3_TASK DLASD3_TASK_64
 #define DLASD4 DLASD4_64
 #define DLASD5 DLASD5_64
 #define DLASD6 DLASD6_64
@@ -879,6 +913,7 @@
 #define DLATRS3 DLATRS3_64
 #define DLATRZ DLATRZ_64
 #define DLATSQR DLATSQR_64
+#define DLATSQR_TREE DLATSQR_TREE_64
 #define DLATZM DLATZM_64
 #define DLAUU2 DLAUU2_64
 #define DLAUUM DLAUUM_64
@@ -947,8 +982,11 @@
 #define DPOTRF DPOTRF_64
 #define DPOTRF  DPOTRF_64
 #define DPOTRF2 DPOTRF2_64
+#define DPOTRF_TASK DPOTRF_TASK_64
 #define DPOTRI DPOTRI_64
+#define DPOTRI_TASK DPOTRI_TASK_64
 #define DPOTRS DPOTRS_64
+#define DPOTRS_TASK DPOTRS_TASK_64
 #define DPPCON DPPCON_64
 #define DPPEQU DPPEQU_64
 #define DPPRFS DPPRFS_64
@@ -988,6 +1026,7 @@
 #define DSECND DSECND_64
 #define DSFRK DSFRK_64
 #define DSGESV DSGESV_64
+#define DSGESV_GMRES DSGESV_GMRES_64
 #define DSPCON DSPCON_64
 #define DSPEV DSPEV_64
 #define DSPEVD DSPEVD_64
@@ -998,6 +1037,7 @@
 #define DSPGVX DSPGVX_64
 #define DSPMV DSPMV_64
 #define DSPOSV DSPOSV_64
+#define DSPOSV_GMRES DSPOSV_GMRES_64
 #define DSPR DSPR_64
 #define DSPR2 DSPR2_64
 #define DSPRFS DSPRFS_64
@@ -1126,6 +1166,7 @@
 #define DTRSV DTRSV_64
 #define DTRSYL DTRSYL_64
 #define DTRSYL3 DTRSYL3_64
+#define DTRSYL3_TASK DTRSYL3_TASK_64
 #define DTRTI2 DTRTI2_64
 #define DTRTRI DTRTRI_64
 #define DTRTRS DTRTRS_64
@@ -1136,6 +1177,7 @@
 #define DZASUM DZASUM_64
 #define DZNRM2 DZNRM2_64
 #define DZSUM1 DZSUM1_64
+#define HLAG2S HLAG2S_64
 #define ICAMAX ICAMAX_64
 #define ICMAX1 ICMAX1_64
 #define IDAMAX IDAMAX_64
@@ -1146,7 +1188,10 @@
 #define ILADLC ILADLC_64
 #define ILADLR ILADLR_64
 #define ILAENV ILAENV_64
+#define ILATHREADS ILATHREADS_64
 #define ILAENV2STAGE ILAENV2STAGE_64
+#define ILAENVIO ILAENVIO_64
+#define ILAENVTAB ILAENVTAB_64
 #define ILAPREC ILAPREC_64
 #define ILASLC ILASLC_64
 #define ILASLR ILASLR_64
@@ -1175,6 +1220,7 @@
 #define SDISNA SDISNA_64
 #define SDOT SDOT_64
 #define SECOND SECOND_64
+#define SGB2BD_KERNELS SGB2BD_KERNELS_64
 #define SGBBRD SGBBRD_64
 #define SGBCON SGBCON_64
 #define SGBEQU SGBEQU_64
@@ -1192,6 +1238,9 @@
 #define SGEBAL SGEBAL_64
 #define SGEBD2 SGEBD2_64
 #define SGEBRD SGEBRD_64
+#define SGEBRD_2STAGE SGEBRD_2STAGE_64
+#define SGEBRD_GB2BD SGEBRD_GB2BD_64
+#define SGEBRD_GE2GB SGEBRD_GE2GB_64
 #define SGECON SGECON_64
 #define SGEDMD SGEDMD_64
 #define SGEDMD  SGEDMD_64
@@ -1248,8 +1297,10 @@
 #define SGERQF SGERQF_64
 #define SGESC2 SGESC2_64
 #define SGESDD SGESDD_64
+#define SGESDD_2STAGE SGESDD_2STAGE_64
 #define SGESV SGESV_64
 #define SGESVD SGESVD_64
+#define SGESVD_2STAGE SGESVD_2STAGE_64
 #define SGESVDQ SGESVDQ_64
 #define SGESVDX SGESVDX_64
 #define SGESVJ SGESVJ_64
@@ -1260,6 +1311,7 @@
 #define SGETRF SGETRF_64
 #define SGETRF  SGETRF_64
 #define SGETRF2 SGETRF2_64
+#define SGETRF_TASK SGETRF_TASK_64
 #define SGETRI SGETRI_64
 #define SGETRS SGETRS_64
 #define SGETSLS SGETSLS_64
@@ -1292,7 +1344,9 @@
 #define SGTTRS SGTTRS_64
 #define SGTTS2 SGTTS2_64
 #define SHGEQZ SHGEQZ_64
+#define SHGETRF SHGETRF_64
 #define SHSEIN SHSEIN_64
+#define SHPOTRF SHPOTRF_64
 #define SHSEQR SHSEQR_64
 #define SISNAN SISNAN_64
 #define SLABAD SLABAD_64
@@ -1306,9 +1360,11 @@
 #define SLAE2 SLAE2_64
 #define SLAEBZ SLAEBZ_64
 #define SLAED0 SLAED0_64
+#define SLAED0_TASK SLAED0_TASK_64
 #define SLAED1 SLAED1_64
 #define SLAED2 SLAED2_64
 #define SLAED3 SLAED3_64
+#define SLAED3_TASK SLAED3_TASK_64
 #define SLAED4 SLAED4_64
 #define SLAED5 SLAED5_64
 #define SLAED6 SLAED6_64
@@ -1321,6 +1377,7 @@
 #define SLAEXC SLAEXC_64
 #define SLAG2 SLAG2_64
 #define SLAG2D SLAG2D_64
+#define SLAG2H SLAG2H_64
 #define SLA_GBAMV SLA_GBAMV_64
 #define SLA_GBRCOND SLA_GBRCOND_64
 #define SLA_GBRFSX_EXTENDED SLA_GBRFSX_EXTENDED_64
@@ -1349,6 +1406,7 @@
 #define SLAMRG SLAMRG_64
 #define SLAMSWLQ SLAMSWLQ_64
 #define SLAMTSQR SLAMTSQR_64
+#define SLAMTSQR_TREE SLAMTSQR_TREE_64
 #define SLANEG SLANEG_64
 #define SLANGB SLANGB_64
 #define SLANGE SLANGE_64
@@ -1383,8 +1441,10 @@
 #define SLAQR1 SLAQR1_64
 #define SLAQR2 SLAQR2_64
 #define SLAQR3 SLAQR3_64
+#define SLAQR3_TASK SLAQR3_TASK_64
 #define SLAQR4 SLAQR4_64
 #define SLAQR5 SLAQR5_64
+#define SLAQR5_TASK SLAQR5_TASK_64
 #define SLAQSB SLAQSB_64
 #define SLAQSP SLAQSP_64
 #define SLAQSY SLAQSY_64
@@ -1411,6 +1471,7 @@
 #define SLARNV SLARNV_64
 #define SLARRA SLARRA_64
 #define SLARRB SLARRB_64
+#define SLARRB_TASK SLARRB_TASK_64
 #define SLARRC SLARRC_64
 #define SLARRD SLARRD_64
 #define SLARRE SLARRE_64
@@ -1419,6 +1480,7 @@
 #define SLARRK SLARRK_64
 #define SLARRR SLARRR_64
 #define SLARRV SLARRV_64
+#define SLARRV_TASK SLARRV_TASK_64
 #define SLARSCL2  SLARSCL2_64
 #define SLARTG SLARTG_64
 #define SLARTGP SLARTGP_64
@@ -1432,9 +1494,11 @@
 #define SLASCL SLASCL_64
 #define SLASCL2  SLASCL2_64
 #define SLASD0 SLASD0_64
+#define SLASD0_TASK SLASD0_TASK_64
 #define SLASD1 SLASD1_64
 #define SLASD2 SLASD2_64
 #define SLASD3 SLASD3_64
+#define SLASD3_TASK SLASD3_TASK_64
 #define SLASD4 SLASD4_64
 #define SLASD5 SLASD5_64
 #define SLASD6 SLASD6_64
@@ -1473,6 +1537,7 @@
 #define SLATRS3 SLATRS3_64
 #define SLATRZ SLATRZ_64
 #define SLATSQR SLATSQR_64
+#define SLATSQR_TREE SLATSQR_TREE_64
 #define SLATZM SLATZM_64
 #define SLAUU2 SLAUU2_64
 #define SLAUUM SLAUUM_64
@@ -1541,8 +1606,11 @@
 #define SPOTRF SPOTRF_64
 #define SPOTRF  SPOTRF_64
 #define SPOTRF2 SPOTRF2_64
+#define SPOTRF_TASK SPOTRF_TASK_64
 #define SPOTRI SPOTRI_64
+#define SPOTRI_TASK SPOTRI_TASK_64
 #define SPOTRS SPOTRS_64
+#define SPOTRS_TASK SPOTRS_TASK_64
 #define SPPCON SPPCON_64
 #define SPPEQU SPPEQU_64
 #define SPPRFS SPPRFS_64
@@ -1717,6 +1785,7 @@
 #define STRSV STRSV_64
 #define STRSYL STRSYL_64
 #define STRSYL3 STRSYL3_64
+#define STRSYL3_TASK STRSYL3_TASK_64
 #define STRTI2 STRTI2_64
 #define STRTRI STRTRI_64
 #define STRTRS STRTRS_64
@@ -1730,13 +1799,16 @@
 #define ZBBCSD ZBBCSD_64
 #define ZBDSQR ZBDSQR_64
 #define ZCGESV ZCGESV_64
+#define ZCGESV_GMRES ZCGESV_GMRES_64
 #define ZCOPY ZCOPY_64
 #define ZCPOSV ZCPOSV_64
+#define ZCPOSV_GMRES ZCPOSV_GMRES_64
 #define ZDOTC ZDOTC_64
 #define ZDOTU ZDOTU_64
 #define ZDROT ZDROT_64
 #define ZDRSCL ZDRSCL_64
 #define ZDSCAL ZDSCAL_64
+#define ZGB2BD_KERNELS ZGB2BD_KERNELS_64
 #define ZGBBRD ZGBBRD_64
 #define ZGBCON ZGBCON_64
 #define ZGBEQU ZGBEQU_64
@@ -1754,6 +1826,9 @@
 #define ZGEBAL ZGEBAL_64
 #define ZGEBD2 ZGEBD2_64
 #define ZGEBRD ZGEBRD_64
+#define ZGEBRD_2STAGE ZGEBRD_2STAGE_64
+#define ZGEBRD_GB2BD ZGEBRD_GB2BD_64
+#define ZGEBRD_GE2GB ZGEBRD_GE2GB_64
 #define ZGECON ZGECON_64
 #define ZGEDMD ZGEDMD_64
 #define ZGEDMD  ZGEDMD_64
@@ -1811,8 +1886,10 @@
 #define ZGERU ZGERU_64
 #define ZGESC2 ZGESC2_64
 #define ZGESDD ZGESDD_64
+#define ZGESDD_2STAGE ZGESDD_2STAGE_64
 #define ZGESV ZGESV_64
 #define ZGESVD ZGESVD_64
+#define ZGESVD_2STAGE ZGESVD_2STAGE_64
 #define ZGESVDQ ZGESVDQ_64
 #define ZGESVDX ZGESVDX_64
 #define ZGESVJ ZGESVJ_64
@@ -1823,6 +1900,7 @@
 #define ZGETRF ZGETRF_64
 #define ZGETRF  ZGETRF_64
 #define ZGETRF2 ZGETRF2_64
+#define ZGETRF_TASK ZGETRF_TASK_64
 #define ZGETRI ZGETRI_64
 #define ZGETRS ZGETRS_64
 #define ZGETSLS ZGETSLS_64
@@ -1845,6 +1923,7 @@
 #define ZGGSVD3 ZGGSVD3_64
 #define ZGGSVP ZGGSVP_64
 #define ZGGSVP3 ZGGSVP3_64
+#define ZGMRIR ZGMRIR_64
 #define ZGSVJ0 ZGSVJ0_64
 #define ZGSVJ1 ZGSVJ1_64
 #define ZGTCON ZGTCON_64
@@ -1995,6 +2074,7 @@
 #define ZLALSD ZLALSD_64
 #define ZLAMSWLQ ZLAMSWLQ_64
 #define ZLAMTSQR ZLAMTSQR_64
+#define ZLAMTSQR_TREE ZLAMTSQR_TREE_64
 #define ZLANGB ZLANGB_64
 #define ZLANGE ZLANGE_64
 #define ZLANGT ZLANGT_64
@@ -2030,8 +2110,10 @@
 #define ZLAQR1 ZLAQR1_64
 #define ZLAQR2 ZLAQR2_64
 #define ZLAQR3 ZLAQR3_64
+#define ZLAQR3_TASK ZLAQR3_TASK_64
 #define ZLAQR4 ZLAQR4_64
 #define ZLAQR5 ZLAQR5_64
+#define ZLAQR5_TASK ZLAQR5_TASK_64
 #define ZLAQSB ZLAQSB_64
 #define ZLAQSP ZLAQSP_64
 #define ZLAQSY ZLAQSY_64
@@ -2086,6 +2168,7 @@
 #define ZLATRS3 ZLATRS3_64
 #define ZLATRZ ZLATRZ_64
 #define ZLATSQR ZLATSQR_64
+#define ZLATSQR_TREE ZLATSQR_TREE_64
 #define ZLATZM ZLATZM_64
 #define ZLAUNHR_COL_GETRFNP ZLAUNHR_COL_GETRFNP_64
 #define ZLAUNHR_COL_GETRFNP2 ZLAUNHR_COL_GETRFNP2_64
@@ -2116,8 +2199,11 @@
 #define ZPOTRF ZPOTRF_64
 #define ZPOTRF  ZPOTRF_64
 #define ZPOTRF2 ZPOTRF2_64
+#define ZPOTRF_TASK ZPOTRF_TASK_64
 #define ZPOTRI ZPOTRI_64
+#define ZPOTRI_TASK ZPOTRI_TASK_64
 #define ZPOTRS ZPOTRS_64
+#define ZPOTRS_TASK ZPOTRS_TASK_64
 #define ZPPCON ZPPCON_64
 #define ZPPEQU ZPPEQU_64
 #define ZPPRFS ZPPRFS_64
@@ -2238,6 +2324,7 @@
 #define ZTRSV ZTRSV_64
 #define ZTRSYL ZTRSYL_64
 #define ZTRSYL3 ZTRSYL3_64
+#define ZTRSYL3_TASK ZTRSYL3_TASK_64
 #define ZTRTI2 ZTRTI2_64
 #define ZTRTRI ZTRTRI_64
 #define ZTRTRS ZTRTRS_64
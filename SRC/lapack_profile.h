@@ -0,0 +1,90 @@
+/*
+ * lapack_profile.h
+ * C interface to the profiling hooks of LAPACK.
+ *
+ * A LAPACK library built with BUILD_PROFILE=ON (CMake) or PROFILE=Yes
+ * (make.inc) records, for each of its computational routines and for
+ * each Level 2 and Level 3 BLAS routine it calls:
+ *
+ *   - the number of calls,
+ *   - the wall time spent in the routine, with and without the time of
+ *     the routines it calls,
+ *   - the floating point operations of the BLAS calls made inside it,
+ *     including those of its OpenMP tasks (see la_profile.c for when
+ *     several threads call LAPACK at once),
+ *   - for the BLAS routines, a histogram of the largest dimension of
+ *     the calls.
+ *
+ * The functions below read and reset the counters.  The counters are
+ * kept per thread and summed when they are read, so they should be
+ * read when no thread is running LAPACK.
+ *
+ * If the environment variable LAPACK_PROFILE_OUTPUT is set, the
+ * counters are written at exit to the file it names, or to the
+ * standard error if it is "-".
+ *
+ * Without the profiling hooks, LAPACK does not provide these functions.
+ */
+
+#ifndef LAPACK_PROFILE_H
+#define LAPACK_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bins of the dimension histograms: bin 0 counts the calls whose
+ * largest dimension d is 0, bin b > 0 those with 2^(b-1) <= d < 2^b,
+ * and the last bin also the larger ones.
+ */
+#define LAPACK_PROFILE_NBINS 16
+
+/* Length of the routine names, including the terminating null */
+#define LAPACK_PROFILE_NAMELEN 48
+
+typedef struct {
+    char      name[LAPACK_PROFILE_NAMELEN]; /* e.g. "dgetrf", "dgemm" */
+    int       blas;       /* 1 for a BLAS routine, 0 for LAPACK */
+    long long calls;      /* number of calls */
+    double    time;       /* seconds, including the routines called */
+    double    self_time;  /* seconds, without the routines called */
+    double    flops;      /* operations of the BLAS calls inside */
+    long long hist[LAPACK_PROFILE_NBINS]; /* BLAS only, see above */
+} lapack_profile_entry;
+
+/* Sets all the counters to zero */
+void lapack_profile_reset( void );
+
+/*
+ * Sums the counters of all the threads, sorts the routines by
+ * decreasing time and returns their number.  The routines are then
+ * read with lapack_profile_get.
+ */
+int lapack_profile_count( void );
+
+/*
+ * Copies the entry i (0 <= i < lapack_profile_count()) of the last
+ * sum to *e.  Returns 0, or 1 if i is out of range.
+ */
+int lapack_profile_get( int i, lapack_profile_entry *e );
+
+/*
+ * Copies the counters of the routine name (case insensitive, without
+ * the trailing underscore: "dgetrf", "DGEMM") to *e.  Returns 0, or 1
+ * if the routine has not been called.
+ */
+int lapack_profile_find( const char *name, lapack_profile_entry *e );
+
+/*
+ * Writes the counters as a table to the file name, or to the standard
+ * error if name is NULL or "-".  Returns 0, or 1 if the file cannot
+ * be written.
+ */
+int lapack_profile_dump( const char *name );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,345 @@
+*> \brief \b SGEBRD_GE2GB reduces a real general matrix A to real upper or lower triangular band form AB
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE SGEBRD_GE2GB( M, N, KD, A, LDA, AB, LDAB, TAUQ,
+*                                TAUP, WORK, LWORK, INFO )
+*
+*       IMPLICIT NONE
+*
+*       .. Scalar Arguments ..
+*       INTEGER            INFO, LDA, LDAB, LWORK, M, N, KD
+*       ..
+*       .. Array Arguments ..
+*       REAL               A( LDA, * ), AB( LDAB, * ),
+*                          TAUQ( * ), TAUP( * ), WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> SGEBRD_GE2GB reduces a real general M-by-N matrix A to real
+*> triangular band form AB by an orthogonal transformation:
+*> Q**T * A * P = AB.
+*>
+*> If m >= n, AB is upper triangular of order n with kd
+*> superdiagonals; if m < n, AB is lower triangular of order m with
+*> kd subdiagonals.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows in the matrix A.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns in the matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] KD
+*> \verbatim
+*>          KD is INTEGER
+*>          The number of superdiagonals of the reduced matrix if
+*>          m >= n, or the number of subdiagonals if m < n.  KD >= 1.
+*>          The reduced matrix is stored in the array AB.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is REAL array, dimension (LDA,N)
+*>          On entry, the M-by-N general matrix to be reduced.
+*>          On exit, the elements on and within the band are
+*>          overwritten by the band matrix AB; the elements below the
+*>          band, with the array TAUQ, represent the orthogonal matrix Q
+*>          and the elements above the band, with the array TAUP,
+*>          represent the orthogonal matrix P as a product of elementary
+*>          reflectors; see Further Details.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] AB
+*> \verbatim
+*>          AB is REAL array, dimension (LDAB,min(M,N))
+*>          On exit, the band matrix of order min(M,N), stored in the
+*>          first KD+1 rows of the array.  The j-th column of the band
+*>          matrix is stored in the j-th column of the array AB as
+*>          follows:
+*>          if m >= n, AB(kd+1+i-j,j) = A(i,j) for max(1,j-kd)<=i<=j;
+*>          if m < n,  AB(1+i-j,j)    = A(i,j) for j<=i<=min(m,j+kd).
+*> \endverbatim
+*>
+*> \param[in] LDAB
+*> \verbatim
+*>          LDAB is INTEGER
+*>          The leading dimension of the array AB.  LDAB >= KD+1.
+*> \endverbatim
+*>
+*> \param[out] TAUQ
+*> \verbatim
+*>          TAUQ is REAL array, dimension (min(M,N))
+*>          The scalar factors of the elementary reflectors which
+*>          represent the orthogonal matrix Q. See Further Details.
+*> \endverbatim
+*>
+*> \param[out] TAUP
+*> \verbatim
+*>          TAUP is REAL array, dimension (min(M,N))
+*>          The scalar factors of the elementary reflectors which
+*>          represent the orthogonal matrix P. See Further Details.
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is REAL array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, or if LWORK=-1,
+*>          WORK(1) returns the size of LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK which should be calculated
+*>          by a workspace query. LWORK = MAX(1, LWORK_QUERY)
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*>          LWORK_QUERY = N*KD + N*max(KD,FACTOPTNB) + 2*KD*KD
+*>          where N = max(M,N) and FACTOPTNB is the blocking used by
+*>          the QR or LQ algorithm, usually FACTOPTNB=128 is a good
+*>          choice otherwise putting LWORK=-1 will provide the size of
+*>          WORK.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gebrd_ge2gb
+*
+*> \par Further Details:
+*  =====================
+*>
+*> \verbatim
+*>
+*>  The matrix is reduced by panels of KD columns (or rows).  If
+*>  m >= n, the panel that starts at column i is first factorized by
+*>  SGEQRF, whose reflectors are applied to the trailing columns, and
+*>  then the rows i:i+kd-1 of the columns i+kd:n are factorized by
+*>  SGELQF, whose reflectors are applied to the trailing rows.  Both
+*>  updates are done in Level 3 BLAS by SORMQR and SORMLQ.  If m < n,
+*>  the roles of the rows and the columns are exchanged.
+*>
+*>  The reflectors are left in A in the format of SGEQRF and SGELQF:
+*>  if m >= n, the reflectors of the panel of column i are stored below
+*>  the diagonal of A(i:m,i:i+kd-1), with their scalar factors in
+*>  TAUQ(i:i+kd-1), and those of the rows i:i+kd-1 are stored above the
+*>  diagonal of A(i:i+kd-1,i+kd:n), with their scalar factors in
+*>  TAUP(i:i+kd-1).  If m < n, the reflectors of the rows i:i+kd-1 are
+*>  stored above the diagonal of A(i:i+kd-1,i:n), with their factors in
+*>  TAUP(i:i+kd-1), and those of the columns i:i+kd-1 below the
+*>  diagonal of A(i+kd:m,i:i+kd-1), with their factors in TAUQ(i:i+kd-1).
+*>
+*> \endverbatim
+*>
+*  =====================================================================
+      SUBROUTINE SGEBRD_GE2GB( M, N, KD, A, LDA, AB, LDAB, TAUQ,
+     $                         TAUP, WORK, LWORK, INFO )
+*
+      IMPLICIT NONE
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      INTEGER            INFO, LDA, LDAB, LWORK, M, N, KD
+*     ..
+*     .. Array Arguments ..
+      REAL               A( LDA, * ), AB( LDAB, * ),
+     $                   TAUQ( * ), TAUP( * ), WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Local Scalars ..
+      LOGICAL            LQUERY
+      INTEGER            I, J, IINFO, LWMIN, MINMN, PN, PK, LK
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           XERBLA, SCOPY, SGELQF, SGEQRF,
+     $                   SORMLQ, SORMQR
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          MIN, MAX
+*     ..
+*     .. External Functions ..
+      INTEGER            ILAENV2STAGE
+      EXTERNAL           ILAENV2STAGE
+*     ..
+*     .. Executable Statements ..
+*
+*     Determine the minimal workspace size required
+*     and test the input parameters
+*
+      INFO   = 0
+      LQUERY = ( LWORK.EQ.-1 )
+      MINMN  = MIN( M, N )
+      IF( MINMN.EQ.0 ) THEN
+         LWMIN = 1
+      ELSE
+         LWMIN = ILAENV2STAGE( 4, 'SGEBRD_GE2GB', ' ', MAX( M, N ),
+     $                         KD, -1, -1 )
+      END IF
+*
+      IF( M.LT.0 ) THEN
+         INFO = -1
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( KD.LT.1 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -5
+      ELSE IF( LDAB.LT.KD+1 ) THEN
+         INFO = -7
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -11
+      END IF
+*
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'SGEBRD_GE2GB', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         WORK( 1 ) = LWMIN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( MINMN.EQ.0 ) THEN
+         WORK( 1 ) = 1
+         RETURN
+      END IF
+*
+      IF( M.GE.N ) THEN
+*
+*        Reduce to upper band form, KD columns at a time.
+*
+         DO 10 I = 1, N, KD
+            PK = MIN( KD, N-I+1 )
+*
+*           QR factorization of the panel A(i:m,i:i+pk-1) and update of
+*           the trailing columns.
+*
+            CALL SGEQRF( M-I+1, PK, A( I, I ), LDA, TAUQ( I ),
+     $                   WORK, LWORK, IINFO )
+            IF( I+PK.LE.N ) THEN
+               CALL SORMQR( 'Left', 'Transpose', M-I+1, N-I-PK+1, PK,
+     $                      A( I, I ), LDA, TAUQ( I ), A( I, I+PK ),
+     $                      LDA, WORK, LWORK, IINFO )
+            END IF
+*
+*           LQ factorization of the rows A(i:i+kd-1,i+kd:n) and update
+*           of the trailing rows.
+*
+            IF( I+KD.LE.N ) THEN
+               PN = N-I-KD+1
+               LK = MIN( PK, PN )
+               CALL SGELQF( PK, PN, A( I, I+KD ), LDA, TAUP( I ),
+     $                      WORK, LWORK, IINFO )
+               IF( I+PK.LE.M ) THEN
+                  CALL SORMLQ( 'Right', 'Transpose', M-I-PK+1, PN,
+     $                         LK, A( I, I+KD ), LDA, TAUP( I ),
+     $                         A( I+PK, I+KD ), LDA, WORK, LWORK,
+     $                         IINFO )
+               END IF
+            END IF
+*
+*           Copy the rows i:i+pk-1 of the band into AB.
+*
+            DO 20 J = I, I+PK-1
+               LK = MIN( KD+1, N-J+1 )
+               CALL SCOPY( LK, A( J, J ), LDA, AB( KD+1, J ),
+     $                      LDAB-1 )
+   20       CONTINUE
+   10    CONTINUE
+      ELSE
+*
+*        Reduce to lower band form, KD rows at a time.
+*
+         DO 30 I = 1, M, KD
+            PK = MIN( KD, M-I+1 )
+*
+*           LQ factorization of the panel A(i:i+pk-1,i:n) and update of
+*           the trailing rows.
+*
+            CALL SGELQF( PK, N-I+1, A( I, I ), LDA, TAUP( I ),
+     $                   WORK, LWORK, IINFO )
+            IF( I+PK.LE.M ) THEN
+               CALL SORMLQ( 'Right', 'Transpose', M-I-PK+1, N-I+1,
+     $                      PK, A( I, I ), LDA, TAUP( I ), A( I+PK, I ),
+     $                      LDA, WORK, LWORK, IINFO )
+            END IF
+*
+*           QR factorization of the columns A(i+kd:m,i:i+kd-1) and
+*           update of the trailing columns.
+*
+            IF( I+KD.LE.M ) THEN
+               PN = M-I-KD+1
+               LK = MIN( PK, PN )
+               CALL SGEQRF( PN, PK, A( I+KD, I ), LDA, TAUQ( I ),
+     $                      WORK, LWORK, IINFO )
+               IF( I+PK.LE.N ) THEN
+                  CALL SORMQR( 'Left', 'Transpose', PN, N-I-PK+1, LK,
+     $                         A( I+KD, I ), LDA, TAUQ( I ),
+     $                         A( I+KD, I+PK ), LDA, WORK, LWORK,
+     $                         IINFO )
+               END IF
+            END IF
+*
+*           Copy the columns i:i+pk-1 of the band into AB.
+*
+            DO 40 J = I, I+PK-1
+               LK = MIN( KD+1, M-J+1 )
+               CALL SCOPY( LK, A( J, J ), 1, AB( 1, J ), 1 )
+   40       CONTINUE
+   30    CONTINUE
+      END IF
+*
+      WORK( 1 ) = LWMIN
+      RETURN
+*
+*     End of SGEBRD_GE2GB
+*
+      END
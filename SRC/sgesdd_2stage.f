@@ -0,0 +1,401 @@
+*> \brief \b SGESDD_2STAGE
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE SGESDD_2STAGE( JOBZ, M, N, A, LDA, S, U, LDU, VT,
+*                                 LDVT, WORK, LWORK, IWORK, INFO )
+*
+*       IMPLICIT NONE
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          JOBZ
+*       INTEGER            INFO, LDA, LDU, LDVT, LWORK, M, N
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            IWORK( * )
+*       REAL               A( LDA, * ), S( * ), U( LDU, * ),
+*      $                   VT( LDVT, * ), WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> SGESDD_2STAGE computes the singular values and, optionally, the
+*> left and right singular vectors of a real M-by-N matrix A, using
+*> the 2stage technique for the reduction to bidiagonal form.  The
+*> singular values are computed from the bidiagonal form by SBDSDC,
+*> as in SGESDD.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] JOBZ
+*> \verbatim
+*>          JOBZ is CHARACTER*1
+*>          Specifies options for computing all or part of the matrix U:
+*>          = 'N':  no columns of U or rows of V**T are computed.
+*>          The other options of SGESDD are not available in this
+*>          release.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows of the input matrix A.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the input matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is REAL array, dimension (LDA,N)
+*>          On entry, the M-by-N matrix A.
+*>          On exit, the contents of A are destroyed.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] S
+*> \verbatim
+*>          S is REAL array, dimension (min(M,N))
+*>          The singular values of A, sorted so that S(i) >= S(i+1).
+*> \endverbatim
+*>
+*> \param[out] U
+*> \verbatim
+*>          U is REAL array, dimension (LDU,1)
+*>          Not referenced.
+*> \endverbatim
+*>
+*> \param[in] LDU
+*> \verbatim
+*>          LDU is INTEGER
+*>          The leading dimension of the array U.  LDU >= 1.
+*> \endverbatim
+*>
+*> \param[out] VT
+*> \verbatim
+*>          VT is REAL array, dimension (LDVT,1)
+*>          Not referenced.
+*> \endverbatim
+*>
+*> \param[in] LDVT
+*> \verbatim
+*>          LDVT is INTEGER
+*>          The leading dimension of the array VT.  LDVT >= 1.
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is REAL array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK;
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK. LWORK >= 1.
+*>          If LWORK = -1, a workspace query is assumed.  The optimal
+*>          size for the WORK array is calculated and stored in WORK(1),
+*>          and no other work except argument checking is performed.
+*>
+*>          Let mn = min(M,N).
+*>          If JOBZ = 'N', LWORK >= max( 3*mn + LHOUS2 + LWBRD, 5*mn ),
+*>          where LHOUS2 and LWBRD are the sizes of the arrays HOUS2 and
+*>          WORK of SGEBRD_2STAGE, applied to A or, if M or N is much
+*>          larger than the other, to its R or L factor.
+*> \endverbatim
+*>
+*> \param[out] IWORK
+*> \verbatim
+*>          IWORK is INTEGER array, dimension (8*min(M,N))
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          <  0:  if INFO = -i, the i-th argument had an illegal value.
+*>          = -4:  if A had a NAN entry.
+*>          >  0:  SBDSDC did not converge, updating process failed.
+*>          =  0:  successful exit.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gesdd_2stage
+*
+*> \par Further Details:
+*  =====================
+*>
+*> \verbatim
+*>
+*>  All details about the 2stage techniques are available in:
+*>
+*>  A. Haidar, J. Kurzak, P. Luszczek, 2013.
+*>  An improved parallel singular value algorithm and its implementation
+*>  for multicore hardware, In Proceedings of 2013 International Conference
+*>  for High Performance Computing, Networking, Storage and Analysis (SC '13).
+*>  Denver, Colorado, USA, 2013.
+*>  Article 90, 12 pages.
+*>  http://doi.acm.org/10.1145/2503210.2503292
+*>
+*> \endverbatim
+*
+*  =====================================================================
+      SUBROUTINE SGESDD_2STAGE( JOBZ, M, N, A, LDA, S, U, LDU, VT,
+     $                          LDVT, WORK, LWORK, IWORK, INFO )
+*
+      IMPLICIT NONE
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          JOBZ
+      INTEGER            INFO, LDA, LDU, LDVT, LWORK, M, N
+*     ..
+*     .. Array Arguments ..
+      INTEGER            IWORK( * )
+      REAL               A( LDA, * ), S( * ), U( LDU, * ),
+     $                   VT( LDVT, * ), WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      REAL               ZERO, ONE
+      PARAMETER          ( ZERO = 0.0E0, ONE = 1.0E0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            LQUERY, QRFRST
+      INTEGER            BDSPAC, IE, IERR, IHOUS, ISCL, ITAU, ITAUP,
+     $                   ITAUQ, NWORK, KD, IB, LHBRD, LWBRD,
+     $                   LWORK_SGEQRF, MAXWRK, MINMN, MINWRK, MNTHR,
+     $                   MR, NR
+      REAL               ANRM, BIGNUM, EPS, SMLNUM
+*     ..
+*     .. Local Arrays ..
+      INTEGER            IDUM( 1 )
+      REAL               DUM( 1 )
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           SBDSDC, SGEBRD_2STAGE, SGELQF,
+     $                   SGEQRF, SLASCL, SLASET, XERBLA
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME, SISNAN
+      INTEGER            ILAENV2STAGE
+      REAL               SLAMCH, SLANGE, SROUNDUP_LWORK
+      EXTERNAL           SLAMCH, SLANGE, LSAME, SISNAN,
+     $                   ILAENV2STAGE, SROUNDUP_LWORK
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          INT, MAX, MIN, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input arguments
+*
+      INFO   = 0
+      MINMN  = MIN( M, N )
+      LQUERY = ( LWORK.EQ.-1 )
+*
+      IF( .NOT.LSAME( JOBZ, 'N' ) ) THEN
+         INFO = -1
+      ELSE IF( M.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -5
+      ELSE IF( LDU.LT.1 ) THEN
+         INFO = -8
+      ELSE IF( LDVT.LT.1 ) THEN
+         INFO = -10
+      END IF
+*
+*     Compute workspace
+*
+      QRFRST = .FALSE.
+      IF( INFO.EQ.0 ) THEN
+         MINWRK = 1
+         MAXWRK = 1
+         IF( MINMN.GT.0 ) THEN
+*
+*           If A has sufficiently more rows than columns, or columns
+*           than rows, it is first reduced by the QR or LQ
+*           decomposition, as in SGESDD.
+*
+            MNTHR  = INT( MINMN*11.0E0 / 6.0E0 )
+            QRFRST = MAX( M, N ).GE.MNTHR
+            IF( QRFRST ) THEN
+               IF( M.GE.N ) THEN
+                  CALL SGEQRF( M, N, A, LDA, DUM(1), DUM(1), -1,
+     $                         IERR )
+               ELSE
+                  CALL SGELQF( M, N, A, LDA, DUM(1), DUM(1), -1,
+     $                         IERR )
+               END IF
+               LWORK_SGEQRF = INT( DUM(1) )
+               MR = MINMN
+               NR = MINMN
+            ELSE
+               MR = M
+               NR = N
+            END IF
+*
+*           Compute space needed for SGEBRD_2STAGE and SBDSDC, which
+*           needs only 4*MINMN for an upper bidiagonal matrix
+*
+            KD    = ILAENV2STAGE( 1, 'SGEBRD_2STAGE', 'N', MINMN, -1,
+     $                            -1, -1 )
+            IB    = ILAENV2STAGE( 2, 'SGEBRD_2STAGE', 'N', MINMN, KD,
+     $                            -1, -1 )
+            LHBRD = ILAENV2STAGE( 3, 'SGEBRD_2STAGE', 'N', MINMN, KD,
+     $                            IB, -1 )
+            LWBRD = ILAENV2STAGE( 4, 'SGEBRD_2STAGE', 'N',
+     $                            MAX( MR, NR ), KD, IB, -1 )
+            BDSPAC = 4*MINMN
+            MINWRK = MAX( 3*MINMN + LHBRD + LWBRD, MINMN + BDSPAC )
+            MAXWRK = MINWRK
+            IF( QRFRST )
+     $         MAXWRK = MAX( MAXWRK, MINMN + LWORK_SGEQRF )
+         END IF
+         WORK( 1 ) = SROUNDUP_LWORK( MAXWRK )
+*
+         IF( LWORK.LT.MINWRK .AND. .NOT.LQUERY ) THEN
+            INFO = -12
+         END IF
+      END IF
+*
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'SGESDD_2STAGE', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( M.EQ.0 .OR. N.EQ.0 ) THEN
+         RETURN
+      END IF
+*
+*     Get machine constants
+*
+      EPS = SLAMCH( 'P' )
+      SMLNUM = SQRT( SLAMCH( 'S' ) ) / EPS
+      BIGNUM = ONE / SMLNUM
+*
+*     Scale A if max element outside range [SMLNUM,BIGNUM]
+*
+      ANRM = SLANGE( 'M', M, N, A, LDA, DUM )
+      IF( SISNAN( ANRM ) ) THEN
+          INFO = -4
+          RETURN
+      END IF
+      ISCL = 0
+      IF( ANRM.GT.ZERO .AND. ANRM.LT.SMLNUM ) THEN
+         ISCL = 1
+         CALL SLASCL( 'G', 0, 0, ANRM, SMLNUM, M, N, A, LDA, IERR )
+      ELSE IF( ANRM.GT.BIGNUM ) THEN
+         ISCL = 1
+         CALL SLASCL( 'G', 0, 0, ANRM, BIGNUM, M, N, A, LDA, IERR )
+      END IF
+*
+      IF( QRFRST ) THEN
+         ITAU = 1
+         NWORK = ITAU + MINMN
+         IF( M.GE.N ) THEN
+*
+*           Compute A=Q*R and zero out below R
+*           Workspace: need   N [tau] + N    [work]
+*           Workspace: prefer N [tau] + N*NB [work]
+*
+            CALL SGEQRF( M, N, A, LDA, WORK( ITAU ), WORK( NWORK ),
+     $                   LWORK - NWORK + 1, IERR )
+            IF( N.GT.1 ) THEN
+               CALL SLASET( 'L', N-1, N-1, ZERO, ZERO, A( 2, 1 ),
+     $                      LDA )
+            END IF
+         ELSE
+*
+*           Compute A=L*Q and zero out above L
+*           Workspace: need   M [tau] + M    [work]
+*           Workspace: prefer M [tau] + M*NB [work]
+*
+            CALL SGELQF( M, N, A, LDA, WORK( ITAU ), WORK( NWORK ),
+     $                   LWORK - NWORK + 1, IERR )
+            IF( M.GT.1 ) THEN
+               CALL SLASET( 'U', M-1, M-1, ZERO, ZERO, A( 1, 2 ),
+     $                      LDA )
+            END IF
+         END IF
+      END IF
+*
+*     Reduce the MR-by-NR matrix in A to upper bidiagonal form
+*     Workspace: need   3*MINMN [e, tauq, taup] + LHBRD [hous2]
+*                       + LWBRD [work]
+*
+      IE = 1
+      ITAUQ = IE + MINMN
+      ITAUP = ITAUQ + MINMN
+      IHOUS = ITAUP + MINMN
+      NWORK = IHOUS + LHBRD
+      CALL SGEBRD_2STAGE( 'N', MR, NR, A, LDA, S, WORK( IE ),
+     $                    WORK( ITAUQ ), WORK( ITAUP ), WORK( IHOUS ),
+     $                    LHBRD, WORK( NWORK ), LWORK - NWORK + 1,
+     $                    IERR )
+      NWORK = IE + MINMN
+*
+*     Perform bidiagonal SVD, computing singular values only
+*     Workspace: need   MINMN [e] + BDSPAC
+*
+      CALL SBDSDC( 'U', 'N', MINMN, S, WORK( IE ), DUM, 1, DUM, 1,
+     $             DUM, IDUM, WORK( NWORK ), IWORK, INFO )
+*
+*     Undo scaling if necessary
+*
+      IF( ISCL.EQ.1 ) THEN
+         IF( ANRM.GT.BIGNUM )
+     $      CALL SLASCL( 'G', 0, 0, BIGNUM, ANRM, MINMN, 1, S, MINMN,
+     $                   IERR )
+         IF( ANRM.LT.SMLNUM )
+     $      CALL SLASCL( 'G', 0, 0, SMLNUM, ANRM, MINMN, 1, S, MINMN,
+     $                   IERR )
+      END IF
+*
+*     Return optimal workspace in WORK(1)
+*
+      WORK( 1 ) = SROUNDUP_LWORK( MAXWRK )
+*
+      RETURN
+*
+*     End of SGESDD_2STAGE
+*
+      END
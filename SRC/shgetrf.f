@@ -0,0 +1,310 @@
+*> \brief \b SHGETRF computes the LU factorization of a general matrix stored in a 16-bit floating-point format, with single precision arithmetic.
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE SHGETRF( FMT, M, N, A, LDA, IPIV, WORK, LWORK,
+*                           INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          FMT
+*       INTEGER            INFO, LDA, LWORK, M, N
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            IPIV( * )
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) A( LDA, * )
+*       REAL               WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> SHGETRF computes an LU factorization of a general M-by-N matrix A
+*> using partial pivoting with row interchanges, like SGETRF, but with
+*> the matrix and its factors stored in the 16-bit floating-point
+*> format FMT (bfloat16 or IEEE half precision, see SLAG2H).
+*>
+*> The factorization has the form
+*>    A = P * L * U
+*> where P is a permutation matrix, L is lower triangular with unit
+*> diagonal elements (lower trapezoidal if m > n), and U is upper
+*> triangular (upper trapezoidal if m < n).
+*>
+*> This is the right-looking Level 3 BLAS version of the algorithm.
+*> Each block of columns and each block of the trailing matrix is
+*> converted to SINGLE PRECISION in WORK, updated there with SGETRF2,
+*> STRSM and SGEMM, which accumulate in SINGLE PRECISION, and rounded
+*> back to the format FMT, so that the matrix is only read and
+*> written in 16-bit words.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] FMT
+*> \verbatim
+*>          FMT is CHARACTER*1
+*>          Specifies the 16-bit format of A:
+*>          = 'B':  bfloat16;
+*>          = 'H':  IEEE half precision.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows of the matrix A.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension (LDA,N)
+*>          On entry, the M-by-N matrix to be factored, in the format
+*>          FMT.
+*>          On exit, the factors L and U from the factorization
+*>          A = P*L*U in the format FMT; the unit diagonal elements of L
+*>          are not stored.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] IPIV
+*> \verbatim
+*>          IPIV is INTEGER array, dimension (min(M,N))
+*>          The pivot indices; for 1 <= i <= min(M,N), row i of the
+*>          matrix was interchanged with row IPIV(i).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is REAL array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.
+*>          If min(M,N) = 0, LWORK >= 1, else LWORK >= 2*M+N.
+*>          For optimal performance LWORK >= (2*M+N)*NB, where NB is
+*>          the optimal blocksize of SGETRF.
+*>
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*>          > 0:  if INFO = i <= min(M,N), U(i,i) is exactly zero. The
+*>                factorization has been completed, but the factor U is
+*>                exactly singular.
+*>          = min(M,N)+1:  an entry of the factors is out of the range
+*>                of the format FMT.  The factorization has been
+*>                stopped and the content of A is unspecified.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup getrf
+*
+*  =====================================================================
+      SUBROUTINE SHGETRF( FMT, M, N, A, LDA, IPIV, WORK, LWORK,
+     $                    INFO )
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          FMT
+      INTEGER            INFO, LDA, LWORK, M, N
+*     ..
+*     .. Array Arguments ..
+      INTEGER            IPIV( * )
+      INTEGER(KIND=SELECTED_INT_KIND(4)) A( LDA, * )
+      REAL               WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      REAL               ONE
+      PARAMETER          ( ONE = 1.0E+0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            LQUERY
+      INTEGER            I, IINFO, IP, IR, IT, J, JB, K, KB, LWMIN,
+     $                   LWOPT, MN, NB, NR
+      INTEGER(KIND=SELECTED_INT_KIND(4)) TEMP
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      INTEGER            ILAENV
+      REAL               SROUNDUP_LWORK
+      EXTERNAL           LSAME, ILAENV, SROUNDUP_LWORK
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           HLAG2S, SGEMM, SGETRF2, SLAG2H,
+     $                   STRSM, XERBLA
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          MAX, MIN
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input parameters.
+*
+      INFO = 0
+      MN = MIN( M, N )
+      NB = ILAENV( 1, 'SGETRF', ' ', M, N, -1, -1 )
+      IF( MN.LE.0 ) THEN
+         LWMIN = 1
+         LWOPT = 1
+      ELSE
+         NB = MAX( 1, MIN( NB, MN ) )
+         LWMIN = 2*M + N
+         LWOPT = NB*LWMIN
+      END IF
+      WORK( 1 ) = SROUNDUP_LWORK( LWOPT )
+*
+      LQUERY = ( LWORK.EQ.-1 )
+      IF( .NOT.LSAME( FMT, 'B' ) .AND.
+     $    .NOT.LSAME( FMT, 'H' ) ) THEN
+         INFO = -1
+      ELSE IF( M.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -5
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -8
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'SHGETRF', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( MN.EQ.0 )
+     $   RETURN
+*
+*     Use the largest block size up to NB for which WORK is large
+*     enough.  WORK holds the panel (M-by-NB), the block row of U
+*     (NB-by-N) and a block of columns of the trailing matrix
+*     (M-by-NB).
+*
+      NB = MIN( NB, LWORK / LWMIN )
+      IR = 1 + M*NB
+      IT = IR + NB*N
+*
+      DO 40 J = 1, MN, NB
+         JB = MIN( MN-J+1, NB )
+*
+*        Factor diagonal and subdiagonal blocks and test for exact
+*        singularity.
+*
+         CALL HLAG2S( FMT, M-J+1, JB, A( J, J ), LDA, WORK, M,
+     $                IINFO )
+         CALL SGETRF2( M-J+1, JB, WORK, M, IPIV( J ), IINFO )
+         IF( INFO.EQ.0 .AND. IINFO.GT.0 )
+     $      INFO = IINFO + J - 1
+         CALL SLAG2H( FMT, M-J+1, JB, WORK, M, A( J, J ), LDA,
+     $                IINFO )
+         IF( IINFO.NE.0 )
+     $      GO TO 50
+*
+*        Adjust pivot indices and apply the interchanges to columns
+*        1:J-1 and J+JB:N.
+*
+         DO 20 I = J, J + JB - 1
+            IPIV( I ) = J - 1 + IPIV( I )
+            IP = IPIV( I )
+            IF( IP.NE.I ) THEN
+               DO 10 K = 1, N
+                  IF( K.LT.J .OR. K.GE.J+JB ) THEN
+                     TEMP = A( I, K )
+                     A( I, K ) = A( IP, K )
+                     A( IP, K ) = TEMP
+                  END IF
+   10          CONTINUE
+            END IF
+   20    CONTINUE
+*
+         IF( J+JB.LE.N ) THEN
+*
+*           Compute block row of U.
+*
+            NR = N - J - JB + 1
+            CALL HLAG2S( FMT, JB, NR, A( J, J+JB ), LDA, WORK( IR ),
+     $                   NB, IINFO )
+            CALL STRSM( 'Left', 'Lower', 'No transpose', 'Unit', JB,
+     $                  NR, ONE, WORK, M, WORK( IR ), NB )
+            CALL SLAG2H( FMT, JB, NR, WORK( IR ), NB, A( J, J+JB ),
+     $                   LDA, IINFO )
+            IF( IINFO.NE.0 )
+     $         GO TO 50
+*
+*           Update trailing submatrix, one block of columns at a time.
+*
+            IF( J+JB.LE.M ) THEN
+               DO 30 K = J + JB, N, NB
+                  KB = MIN( NB, N-K+1 )
+                  CALL HLAG2S( FMT, M-J-JB+1, KB, A( J+JB, K ), LDA,
+     $                         WORK( IT ), M, IINFO )
+                  CALL SGEMM( 'No transpose', 'No transpose',
+     $                        M-J-JB+1, KB, JB, -ONE, WORK( JB+1 ), M,
+     $                        WORK( IR+( K-J-JB )*NB ), NB, ONE,
+     $                        WORK( IT ), M )
+                  CALL SLAG2H( FMT, M-J-JB+1, KB, WORK( IT ), M,
+     $                         A( J+JB, K ), LDA, IINFO )
+                  IF( IINFO.NE.0 )
+     $               GO TO 50
+   30          CONTINUE
+            END IF
+         END IF
+   40 CONTINUE
+      WORK( 1 ) = SROUNDUP_LWORK( LWOPT )
+      RETURN
+*
+*     An entry of the factors is out of the range of FMT.
+*
+   50 CONTINUE
+      INFO = MN + 1
+      RETURN
+*
+*     End of SHGETRF
+*
+      END
@@ -0,0 +1,335 @@
+*> \brief \b SHPOTRF computes the Cholesky factorization of a symmetric positive definite matrix stored in a 16-bit floating-point format, with single precision arithmetic.
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE SHPOTRF( FMT, UPLO, N, A, LDA, WORK, LWORK, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          FMT, UPLO
+*       INTEGER            INFO, LDA, LWORK, N
+*       ..
+*       .. Array Arguments ..
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) A( LDA, * )
+*       REAL               WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> SHPOTRF computes the Cholesky factorization of a real symmetric
+*> positive definite matrix A, like SPOTRF, but with the matrix and its
+*> factor stored in the 16-bit floating-point format FMT (bfloat16 or
+*> IEEE half precision, see SLAG2H).
+*>
+*> The factorization has the form
+*>    A = U**T * U,  if UPLO = 'U', or
+*>    A = L  * L**T,  if UPLO = 'L',
+*> where U is an upper triangular matrix and L is lower triangular.
+*>
+*> This is the right-looking Level 3 BLAS version of the algorithm.
+*> Each block of columns (or rows) and each block of the trailing
+*> matrix is converted to SINGLE PRECISION in WORK, updated there with
+*> SPOTRF2, STRSM and SGEMM, which accumulate in SINGLE PRECISION, and
+*> rounded back to the format FMT, so that the matrix is only read and
+*> written in 16-bit words.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] FMT
+*> \verbatim
+*>          FMT is CHARACTER*1
+*>          Specifies the 16-bit format of A:
+*>          = 'B':  bfloat16;
+*>          = 'H':  IEEE half precision.
+*> \endverbatim
+*>
+*> \param[in] UPLO
+*> \verbatim
+*>          UPLO is CHARACTER*1
+*>          = 'U':  Upper triangle of A is stored;
+*>          = 'L':  Lower triangle of A is stored.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The order of the matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension (LDA,N)
+*>          On entry, the symmetric matrix A in the format FMT.  If
+*>          UPLO = 'U', the leading N-by-N upper triangular part of A
+*>          contains the upper triangular part of the matrix A, and the
+*>          strictly lower triangular part of A is not referenced.  If
+*>          UPLO = 'L', the leading N-by-N lower triangular part of A
+*>          contains the lower triangular part of the matrix A, and the
+*>          strictly upper triangular part of A is not referenced.
+*>
+*>          On exit, if INFO = 0, the factor U or L from the Cholesky
+*>          factorization A = U**T*U or A = L*L**T, in the format FMT.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is REAL array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.
+*>          If N = 0, LWORK >= 1, else LWORK >= 2*N.
+*>          For optimal performance LWORK >= 2*N*NB, where NB is the
+*>          optimal blocksize of SPOTRF.
+*>
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*>          > 0:  if INFO = i <= N, the leading principal minor of order
+*>                i is not positive, and the factorization could not be
+*>                completed.
+*>          = N+1:  an entry of the factor is out of the range of the
+*>                format FMT.  The factorization has been stopped and
+*>                the content of A is unspecified.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup potrf
+*
+*  =====================================================================
+      SUBROUTINE SHPOTRF( FMT, UPLO, N, A, LDA, WORK, LWORK, INFO )
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          FMT, UPLO
+      INTEGER            INFO, LDA, LWORK, N
+*     ..
+*     .. Array Arguments ..
+      INTEGER(KIND=SELECTED_INT_KIND(4)) A( LDA, * )
+      REAL               WORK( * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      REAL               ONE
+      PARAMETER          ( ONE = 1.0E+0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            LQUERY, UPPER
+      INTEGER            I, IINFO, IT, J, JB, K, KB, LWMIN, LWOPT, NB,
+     $                   NR
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      INTEGER            ILAENV
+      REAL               SROUNDUP_LWORK
+      EXTERNAL           LSAME, ILAENV, SROUNDUP_LWORK
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           HLAG2S, SGEMM, SLAG2H, SPOTRF2,
+     $                   STRSM, XERBLA
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          MAX, MIN
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input parameters.
+*
+      INFO = 0
+      UPPER = LSAME( UPLO, 'U' )
+      NB = ILAENV( 1, 'SPOTRF', UPLO, N, -1, -1, -1 )
+      IF( N.LE.0 ) THEN
+         LWMIN = 1
+         LWOPT = 1
+      ELSE
+         NB = MAX( 1, MIN( NB, N ) )
+         LWMIN = 2*N
+         LWOPT = NB*LWMIN
+      END IF
+      WORK( 1 ) = SROUNDUP_LWORK( LWOPT )
+*
+      LQUERY = ( LWORK.EQ.-1 )
+      IF( .NOT.LSAME( FMT, 'B' ) .AND.
+     $    .NOT.LSAME( FMT, 'H' ) ) THEN
+         INFO = -1
+      ELSE IF( .NOT.UPPER .AND. .NOT.LSAME( UPLO, 'L' ) ) THEN
+         INFO = -2
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, N ) ) THEN
+         INFO = -5
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -7
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'SHPOTRF', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( N.EQ.0 )
+     $   RETURN
+*
+*     Use the largest block size up to NB for which WORK is large
+*     enough.  WORK holds the panel (N-by-NB) and a block of columns
+*     of the trailing matrix (N-by-NB).
+*
+      NB = MIN( NB, LWORK / LWMIN )
+      IT = 1 + N*NB
+*
+      IF( UPPER ) THEN
+*
+*        Compute the Cholesky factorization A = U**T*U.  The block
+*        row of U is kept in WORK with leading dimension NB.
+*
+         DO 40 J = 1, N, NB
+            JB = MIN( NB, N-J+1 )
+            NR = N - J - JB + 1
+*
+*           Factor the diagonal block and compute the block row of U.
+*
+            CALL HLAG2S( FMT, JB, N-J+1, A( J, J ), LDA, WORK, NB,
+     $                   IINFO )
+            CALL SPOTRF2( 'Upper', JB, WORK, NB, IINFO )
+            IF( IINFO.NE.0 ) THEN
+               INFO = IINFO + J - 1
+               GO TO 100
+            END IF
+            CALL STRSM( 'Left', 'Upper', 'Transpose', 'Non-unit', JB,
+     $                  NR, ONE, WORK, NB, WORK( 1+JB*NB ), NB )
+            DO 10 I = 1, JB
+               CALL SLAG2H( FMT, I, 1, WORK( 1+( I-1 )*NB ), NB,
+     $                      A( J, J+I-1 ), LDA, IINFO )
+               IF( IINFO.NE.0 )
+     $            GO TO 90
+   10       CONTINUE
+            CALL SLAG2H( FMT, JB, NR, WORK( 1+JB*NB ), NB,
+     $                   A( J, J+JB ), LDA, IINFO )
+            IF( IINFO.NE.0 )
+     $         GO TO 90
+*
+*           Update the trailing submatrix, one block of columns at a
+*           time.
+*
+            DO 30 K = J + JB, N, NB
+               KB = MIN( NB, N-K+1 )
+               CALL HLAG2S( FMT, K+KB-J-JB, KB, A( J+JB, K ), LDA,
+     $                      WORK( IT ), N, IINFO )
+               CALL SGEMM( 'Transpose', 'No transpose', K+KB-J-JB,
+     $                     KB, JB, -ONE, WORK( 1+JB*NB ), NB,
+     $                     WORK( 1+( K-J )*NB ), NB, ONE, WORK( IT ),
+     $                     N )
+               DO 20 I = 1, KB
+                  CALL SLAG2H( FMT, K+I-J-JB, 1,
+     $                         WORK( IT+( I-1 )*N ), N,
+     $                         A( J+JB, K+I-1 ), LDA, IINFO )
+                  IF( IINFO.NE.0 )
+     $               GO TO 90
+   20          CONTINUE
+   30       CONTINUE
+   40    CONTINUE
+*
+      ELSE
+*
+*        Compute the Cholesky factorization A = L*L**T.  The block
+*        column of L is kept in WORK with leading dimension N.
+*
+         DO 80 J = 1, N, NB
+            JB = MIN( NB, N-J+1 )
+            NR = N - J - JB + 1
+*
+*           Factor the diagonal block and compute the block column
+*           of L.
+*
+            CALL HLAG2S( FMT, N-J+1, JB, A( J, J ), LDA, WORK, N,
+     $                   IINFO )
+            CALL SPOTRF2( 'Lower', JB, WORK, N, IINFO )
+            IF( IINFO.NE.0 ) THEN
+               INFO = IINFO + J - 1
+               GO TO 100
+            END IF
+            CALL STRSM( 'Right', 'Lower', 'Transpose', 'Non-unit',
+     $                  NR, JB, ONE, WORK, N, WORK( JB+1 ), N )
+            DO 50 I = 1, JB
+               CALL SLAG2H( FMT, N-J-I+2, 1, WORK( I+( I-1 )*N ), N,
+     $                      A( J+I-1, J+I-1 ), LDA, IINFO )
+               IF( IINFO.NE.0 )
+     $            GO TO 90
+   50       CONTINUE
+*
+*           Update the trailing submatrix, one block of columns at a
+*           time.
+*
+            DO 70 K = J + JB, N, NB
+               KB = MIN( NB, N-K+1 )
+               CALL HLAG2S( FMT, N-K+1, KB, A( K, K ), LDA,
+     $                      WORK( IT ), N, IINFO )
+               CALL SGEMM( 'No transpose', 'Transpose', N-K+1, KB,
+     $                     JB, -ONE, WORK( K-J+1 ), N, WORK( K-J+1 ),
+     $                     N, ONE, WORK( IT ), N )
+               DO 60 I = 1, KB
+                  CALL SLAG2H( FMT, N-K-I+2, 1,
+     $                         WORK( IT+( I-1 )*( N+1 ) ), N,
+     $                         A( K+I-1, K+I-1 ), LDA, IINFO )
+                  IF( IINFO.NE.0 )
+     $               GO TO 90
+   60          CONTINUE
+   70       CONTINUE
+   80    CONTINUE
+      END IF
+      WORK( 1 ) = SROUNDUP_LWORK( LWOPT )
+      GO TO 100
+*
+   90 CONTINUE
+      INFO = N + 1
+*
+  100 CONTINUE
+      RETURN
+*
+*     End of SHPOTRF
+*
+      END
@@ -36,6 +36,10 @@
 *>
 *> SLAED0 computes all eigenvalues and corresponding eigenvectors of a
 *> symmetric tridiagonal matrix using the divide and conquer method.
+*>
+*> If ICOMPQ = 2 and ILAENV( 7, 'SLAED0', ... ) returns more than one
+*> thread, the work is done by SLAED0_TASK, which solves the
+*> independent subproblems of the divide and conquer tree in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -195,9 +199,8 @@
       REAL               TEMP
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           SCOPY, SGEMM, SLACPY, SLAED1, SLAED7,
-     $                   SSTEQR,
-     $                   XERBLA
+      EXTERNAL           SCOPY, SGEMM, SLACPY, SLAED0_TASK,
+     $                   SLAED1, SLAED7, SSTEQR, XERBLA
 *     ..
 *     .. External Functions ..
       INTEGER            ILAENV
@@ -232,6 +235,16 @@
 *
       IF( N.EQ.0 )
      $   RETURN
+*
+*     With more than one thread, solve the subproblems of the tree in
+*     parallel.
+*
+      IF( ICOMPQ.EQ.2 ) THEN
+         IF( ILAENV( 7, 'SLAED0', ' ', N, -1, -1, -1 ).GT.1 ) THEN
+            CALL SLAED0_TASK( N, D, E, Q, LDQ, WORK, IWORK, INFO )
+            RETURN
+         END IF
+      END IF
 *
       SMLSIZ = ILAENV( 9, 'SLAED0', ' ', 0, 0, 0, 0 )
 *
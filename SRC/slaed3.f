@@ -42,6 +42,10 @@
 *> being combined by the matrix of eigenvectors of the K-by-K system
 *> which is solved here.
 *>
+*> If ILAENV( 7, 'SLAED3', ... ) returns more than one thread, the
+*> work is done by SLAED3_TASK, which solves the secular equations and
+*> updates the eigenvectors in parallel.
+*>
 *> \endverbatim
 *
 *  Arguments:
@@ -198,12 +202,13 @@
       REAL               TEMP
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SNRM2
-      EXTERNAL           SNRM2
+      EXTERNAL           SNRM2, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           SCOPY, SGEMM, SLACPY, SLAED4, SLASET,
-     $                   XERBLA
+      EXTERNAL           SCOPY, SGEMM, SLACPY, SLAED3_TASK,
+     $                   SLAED4, SLASET, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, SIGN, SQRT
@@ -230,6 +235,15 @@
 *
       IF( K.EQ.0 )
      $   RETURN
+*
+*     With more than one thread, solve the secular equations and
+*     update the eigenvectors in parallel.
+*
+      IF( ILAENV( 7, 'SLAED3', ' ', K, N, N1, -1 ).GT.1 ) THEN
+         CALL SLAED3_TASK( K, N, N1, D, Q, LDQ, RHO, DLAMBDA, Q2,
+     $                     INDX, CTOT, W, S, INFO )
+         RETURN
+      END IF
 *
       DO 20 J = 1, K
          CALL SLAED4( K, J, DLAMBDA, W, Q( 1, J ), RHO, D( J ),
@@ -0,0 +1,219 @@
+*> \brief \b SLAG2H converts a single precision matrix to a matrix stored in a 16-bit floating-point format.
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE SLAG2H( FMT, M, N, SA, LDSA, HA, LDHA, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER          FMT
+*       INTEGER            INFO, LDHA, LDSA, M, N
+*       ..
+*       .. Array Arguments ..
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) HA( LDHA, * )
+*       REAL               SA( LDSA, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> SLAG2H converts a SINGLE PRECISION matrix, SA, to a matrix, HA,
+*> whose entries are stored in a 16-bit floating-point format: the
+*> bit pattern of each entry is kept in a 16-bit integer.  The format
+*> is either bfloat16 (8 exponent bits, 8 significant bits, the range
+*> of SINGLE PRECISION) or the IEEE 754 binary16 half precision (5
+*> exponent bits, 11 significant bits, largest value 65504).
+*>
+*> The entries are rounded to the nearest value of the format, ties
+*> to even; the conversion is done in software on the bits of the
+*> IEEE 754 SINGLE PRECISION entries of SA.  If an entry is out of
+*> the range of the format, or is an Inf or a NaN, the conversion is
+*> aborted and a flag is raised.
+*>
+*> This is an auxiliary routine so there is no argument checking.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] FMT
+*> \verbatim
+*>          FMT is CHARACTER*1
+*>          Specifies the 16-bit format of HA:
+*>          = 'B':  bfloat16;
+*>          = 'H':  IEEE half precision.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of lines of the matrix SA.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the matrix SA.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] SA
+*> \verbatim
+*>          SA is REAL array, dimension (LDSA,N)
+*>          On entry, the M-by-N coefficient matrix SA.
+*> \endverbatim
+*>
+*> \param[in] LDSA
+*> \verbatim
+*>          LDSA is INTEGER
+*>          The leading dimension of the array SA.  LDSA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] HA
+*> \verbatim
+*>          HA is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension (LDHA,N)
+*>          On exit, if INFO=0, the M-by-N coefficient matrix HA in the
+*>          format FMT; if INFO>0, the content of HA is unspecified.
+*> \endverbatim
+*>
+*> \param[in] LDHA
+*> \verbatim
+*>          LDHA is INTEGER
+*>          The leading dimension of the array HA.  LDHA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit.
+*>          = 1:  an entry of the matrix SA is an Inf or a NaN, or
+*>                rounds to a value greater than the largest value of
+*>                the format, in this case, the content of HA in exit
+*>                is unspecified.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup _lag2_
+*
+*  =====================================================================
+      SUBROUTINE SLAG2H( FMT, M, N, SA, LDSA, HA, LDHA, INFO )
+*
+*  -- LAPACK auxiliary routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          FMT
+      INTEGER            INFO, LDHA, LDSA, M, N
+*     ..
+*     .. Array Arguments ..
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HA( LDHA, * )
+      REAL               SA( LDSA, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+*     IK is the kind of a 32-bit integer, which holds the bits of a
+*     REAL whatever the size of the default INTEGER.
+*     MABS masks the sign bit of the bits of a REAL, INFBIT are the
+*     bits of Inf, HOVFL the bits of 65520 (the first value that rounds
+*     to Inf in half precision) and HMIN the bits of 2**(-14) (the
+*     smallest normalized number of half precision).  REBIAS changes the
+*     exponent bias from 127 to 15.
+      INTEGER            IK
+      PARAMETER          ( IK = SELECTED_INT_KIND( 9 ) )
+      INTEGER( KIND=IK ) MABS
+      PARAMETER          ( MABS = 2147483647 )
+      INTEGER            INFBIT, HOVFL, HMIN, REBIAS
+      PARAMETER          ( INFBIT = 2139095040,
+     $                   HOVFL = 1199566848, HMIN = 947912704,
+     $                   REBIAS = 939524096 )
+      REAL               TWO24, HALF
+      PARAMETER          ( TWO24 = 16777216.0E+0, HALF = 0.5E+0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            BF16
+      INTEGER            I, IH, J, MB
+      INTEGER( KIND=IK ) IB
+      REAL               F, T
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      EXTERNAL           LSAME
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          ABS, IAND, INT, ISHFT, MOD, REAL,
+     $                   SELECTED_INT_KIND, TRANSFER
+*     ..
+*     .. Executable Statements ..
+*
+      BF16 = LSAME( FMT, 'B' )
+      DO 20 J = 1, N
+         DO 10 I = 1, M
+            IB = TRANSFER( SA( I, J ), IB )
+            MB = IAND( IB, MABS )
+            IF( MB.GE.INFBIT ) THEN
+               INFO = 1
+               GO TO 30
+            END IF
+            IF( BF16 ) THEN
+*
+*              Keep the 16 leading bits, rounded to nearest even.
+*
+               IH = ISHFT( MB+32767+IAND( ISHFT( MB, -16 ), 1 ), -16 )
+               IF( IH.GE.32640 ) THEN
+                  INFO = 1
+                  GO TO 30
+               END IF
+            ELSE IF( MB.GE.HOVFL ) THEN
+               INFO = 1
+               GO TO 30
+            ELSE IF( MB.GE.HMIN ) THEN
+*
+*              Normalized number: change the exponent bias and keep
+*              10 bits of the fraction, rounded to nearest even.
+*
+               MB = MB - REBIAS
+               IH = ISHFT( MB+4095+IAND( ISHFT( MB, -13 ), 1 ), -13 )
+            ELSE
+*
+*              Subnormal number or zero: the bits are the multiple of
+*              2**(-24), rounded to nearest even.
+*
+               T = ABS( SA( I, J ) )*TWO24
+               IH = INT( T )
+               F = T - REAL( IH )
+               IF( F.GT.HALF .OR.
+     $             ( F.EQ.HALF .AND. MOD( IH, 2 ).EQ.1 ) ) IH = IH + 1
+            END IF
+*
+*           Set the sign bit, as a negative 16-bit integer.
+*
+            IF( IB.LT.0 )
+     $         IH = IH - 32768
+            HA( I, J ) = INT( IH, KIND=SELECTED_INT_KIND( 4 ) )
+   10    CONTINUE
+   20 CONTINUE
+      INFO = 0
+   30 CONTINUE
+      RETURN
+*
+*     End of SLAG2H
+*
+      END
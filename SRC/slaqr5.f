@@ -39,6 +39,10 @@
 *>
 *>    SLAQR5, called by SLAQR0, performs a
 *>    single small-bulge multi-shift QR sweep.
+*>
+*>    If KACC22 = 1 or 2 and ILAENV( 7, 'SLAQR5', ... ) returns more
+*>    than one thread, the sweep is made by SLAQR5_TASK, which chases
+*>    several chains of bulges in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -289,12 +293,13 @@
       INTEGER            I, I2, I4, INCOL, J, JBOT, JCOL, JLEN,
      $                   JROW, JTOP, K, K1, KDU, KMS, KRCOL,
      $                   M, M22, MBOT, MTOP, NBMPS, NDCOL,
-     $                   NS, NU
+     $                   NS, NTHR, NU
       LOGICAL            ACCUM, BMP22
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SLAMCH
-      EXTERNAL           SLAMCH
+      EXTERNAL           ILAENV, SLAMCH
 *     ..
 *     .. Intrinsic Functions ..
 *
@@ -304,8 +309,8 @@
       REAL               VT( 3 )
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           SGEMM, SLACPY, SLAQR1, SLARFG, SLASET,
-     $                   STRMM
+      EXTERNAL           SGEMM, SLACPY, SLAQR1, SLAQR5_TASK,
+     $                   SLARFG, SLASET, STRMM
 *     ..
 *     .. Executable Statements ..
 *
@@ -320,6 +325,20 @@
       IF( KTOP.GE.KBOT )
      $   RETURN
 *
+*     ==== With more than one thread, chase several chains of
+*     .    bulges at the same time. ====
+*
+      IF( ( KACC22.EQ.1 .OR. KACC22.EQ.2 ) .AND. NSHFTS.GE.4 ) THEN
+         NTHR = ILAENV( 7, 'SLAQR5', ' ', N, KTOP, KBOT, NSHFTS )
+         IF( NTHR.GT.1 ) THEN
+            CALL SLAQR5_TASK( WANTT, WANTZ, N, KTOP, KBOT, NSHFTS,
+     $                        SR, SI, H, LDH, ILOZ, IHIZ, Z, LDZ, V,
+     $                        LDV, U, LDU, NV, WV, LDWV, NH, WH,
+     $                        LDWH )
+            RETURN
+         END IF
+      END IF
+*
 *     ==== Shuffle shifts into pairs of real shifts and pairs
 *     .    of complex conjugate shifts assuming complex
 *     .    conjugate shifts are already adjacent to one
@@ -43,6 +43,10 @@
 *> vectors by matrix multiplication.
 *>
 *> SLASD3 is called from SLASD1.
+*>
+*> If ILAENV( 7, 'SLASD3', ... ) returns more than one thread, the
+*> work is done by SLASD3_TASK, which solves the secular equations
+*> and updates the singular vectors in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -241,12 +245,13 @@
       REAL               RHO, TEMP
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SNRM2
-      EXTERNAL           SNRM2
+      EXTERNAL           SNRM2, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           SCOPY, SGEMM, SLACPY, SLASCL, SLASD4,
-     $                   XERBLA
+      EXTERNAL           SCOPY, SGEMM, SLACPY, SLASCL,
+     $                   SLASD3_TASK, SLASD4, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, SIGN, SQRT
@@ -303,6 +308,16 @@
          RETURN
       END IF
 *
+*     With more than one thread, find the singular values and update
+*     the singular vectors in parallel.
+*
+      IF( ILAENV( 7, 'SLASD3', ' ', K, NL, NR, SQRE ).GT.1 ) THEN
+         CALL SLASD3_TASK( NL, NR, SQRE, K, D, Q, LDQ, DSIGMA, U,
+     $                     LDU, U2, LDU2, VT, LDVT, VT2, LDVT2, IDXC,
+     $                     CTOT, Z, INFO )
+         RETURN
+      END IF
+*
 *     Keep a copy of Z.
 *
       CALL SCOPY( K, Z, 1, Q, 1 )
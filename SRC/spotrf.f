@@ -41,6 +41,8 @@
 *> where U is an upper triangular matrix and L is lower triangular.
 *>
 *> This is the block version of the algorithm, calling Level 3 BLAS.
+*> If ILAENV( 7, 'SPOTRF', ... ) returns more than one thread, the
+*> factorization is done by the task-parallel SPOTRF_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -131,8 +133,8 @@
       EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           SGEMM, SPOTRF2, SSYRK, STRSM,
-     $                   XERBLA
+      EXTERNAL           SGEMM, SPOTRF2, SPOTRF_TASK, SSYRK,
+     $                   STRSM, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, MIN
@@ -168,6 +170,12 @@
 *        Use unblocked code.
 *
          CALL SPOTRF2( UPLO, N, A, LDA, INFO )
+      ELSE IF( ILAENV( 7, 'SPOTRF', UPLO, N, -1, -1, -1 ).GT.1 )
+     $         THEN
+*
+*        Use the task-parallel blocked code.
+*
+         CALL SPOTRF_TASK( UPLO, N, A, LDA, INFO )
       ELSE
 *
 *        Use blocked code.
@@ -35,6 +35,8 @@
 *> SPOTRS solves a system of linear equations A*X = B with a symmetric
 *> positive definite matrix A using the Cholesky factorization
 *> A = U**T*U or A = L*L**T computed by SPOTRF.
+*> If ILAENV( 7, 'SPOTRS', ... ) returns more than one thread, the
+*> right-hand sides are solved concurrently by SPOTRS_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -129,10 +131,11 @@
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
-      EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           STRSM, XERBLA
+      EXTERNAL           SPOTRS_TASK, STRSM, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX
@@ -164,7 +167,13 @@
       IF( N.EQ.0 .OR. NRHS.EQ.0 )
      $   RETURN
 *
-      IF( UPPER ) THEN
+      IF( NRHS.GT.1 .AND.
+     $    ILAENV( 7, 'SPOTRS', UPLO, N, NRHS, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for blocks of right-hand sides concurrently.
+*
+         CALL SPOTRS_TASK( UPLO, N, NRHS, A, LDA, B, LDB, INFO )
+      ELSE IF( UPPER ) THEN
 *
 *        Solve A*X = B where A = U**T *U.
 *
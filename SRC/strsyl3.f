@@ -40,7 +40,9 @@
 *>  each 2-by-2 diagonal block has its diagonal elements equal and its
 *>  off-diagonal elements of opposite sign.
 *>
-*>  This is the block version of the algorithm.
+*>  This is the block version of the algorithm.  If ILAENV( 7,
+*>  'STRSYL3', ... ) returns more than one thread, the blocks of X are
+*>  solved in parallel by STRSYL3_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -232,7 +234,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           SGEMM, SLASCL, SSCAL, STRSYL,
-     $                   XERBLA
+     $                   STRSYL3_TASK, XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, EXPONENT, MAX, MIN, REAL
@@ -438,7 +440,15 @@
 *
       SGN = REAL( ISGN )
 *
-      IF( NOTRNA .AND. NOTRNB ) THEN
+      IF( ILAENV( 7, 'STRSYL3', ' ', M, N, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for the blocks of X by anti-diagonals of the block grid,
+*        in parallel.
+*
+         CALL STRSYL3_TASK( TRANA, TRANB, ISGN, NBA, NBB, NB, IWORK,
+     $                      A, LDA, B, LDB, C, LDC, SWORK, LDSWORK,
+     $                      BUF, INFO )
+      ELSE IF( NOTRNA .AND. NOTRNB ) THEN
 *
 *        Solve    A*X + ISGN*X*B = scale*C.
 *
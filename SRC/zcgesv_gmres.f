@@ -0,0 +1,364 @@
+*> \brief <b> ZCGESV_GMRES computes the solution to system of linear equations A * X = B for GE matrices</b> (mixed precision with GMRES-based iterative refinement)
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE ZCGESV_GMRES( N, NRHS, A, LDA, IPIV, B, LDB, X, LDX,
+*                                WORK, LWORK, SWORK, RWORK, ITER,
+*                                INFO )
+*
+*       .. Scalar Arguments ..
+*       INTEGER            INFO, ITER, LDA, LDB, LDX, LWORK, N, NRHS
+*       ..
+*       .. Array Arguments ..
+*       INTEGER            IPIV( * )
+*       DOUBLE PRECISION   RWORK( * )
+*       COMPLEX            SWORK( * )
+*       COMPLEX*16         A( LDA, * ), B( LDB, * ), WORK( * ),
+*      $                   X( LDX, * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> ZCGESV_GMRES computes the solution to a complex system of linear
+*> equations
+*>    A * X = B,
+*> where A is an N-by-N matrix and X and B are N-by-NRHS matrices.
+*>
+*> Like ZCGESV, ZCGESV_GMRES factorizes the matrix in COMPLEX and
+*> refines the solution to a COMPLEX*16 normwise backward
+*> error, but each refinement step solves for the correction with
+*> GMRES preconditioned by the COMPLEX LU factorization (see
+*> ZGMRIR) instead of applying the factorization alone.  The factors
+*> are copied to COMPLEX*16, where GMRES applies them.  The
+*> refinement converges for condition numbers up to about 1/EPS in
+*> COMPLEX*16, where the refinement of ZCGESV needs them below
+*> about 1/EPS in COMPLEX.  If the approach fails the method
+*> switches to a COMPLEX*16 factorization and solve.
+*>
+*> GMRES is restarted every MIN(N,100) iterations when LWORK is large
+*> enough (see LWORK), and the refinement is stopped after
+*> MAXCYC = 10 restarts or when for all the RHS we have:
+*>     RNRM < SQRT(N)*XNRM*ANRM*EPS*BWDMAX
+*> where
+*>     o RNRM is the infinity-norm of the residual
+*>     o XNRM is the infinity-norm of the solution
+*>     o ANRM is the infinity-operator-norm of the matrix A
+*>     o EPS is the machine epsilon returned by DLAMCH('Epsilon')
+*> The value BWDMAX is fixed to 1.0D+00.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of linear equations, i.e., the order of the
+*>          matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in] NRHS
+*> \verbatim
+*>          NRHS is INTEGER
+*>          The number of right hand sides, i.e., the number of columns
+*>          of the matrix B.  NRHS >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is COMPLEX*16 array,
+*>          dimension (LDA,N)
+*>          On entry, the N-by-N coefficient matrix A.
+*>          On exit, if iterative refinement has been successfully used
+*>          (INFO = 0 and ITER >= 0, see description below), then A is
+*>          unchanged, if double precision factorization has been used
+*>          (INFO = 0 and ITER < 0, see description below), then the
+*>          array A contains the factors L and U from the factorization
+*>          A = P*L*U; the unit diagonal elements of L are not stored.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] IPIV
+*> \verbatim
+*>          IPIV is INTEGER array, dimension (N)
+*>          The pivot indices that define the permutation matrix P;
+*>          row i of the matrix was interchanged with row IPIV(i).
+*>          Corresponds either to the single precision factorization
+*>          (if INFO = 0 and ITER >= 0) or the double precision
+*>          factorization (if INFO = 0 and ITER < 0).
+*> \endverbatim
+*>
+*> \param[in] B
+*> \verbatim
+*>          B is COMPLEX*16 array, dimension (LDB,NRHS)
+*>          The N-by-NRHS right hand side matrix B.
+*> \endverbatim
+*>
+*> \param[in] LDB
+*> \verbatim
+*>          LDB is INTEGER
+*>          The leading dimension of the array B.  LDB >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] X
+*> \verbatim
+*>          X is COMPLEX*16 array, dimension (LDX,NRHS)
+*>          If INFO = 0, the N-by-NRHS solution matrix X.
+*> \endverbatim
+*>
+*> \param[in] LDX
+*> \verbatim
+*>          LDX is INTEGER
+*>          The leading dimension of the array X.  LDX >= max(1,N).
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is COMPLEX*16 array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.  If N = 0, LWORK >= 1,
+*>          else
+*>          LWORK >= N*(N+NRHS*(K+3)) + NRHS*((K+1)*(K+3)+3)
+*>          with K = MIN(N,10).  GMRES is restarted every K iterations,
+*>          where K is the largest value up to MIN(N,100) for which
+*>          WORK is large enough; K = MIN(N,100) gives the optimal
+*>          LWORK.
+*>
+*>          If LWORK = -1, then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*> \endverbatim
+*>
+*> \param[out] SWORK
+*> \verbatim
+*>          SWORK is COMPLEX array, dimension (N*N)
+*>          This array is used to hold the COMPLEX matrix.
+*> \endverbatim
+*>
+*> \param[out] RWORK
+*> \verbatim
+*>          RWORK is DOUBLE PRECISION array, dimension (N)
+*> \endverbatim
+*>
+*> \param[out] ITER
+*> \verbatim
+*>          ITER is INTEGER
+*>          < 0: iterative refinement has failed, COMPLEX*16
+*>               factorization has been performed
+*>               -2 : narrowing the precision induced an overflow,
+*>                    the routine fell back to full precision
+*>               -3 : failure of CGETRF
+*>               -4 : the stopping criterion is not satisfied after
+*>                    MAXCYC restarts of GMRES
+*>          >= 0: iterative refinement has been successfully used.
+*>               Returns the number of GMRES iterations
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*>          > 0:  if INFO = i, U(i,i) computed in COMPLEX*16 is
+*>                exactly zero.  The factorization has been completed,
+*>                but the factor U is exactly singular, so the solution
+*>                could not be computed.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gesv_mixed
+*
+*  =====================================================================
+      SUBROUTINE ZCGESV_GMRES( N, NRHS, A, LDA, IPIV, B, LDB, X, LDX,
+     $                         WORK, LWORK, SWORK, RWORK, ITER,
+     $                         INFO )
+*
+*  -- LAPACK driver routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      INTEGER            INFO, ITER, LDA, LDB, LDX, LWORK, N, NRHS
+*     ..
+*     .. Array Arguments ..
+      INTEGER            IPIV( * )
+      DOUBLE PRECISION   RWORK( * )
+      COMPLEX            SWORK( * )
+      COMPLEX*16         A( LDA, * ), B( LDB, * ), WORK( * ),
+     $                   X( LDX, * )
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      INTEGER            MMIN, MMAX, MAXCYC
+      PARAMETER          ( MMIN = 10, MMAX = 100, MAXCYC = 10 )
+*
+      DOUBLE PRECISION   BWDMAX
+      PARAMETER          ( BWDMAX = 1.0E+00 )
+*
+*     .. Local Scalars ..
+      LOGICAL            LQUERY
+      INTEGER            IINFO, LWMIN, LWOPT, M
+      DOUBLE PRECISION   ANRM, CTE, EPS
+*
+*     .. External Subroutines ..
+      EXTERNAL           ZGETRF, ZGETRS, ZGMRIR, ZLACPY,
+     $                   ZLAG2C, CGETRF, CLAG2Z, XERBLA
+*     ..
+*     .. External Functions ..
+      DOUBLE PRECISION   DLAMCH, ZLANGE
+      EXTERNAL           DLAMCH, ZLANGE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          DBLE, MAX, MIN, SQRT
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      ITER = 0
+      LQUERY = ( LWORK.EQ.-1 )
+*
+*     Compute the minimal and the optimal workspace.
+*
+      IF( N.LE.0 ) THEN
+         LWMIN = 1
+         LWOPT = 1
+      ELSE
+         M = MIN( N, MMIN )
+         LWMIN = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+         M = MIN( N, MMAX )
+         LWOPT = N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 )
+      END IF
+      WORK( 1 ) = LWOPT
+*
+*     Test the input parameters.
+*
+      IF( N.LT.0 ) THEN
+         INFO = -1
+      ELSE IF( NRHS.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( LDA.LT.MAX( 1, N ) ) THEN
+         INFO = -4
+      ELSE IF( LDB.LT.MAX( 1, N ) ) THEN
+         INFO = -7
+      ELSE IF( LDX.LT.MAX( 1, N ) ) THEN
+         INFO = -9
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -11
+      END IF
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'ZCGESV_GMRES', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if (N.EQ.0).
+*
+      IF( N.EQ.0 )
+     $   RETURN
+*
+*     Restart GMRES after as many iterations as WORK allows.
+*
+      M = MIN( N, MMAX )
+   10 CONTINUE
+      IF( N*( N+NRHS*( M+3 ) ) + NRHS*( ( M+1 )*( M+3 )+3 ).GT.LWORK )
+     $   THEN
+         M = M - 1
+         GO TO 10
+      END IF
+*
+*     Compute some constants.
+*
+      ANRM = ZLANGE( 'I', N, N, A, LDA, RWORK )
+      EPS = DLAMCH( 'Epsilon' )
+      CTE = ANRM*EPS*SQRT( DBLE( N ) )*BWDMAX
+*
+*     Convert A from COMPLEX*16 to COMPLEX and store the result in SA
+*     (SWORK).
+*
+      CALL ZLAG2C( N, N, A, LDA, SWORK, N, INFO )
+*
+      IF( INFO.NE.0 ) THEN
+         ITER = -2
+         GO TO 40
+      END IF
+*
+*     Compute the LU factorization of SA.
+*
+      CALL CGETRF( N, N, SWORK, N, IPIV, INFO )
+*
+      IF( INFO.NE.0 ) THEN
+         ITER = -3
+         GO TO 40
+      END IF
+*
+*     Copy the factors of SA to COMPLEX*16 (AF is WORK) and
+*     solve the system AF*X = B.
+*
+      CALL CLAG2Z( N, N, SWORK, N, WORK, N, INFO )
+      CALL ZLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL ZGETRS( 'No transpose', N, NRHS, WORK, N, IPIV, X, LDX,
+     $             INFO )
+*
+*     Refine X by GMRES preconditioned with the factors.
+*
+      CALL ZGMRIR( 'General', ' ', N, NRHS, M, MAXCYC, A, LDA, WORK,
+     $             N, IPIV, B, LDB, X, LDX, CTE, WORK( N*N+1 ), ITER,
+     $             IINFO )
+*
+      IF( IINFO.EQ.0 ) THEN
+         WORK( 1 ) = LWOPT
+         RETURN
+      END IF
+      ITER = -4
+*
+   40 CONTINUE
+*
+*     Single-precision iterative refinement failed to converge to a
+*     satisfactory solution, so we resort to double precision.
+*
+      CALL ZGETRF( N, N, A, LDA, IPIV, INFO )
+*
+      IF( INFO.NE.0 )
+     $   RETURN
+*
+      CALL ZLACPY( 'All', N, NRHS, B, LDB, X, LDX )
+      CALL ZGETRS( 'No transpose', N, NRHS, A, LDA, IPIV, X, LDX,
+     $             INFO )
+*
+      WORK( 1 ) = LWOPT
+      RETURN
+*
+*     End of ZCGESV_GMRES
+*
+      END
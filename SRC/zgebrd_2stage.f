@@ -0,0 +1,316 @@
+*> \brief \b ZGEBRD_2STAGE
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE ZGEBRD_2STAGE( VECT, M, N, A, LDA, D, E, TAUQ, TAUP,
+*                                 HOUS2, LHOUS2, WORK, LWORK, INFO )
+*
+*       IMPLICIT NONE
+*
+*      .. Scalar Arguments ..
+*       CHARACTER          VECT
+*       INTEGER            M, N, LDA, LWORK, LHOUS2, INFO
+*      ..
+*      .. Array Arguments ..
+*       DOUBLE PRECISION   D( * ), E( * )
+*       COMPLEX*16         A( LDA, * ), TAUQ( * ), TAUP( * ),
+*                          HOUS2( * ), WORK( * )
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> ZGEBRD_2STAGE reduces a complex general M-by-N matrix A to real upper
+*> bidiagonal form B by unitary transformations in two stages:
+*> the matrix is first reduced to band form by ZGEBRD_GE2GB, then the
+*> band is reduced to bidiagonal form by ZGEBRD_GB2BD.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] VECT
+*> \verbatim
+*>          VECT is CHARACTER*1
+*>          = 'N':  No need for the Housholder representation,
+*>                  in particular for the second stage (Band to
+*>                  bidiagonal) and thus LHOUS2 is of size
+*>                  max(1, 4*min(m,n));
+*>          = 'V':  the Householder representation is needed to
+*>                  either generate Q1 Q2 and P1 P2 or to apply them,
+*>                  then LHOUS2 is to be queried and computed.
+*>                  (NOT AVAILABLE IN THIS RELEASE).
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows in the matrix A.  M >= 0.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns in the matrix A.  N >= 0.
+*> \endverbatim
+*>
+*> \param[in,out] A
+*> \verbatim
+*>          A is COMPLEX*16 array, dimension (LDA,N)
+*>          On entry, the M-by-N general matrix to be reduced.
+*>          On exit, the band matrix of the first stage and the
+*>          elementary reflectors which represent its unitary
+*>          matrices, as returned by ZGEBRD_GE2GB.
+*> \endverbatim
+*>
+*> \param[in] LDA
+*> \verbatim
+*>          LDA is INTEGER
+*>          The leading dimension of the array A.  LDA >= max(1,M).
+*> \endverbatim
+*>
+*> \param[out] D
+*> \verbatim
+*>          D is DOUBLE PRECISION array, dimension (min(M,N))
+*>          The diagonal elements of the bidiagonal matrix B.
+*> \endverbatim
+*>
+*> \param[out] E
+*> \verbatim
+*>          E is DOUBLE PRECISION array, dimension (min(M,N)-1)
+*>          The superdiagonal elements of the bidiagonal matrix B.
+*> \endverbatim
+*>
+*> \param[out] TAUQ
+*> \verbatim
+*>          TAUQ is COMPLEX*16 array, dimension (min(M,N))
+*>          The scalar factors of the elementary reflectors which
+*>          represent the unitary matrix Q of the first stage.
+*> \endverbatim
+*>
+*> \param[out] TAUP
+*> \verbatim
+*>          TAUP is COMPLEX*16 array, dimension (min(M,N))
+*>          The scalar factors of the elementary reflectors which
+*>          represent the unitary matrix P of the first stage.
+*> \endverbatim
+*>
+*> \param[out] HOUS2
+*> \verbatim
+*>          HOUS2 is COMPLEX*16 array, dimension (MAX(1,LHOUS2))
+*>          Stores the Householder representation of the stage2
+*>          band to bidiagonal.
+*> \endverbatim
+*>
+*> \param[in] LHOUS2
+*> \verbatim
+*>          LHOUS2 is INTEGER
+*>          The dimension of the array HOUS2.
+*>          LHOUS2 >= 1.
+*>
+*>          If LWORK = -1, or LHOUS2 = -1,
+*>          then a query is assumed; the routine
+*>          only calculates the optimal size of the HOUS2 array, returns
+*>          this value as the first entry of the HOUS2 array, and no error
+*>          message related to LHOUS2 is issued by XERBLA.
+*>          If VECT='N', LHOUS2 = max(1, 4*min(m,n));
+*>          if VECT='V', option not yet available.
+*> \endverbatim
+*>
+*> \param[out] WORK
+*> \verbatim
+*>          WORK is COMPLEX*16 array, dimension (MAX(1,LWORK))
+*>          On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+*> \endverbatim
+*>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK.
+*>          If min(M,N) = 0, LWORK >= 1, else LWORK = MAX(1, dimension).
+*>
+*>          If LWORK = -1, or LHOUS2 = -1,
+*>          then a workspace query is assumed; the routine
+*>          only calculates the optimal size of the WORK array, returns
+*>          this value as the first entry of the WORK array, and no error
+*>          message related to LWORK is issued by XERBLA.
+*>          LWORK = MAX(1, dimension) where
+*>          dimension   = max(stage1,stage2) + (KD+1)*min(M,N)
+*>                     <= 2*N*KD + N*max(KD+1,FACTOPTNB)
+*>                        + max(2*KD*KD, KD*NTHREADS)
+*>                        + (KD+1)*N
+*>          where N = max(M,N), KD is the blocking size of the
+*>          reduction, FACTOPTNB is the blocking used by the QR or LQ
+*>          algorithm, usually FACTOPTNB=128 is a good choice
+*>          NTHREADS is the number of threads used when
+*>          openMP compilation is enabled, otherwise =1.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0:  successful exit
+*>          < 0:  if INFO = -i, the i-th argument had an illegal value
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup gebrd_2stage
+*
+*> \par Further Details:
+*  =====================
+*>
+*> \verbatim
+*>
+*>  The first stage does most of the flops in Level 3 BLAS, and the
+*>  second stage chases the bulges of the band on several threads when
+*>  openMP is enabled; see ZGEBRD_GE2GB and ZGEBRD_GB2BD.  If m < n,
+*>  the band of the first stage is lower triangular and the second
+*>  stage reduces its transpose, so that B is upper bidiagonal in both
+*>  cases.
+*>
+*> \endverbatim
+*>
+*  =====================================================================
+      SUBROUTINE ZGEBRD_2STAGE( VECT, M, N, A, LDA, D, E, TAUQ, TAUP,
+     $                          HOUS2, LHOUS2, WORK, LWORK, INFO )
+*
+      IMPLICIT NONE
+*
+*  -- LAPACK computational routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER          VECT
+      INTEGER            M, N, LDA, LWORK, LHOUS2, INFO
+*     ..
+*     .. Array Arguments ..
+      DOUBLE PRECISION   D( * ), E( * )
+      COMPLEX*16         A( LDA, * ), TAUQ( * ), TAUP( * ),
+     $                   HOUS2( * ), WORK( * )
+*     ..
+*
+*  =====================================================================
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            LQUERY
+      CHARACTER          UPLO
+      INTEGER            KD, IB, MINMN, LWMIN, LHMIN, LWRK, LDAB, WPOS,
+     $                   ABPOS
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           XERBLA, ZGEBRD_GE2GB, ZGEBRD_GB2BD
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          MIN, MAX
+*     ..
+*     .. External Functions ..
+      LOGICAL            LSAME
+      INTEGER            ILAENV2STAGE
+      EXTERNAL           LSAME, ILAENV2STAGE
+*     ..
+*     .. Executable Statements ..
+*
+*     Test the input parameters
+*
+      INFO   = 0
+      MINMN  = MIN( M, N )
+      LQUERY = ( LWORK.EQ.-1 ) .OR. ( LHOUS2.EQ.-1 )
+*
+*     Determine the block size, the workspace size and the hous size.
+*
+      KD     = ILAENV2STAGE( 1, 'ZGEBRD_2STAGE', VECT, MINMN, -1, -1,
+     $                      -1 )
+      IB     = ILAENV2STAGE( 2, 'ZGEBRD_2STAGE', VECT, MINMN, KD, -1,
+     $                      -1 )
+      IF( MINMN.EQ.0 ) THEN
+         LHMIN = 1
+         LWMIN = 1
+      ELSE
+         LHMIN = ILAENV2STAGE( 3, 'ZGEBRD_2STAGE', VECT, MINMN, KD,
+     $                        IB, -1 )
+         LWMIN = ILAENV2STAGE( 4, 'ZGEBRD_2STAGE', VECT, MAX( M, N ),
+     $                        KD, IB, -1 )
+      END IF
+*
+      IF( .NOT.LSAME( VECT, 'N' ) ) THEN
+         INFO = -1
+      ELSE IF( M.LT.0 ) THEN
+         INFO = -2
+      ELSE IF( N.LT.0 ) THEN
+         INFO = -3
+      ELSE IF( LDA.LT.MAX( 1, M ) ) THEN
+         INFO = -5
+      ELSE IF( LHOUS2.LT.LHMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -11
+      ELSE IF( LWORK.LT.LWMIN .AND. .NOT.LQUERY ) THEN
+         INFO = -13
+      END IF
+*
+      IF( INFO.EQ.0 ) THEN
+         HOUS2( 1 ) = LHMIN
+         WORK( 1 )  = LWMIN
+      END IF
+*
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'ZGEBRD_2STAGE', -INFO )
+         RETURN
+      ELSE IF( LQUERY ) THEN
+         RETURN
+      END IF
+*
+*     Quick return if possible
+*
+      IF( MINMN.EQ.0 ) THEN
+         WORK( 1 ) = 1
+         RETURN
+      END IF
+*
+*     Determine pointer position
+*
+      IF( M.GE.N ) THEN
+         UPLO = 'U'
+      ELSE
+         UPLO = 'L'
+      END IF
+      LDAB  = KD+1
+      LWRK  = LWORK-LDAB*MINMN
+      ABPOS = 1
+      WPOS  = ABPOS + LDAB*MINMN
+      CALL ZGEBRD_GE2GB( M, N, KD, A, LDA, WORK( ABPOS ), LDAB,
+     $                   TAUQ, TAUP, WORK( WPOS ), LWRK, INFO )
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'ZGEBRD_GE2GB', -INFO )
+         RETURN
+      END IF
+      CALL ZGEBRD_GB2BD( 'Y', VECT, UPLO, MINMN, KD,
+     $                   WORK( ABPOS ), LDAB, D, E,
+     $                   HOUS2, LHOUS2, WORK( WPOS ), LWRK, INFO )
+      IF( INFO.NE.0 ) THEN
+         CALL XERBLA( 'ZGEBRD_GB2BD', -INFO )
+         RETURN
+      END IF
+*
+*
+      WORK( 1 ) = LWMIN
+      RETURN
+*
+*     End of ZGEBRD_2STAGE
+*
+      END
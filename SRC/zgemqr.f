@@ -154,6 +154,7 @@
 *>
 *>          T(2): row block size (MB)
 *>          T(3): column block size (NB)
+*>          T(4): arity of the reduction tree (KT), or 0
 *>          T(6:TSIZE): data structure needed for Q, computed by
 *>                           ZLATSQR or ZGEQRT
 *>
@@ -163,6 +164,10 @@
 *>  the QR factorization.
 *>  This version of ZGEMQR will use either ZLAMTSQR or ZGEMQRT to
 *>  multiply matrix Q by another matrix.
+*>  If T(4) is not 0, ZGEQR used ZLATSQR_TREE, and ZGEMQR uses
+*>  ZLAMTSQR_TREE, which shares the work among the threads given by
+*>  ILAENV( 7, 'ZGEMQR', ... ).  A workspace query then returns
+*>  enough WORK for all of them.
 *>  Further Details in ZLAMTSQR or ZGEMQRT.
 *>
 *> \endverbatim
@@ -190,14 +195,18 @@
 *     ..
 *     .. Local Scalars ..
       LOGICAL            LEFT, RIGHT, TRAN, NOTRAN, LQUERY
-      INTEGER            MB, NB, LW, NBLCKS, MN, MINMNK, LWMIN
+      INTEGER            MB, NB, LW, NBLCKS, MN, MINMNK, LWMIN, KT,
+     $                   NTHR
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
       EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           ZGEMQRT, ZLAMTSQR, XERBLA
+      EXTERNAL           ZGEMQRT, ZLAMTSQR, ZLAMTSQR_TREE,
+     $                   XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          INT, MAX, MIN, MOD
@@ -214,9 +223,13 @@
 *
       MB = INT( T( 2 ) )
       NB = INT( T( 3 ) )
+      KT = INT( T( 4 ) )
       IF( LEFT ) THEN
         LW = N * NB
         MN = M
+      ELSE IF( KT.GT.0 ) THEN
+        LW = M * NB
+        MN = N
       ELSE
         LW = MB * NB
         MN = N
@@ -228,6 +241,9 @@
       ELSE
         LWMIN = MAX( 1, LW )
       END IF
+      NTHR = 1
+      IF( KT.GT.0 .AND. MINMNK.GT.0 )
+     $   NTHR = MAX( 1, ILAENV( 7, 'ZGEMQR', ' ', M, N, K, -1 ) )
 *
       IF( ( MB.GT.K ) .AND. ( MN.GT.K ) ) THEN
         IF( MOD( MN - K, MB - K ).EQ.0 ) THEN
@@ -261,7 +277,7 @@
       END IF
 *
       IF( INFO.EQ.0 ) THEN
-        WORK( 1 ) = LWMIN
+        WORK( 1 ) = NTHR*LWMIN
       END IF
 *
       IF( INFO.NE.0 ) THEN
@@ -281,12 +297,15 @@
      $     .OR. ( MB.LE.K ) .OR. ( MB.GE.MAX( M, N, K ) ) ) THEN
         CALL ZGEMQRT( SIDE, TRANS, M, N, K, NB, A, LDA, T( 6 ),
      $                NB, C, LDC, WORK, INFO )
+      ELSE IF( KT.GT.0 ) THEN
+        CALL ZLAMTSQR_TREE( SIDE, TRANS, M, N, K, MB, NB, KT, A, LDA,
+     $                      T( 6 ), NB, C, LDC, WORK, LWORK, INFO )
       ELSE
         CALL ZLAMTSQR( SIDE, TRANS, M, N, K, MB, NB, A, LDA, T( 6 ),
      $                 NB, C, LDC, WORK, LWORK, INFO )
       END IF
 *
-      WORK( 1 ) = LWMIN
+      WORK( 1 ) = NTHR*LWMIN
 *
       RETURN
 *
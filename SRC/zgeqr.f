@@ -158,6 +158,7 @@
 *>
 *>          T(2): row block size (MB)
 *>          T(3): column block size (NB)
+*>          T(4): arity of the reduction tree (KT), or 0
 *>          T(6:TSIZE): data structure needed for Q, computed by
 *>                           ZLATSQR or ZGEQRT
 *>
@@ -166,6 +167,12 @@
 *>  ZLATSQR (if the matrix is tall-and-skinny) or ZGEQRT to compute
 *>  the QR factorization.
 *>
+*>  If ILAENV( 7, 'ZGEQR', ... ) returns more than one thread, and if
+*>  TSIZE allows it, a tall-and-skinny matrix is factored along a
+*>  KT-ary reduction tree by ZLATSQR_TREE instead, with the leaves and
+*>  the nodes of each level of the tree shared among the threads.  KT
+*>  is ILAENV( 1, 'ZGEQR', ' ', M, N, 3, -1 ), at least 2.
+*>
 *> \endverbatim
 *>
 *> \ingroup geqr
@@ -190,14 +197,16 @@
 *     ..
 *     .. Local Scalars ..
       LOGICAL            LQUERY, LMINWS, MINT, MINW
-      INTEGER            MB, NB, MINTSZ, NBLCKS, LWMIN, LWREQ
+      INTEGER            MB, NB, MINTSZ, NBLCKS, LWMIN, LWREQ, KT,
+     $                   NTHR
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
       EXTERNAL           LSAME
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           ZLATSQR, ZGEQRT, XERBLA
+      EXTERNAL           ZLATSQR, ZLATSQR_TREE, ZGEQRT,
+     $                   XERBLA
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, MIN, MOD
@@ -244,6 +253,23 @@
         NBLCKS = 1
       END IF
 *
+*     Use a reduction tree with several threads and at least two row
+*     blocks, unless T is too small for it.  The tree has M/MB leaves
+*     and M/MB-1 inner nodes.
+*
+      KT = 0
+      NTHR = 1
+      IF( MB.GT.N .AND. M.GE.2*MB ) THEN
+        NTHR = ILAENV( 7, 'ZGEQR ', ' ', M, N, -1, -1 )
+        IF( NTHR.GT.1 .AND. ( LQUERY .OR.
+     $      TSIZE.GE.NB*N*( 2*( M / MB )-1 ) + 5 ) ) THEN
+          KT = MAX( 2, ILAENV( 1, 'ZGEQR ', ' ', M, N, 3, -1 ) )
+          NBLCKS = 2*( M / MB ) - 1
+        ELSE
+          NTHR = 1
+        END IF
+      END IF
+*
 *     Determine if the workspace size satisfies minimal size
 *
       LWMIN = MAX( 1, N )
@@ -285,10 +311,11 @@
         END IF
         T( 2 ) = MB
         T( 3 ) = NB
+        T( 4 ) = KT
         IF( MINW ) THEN
           WORK( 1 ) = LWMIN
         ELSE
-          WORK( 1 ) = LWREQ
+          WORK( 1 ) = NTHR*LWREQ
         END IF
       END IF
       IF( INFO.NE.0 ) THEN
@@ -308,12 +335,15 @@
 *
       IF( ( M.LE.N ) .OR. ( MB.LE.N ) .OR. ( MB.GE.M ) ) THEN
         CALL ZGEQRT( M, N, NB, A, LDA, T( 6 ), NB, WORK, INFO )
+      ELSE IF( KT.GT.0 ) THEN
+        CALL ZLATSQR_TREE( M, N, MB, NB, KT, A, LDA, T( 6 ), NB,
+     $                     WORK, LWORK, INFO )
       ELSE
         CALL ZLATSQR( M, N, MB, NB, A, LDA, T( 6 ), NB, WORK,
      $                LWORK, INFO )
       END IF
 *
-      WORK( 1 ) = LWREQ
+      WORK( 1 ) = NTHR*LWREQ
 *
       RETURN
 *
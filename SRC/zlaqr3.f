@@ -47,6 +47,10 @@
 *>    hoped that the final version of H has many zero subdiagonal
 *>    entries.
 *>
+*>    If ILAENV( 7, 'ZLAQR3', ... ) returns more than one thread, the
+*>    rows and columns of H outside the deflation window, and Z, are
+*>    updated in parallel by ZLAQR3_TASK.
+*>
 *> \endverbatim
 *
 *  Arguments:
@@ -301,7 +305,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ZCOPY, ZGEHRD, ZGEMM, ZLACPY, ZLAHQR,
-     $                   ZLAQR4,
+     $                   ZLAQR3_TASK, ZLAQR4,
      $                   ZLARF1F, ZLARFG, ZLASET, ZTREXC, ZUNMHR
 *     ..
 *     .. Intrinsic Functions ..
@@ -520,44 +524,56 @@
      $                   LDV,
      $                   WORK( JW+1 ), LWORK-JW, INFO )
 *
-*        ==== Update vertical slab in H ====
+         IF( ILAENV( 7, 'ZLAQR3', ' ', N, KWTOP, KBOT, -1 ).GT.1 )
+     $       THEN
+*
+*           ==== Update the slabs of H and Z in parallel ====
 *
-         IF( WANTT ) THEN
-            LTOP = 1
+            CALL ZLAQR3_TASK( WANTT, WANTZ, N, KTOP, KBOT, KWTOP, JW,
+     $                        H, LDH, ILOZ, IHIZ, Z, LDZ, V, LDV, NH,
+     $                        T, LDT, NV, WV, LDWV )
          ELSE
-            LTOP = KTOP
-         END IF
-         DO 60 KROW = LTOP, KWTOP - 1, NV
-            KLN = MIN( NV, KWTOP-KROW )
-            CALL ZGEMM( 'N', 'N', KLN, JW, JW, ONE, H( KROW, KWTOP ),
-     $                  LDH, V, LDV, ZERO, WV, LDWV )
-            CALL ZLACPY( 'A', KLN, JW, WV, LDWV, H( KROW, KWTOP ),
-     $                   LDH )
-   60    CONTINUE
-*
-*        ==== Update horizontal slab in H ====
-*
-         IF( WANTT ) THEN
-            DO 70 KCOL = KBOT + 1, N, NH
-               KLN = MIN( NH, N-KCOL+1 )
-               CALL ZGEMM( 'C', 'N', JW, KLN, JW, ONE, V, LDV,
-     $                     H( KWTOP, KCOL ), LDH, ZERO, T, LDT )
-               CALL ZLACPY( 'A', JW, KLN, T, LDT, H( KWTOP, KCOL ),
-     $                      LDH )
-   70       CONTINUE
-         END IF
 *
-*        ==== Update vertical slab in Z ====
-*
-         IF( WANTZ ) THEN
-            DO 80 KROW = ILOZ, IHIZ, NV
-               KLN = MIN( NV, IHIZ-KROW+1 )
-               CALL ZGEMM( 'N', 'N', KLN, JW, JW, ONE, Z( KROW,
-     $                     KWTOP ),
-     $                     LDZ, V, LDV, ZERO, WV, LDWV )
-               CALL ZLACPY( 'A', KLN, JW, WV, LDWV, Z( KROW, KWTOP ),
-     $                      LDZ )
-   80       CONTINUE
+*           ==== Update vertical slab in H ====
+*
+            IF( WANTT ) THEN
+               LTOP = 1
+            ELSE
+               LTOP = KTOP
+            END IF
+            DO 60 KROW = LTOP, KWTOP - 1, NV
+               KLN = MIN( NV, KWTOP-KROW )
+               CALL ZGEMM( 'N', 'N', KLN, JW, JW, ONE,
+     $                     H( KROW, KWTOP ), LDH, V, LDV, ZERO, WV,
+     $                     LDWV )
+               CALL ZLACPY( 'A', KLN, JW, WV, LDWV, H( KROW, KWTOP ),
+     $                      LDH )
+   60       CONTINUE
+*
+*           ==== Update horizontal slab in H ====
+*
+            IF( WANTT ) THEN
+               DO 70 KCOL = KBOT + 1, N, NH
+                  KLN = MIN( NH, N-KCOL+1 )
+                  CALL ZGEMM( 'C', 'N', JW, KLN, JW, ONE, V, LDV,
+     $                        H( KWTOP, KCOL ), LDH, ZERO, T, LDT )
+                  CALL ZLACPY( 'A', JW, KLN, T, LDT,
+     $                         H( KWTOP, KCOL ), LDH )
+   70          CONTINUE
+            END IF
+*
+*           ==== Update vertical slab in Z ====
+*
+            IF( WANTZ ) THEN
+               DO 80 KROW = ILOZ, IHIZ, NV
+                  KLN = MIN( NV, IHIZ-KROW+1 )
+                  CALL ZGEMM( 'N', 'N', KLN, JW, JW, ONE,
+     $                        Z( KROW, KWTOP ), LDZ, V, LDV, ZERO, WV,
+     $                        LDWV )
+                  CALL ZLACPY( 'A', KLN, JW, WV, LDWV,
+     $                         Z( KROW, KWTOP ), LDZ )
+   80          CONTINUE
+            END IF
          END IF
       END IF
 *
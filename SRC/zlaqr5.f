@@ -38,6 +38,10 @@
 *>
 *>    ZLAQR5, called by ZLAQR0, performs a
 *>    single small-bulge multi-shift QR sweep.
+*>
+*>    If KACC22 = 1 or 2 and ILAENV( 7, 'ZLAQR5', ... ) returns more
+*>    than one thread, the sweep is made by ZLAQR5_TASK, which chases
+*>    several chains of bulges in parallel.
 *> \endverbatim
 *
 *  Arguments:
@@ -284,12 +288,13 @@
       INTEGER            I2, I4, INCOL, J, JBOT, JCOL, JLEN,
      $                   JROW, JTOP, K, K1, KDU, KMS, KRCOL,
      $                   M, M22, MBOT, MTOP, NBMPS, NDCOL,
-     $                   NS, NU
+     $                   NS, NTHR, NU
       LOGICAL            ACCUM, BMP22
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       DOUBLE PRECISION   DLAMCH
-      EXTERNAL           DLAMCH
+      EXTERNAL           ILAENV, DLAMCH
 *     ..
 *     .. Intrinsic Functions ..
 *
@@ -299,8 +304,8 @@
       COMPLEX*16         VT( 3 )
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           ZGEMM, ZLACPY, ZLAQR1, ZLARFG, ZLASET,
-     $                   ZTRMM
+      EXTERNAL           ZGEMM, ZLACPY, ZLAQR1, ZLAQR5_TASK,
+     $                   ZLARFG, ZLASET, ZTRMM
 *     ..
 *     .. Statement Functions ..
       DOUBLE PRECISION   CABS1
@@ -321,6 +326,19 @@
       IF( KTOP.GE.KBOT )
      $   RETURN
 *
+*     ==== With more than one thread, chase several chains of
+*     .    bulges at the same time. ====
+*
+      IF( ( KACC22.EQ.1 .OR. KACC22.EQ.2 ) .AND. NSHFTS.GE.4 ) THEN
+         NTHR = ILAENV( 7, 'ZLAQR5', ' ', N, KTOP, KBOT, NSHFTS )
+         IF( NTHR.GT.1 ) THEN
+            CALL ZLAQR5_TASK( WANTT, WANTZ, N, KTOP, KBOT, NSHFTS,
+     $                        S, H, LDH, ILOZ, IHIZ, Z, LDZ, V, LDV, U,
+     $                        LDU, NV, WV, LDWV, NH, WH, LDWH )
+            RETURN
+         END IF
+      END IF
+*
 *     ==== NSHFTS is supposed to be even, but if it is odd,
 *     .    then simply reduce it by one.  ====
 *
@@ -41,6 +41,8 @@
 *> where U is an upper triangular matrix and L is lower triangular.
 *>
 *> This is the block version of the algorithm, calling Level 3 BLAS.
+*> If ILAENV( 7, 'ZPOTRF', ... ) returns more than one thread, the
+*> factorization is done by the task-parallel ZPOTRF_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -133,7 +135,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           XERBLA, ZGEMM, ZHERK, ZPOTRF2,
-     $                   ZTRSM
+     $                   ZPOTRF_TASK, ZTRSM
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX, MIN
@@ -169,6 +171,12 @@
 *        Use unblocked code.
 *
          CALL ZPOTRF2( UPLO, N, A, LDA, INFO )
+      ELSE IF( ILAENV( 7, 'ZPOTRF', UPLO, N, -1, -1, -1 ).GT.1 )
+     $         THEN
+*
+*        Use the task-parallel blocked code.
+*
+         CALL ZPOTRF_TASK( UPLO, N, A, LDA, INFO )
       ELSE
 *
 *        Use blocked code.
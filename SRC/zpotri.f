@@ -35,6 +35,8 @@
 *> ZPOTRI computes the inverse of a complex Hermitian positive definite
 *> matrix A using the Cholesky factorization A = U**H*U or A = L*L**H
 *> computed by ZPOTRF.
+*> If ILAENV( 7, 'ZPOTRI', ... ) returns more than one thread, the
+*> inverse is computed by the task-parallel ZPOTRI_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -107,10 +109,11 @@
 *
 *     .. External Functions ..
       LOGICAL            LSAME
-      EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           XERBLA, ZLAUUM, ZTRTRI
+      EXTERNAL           XERBLA, ZLAUUM, ZPOTRI_TASK, ZTRTRI
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX
@@ -137,6 +140,14 @@
 *
       IF( N.EQ.0 )
      $   RETURN
+*
+      IF( ILAENV( 7, 'ZPOTRI', UPLO, N, -1, -1, -1 ).GT.1 ) THEN
+*
+*        Use the task-parallel code.
+*
+         CALL ZPOTRI_TASK( UPLO, N, A, LDA, INFO )
+         RETURN
+      END IF
 *
 *     Invert the triangular Cholesky factor U or L.
 *
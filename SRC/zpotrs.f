@@ -35,6 +35,8 @@
 *> ZPOTRS solves a system of linear equations A*X = B with a Hermitian
 *> positive definite matrix A using the Cholesky factorization
 *> A = U**H * U or A = L * L**H computed by ZPOTRF.
+*> If ILAENV( 7, 'ZPOTRS', ... ) returns more than one thread, the
+*> right-hand sides are solved concurrently by ZPOTRS_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -129,10 +131,11 @@
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
-      EXTERNAL           LSAME
+      INTEGER            ILAENV
+      EXTERNAL           LSAME, ILAENV
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           XERBLA, ZTRSM
+      EXTERNAL           XERBLA, ZPOTRS_TASK, ZTRSM
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          MAX
@@ -164,7 +167,13 @@
       IF( N.EQ.0 .OR. NRHS.EQ.0 )
      $   RETURN
 *
-      IF( UPPER ) THEN
+      IF( NRHS.GT.1 .AND.
+     $    ILAENV( 7, 'ZPOTRS', UPLO, N, NRHS, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for blocks of right-hand sides concurrently.
+*
+         CALL ZPOTRS_TASK( UPLO, N, NRHS, A, LDA, B, LDB, INFO )
+      ELSE IF( UPPER ) THEN
 *
 *        Solve A*X = B where A = U**H *U.
 *
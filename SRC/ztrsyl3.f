@@ -32,7 +32,9 @@
 *>  M-by-N; and scale is an output scale factor, set <= 1 to avoid
 *>  overflow in X.
 *>
-*>  This is the block version of the algorithm.
+*>  This is the block version of the algorithm.  If ILAENV( 7,
+*>  'ZTRSYL3', ... ) returns more than one thread, the blocks of X are
+*>  solved in parallel by ZTRSYL3_TASK.
 *> \endverbatim
 *
 *  Arguments:
@@ -204,7 +206,7 @@
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           XERBLA, ZDSCAL, ZGEMM, ZLASCL,
-     $                   ZTRSYL
+     $                   ZTRSYL, ZTRSYL3_TASK
 *     ..
 *     .. Intrinsic Functions ..
       INTRINSIC          ABS, DBLE, DIMAG, EXPONENT, MAX, MIN
@@ -332,7 +334,14 @@
       SGN = DBLE( ISGN )
       CSGN = DCMPLX( SGN, ZERO )
 *
-      IF( NOTRNA .AND. NOTRNB ) THEN
+      IF( ILAENV( 7, 'ZTRSYL3', ' ', M, N, -1, -1 ).GT.1 ) THEN
+*
+*        Solve for the blocks of X by anti-diagonals of the block grid,
+*        in parallel.
+*
+         CALL ZTRSYL3_TASK( TRANA, TRANB, ISGN, M, N, NB, A, LDA, B,
+     $                      LDB, C, LDC, SWORK, LDSWORK, BUF, INFO )
+      ELSE IF( NOTRNA .AND. NOTRNB ) THEN
 *
 *        Solve    A*X + ISGN*X*B = scale*C.
 *
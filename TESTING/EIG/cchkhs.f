@@ -473,10 +473,10 @@
       EXTERNAL           CCOPY, CGEHRD, CGEMM, CGET10, CGET22, CHSEIN,
      $                   CHSEQR, CHST01, CLACPY, CLASET, CLATME, CLATMR,
      $                   CLATMS, CTREVC, CTREVC3, CUNGHR, CUNMHR,
-     $                   SLAFTS, SLASUM, XERBLA
+     $                   SLAFTS, SLASUM, XERBLA, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, MAX, MIN, REAL, SQRT
+      INTRINSIC          ABS, MAX, MIN, MOD, REAL, SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 3, 5*4, 4*6, 6*6, 3*9 /
@@ -564,6 +564,11 @@
             NMATS = NMATS + 1
             NTEST = 0
 *
+*           Use the parallel CLAQR3_TASK and CLAQR5_TASK for
+*           every other matrix type.
+*
+            CALL XLAENV( 7, 1+MOD( JTYPE, 2 ) )
+*
 *           Save ISEED in case of an error.
 *
             DO 20 J = 1, 4
@@ -1145,6 +1150,7 @@
 *
   250    CONTINUE
   260 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Summary
 *
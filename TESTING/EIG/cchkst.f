@@ -645,7 +645,7 @@
      $                   ITYPE, IU, J, JC, JR, JSIZE, JTYPE, LGN,
      $                   LIWEDC, LOG2UI, LRWEDC, LWEDC, M, M2, M3,
      $                   MTYPES, N, NAP, NBLOCK, NERRS, NMATS, NMAX,
-     $                   NSPLIT, NTEST, NTESTT
+     $                   NSMLSZ, NSPLIT, NTEST, NTESTT
       REAL               ABSTOL, ANINV, ANORM, COND, OVFL, RTOVFL,
      $                   RTUNFL, TEMP1, TEMP2, TEMP3, TEMP4, ULP,
      $                   ULPINV, UNFL, VL, VU
@@ -665,10 +665,12 @@
       EXTERNAL           CCOPY, CHET21, CHETRD, CHPT21, CHPTRD, CLACPY,
      $                   CLASET, CLATMR, CLATMS, CPTEQR, CSTEDC, CSTEMR,
      $                   CSTEIN, CSTEQR, CSTT21, CSTT22, CUNGTR, CUPGTR,
-     $                   SCOPY, SLASUM, SSTEBZ, SSTECH, SSTERF, XERBLA
+     $                   SCOPY, SLASUM, SSTEBZ, SSTECH, SSTERF, XERBLA,
+     $                   XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, CONJG, INT, LOG, MAX, MIN, REAL, SQRT
+      INTRINSIC          ABS, CONJG, INT, LOG, MAX, MIN, MOD, REAL,
+     $                   SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 8,
@@ -701,6 +703,7 @@
 *
       NBLOCK = ILAENV( 1, 'CHETRD', 'L', NMAX, -1, -1, -1 )
       NBLOCK = MIN( NMAX, MAX( 1, NBLOCK ) )
+      NSMLSZ = ILAENV( 9, 'CSTEDC', 'I', NMAX, 0, 0, 0 )
 *
 *     Check for errors
 *
@@ -776,6 +779,18 @@
      $         GO TO 300
             NMATS = NMATS + 1
             NTEST = 0
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of SSTEDC, called by CSTEDC, with pieces of at most
+*           5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 30 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -1950,6 +1965,8 @@
   290       CONTINUE
   300    CONTINUE
   310 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -34,7 +34,8 @@
 *> \verbatim
 *>
 *> CDRVBD checks the singular value decomposition (SVD) driver CGESVD,
-*> CGESDD, CGESVJ, CGEJSV, CGESVDX, and CGESVDQ.
+*> CGESDD, CGESVJ, CGEJSV, CGESVDX, CGESVDQ, CGESVD_2STAGE and
+*> CGESDD_2STAGE.
 *>
 *> CGESVD and CGESDD factors A = U diag(S) VT, where U and VT are
 *> unitary and diag(S) is diagonal with the entries of the array S on
@@ -103,6 +104,14 @@
 *> (39)  S contains MNMIN nonnegative values in decreasing order.
 *>       (Return 0 if true, 1/ULP if false.)
 *>
+*> Test for CGESVD_2STAGE( 'N', 'N' ) and CGESDD_2STAGE( 'N' ):
+*>
+*> (40)  | S - S2 | / ( MNMIN ulp |S| ) where S2 is the vector of
+*>       singular values from CGESVD_2STAGE
+*>
+*> (41)  | S - S2 | / ( MNMIN ulp |S| ) where S2 is the vector of
+*>       singular values from CGESDD_2STAGE
+*>
 *> Test for CGESVJ:
 *>
 *> (15)  | A - U diag(S) VT | / ( |A| max(M,N) ulp )
@@ -438,7 +447,7 @@
      $                   IWSPC, IWTMP, J, JSIZE, JTYPE, LSWORK, M,
      $                   MINWRK, MMAX, MNMAX, MNMIN, MTYPES, N,
      $                   NERRS, NFAIL, NMAX, NS, NSI, NSV, NTEST,
-     $                   NTESTF, NTESTT, LRWORK
+     $                   NSMLSZ, NTESTF, NTESTT, LRWORK
       REAL               ANORM, DIF, DIV, OVFL, RTUNFL, ULP, ULPINV,
      $                   UNFL, VL, VU
 *     ..
@@ -448,19 +457,21 @@
 *     .. Local Arrays ..
       CHARACTER          CJOB( 4 ), CJOBR( 3 ), CJOBV( 2 )
       INTEGER            IOLDSD( 4 ), ISEED2( 4 )
-      REAL               RESULT( 39 )
+      REAL               RESULT( 41 )
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SLAMCH, SLARND
-      EXTERNAL           SLAMCH, SLARND
+      EXTERNAL           ILAENV, SLAMCH, SLARND
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALASVM, XERBLA, CBDT01, CBDT05, CGESDD,
      $                   CGESVD, CGESVDQ, CGESVJ, CGEJSV, CGESVDX,
-     $                   CLACPY, CLASET, CLATMS, CUNT01, CUNT03
+     $                   CLACPY, CLASET, CLATMS, CUNT01, CUNT03,
+     $                   CGESVD_2STAGE, CGESDD_2STAGE, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, REAL, MAX, MIN
+      INTRINSIC          ABS, REAL, INT, MAX, MIN, MOD
 *     ..
 *     .. Scalars in Common ..
       CHARACTER*32       SRNAMT
@@ -540,6 +551,7 @@
       ULP = SLAMCH( 'E' )
       ULPINV = ONE / ULP
       RTUNFL = SQRT( UNFL )
+      NSMLSZ = ILAENV( 9, 'SBDSDC', ' ', 0, 0, 0, 0 )
 *
 *     Loop over sizes, types
 *
@@ -560,6 +572,17 @@
             IF( .NOT.DOTYPE( JTYPE ) )
      $         GO TO 300
             NTEST = 0
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of CGESDD, with subproblems of at most 5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 20 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -908,6 +931,63 @@
                   END IF
                END IF
 *
+*              Test CGESVD_2STAGE and CGESDD_2STAGE, computing the
+*              singular values only, against SSAV
+*
+               RESULT( 40 ) = ZERO
+               RESULT( 41 ) = ZERO
+               DIV = MAX( MNMIN*ULP*SSAV( 1 ), UNFL )
+*
+               SRNAMT = 'CGESVD_2STAGE'
+               CALL CGESVD_2STAGE( 'N', 'N', M, N, A, LDA, S, U, LDU,
+     $                             VT, LDVT, WORK, -1, RWORK, IINFO )
+               IWTMP = INT( WORK( 1 ) )
+               LSWORK = IWTMP + ( IWSPC-1 )*( LWORK-IWTMP ) / 3
+               LSWORK = MIN( LSWORK, LWORK )
+               LSWORK = MAX( LSWORK, 1 )
+               IF( IWSPC.EQ.4 )
+     $            LSWORK = LWORK
+*
+               CALL CLACPY( 'F', M, N, ASAV, LDA, A, LDA )
+               CALL CGESVD_2STAGE( 'N', 'N', M, N, A, LDA, S, U, LDU,
+     $                             VT, LDVT, WORK, LSWORK, RWORK,
+     $                             IINFO )
+               IF( IINFO.NE.0 ) THEN
+                  WRITE( NOUNIT, FMT = 9995 )'GESVD_2STAGE', IINFO, M,
+     $               N, JTYPE, LSWORK, IOLDSD
+                  INFO = ABS( IINFO )
+                  RETURN
+               END IF
+               DO 201 I = 1, MNMIN
+                  RESULT( 40 ) = MAX( RESULT( 40 ),
+     $                           ABS( SSAV( I )-S( I ) ) / DIV )
+  201          CONTINUE
+*
+               SRNAMT = 'CGESDD_2STAGE'
+               CALL CGESDD_2STAGE( 'N', M, N, A, LDA, S, U, LDU, VT,
+     $                             LDVT, WORK, -1, RWORK, IWORK, IINFO )
+               IWTMP = INT( WORK( 1 ) )
+               LSWORK = IWTMP + ( IWSPC-1 )*( LWORK-IWTMP ) / 3
+               LSWORK = MIN( LSWORK, LWORK )
+               LSWORK = MAX( LSWORK, 1 )
+               IF( IWSPC.EQ.4 )
+     $            LSWORK = LWORK
+*
+               CALL CLACPY( 'F', M, N, ASAV, LDA, A, LDA )
+               CALL CGESDD_2STAGE( 'N', M, N, A, LDA, S, U, LDU, VT,
+     $                             LDVT, WORK, LSWORK, RWORK, IWORK,
+     $                             IINFO )
+               IF( IINFO.NE.0 ) THEN
+                  WRITE( NOUNIT, FMT = 9995 )'GESDD_2STAGE', IINFO, M,
+     $               N, JTYPE, LSWORK, IOLDSD
+                  INFO = ABS( IINFO )
+                  RETURN
+               END IF
+               DO 202 I = 1, MNMIN
+                  RESULT( 41 ) = MAX( RESULT( 41 ),
+     $                           ABS( SSAV( I )-S( I ) ) / DIV )
+  202          CONTINUE
+*
 *              Test CGESVJ
 *              Note: CGESVJ only works for M >= N
 *
@@ -1228,7 +1308,7 @@
 *
                NTEST = 0
                NFAIL = 0
-               DO 190 J = 1, 39
+               DO 190 J = 1, 41
                   IF( RESULT( J ).GE.ZERO )
      $               NTEST = NTEST + 1
                   IF( RESULT( J ).GE.THRESH )
@@ -1243,7 +1323,7 @@
                   NTESTF = 2
                END IF
 *
-               DO 200 J = 1, 39
+               DO 200 J = 1, 41
                   IF( RESULT( J ).GE.THRESH ) THEN
                      WRITE( NOUNIT, FMT = 9997 )M, N, JTYPE, IWSPC,
      $                  IOLDSD, J, RESULT( J )
@@ -1257,6 +1337,8 @@
 *
   300    CONTINUE
   310 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -1325,6 +1407,10 @@
      $      / '38 = | I - VT VT**T | / ( N ulp ) ',
      $      / '39 = 0 if S contains min(M,N) nonnegative values in',
      $      ' decreasing order, else 1/ulp',
+     $      / '40 = | S - S2 | / ( min(M,N) ulp |S| ),',
+     $      ' CGESVD_2STAGE(N,N) ',
+     $      / '41 = | S - S2 | / ( min(M,N) ulp |S| ),',
+     $      ' CGESDD_2STAGE(N) ',
      $      / / )
  9997 FORMAT( ' M=', I5, ', N=', I5, ', type ', I1, ', IWS=', I1,
      $      ', seed=', 4( I4, ',' ), ' test(', I2, ')=', G11.4 )
@@ -136,10 +136,11 @@
       EXTERNAL           SISNAN, SLAMCH, CLANGE
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CLATMR, CLACPY, CGEMM, CTRSYL, CTRSYL3
+      EXTERNAL           CLATMR, CLACPY, CGEMM, CTRSYL, CTRSYL3,
+     $                   XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, REAL, MAX
+      INTRINSIC          ABS, REAL, MAX, MOD
 *     ..
 *     .. Allocate memory dynamically ..
       ALLOCATE ( A( MAXM, MAXM ), STAT = AllocateStatus )
@@ -265,6 +266,11 @@
 *
                         CALL CLACPY( 'All', M, N, C, MAXM, X, MAXM )
                         CALL CLACPY( 'All', M, N, C, MAXM, CC, MAXM )
+*
+*                       Alternate between the serial and the parallel
+*                       block solvers of CTRSYL3.
+*
+                        CALL XLAENV( 7, 1+MOD( M+N, 2 ) )
                         CALL CTRSYL3( TRANA, TRANB, ISGN, M, N,
      $                                A, MAXM, B, MAXN, X, MAXM,
      $                                SCALE3, SWORK, LDSWORK, INFO)
@@ -302,6 +308,8 @@
             END DO
          END DO
       END DO
+*
+      CALL XLAENV( 7, 1 )
 *
       DEALLOCATE (A, STAT = AllocateStatus)
       DEALLOCATE (B, STAT = AllocateStatus)
@@ -471,10 +471,10 @@
       EXTERNAL           DCOPY, DGEHRD, DGEMM, DGET10, DGET22, DHSEIN,
      $                   DHSEQR, DHST01, DLACPY, DLAFTS, DLASET, DLASUM,
      $                   DLATME, DLATMR, DLATMS, DORGHR, DORMHR, DTREVC,
-     $                   DTREVC3, XERBLA
+     $                   DTREVC3, XERBLA, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, DBLE, MAX, MIN, SQRT
+      INTRINSIC          ABS, DBLE, MAX, MIN, MOD, SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 3, 5*4, 4*6, 6*6, 3*9 /
@@ -562,6 +562,11 @@
             NMATS = NMATS + 1
             NTEST = 0
 *
+*           Use the parallel DLAQR3_TASK and DLAQR5_TASK for
+*           every other matrix type.
+*
+            CALL XLAENV( 7, 1+MOD( JTYPE, 2 ) )
+*
 *           Save ISEED in case of an error.
 *
             DO 20 J = 1, 4
@@ -1185,6 +1190,7 @@
 *
   260    CONTINUE
   270 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Summary
 *
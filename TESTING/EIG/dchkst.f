@@ -628,7 +628,7 @@
       INTEGER            I, IINFO, IL, IMODE, ITEMP, ITYPE, IU, J, JC,
      $                   JR, JSIZE, JTYPE, LGN, LIWEDC, LOG2UI, LWEDC,
      $                   M, M2, M3, MTYPES, N, NAP, NBLOCK, NERRS,
-     $                   NMATS, NMAX, NSPLIT, NTEST, NTESTT
+     $                   NMATS, NMAX, NSMLSZ, NSPLIT, NTEST, NTESTT
       DOUBLE PRECISION   ABSTOL, ANINV, ANORM, COND, OVFL, RTOVFL,
      $                   RTUNFL, TEMP1, TEMP2, TEMP3, TEMP4, ULP,
      $                   ULPINV, UNFL, VL, VU
@@ -648,10 +648,11 @@
       EXTERNAL           DCOPY, DLACPY, DLASET, DLASUM, DLATMR, DLATMS,
      $                   DOPGTR, DORGTR, DPTEQR, DSPT21, DSPTRD, DSTEBZ,
      $                   DSTECH, DSTEDC, DSTEMR, DSTEIN, DSTEQR, DSTERF,
-     $                   DSTT21, DSTT22, DSYT21, DSYTRD, XERBLA
+     $                   DSTT21, DSTT22, DSYT21, DSYTRD, XERBLA,
+     $                   XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, DBLE, INT, LOG, MAX, MIN, SQRT
+      INTRINSIC          ABS, DBLE, INT, LOG, MAX, MIN, MOD, SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 8,
@@ -684,6 +685,7 @@
 *
       NBLOCK = ILAENV( 1, 'DSYTRD', 'L', NMAX, -1, -1, -1 )
       NBLOCK = MIN( NMAX, MAX( 1, NBLOCK ) )
+      NSMLSZ = ILAENV( 9, 'DSTEDC', 'I', NMAX, 0, 0, 0 )
 *
 *     Check for errors
 *
@@ -757,6 +759,17 @@
      $         GO TO 300
             NMATS = NMATS + 1
             NTEST = 0
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of DSTEDC, with pieces of at most 5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 30 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -1929,6 +1942,8 @@
   290       CONTINUE
   300    CONTINUE
   310 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -133,10 +133,11 @@
       EXTERNAL           DLAMCH, DLANGE
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           DLATMR, DLACPY, DGEMM, DTRSYL, DTRSYL3
+      EXTERNAL           DLATMR, DLACPY, DGEMM, DTRSYL, DTRSYL3,
+     $                   XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, DBLE, MAX
+      INTRINSIC          ABS, DBLE, MAX, MOD
 *     ..
 *     .. Allocate memory dynamically ..
       ALLOCATE ( A( MAXM, MAXM ), STAT = AllocateStatus )
@@ -258,6 +259,11 @@
 *
                         CALL DLACPY( 'All', M, N, C, MAXM, X, MAXM )
                         CALL DLACPY( 'All', M, N, C, MAXM, CC, MAXM )
+*
+*                       Alternate between the serial and the parallel
+*                       block solvers of DTRSYL3.
+*
+                        CALL XLAENV( 7, 1+MOD( M+N, 2 ) )
                         CALL DTRSYL3( TRANA, TRANB, ISGN, M, N,
      $                                A, MAXM, B, MAXN, X, MAXM,
      $                                SCALE3, IWORK, LIWORK,
@@ -296,6 +302,8 @@
             END DO
          END DO
       END DO
+*
+      CALL XLAENV( 7, 1 )
 *
       DEALLOCATE (A, STAT = AllocateStatus)
       DEALLOCATE (B, STAT = AllocateStatus)
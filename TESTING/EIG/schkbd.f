@@ -526,7 +526,7 @@
      $                   IWBE, IWBS, IWBZ, IWWORK, J, JCOL, JSIZE,
      $                   JTYPE, LOG2UI, M, MINWRK, MMAX, MNMAX, MNMIN,
      $                   MNMIN2, MQ, MTYPES, N, NFAIL, NMAX,
-     $                   NS1, NS2, NTEST
+     $                   NS1, NS2, NSMLSZ, NTEST
       REAL               ABSTOL, AMNINV, ANORM, COND, OVFL, RTOVFL,
      $                   RTUNFL, TEMP1, TEMP2, ULP, ULPINV, UNFL,
      $                   VL, VU
@@ -538,17 +538,18 @@
       REAL               DUM( 1 ), DUMMA( 1 ), RESULT( 40 )
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SLAMCH, SLARND, SSXT1
-      EXTERNAL           SLAMCH, SLARND, SSXT1
+      EXTERNAL           ILAENV, SLAMCH, SLARND, SSXT1
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALASUM, SBDSDC, SBDSQR, SBDSVDX, SBDT01,
      $                   SBDT02, SBDT03, SBDT04, SCOPY, SGEBRD,
      $                   SGEMM, SLACPY, SLAHD2, SLASET, SLATMR,
-     $                   SLATMS, SORGBR, SORT01, XERBLA
+     $                   SLATMS, SORGBR, SORT01, XERBLA, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, EXP, INT, LOG, MAX, MIN, SQRT
+      INTRINSIC          ABS, EXP, INT, LOG, MAX, MIN, MOD, SQRT
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -633,6 +634,7 @@
       RTUNFL = SQRT( UNFL )
       RTOVFL = SQRT( OVFL )
       INFOT = 0
+      NSMLSZ = ILAENV( 9, 'SBDSDC', ' ', 0, 0, 0, 0 )
       ABSTOL = 2*UNFL
 *
 *     Loop over sizes, types
@@ -652,6 +654,17 @@
          DO 290 JTYPE = 1, MTYPES
             IF( .NOT.DOTYPE( JTYPE ) )
      $         GO TO 290
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of SBDSDC, with subproblems of at most 5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 20 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -1509,6 +1522,8 @@
 *
   290    CONTINUE
   300 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -470,10 +470,10 @@
       EXTERNAL           SCOPY, SGEHRD, SGEMM, SGET10, SGET22, SHSEIN,
      $                   SHSEQR, SHST01, SLACPY, SLAFTS, SLASET, SLASUM,
      $                   SLATME, SLATMR, SLATMS, SORGHR, SORMHR, STREVC,
-     $                   STREVC3, XERBLA
+     $                   STREVC3, XERBLA, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, MAX, MIN, REAL, SQRT
+      INTRINSIC          ABS, MAX, MIN, MOD, REAL, SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 3, 5*4, 4*6, 6*6, 3*9 /
@@ -561,6 +561,11 @@
             NMATS = NMATS + 1
             NTEST = 0
 *
+*           Use the parallel SLAQR3_TASK and SLAQR5_TASK for
+*           every other matrix type.
+*
+            CALL XLAENV( 7, 1+MOD( JTYPE, 2 ) )
+*
 *           Save ISEED in case of an error.
 *
             DO 20 J = 1, 4
@@ -1184,6 +1189,7 @@
 *
   260    CONTINUE
   270 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Summary
 *
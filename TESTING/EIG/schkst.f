@@ -628,7 +628,7 @@
       INTEGER            I, IINFO, IL, IMODE, ITEMP, ITYPE, IU, J, JC,
      $                   JR, JSIZE, JTYPE, LGN, LIWEDC, LOG2UI, LWEDC,
      $                   M, M2, M3, MTYPES, N, NAP, NBLOCK, NERRS,
-     $                   NMATS, NMAX, NSPLIT, NTEST, NTESTT
+     $                   NMATS, NMAX, NSMLSZ, NSPLIT, NTEST, NTESTT
       REAL               ABSTOL, ANINV, ANORM, COND, OVFL, RTOVFL,
      $                   RTUNFL, TEMP1, TEMP2, TEMP3, TEMP4, ULP,
      $                   ULPINV, UNFL, VL, VU
@@ -648,10 +648,11 @@
       EXTERNAL           SCOPY, SLACPY, SLASET, SLASUM, SLATMR, SLATMS,
      $                   SOPGTR, SORGTR, SPTEQR, SSPT21, SSPTRD, SSTEBZ,
      $                   SSTECH, SSTEDC, SSTEMR, SSTEIN, SSTEQR, SSTERF,
-     $                   SSTT21, SSTT22, SSYT21, SSYTRD, XERBLA
+     $                   SSTT21, SSTT22, SSYT21, SSYTRD, XERBLA,
+     $                   XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, INT, LOG, MAX, MIN, REAL, SQRT
+      INTRINSIC          ABS, INT, LOG, MAX, MIN, MOD, REAL, SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 8,
@@ -684,6 +685,7 @@
 *
       NBLOCK = ILAENV( 1, 'SSYTRD', 'L', NMAX, -1, -1, -1 )
       NBLOCK = MIN( NMAX, MAX( 1, NBLOCK ) )
+      NSMLSZ = ILAENV( 9, 'SSTEDC', 'I', NMAX, 0, 0, 0 )
 *
 *     Check for errors
 *
@@ -757,6 +759,17 @@
      $         GO TO 300
             NMATS = NMATS + 1
             NTEST = 0
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of SSTEDC, with pieces of at most 5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 30 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -1929,6 +1942,8 @@
   290       CONTINUE
   300    CONTINUE
   310 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -32,7 +32,8 @@
 *> \verbatim
 *>
 *> SDRVBD checks the singular value decomposition (SVD) drivers
-*> SGESVD, SGESDD, SGESVDQ, SGESVJ, SGEJSV, and DGESVDX.
+*> SGESVD, SGESDD, SGESVDQ, SGESVJ, SGEJSV, SGESVDX,
+*> SGESVD_2STAGE and SGESDD_2STAGE.
 *>
 *> Both SGESVD and SGESDD factor A = U diag(S) VT, where U and VT are
 *> orthogonal and diag(S) is diagonal with the entries of the array S
@@ -101,6 +102,14 @@
 *> (39)   S contains MNMIN nonnegative values in decreasing order.
 *>        (Return 0 if true, 1/ULP if false.)
 *>
+*> Test for SGESVD_2STAGE( 'N', 'N' ) and SGESDD_2STAGE( 'N' ):
+*>
+*> (40)   | S - S2 | / ( MNMIN ulp |S| ) where S2 is the vector of
+*>        singular values from SGESVD_2STAGE
+*>
+*> (41)   | S - S2 | / ( MNMIN ulp |S| ) where S2 is the vector of
+*>        singular values from SGESDD_2STAGE
+*>
 *> Test for SGESVJ:
 *>
 *> (15)   | A - U diag(S) VT | / ( |A| max(M,N) ulp )
@@ -399,7 +408,7 @@
       INTEGER            I, IINFO, IJQ, IJU, IJVT, IL,IU, IWS, IWTMP,
      $                   ITEMP, J, JSIZE, JTYPE, LSWORK, M, MINWRK,
      $                   MMAX, MNMAX, MNMIN, MTYPES, N, NFAIL,
-     $                   NMAX, NS, NSI, NSV, NTEST
+     $                   NMAX, NS, NSI, NSMLSZ, NSV, NTEST
       REAL               ANORM, DIF, DIV, OVFL, RTUNFL, ULP,
      $                   ULPINV, UNFL, VL, VU
 *     ..
@@ -412,19 +421,21 @@
 *     .. Local Arrays ..
       CHARACTER          CJOB( 4 ), CJOBR( 3 ), CJOBV( 2 )
       INTEGER            IOLDSD( 4 ), ISEED2( 4 )
-      REAL               RESULT( 39 )
+      REAL               RESULT( 41 )
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       REAL               SLAMCH, SLARND
-      EXTERNAL           SLAMCH, SLARND
+      EXTERNAL           ILAENV, SLAMCH, SLARND
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALASVM, SBDT01, SGEJSV, SGESDD, SGESVD,
      $                   SGESVDQ, SGESVDX, SGESVJ, SLACPY, SLASET,
-     $                   SLATMS, SORT01, SORT03, XERBLA
+     $                   SLATMS, SORT01, SORT03, XERBLA,
+     $                   SGESVD_2STAGE, SGESDD_2STAGE, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, REAL, INT, MAX, MIN
+      INTRINSIC          ABS, REAL, INT, MAX, MIN, MOD
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -501,6 +512,7 @@
       RTUNFL = SQRT( UNFL )
       ULPINV = ONE / ULP
       INFOT = 0
+      NSMLSZ = ILAENV( 9, 'SBDSDC', ' ', 0, 0, 0, 0 )
 *
 *     Loop over sizes, types
 *
@@ -518,6 +530,17 @@
          DO 230 JTYPE = 1, MTYPES
             IF( .NOT.DOTYPE( JTYPE ) )
      $         GO TO 230
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of SGESDD, with subproblems of at most 5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 20 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -852,6 +875,62 @@
                   END IF
                END IF
 *
+*              Test SGESVD_2STAGE and SGESDD_2STAGE, computing the
+*              singular values only, against SSAV
+*
+               RESULT( 40 ) = ZERO
+               RESULT( 41 ) = ZERO
+               DIV = MAX( MNMIN*ULP*SSAV( 1 ), UNFL )
+*
+               SRNAMT = 'SGESVD_2STAGE'
+               CALL SGESVD_2STAGE( 'N', 'N', M, N, A, LDA, S, U, LDU,
+     $                             VT, LDVT, WORK, -1, IINFO )
+               IWTMP = INT( WORK( 1 ) )
+               LSWORK = IWTMP + ( IWS-1 )*( LWORK-IWTMP ) / 3
+               LSWORK = MIN( LSWORK, LWORK )
+               LSWORK = MAX( LSWORK, 1 )
+               IF( IWS.EQ.4 )
+     $            LSWORK = LWORK
+*
+               CALL SLACPY( 'F', M, N, ASAV, LDA, A, LDA )
+               CALL SGESVD_2STAGE( 'N', 'N', M, N, A, LDA, S, U, LDU,
+     $                             VT, LDVT, WORK, LSWORK, IINFO )
+               IF( IINFO.NE.0 ) THEN
+                  WRITE( NOUT, FMT = 9995 )'GESVD_2STAGE', IINFO, M,
+     $               N, JTYPE, LSWORK, IOLDSD
+                  INFO = ABS( IINFO )
+                  RETURN
+               END IF
+               DO 201 I = 1, MNMIN
+                  RESULT( 40 ) = MAX( RESULT( 40 ),
+     $                           ABS( SSAV( I )-S( I ) ) / DIV )
+  201          CONTINUE
+*
+               SRNAMT = 'SGESDD_2STAGE'
+               CALL SGESDD_2STAGE( 'N', M, N, A, LDA, S, U, LDU, VT,
+     $                             LDVT, WORK, -1, IWORK, IINFO )
+               IWTMP = INT( WORK( 1 ) )
+               LSWORK = IWTMP + ( IWS-1 )*( LWORK-IWTMP ) / 3
+               LSWORK = MIN( LSWORK, LWORK )
+               LSWORK = MAX( LSWORK, 1 )
+               IF( IWS.EQ.4 )
+     $            LSWORK = LWORK
+*
+               CALL SLACPY( 'F', M, N, ASAV, LDA, A, LDA )
+               CALL SGESDD_2STAGE( 'N', M, N, A, LDA, S, U, LDU, VT,
+     $                             LDVT, WORK, LSWORK, IWORK,
+     $                             IINFO )
+               IF( IINFO.NE.0 ) THEN
+                  WRITE( NOUT, FMT = 9995 )'GESDD_2STAGE', IINFO, M,
+     $               N, JTYPE, LSWORK, IOLDSD
+                  INFO = ABS( IINFO )
+                  RETURN
+               END IF
+               DO 202 I = 1, MNMIN
+                  RESULT( 41 ) = MAX( RESULT( 41 ),
+     $                           ABS( SSAV( I )-S( I ) ) / DIV )
+  202          CONTINUE
+*
 *              Test SGESVJ
 *              Note: SGESVJ only works for M >= N
 *
@@ -1155,7 +1234,7 @@
 *
 *              End of Loop -- Check for RESULT(j) > THRESH
 *
-               DO 210 J = 1, 39
+               DO 210 J = 1, 41
                   IF( RESULT( J ).GE.THRESH ) THEN
                      IF( NFAIL.EQ.0 ) THEN
                         WRITE( NOUT, FMT = 9999 )
@@ -1166,10 +1245,12 @@
                      NFAIL = NFAIL + 1
                   END IF
   210          CONTINUE
-               NTEST = NTEST + 39
+               NTEST = NTEST + 41
   220       CONTINUE
   230    CONTINUE
   240 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -1233,6 +1314,10 @@
      $      / '38 = | I - VT VT**T | / ( N ulp ) ',
      $      / '39 = 0 if S contains min(M,N) nonnegative values in',
      $      ' decreasing order, else 1/ulp',
+     $      / '40 = | S - S2 | / ( min(M,N) ulp |S| ),',
+     $      ' SGESVD_2STAGE(N,N) ',
+     $      / '41 = | S - S2 | / ( min(M,N) ulp |S| ),',
+     $      ' SGESDD_2STAGE(N) ',
      $      / / )
  9997 FORMAT( ' M=', I5, ', N=', I5, ', type ', I1, ', IWS=', I1,
      $      ', seed=', 4( I4, ',' ), ' test(', I2, ')=', G11.4 )
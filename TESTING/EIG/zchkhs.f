@@ -473,10 +473,10 @@
       EXTERNAL           DLAFTS, DLASUM, XERBLA, ZCOPY, ZGEHRD, ZGEMM,
      $                   ZGET10, ZGET22, ZHSEIN, ZHSEQR, ZHST01, ZLACPY,
      $                   ZLASET, ZLATME, ZLATMR, ZLATMS, ZTREVC, ZTREVC3,
-     $                   ZUNGHR, ZUNMHR
+     $                   XLAENV, ZUNGHR, ZUNMHR
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, DBLE, MAX, MIN, SQRT
+      INTRINSIC          ABS, DBLE, MAX, MIN, MOD, SQRT
 *     ..
 *     .. Data statements ..
       DATA               KTYPE / 1, 2, 3, 5*4, 4*6, 6*6, 3*9 /
@@ -564,6 +564,11 @@
             NMATS = NMATS + 1
             NTEST = 0
 *
+*           Use the parallel ZLAQR3_TASK and ZLAQR5_TASK for
+*           every other matrix type.
+*
+            CALL XLAENV( 7, 1+MOD( JTYPE, 2 ) )
+*
 *           Save ISEED in case of an error.
 *
             DO 20 J = 1, 4
@@ -1145,6 +1150,7 @@
 *
   250    CONTINUE
   260 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Summary
 *
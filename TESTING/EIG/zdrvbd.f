@@ -34,7 +34,8 @@
 *> \verbatim
 *>
 *> ZDRVBD checks the singular value decomposition (SVD) driver ZGESVD,
-*> ZGESDD, ZGESVJ, ZGEJSV, ZGESVDX, and ZGESVDQ.
+*> ZGESDD, ZGESVJ, ZGEJSV, ZGESVDX, ZGESVDQ, ZGESVD_2STAGE and
+*> ZGESDD_2STAGE.
 *>
 *> ZGESVD and ZGESDD factors A = U diag(S) VT, where U and VT are
 *> unitary and diag(S) is diagonal with the entries of the array S on
@@ -103,6 +104,14 @@
 *> (39)  S contains MNMIN nonnegative values in decreasing order.
 *>       (Return 0 if true, 1/ULP if false.)
 *>
+*> Test for ZGESVD_2STAGE( 'N', 'N' ) and ZGESDD_2STAGE( 'N' ):
+*>
+*> (40)  | S - S2 | / ( MNMIN ulp |S| ) where S2 is the vector of
+*>       singular values from ZGESVD_2STAGE
+*>
+*> (41)  | S - S2 | / ( MNMIN ulp |S| ) where S2 is the vector of
+*>       singular values from ZGESDD_2STAGE
+*>
 *> Test for ZGESVJ:
 *>
 *> (15)  | A - U diag(S) VT | / ( |A| max(M,N) ulp )
@@ -438,7 +447,7 @@
      $                   IWSPC, IWTMP, J, JSIZE, JTYPE, LSWORK, M,
      $                   MINWRK, MMAX, MNMAX, MNMIN, MTYPES, N,
      $                   NERRS, NFAIL, NMAX, NS, NSI, NSV, NTEST,
-     $                   NTESTF, NTESTT, LRWORK
+     $                   NSMLSZ, NTESTF, NTESTT, LRWORK
       DOUBLE PRECISION   ANORM, DIF, DIV, OVFL, RTUNFL, ULP, ULPINV,
      $                   UNFL, VL, VU
 *     ..
@@ -448,19 +457,21 @@
 *     .. Local Arrays ..
       CHARACTER          CJOB( 4 ), CJOBR( 3 ), CJOBV( 2 )
       INTEGER            IOLDSD( 4 ), ISEED2( 4 )
-      DOUBLE PRECISION   RESULT( 39 )
+      DOUBLE PRECISION   RESULT( 41 )
 *     ..
 *     .. External Functions ..
+      INTEGER            ILAENV
       DOUBLE PRECISION   DLAMCH, DLARND
-      EXTERNAL           DLAMCH, DLARND
+      EXTERNAL           ILAENV, DLAMCH, DLARND
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALASVM, XERBLA, ZBDT01, ZBDT05, ZGESDD,
      $                   ZGESVD, ZGESVDQ, ZGESVJ, ZGEJSV, ZGESVDX,
-     $                   ZLACPY, ZLASET, ZLATMS, ZUNT01, ZUNT03
+     $                   ZLACPY, ZLASET, ZLATMS, ZUNT01, ZUNT03,
+     $                   ZGESVD_2STAGE, ZGESDD_2STAGE, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, DBLE, MAX, MIN
+      INTRINSIC          ABS, DBLE, INT, MAX, MIN, MOD
 *     ..
 *     .. Scalars in Common ..
       CHARACTER*32       SRNAMT
@@ -540,6 +551,7 @@
       ULP = DLAMCH( 'E' )
       ULPINV = ONE / ULP
       RTUNFL = SQRT( UNFL )
+      NSMLSZ = ILAENV( 9, 'DBDSDC', ' ', 0, 0, 0, 0 )
 *
 *     Loop over sizes, types
 *
@@ -560,6 +572,17 @@
             IF( .NOT.DOTYPE( JTYPE ) )
      $         GO TO 220
             NTEST = 0
+*
+*           For every other matrix type, use the parallel divide and
+*           conquer of ZGESDD, with subproblems of at most 5 rows.
+*
+            IF( MOD( JTYPE, 2 ).EQ.0 ) THEN
+               CALL XLAENV( 7, 2 )
+               CALL XLAENV( 9, 4 )
+            ELSE
+               CALL XLAENV( 7, 1 )
+               CALL XLAENV( 9, NSMLSZ )
+            END IF
 *
             DO 20 J = 1, 4
                IOLDSD( J ) = ISEED( J )
@@ -907,6 +930,63 @@
                   END IF
                END IF
 *
+*              Test ZGESVD_2STAGE and ZGESDD_2STAGE, computing the
+*              singular values only, against SSAV
+*
+               RESULT( 40 ) = ZERO
+               RESULT( 41 ) = ZERO
+               DIV = MAX( MNMIN*ULP*SSAV( 1 ), UNFL )
+*
+               SRNAMT = 'ZGESVD_2STAGE'
+               CALL ZGESVD_2STAGE( 'N', 'N', M, N, A, LDA, S, U, LDU,
+     $                             VT, LDVT, WORK, -1, RWORK, IINFO )
+               IWTMP = INT( WORK( 1 ) )
+               LSWORK = IWTMP + ( IWSPC-1 )*( LWORK-IWTMP ) / 3
+               LSWORK = MIN( LSWORK, LWORK )
+               LSWORK = MAX( LSWORK, 1 )
+               IF( IWSPC.EQ.4 )
+     $            LSWORK = LWORK
+*
+               CALL ZLACPY( 'F', M, N, ASAV, LDA, A, LDA )
+               CALL ZGESVD_2STAGE( 'N', 'N', M, N, A, LDA, S, U, LDU,
+     $                             VT, LDVT, WORK, LSWORK, RWORK,
+     $                             IINFO )
+               IF( IINFO.NE.0 ) THEN
+                  WRITE( NOUNIT, FMT = 9995 )'GESVD_2STAGE', IINFO, M,
+     $               N, JTYPE, LSWORK, IOLDSD
+                  INFO = ABS( IINFO )
+                  RETURN
+               END IF
+               DO 201 I = 1, MNMIN
+                  RESULT( 40 ) = MAX( RESULT( 40 ),
+     $                           ABS( SSAV( I )-S( I ) ) / DIV )
+  201          CONTINUE
+*
+               SRNAMT = 'ZGESDD_2STAGE'
+               CALL ZGESDD_2STAGE( 'N', M, N, A, LDA, S, U, LDU, VT,
+     $                             LDVT, WORK, -1, RWORK, IWORK, IINFO )
+               IWTMP = INT( WORK( 1 ) )
+               LSWORK = IWTMP + ( IWSPC-1 )*( LWORK-IWTMP ) / 3
+               LSWORK = MIN( LSWORK, LWORK )
+               LSWORK = MAX( LSWORK, 1 )
+               IF( IWSPC.EQ.4 )
+     $            LSWORK = LWORK
+*
+               CALL ZLACPY( 'F', M, N, ASAV, LDA, A, LDA )
+               CALL ZGESDD_2STAGE( 'N', M, N, A, LDA, S, U, LDU, VT,
+     $                             LDVT, WORK, LSWORK, RWORK, IWORK,
+     $                             IINFO )
+               IF( IINFO.NE.0 ) THEN
+                  WRITE( NOUNIT, FMT = 9995 )'GESDD_2STAGE', IINFO, M,
+     $               N, JTYPE, LSWORK, IOLDSD
+                  INFO = ABS( IINFO )
+                  RETURN
+               END IF
+               DO 202 I = 1, MNMIN
+                  RESULT( 41 ) = MAX( RESULT( 41 ),
+     $                           ABS( SSAV( I )-S( I ) ) / DIV )
+  202          CONTINUE
+*
 *              Test ZGESVJ
 *              Note: ZGESVJ only works for M >= N
 *
@@ -1227,7 +1307,7 @@
 *
                NTEST = 0
                NFAIL = 0
-               DO 190 J = 1, 39
+               DO 190 J = 1, 41
                   IF( RESULT( J ).GE.ZERO )
      $               NTEST = NTEST + 1
                   IF( RESULT( J ).GE.THRESH )
@@ -1242,7 +1322,7 @@
                   NTESTF = 2
                END IF
 *
-               DO 200 J = 1, 39
+               DO 200 J = 1, 41
                   IF( RESULT( J ).GE.THRESH ) THEN
                      WRITE( NOUNIT, FMT = 9997 )M, N, JTYPE, IWSPC,
      $                  IOLDSD, J, RESULT( J )
@@ -1256,6 +1336,8 @@
 *
   220    CONTINUE
   230 CONTINUE
+      CALL XLAENV( 7, 1 )
+      CALL XLAENV( 9, NSMLSZ )
 *
 *     Summary
 *
@@ -1324,6 +1406,10 @@
      $      / '38 = | I - VT VT**T | / ( N ulp ) ',
      $      / '39 = 0 if S contains min(M,N) nonnegative values in',
      $      ' decreasing order, else 1/ulp',
+     $      / '40 = | S - S2 | / ( min(M,N) ulp |S| ),',
+     $      ' ZGESVD_2STAGE(N,N) ',
+     $      / '41 = | S - S2 | / ( min(M,N) ulp |S| ),',
+     $      ' ZGESDD_2STAGE(N) ',
      $      / / )
  9997 FORMAT( ' M=', I5, ', N=', I5, ', type ', I1, ', IWS=', I1,
      $      ', seed=', 4( I4, ',' ), ' test(', I2, ')=', G11.4 )
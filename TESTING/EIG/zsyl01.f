@@ -136,10 +136,11 @@
       EXTERNAL           DISNAN, DLAMCH, ZLANGE
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           ZLATMR, ZLACPY, ZGEMM, ZTRSYL, ZTRSYL3
+      EXTERNAL           ZLATMR, ZLACPY, ZGEMM, ZTRSYL, ZTRSYL3,
+     $                   XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          ABS, DBLE, MAX, SQRT
+      INTRINSIC          ABS, DBLE, MAX, SQRT, MOD
 *     ..
 *     .. Allocate memory dynamically ..
       ALLOCATE ( A( MAXM, MAXM ), STAT = AllocateStatus )
@@ -265,6 +266,11 @@
 *
                         CALL ZLACPY( 'All', M, N, C, MAXM, X, MAXM )
                         CALL ZLACPY( 'All', M, N, C, MAXM, CC, MAXM )
+*
+*                       Alternate between the serial and the parallel
+*                       block solvers of ZTRSYL3.
+*
+                        CALL XLAENV( 7, 1+MOD( M+N, 2 ) )
                         CALL ZTRSYL3( TRANA, TRANB, ISGN, M, N,
      $                                A, MAXM, B, MAXN, X, MAXM,
      $                                SCALE3, SWORK, LDSWORK, INFO)
@@ -302,6 +308,8 @@
             END DO
          END DO
       END DO
+*
+      CALL XLAENV( 7, 1 )
 *
       DEALLOCATE (A, STAT = AllocateStatus)
       DEALLOCATE (B, STAT = AllocateStatus)
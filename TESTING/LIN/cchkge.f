@@ -240,7 +240,7 @@
      $                   CLATMS, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          CMPLX, MAX, MIN
+      INTRINSIC          CMPLX, MAX, MIN, MOD
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -359,6 +359,11 @@
                   NB = NBVAL( INB )
                   CALL XLAENV( 1, NB )
 *
+*                 Use the task-parallel CGETRF_TASK for every other
+*                 block size.
+*
+                  CALL XLAENV( 7, 1+MOD( INB, 2 ) )
+*
 *                 Compute the LU factorization of the matrix.
 *
                   CALL CLACPY( 'Full', M, N, A, LDA, AFAC, LDA )
@@ -583,6 +588,7 @@
 *
   110    CONTINUE
   120 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Print a summary of the results.
 *
@@ -90,6 +90,13 @@
       PARAMETER          ( NIN = 5, NOUT = 6 )
       INTEGER            LDAMAX
       PARAMETER          ( LDAMAX = NMAX )
+      INTEGER            KMAX
+      PARAMETER          ( KMAX = 30 )
+      INTEGER            LWORK
+      PARAMETER          ( LWORK = NMAX*( NMAX+MAXRHS*( KMAX+3 ) )+
+     $                   MAXRHS*( ( KMAX+1 )*( KMAX+3 )+3 ) )
+      INTEGER            LSWORK
+      PARAMETER          ( LSWORK = NMAX*( NMAX+MAXRHS ) )
 *     ..
 *     .. Local Scalars ..
       LOGICAL            FATAL, TSTDRV, TSTERR
@@ -108,8 +115,9 @@
       LOGICAL            DOTYPE( MATMAX )
       INTEGER            IWORK( NMAX ), MVAL( MAXIN ), NSVAL( MAXIN )
       DOUBLE PRECISION   A( LDAMAX*NMAX, 2 ), B( NMAX*MAXRHS, 2 ),
-     $                   RWORK( NMAX ), WORK( NMAX*MAXRHS*2 )
-      REAL               SWORK(NMAX*(NMAX+MAXRHS))
+     $                   RWORK( NMAX ), WORK( LWORK )
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( NMAX*NMAX )
+      REAL               SWORK( LSWORK )
 *     ..
 *     .. External Functions ..
       DOUBLE PRECISION   DLAMCH, DSECND
@@ -300,7 +308,8 @@
             CALL DDRVAB( DOTYPE, NM, MVAL, NNS,
      $                   NSVAL, THRESH, LDA, A( 1, 1 ),
      $                   A( 1, 2 ), B( 1, 1 ), B( 1, 2 ),
-     $                   WORK, RWORK, SWORK, IWORK, NOUT )
+     $                   WORK, LWORK, RWORK, SWORK, LSWORK, HWORK,
+     $                   IWORK, NOUT )
          ELSE
             WRITE( NOUT, FMT = 9989 )'DSGESV'
          END IF
@@ -321,7 +330,8 @@
             CALL DDRVAC( DOTYPE, NM, MVAL, NNS, NSVAL,
      $                   THRESH, LDA, A( 1, 1 ), A( 1, 2 ),
      $                   B( 1, 1 ), B( 1, 2 ),
-     $                   WORK, RWORK, SWORK, NOUT )
+     $                   WORK, LWORK, RWORK, SWORK, LSWORK, HWORK,
+     $                   NOUT )
          ELSE
             WRITE( NOUT, FMT = 9989 )PATH
          END IF
@@ -238,7 +238,7 @@
      $                   DLATMS, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          MAX, MIN
+      INTRINSIC          MAX, MIN, MOD
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -357,6 +357,11 @@
                   NB = NBVAL( INB )
                   CALL XLAENV( 1, NB )
 *
+*                 Use the task-parallel DGETRF_TASK for every other
+*                 block size.
+*
+                  CALL XLAENV( 7, 1+MOD( INB, 2 ) )
+*
 *                 Compute the LU factorization of the matrix.
 *
                   CALL DLACPY( 'Full', M, N, A, LDA, AFAC, LDA )
@@ -580,6 +585,7 @@
   100       CONTINUE
   110    CONTINUE
   120 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Print a summary of the results.
 *
@@ -10,15 +10,17 @@
 *
 *       SUBROUTINE DDRVAB( DOTYPE, NM, MVAL, NNS,
 *                          NSVAL, THRESH, NMAX, A, AFAC, B,
-*                          X, WORK, RWORK, SWORK, IWORK, NOUT )
+*                          X, WORK, LWORK, RWORK, SWORK, LSWORK, HWORK,
+*                          IWORK, NOUT )
 *
 *       .. Scalar Arguments ..
-*       INTEGER            NM, NMAX, NNS, NOUT
+*       INTEGER            LSWORK, LWORK, NM, NMAX, NNS, NOUT
 *       DOUBLE PRECISION   THRESH
 *       ..
 *       .. Array Arguments ..
 *       LOGICAL            DOTYPE( * )
 *       INTEGER            MVAL( * ), NSVAL( * ), IWORK( * )
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
 *       REAL               SWORK(*)
 *       DOUBLE PRECISION   A( * ), AFAC( * ), B( * ),
 *      $                   RWORK( * ), WORK( * ), X( * )
@@ -30,7 +32,7 @@
 *>
 *> \verbatim
 *>
-*> DDRVAB tests DSGESV
+*> DDRVAB tests DSGESV, DSGESV_GMRES and DHGESV
 *> \endverbatim
 *
 *  Arguments:
@@ -110,6 +112,13 @@
 *>                      (NMAX*max(3,NSMAX))
 *> \endverbatim
 *>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK, at least the minimal
+*>          workspace of DSGESV_GMRES for N = NMAX and NRHS = NSMAX.
+*> \endverbatim
+*>
 *> \param[out] RWORK
 *> \verbatim
 *>          RWORK is DOUBLE PRECISION array, dimension
@@ -122,6 +131,19 @@
 *>                      (NMAX*(NSMAX+NMAX))
 *> \endverbatim
 *>
+*> \param[in] LSWORK
+*> \verbatim
+*>          LSWORK is INTEGER
+*>          The dimension of the array SWORK.
+*> \endverbatim
+*>
+*> \param[out] HWORK
+*> \verbatim
+*>          HWORK is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension
+*>                      (NMAX*NMAX)
+*> \endverbatim
+*>
 *> \param[out] IWORK
 *> \verbatim
 *>          IWORK is INTEGER array, dimension
@@ -147,19 +169,21 @@
 *  =====================================================================
       SUBROUTINE DDRVAB( DOTYPE, NM, MVAL, NNS,
      $                   NSVAL, THRESH, NMAX, A, AFAC, B,
-     $                   X, WORK, RWORK, SWORK, IWORK, NOUT )
+     $                   X, WORK, LWORK, RWORK, SWORK, LSWORK, HWORK,
+     $                   IWORK, NOUT )
 *
 *  -- LAPACK test routine --
 *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
 *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
 *
 *     .. Scalar Arguments ..
-      INTEGER            NM, NMAX, NNS, NOUT
+      INTEGER            LSWORK, LWORK, NM, NMAX, NNS, NOUT
       DOUBLE PRECISION   THRESH
 *     ..
 *     .. Array Arguments ..
       LOGICAL            DOTYPE( * )
       INTEGER            MVAL( * ), NSVAL( * ), IWORK( * )
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
       REAL               SWORK(*)
       DOUBLE PRECISION   A( * ), AFAC( * ), B( * ),
      $                   RWORK( * ), WORK( * ), X( * )
@@ -177,26 +201,28 @@
 *     ..
 *     .. Local Scalars ..
       LOGICAL            ZEROT
-      CHARACTER          DIST, TRANS, TYPE, XTYPE
+      CHARACTER          DIST, FMT, TRANS, TYPE, XTYPE
       CHARACTER*3        PATH
-      INTEGER            I, IM, IMAT, INFO, IOFF, IRHS,
+      CHARACTER*12       SUBNAM
+      INTEGER            I, IFUNC, IM, IMAT, INFO, IOFF, IRHS,
      $                   IZERO, KL, KU, LDA, M, MODE, N,
      $                   NERRS, NFAIL, NIMAT, NRHS, NRUN
       DOUBLE PRECISION   ANORM, CNDNUM
 *     ..
 *     .. Local Arrays ..
       INTEGER            ISEED( 4 ), ISEEDY( 4 )
+      REAL               SVAL( 6 )
       DOUBLE PRECISION   RESULT( NTESTS )
 *     ..
 *     .. Local Variables ..
-      INTEGER            ITER, KASE
+      INTEGER            ITER, ITERSV, KASE
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALAERH, ALAHD, DGET08, DLACPY, DLARHS, DLASET,
-     $                   DLATB4, DLATMS
+     $                   DLATB4, DLATMS, HLAG2S, SLAG2H
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          DBLE, MAX, MIN, SQRT
+      INTRINSIC          DBLE, MAX, MIN, SQRT, TRIM
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -209,6 +235,8 @@
 *     ..
 *     .. Data statements ..
       DATA               ISEEDY / 2006, 2007, 2008, 2009 /
+      DATA               SVAL / 1.0E+0, -1.0E+0, -2.5E+0, 3.75E-1,
+     $                   -1.024E+3, -1.52587890625E-5 /
 *     ..
 *     .. Executable Statements ..
 *
@@ -303,113 +331,187 @@
      $                      KU, NRHS, A, LDA, X, LDA, B,
      $                      LDA, ISEED, INFO )
 *
-               SRNAMT = 'DSGESV'
+               DO 50 IFUNC = 1, 4
+                  IF( IFUNC.EQ.1 ) THEN
+                     SUBNAM = 'DSGESV'
+                     SRNAMT = 'DSGESV'
+                  ELSE IF( IFUNC.EQ.2 ) THEN
+                     SUBNAM = 'DSGESV_GMRES'
+                     SRNAMT = 'DSGESV_GMRES'
+                  ELSE
+                     IF( IFUNC.EQ.3 ) THEN
+                        FMT = 'B'
+                     ELSE
+                        FMT = 'H'
+                     END IF
+                     SUBNAM = 'DHGESV(''' // FMT // ''')'
+                     SRNAMT = 'DHGESV'
+                  END IF
+*
+                  KASE = KASE + 1
 *
-               KASE = KASE + 1
+                  CALL DLACPY( 'Full', M, N, A, LDA, AFAC, LDA )
 *
-               CALL DLACPY( 'Full', M, N, A, LDA, AFAC, LDA )
+                  IF( IFUNC.EQ.1 ) THEN
+                     CALL DSGESV( N, NRHS, A, LDA, IWORK, B, LDA, X,
+     $                            LDA, WORK, SWORK, ITER, INFO )
+                  ELSE IF( IFUNC.EQ.2 ) THEN
+                     CALL DSGESV_GMRES( N, NRHS, A, LDA, IWORK, B, LDA,
+     $                                  X, LDA, WORK, LWORK, SWORK,
+     $                                  ITER, INFO )
+                  ELSE
+                     CALL DHGESV( FMT, N, NRHS, A, LDA, IWORK, B, LDA,
+     $                            X, LDA, WORK, LWORK, SWORK, LSWORK,
+     $                            HWORK, ITER, INFO )
+                  END IF
 *
-               CALL DSGESV( N, NRHS, A, LDA, IWORK, B, LDA, X, LDA,
-     $                      WORK, SWORK, ITER, INFO)
+                  IF( IFUNC.EQ.1 )
+     $               ITERSV = ITER
 *
-               IF (ITER.LT.0) THEN
-                   CALL DLACPY( 'Full', M, N, AFAC, LDA, A, LDA )
-               ENDIF
+                  IF (ITER.LT.0) THEN
+                      CALL DLACPY( 'Full', M, N, AFAC, LDA, A, LDA )
+                  ENDIF
 *
-*              Check error code from DSGESV. This should be the same as
-*              the one of DGETRF.
+*                 Check error code from DSGESV. This should be the same
+*                 as the one of DGETRF.
 *
-               IF( INFO.NE.IZERO ) THEN
+                  IF( INFO.NE.IZERO ) THEN
 *
-                  IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
-     $               CALL ALAHD( NOUT, PATH )
-                  NERRS = NERRS + 1
+                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                  CALL ALAHD( NOUT, PATH )
+                     NERRS = NERRS + 1
 *
-                  IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
-                     WRITE( NOUT, FMT = 9988 )'DSGESV',INFO,
-     $                         IZERO,M,IMAT
-                  ELSE
-                     WRITE( NOUT, FMT = 9975 )'DSGESV',INFO,
-     $                         M, IMAT
+                     IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
+                        WRITE( NOUT, FMT = 9988 )TRIM( SUBNAM ), INFO,
+     $                            IZERO, M, IMAT
+                     ELSE
+                        WRITE( NOUT, FMT = 9975 )TRIM( SUBNAM ), INFO,
+     $                            M, IMAT
+                     END IF
                   END IF
-               END IF
 *
-*              Skip the remaining test if the matrix is singular.
+*                 Skip the remaining test if the matrix is singular.
 *
-               IF( INFO.NE.0 )
-     $            GO TO 100
+                  IF( INFO.NE.0 )
+     $               GO TO 50
 *
-*              Check the quality of the solution
+*                 Up to type 8, CNDNUM = sqrt(0.1/EPS), GMRES-IR must
+*                 converge whenever the refinement of DSGESV could run,
+*                 that is unless the conversion to single precision
+*                 (ITER = -2) or the single precision factorization
+*                 (ITER = -3) failed.
 *
-               CALL DLACPY( 'Full', N, NRHS, B, LDA, WORK, LDA )
+                  IF( IFUNC.EQ.2 .AND. IMAT.LE.8 .AND. ITER.LT.0 .AND.
+     $               ( ITERSV.GE.0 .OR. ITERSV.LT.-3 ) ) THEN
+                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                  CALL ALAHD( NOUT, PATH )
+                     NERRS = NERRS + 1
+                     WRITE( NOUT, FMT = 9970 )TRIM( SUBNAM ), ITER, N,
+     $                  NRHS, IMAT
+                  END IF
 *
-               CALL DGET08( TRANS, N, N, NRHS, A, LDA, X, LDA, WORK,
-     $                      LDA, RWORK, RESULT( 1 ) )
+*                 Check the quality of the solution
 *
-*              Check if the test passes the testing.
-*              Print information about the tests that did not
-*              pass the testing.
+                  CALL DLACPY( 'Full', N, NRHS, B, LDA, WORK, LDA )
 *
-*              If iterative refinement has been used and claimed to
-*              be successful (ITER>0), we want
-*                NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS*SRQT(N)) < 1
+                  CALL DGET08( TRANS, N, N, NRHS, A, LDA, X, LDA, WORK,
+     $                         LDA, RWORK, RESULT( 1 ) )
 *
-*              If double precision has been used (ITER<0), we want
-*                NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS) < THRES
-*              (Cf. the linear solver testing routines)
+*                 Check if the test passes the testing.
+*                 Print information about the tests that did not
+*                 pass the testing.
 *
-               IF ((THRESH.LE.0.0E+00)
-     $            .OR.((ITER.GE.0).AND.(N.GT.0)
-     $                 .AND.(RESULT(1).GE.SQRT(DBLE(N))))
-     $            .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH))) THEN
+*                 If iterative refinement has been used and claimed to
+*                 be successful (ITER>0), we want
+*                   NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS*SRQT(N)) < 1
 *
-                  IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
-                     WRITE( NOUT, FMT = 8999 )'DGE'
-                     WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
-                     WRITE( NOUT, FMT = 8979 )
-                     WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
-                     WRITE( NOUT, FMT = 8960 )1
-                     WRITE( NOUT, FMT = '( '' Messages:'' )' )
-                  END IF
+*                 If double precision has been used (ITER<0), we want
+*                   NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS) < THRES
+*                 (Cf. the linear solver testing routines)
 *
-                  WRITE( NOUT, FMT = 9998 )TRANS, N, NRHS,
-     $               IMAT, 1, RESULT( 1 )
-                  NFAIL = NFAIL + 1
-               END IF
-               NRUN = NRUN + 1
+                  IF ((THRESH.LE.0.0E+00)
+     $               .OR.((ITER.GE.0).AND.(N.GT.0)
+     $                    .AND.(RESULT(1).GE.SQRT(DBLE(N))))
+     $               .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH))) THEN
+*
+                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
+                        WRITE( NOUT, FMT = 8999 )'DGE'
+                        WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
+                        WRITE( NOUT, FMT = 8979 )
+                        WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
+                        WRITE( NOUT, FMT = 8960 )1
+                        WRITE( NOUT, FMT = '( '' Messages:'' )' )
+                     END IF
+*
+                     WRITE( NOUT, FMT = 9998 )TRIM( SUBNAM ), TRANS, N,
+     $                  NRHS, IMAT, 1, RESULT( 1 )
+                     NFAIL = NFAIL + 1
+                  END IF
+                  NRUN = NRUN + 1
+   50          CONTINUE
    60       CONTINUE
   100    CONTINUE
   120 CONTINUE
 *
+*     Check that SLAG2H and HLAG2S keep the sign and the value of
+*     numbers that both 16-bit formats represent exactly.
+*
+      DO 140 IFUNC = 1, 2
+         IF( IFUNC.EQ.1 ) THEN
+            FMT = 'B'
+         ELSE
+            FMT = 'H'
+         END IF
+         CALL SLAG2H( FMT, 6, 1, SVAL, 6, HWORK, 6, INFO )
+         IF( INFO.EQ.0 )
+     $      CALL HLAG2S( FMT, 6, 1, HWORK, 6, SWORK, 6, INFO )
+         DO 130 I = 1, 6
+            IF( INFO.NE.0 .OR. SWORK( I ).NE.SVAL( I ) ) THEN
+               IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $            CALL ALAHD( NOUT, PATH )
+               NERRS = NERRS + 1
+               WRITE( NOUT, FMT = 9969 )FMT, SVAL( I ), SWORK( I ),
+     $            INFO
+            END IF
+  130    CONTINUE
+         NRUN = NRUN + 1
+  140 CONTINUE
+*
 *     Print a summary of the results.
 *
       IF( NFAIL.GT.0 ) THEN
-         WRITE( NOUT, FMT = 9996 )'DSGESV', NFAIL, NRUN
+         WRITE( NOUT, FMT = 9996 )'DSGESV, DSGESV_GMRES and DHGESV',
+     $      NFAIL, NRUN
       ELSE
-         WRITE( NOUT, FMT = 9995 )'DSGESV', NRUN
+         WRITE( NOUT, FMT = 9995 )'DSGESV, DSGESV_GMRES and DHGESV',
+     $      NRUN
       END IF
       IF( NERRS.GT.0 ) THEN
          WRITE( NOUT, FMT = 9994 )NERRS
       END IF
 *
- 9998 FORMAT( ' TRANS=''', A1, ''', N =', I5, ', NRHS=', I3, ', type ',
-     $      I2, ', test(', I2, ') =', G12.5 )
- 9996 FORMAT( 1X, A6, ': ', I6, ' out of ', I6,
+ 9998 FORMAT( 1X, A, ', TRANS=''', A1, ''', N =', I5, ', NRHS=', I3,
+     $      ', type ', I2, ', test(', I2, ') =', G12.5 )
+ 9996 FORMAT( 1X, A, ': ', I6, ' out of ', I6,
      $      ' tests failed to pass the threshold' )
- 9995 FORMAT( /1X, 'All tests for ', A6,
+ 9995 FORMAT( /1X, 'All tests for ', A,
      $      ' routines passed the threshold ( ', I6, ' tests run)' )
  9994 FORMAT( 6X, I6, ' error messages recorded' )
 *
 *     SUBNAM, INFO, INFOE, M, IMAT
 *
- 9988 FORMAT( ' *** ', A6, ' returned with INFO =', I5, ' instead of ',
+ 9988 FORMAT( ' *** ', A, ' returned with INFO =', I5, ' instead of ',
      $      I5, / ' ==> M =', I5, ', type ',
      $      I2 )
 *
 *     SUBNAM, INFO, M, IMAT
 *
- 9975 FORMAT( ' *** Error code from ', A6, '=', I5, ' for M=', I5,
+ 9975 FORMAT( ' *** Error code from ', A, '=', I5, ' for M=', I5,
      $      ', type ', I2 )
+ 9970 FORMAT( ' *** ', A, ' fell back to full precision, ITER =',
+     $      I5, / ' ==> N =', I5, ', NRHS=', I3, ', type ', I2 )
+ 9969 FORMAT( ' *** SLAG2H and HLAG2S with FMT=''', A1, ''' turned ',
+     $      E13.6, ' into ', E13.6, ', INFO =', I5 )
  8999 FORMAT( / 1X, A3, ':  General dense matrices' )
  8979 FORMAT( 4X, '1. Diagonal', 24X, '7. Last n/2 columns zero', / 4X,
      $      '2. Upper triangular', 16X,
@@ -9,16 +9,17 @@
 *  ===========
 *
 *       SUBROUTINE DDRVAC( DOTYPE, NM, MVAL, NNS, NSVAL, THRESH, NMAX,
-*                          A, AFAC, B, X, WORK,
-*                          RWORK, SWORK, NOUT )
+*                          A, AFAC, B, X, WORK, LWORK,
+*                          RWORK, SWORK, LSWORK, HWORK, NOUT )
 *
 *       .. Scalar Arguments ..
-*       INTEGER            NMAX, NM, NNS, NOUT
+*       INTEGER            LSWORK, LWORK, NMAX, NM, NNS, NOUT
 *       DOUBLE PRECISION   THRESH
 *       ..
 *       .. Array Arguments ..
 *       LOGICAL            DOTYPE( * )
 *       INTEGER            MVAL( * ), NSVAL( * )
+*       INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
 *       REAL               SWORK(*)
 *       DOUBLE PRECISION   A( * ), AFAC( * ), B( * ),
 *      $                   RWORK( * ), WORK( * ), X( * )
@@ -30,7 +31,7 @@
 *>
 *> \verbatim
 *>
-*> DDRVAC tests DSPOSV.
+*> DDRVAC tests DSPOSV, DSPOSV_GMRES and DHPOSV.
 *> \endverbatim
 *
 *  Arguments:
@@ -109,6 +110,13 @@
 *>                      (NMAX*max(3,NSMAX))
 *> \endverbatim
 *>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK, at least the minimal
+*>          workspace of DSPOSV_GMRES for N = NMAX and NRHS = NSMAX.
+*> \endverbatim
+*>
 *> \param[out] RWORK
 *> \verbatim
 *>          RWORK is DOUBLE PRECISION array, dimension
@@ -121,6 +129,19 @@
 *>                      (NMAX*(NSMAX+NMAX))
 *> \endverbatim
 *>
+*> \param[in] LSWORK
+*> \verbatim
+*>          LSWORK is INTEGER
+*>          The dimension of the array SWORK.
+*> \endverbatim
+*>
+*> \param[out] HWORK
+*> \verbatim
+*>          HWORK is INTEGER(KIND=SELECTED_INT_KIND(4)) array,
+*>          dimension
+*>                      (NMAX*NMAX)
+*> \endverbatim
+*>
 *> \param[in] NOUT
 *> \verbatim
 *>          NOUT is INTEGER
@@ -139,20 +160,21 @@
 *
 *  =====================================================================
       SUBROUTINE DDRVAC( DOTYPE, NM, MVAL, NNS, NSVAL, THRESH, NMAX,
-     $                   A, AFAC, B, X, WORK,
-     $                   RWORK, SWORK, NOUT )
+     $                   A, AFAC, B, X, WORK, LWORK,
+     $                   RWORK, SWORK, LSWORK, HWORK, NOUT )
 *
 *  -- LAPACK test routine --
 *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
 *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
 *
 *     .. Scalar Arguments ..
-      INTEGER            NMAX, NM, NNS, NOUT
+      INTEGER            LSWORK, LWORK, NMAX, NM, NNS, NOUT
       DOUBLE PRECISION   THRESH
 *     ..
 *     .. Array Arguments ..
       LOGICAL            DOTYPE( * )
       INTEGER            MVAL( * ), NSVAL( * )
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( * )
       REAL               SWORK(*)
       DOUBLE PRECISION   A( * ), AFAC( * ), B( * ),
      $                   RWORK( * ), WORK( * ), X( * )
@@ -170,9 +192,10 @@
 *     ..
 *     .. Local Scalars ..
       LOGICAL            ZEROT
-      CHARACTER          DIST, TYPE, UPLO, XTYPE
+      CHARACTER          DIST, FMT, TYPE, UPLO, XTYPE
       CHARACTER*3        PATH
-      INTEGER            I, IM, IMAT, INFO, IOFF, IRHS, IUPLO,
+      CHARACTER*12       SUBNAM
+      INTEGER            I, IFUNC, IM, IMAT, INFO, IOFF, IRHS, IUPLO,
      $                   IZERO, KL, KU, LDA, MODE, N,
      $                   NERRS, NFAIL, NIMAT, NRHS, NRUN
       DOUBLE PRECISION   ANORM, CNDNUM
@@ -183,7 +206,7 @@
       DOUBLE PRECISION   RESULT( NTESTS )
 *     ..
 *     .. Local Variables ..
-      INTEGER            ITER, KASE
+      INTEGER            ITER, ITERSV, KASE
 *     ..
 *     .. External Functions ..
       LOGICAL            LSAME
@@ -192,10 +215,10 @@
 *     .. External Subroutines ..
       EXTERNAL           ALAERH, DLACPY,
      $                   DLARHS, DLASET, DLATB4, DLATMS,
-     $                   DPOT06, DSPOSV
+     $                   DHPOSV, DPOT06, DSPOSV, DSPOSV_GMRES
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          DBLE, MAX, SQRT
+      INTRINSIC          DBLE, MAX, SQRT, TRIM
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -325,80 +348,128 @@
 *                 Compute the L*L' or U'*U factorization of the
 *                 matrix and solve the system.
 *
-                  SRNAMT = 'DSPOSV '
-                  KASE = KASE + 1
+                  DO 55 IFUNC = 1, 4
+                     IF( IFUNC.EQ.1 ) THEN
+                        SUBNAM = 'DSPOSV'
+                        SRNAMT = 'DSPOSV'
+                     ELSE IF( IFUNC.EQ.2 ) THEN
+                        SUBNAM = 'DSPOSV_GMRES'
+                        SRNAMT = 'DSPOSV_GMRES'
+                     ELSE
+                        IF( IFUNC.EQ.3 ) THEN
+                           FMT = 'B'
+                        ELSE
+                           FMT = 'H'
+                        END IF
+                        SUBNAM = 'DHPOSV(''' // FMT // ''')'
+                        SRNAMT = 'DHPOSV'
+                     END IF
+                     KASE = KASE + 1
 *
-                  CALL DLACPY( 'All', N, N, A, LDA, AFAC, LDA)
+                     CALL DLACPY( 'All', N, N, A, LDA, AFAC, LDA)
 *
-                  CALL DSPOSV( UPLO, N, NRHS, AFAC, LDA, B, LDA, X, LDA,
-     $                         WORK, SWORK, ITER, INFO )
-
-                  IF (ITER.LT.0) THEN
-                     CALL DLACPY( 'All', N, N, A, LDA, AFAC, LDA )
-                  ENDIF
+                     IF( IFUNC.EQ.1 ) THEN
+                        CALL DSPOSV( UPLO, N, NRHS, AFAC, LDA, B, LDA,
+     $                               X, LDA, WORK, SWORK, ITER, INFO )
+                     ELSE IF( IFUNC.EQ.2 ) THEN
+                        CALL DSPOSV_GMRES( UPLO, N, NRHS, AFAC, LDA, B,
+     $                                     LDA, X, LDA, WORK, LWORK,
+     $                                     SWORK, ITER, INFO )
+                     ELSE
+                        CALL DHPOSV( FMT, UPLO, N, NRHS, AFAC, LDA, B,
+     $                               LDA, X, LDA, WORK, LWORK, SWORK,
+     $                               LSWORK, HWORK, ITER, INFO )
+                     END IF
 *
-*                 Check error code from DSPOSV .
+                     IF( IFUNC.EQ.1 )
+     $                  ITERSV = ITER
 *
-                  IF( INFO.NE.IZERO ) THEN
+                     IF (ITER.LT.0) THEN
+                        CALL DLACPY( 'All', N, N, A, LDA, AFAC, LDA )
+                     ENDIF
 *
-                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
-     $                  CALL ALAHD( NOUT, PATH )
-                     NERRS = NERRS + 1
+*                    Check error code from DSPOSV, DSPOSV_GMRES or
+*                    DHPOSV.
 *
-                     IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
-                        WRITE( NOUT, FMT = 9988 )'DSPOSV',INFO,IZERO,N,
-     $                     IMAT
-                     ELSE
-                        WRITE( NOUT, FMT = 9975 )'DSPOSV',INFO,N,IMAT
-                     END IF
-                  END IF
+                     IF( INFO.NE.IZERO ) THEN
 *
-*                 Skip the remaining test if the matrix is singular.
+                        IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                     CALL ALAHD( NOUT, PATH )
+                        NERRS = NERRS + 1
 *
-                  IF( INFO.NE.0 )
-     $               GO TO 110
+                        IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
+                           WRITE( NOUT, FMT = 9988 )TRIM( SUBNAM ),
+     $                           INFO, IZERO, N, IMAT
+                        ELSE
+                           WRITE( NOUT, FMT = 9975 )TRIM( SUBNAM ),
+     $                           INFO, N, IMAT
+                        END IF
+                     END IF
 *
-*                 Check the quality of the solution
+*                    Skip the remaining test if the matrix is singular.
+*
+                     IF( INFO.NE.0 )
+     $                  GO TO 55
+*
+*                    Up to type 6, CNDNUM = sqrt(0.1/EPS), GMRES-IR must
+*                    converge whenever the refinement of DSPOSV could
+*                    run, that is unless the conversion to single
+*                    precision (ITER = -2) or the single precision
+*                    factorization (ITER = -3) failed.
+*
+                     IF( IFUNC.EQ.2 .AND. IMAT.LE.6 .AND.
+     $                  ITER.LT.0 .AND.
+     $                  ( ITERSV.GE.0 .OR. ITERSV.LT.-3 ) ) THEN
+                        IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                     CALL ALAHD( NOUT, PATH )
+                        NERRS = NERRS + 1
+                        WRITE( NOUT, FMT = 9970 )TRIM( SUBNAM ),
+     $                     ITER, N, NRHS, IMAT
+                     END IF
 *
-                  CALL DLACPY( 'All', N, NRHS, B, LDA, WORK, LDA )
+*                    Check the quality of the solution
 *
-                  CALL DPOT06( UPLO, N, NRHS, A, LDA, X, LDA, WORK,
-     $               LDA, RWORK, RESULT( 1 ) )
+                     CALL DLACPY( 'All', N, NRHS, B, LDA, WORK, LDA )
 *
-*                 Check if the test passes the testing.
-*                 Print information about the tests that did not
-*                 pass the testing.
+                     CALL DPOT06( UPLO, N, NRHS, A, LDA, X, LDA, WORK,
+     $                  LDA, RWORK, RESULT( 1 ) )
 *
-*                 If iterative refinement has been used and claimed to
-*                 be successful (ITER>0), we want
-*                 NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS*SRQT(N)) < 1
+*                    Check if the test passes the testing.
+*                    Print information about the tests that did not
+*                    pass the testing.
 *
-*                 If double precision has been used (ITER<0), we want
-*                 NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS) < THRES
-*                 (Cf. the linear solver testing routines)
+*                    If iterative refinement has been used and claimed
+*                    to be successful (ITER>0), we want
+*                    NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS*SRQT(N)) < 1
 *
-                  IF ((THRESH.LE.0.0E+00)
-     $               .OR.((ITER.GE.0).AND.(N.GT.0)
-     $               .AND.(RESULT(1).GE.SQRT(DBLE(N))))
-     $               .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH))) THEN
+*                    If double precision has been used (ITER<0), we want
+*                    NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS) < THRES
+*                    (Cf. the linear solver testing routines)
 *
-                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
-                        WRITE( NOUT, FMT = 8999 )'DPO'
-                        WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
-                        WRITE( NOUT, FMT = 8979 )
-                        WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
-                        WRITE( NOUT, FMT = 8960 )1
-                        WRITE( NOUT, FMT = '( '' Messages:'' )' )
-                     END IF
+                     IF ((THRESH.LE.0.0E+00)
+     $                  .OR.((ITER.GE.0).AND.(N.GT.0)
+     $                  .AND.(RESULT(1).GE.SQRT(DBLE(N))))
+     $                  .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH)))
+     $                  THEN
 *
-                     WRITE( NOUT, FMT = 9998 )UPLO, N, NRHS, IMAT, 1,
-     $                  RESULT( 1 )
+                        IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
+                           WRITE( NOUT, FMT = 8999 )'DPO'
+                           WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
+                           WRITE( NOUT, FMT = 8979 )
+                           WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
+                           WRITE( NOUT, FMT = 8960 )1
+                           WRITE( NOUT, FMT = '( '' Messages:'' )' )
+                        END IF
 *
-                     NFAIL = NFAIL + 1
+                        WRITE( NOUT, FMT = 9998 )TRIM( SUBNAM ), UPLO,
+     $                     N, NRHS, IMAT, 1, RESULT( 1 )
 *
-                  END IF
+                        NFAIL = NFAIL + 1
+*
+                     END IF
 *
-                  NRUN = NRUN + 1
+                     NRUN = NRUN + 1
+   55             CONTINUE
 *
    60          CONTINUE
   100       CONTINUE
@@ -408,32 +479,36 @@
 *     Print a summary of the results.
 *
       IF( NFAIL.GT.0 ) THEN
-         WRITE( NOUT, FMT = 9996 )'DSPOSV', NFAIL, NRUN
+         WRITE( NOUT, FMT = 9996 )'DSPOSV, DSPOSV_GMRES and DHPOSV',
+     $      NFAIL, NRUN
       ELSE
-         WRITE( NOUT, FMT = 9995 )'DSPOSV', NRUN
+         WRITE( NOUT, FMT = 9995 )'DSPOSV, DSPOSV_GMRES and DHPOSV',
+     $      NRUN
       END IF
       IF( NERRS.GT.0 ) THEN
          WRITE( NOUT, FMT = 9994 )NERRS
       END IF
 *
- 9998 FORMAT( ' UPLO=''', A1, ''', N =', I5, ', NRHS=', I3, ', type ',
-     $      I2, ', test(', I2, ') =', G12.5 )
- 9996 FORMAT( 1X, A6, ': ', I6, ' out of ', I6,
+ 9998 FORMAT( 1X, A, ', UPLO=''', A1, ''', N =', I5, ', NRHS=', I3,
+     $      ', type ', I2, ', test(', I2, ') =', G12.5 )
+ 9996 FORMAT( 1X, A, ': ', I6, ' out of ', I6,
      $      ' tests failed to pass the threshold' )
- 9995 FORMAT( /1X, 'All tests for ', A6,
+ 9995 FORMAT( /1X, 'All tests for ', A,
      $      ' routines passed the threshold ( ', I6, ' tests run)' )
  9994 FORMAT( 6X, I6, ' error messages recorded' )
 *
 *     SUBNAM, INFO, INFOE, N, IMAT
 *
- 9988 FORMAT( ' *** ', A6, ' returned with INFO =', I5, ' instead of ',
+ 9988 FORMAT( ' *** ', A, ' returned with INFO =', I5, ' instead of ',
      $      I5, / ' ==> N =', I5, ', type ',
      $      I2 )
 *
 *     SUBNAM, INFO, N, IMAT
 *
- 9975 FORMAT( ' *** Error code from ', A6, '=', I5, ' for M=', I5,
+ 9975 FORMAT( ' *** Error code from ', A, '=', I5, ' for M=', I5,
      $      ', type ', I2 )
+ 9970 FORMAT( ' *** ', A, ' fell back to full precision, ITER =',
+     $      I5, / ' ==> N =', I5, ', NRHS=', I3, ', type ', I2 )
  8999 FORMAT( / 1X, A3, ':  positive definite dense matrices' )
  8979 FORMAT( 4X, '1. Diagonal', 24X, '7. Last n/2 columns zero', / 4X,
      $      '2. Upper triangular', 16X,
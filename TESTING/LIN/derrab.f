@@ -58,6 +58,8 @@
 *     .. Parameters ..
       INTEGER            NMAX
       PARAMETER          ( NMAX = 4 )
+      INTEGER            LW
+      PARAMETER          ( LW = 100 )
 *     ..
 *     .. Local Scalars ..
       INTEGER            I, INFO, ITER, J
@@ -68,10 +70,11 @@
      $                   C( NMAX ), R( NMAX ), R1( NMAX ), R2( NMAX ),
      $                   W( 2*NMAX ), X( NMAX )
       DOUBLE PRECISION   WORK(1)
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( 1 )
       REAL               SWORK(1)
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CHKXER, DSGESV
+      EXTERNAL           CHKXER, DSGESV, DSGESV_GMRES, DHGESV
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -124,17 +127,71 @@
       INFOT = 9
       CALL DSGESV(2,1,A,2,IP,B,2,X,1,WORK,SWORK,ITER,INFO)
       CALL CHKXER( 'DSGESV', INFOT, NOUT, LERR, OK )
+*
+      SRNAMT = 'DSGESV_GMRES'
+      INFOT = 1
+      CALL DSGESV_GMRES(-1,0,A,1,IP,B,1,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 2
+      CALL DSGESV_GMRES(0,-1,A,1,IP,B,1,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 4
+      CALL DSGESV_GMRES(2,1,A,1,IP,B,2,X,2,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 7
+      CALL DSGESV_GMRES(2,1,A,2,IP,B,1,X,2,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 9
+      CALL DSGESV_GMRES(2,1,A,2,IP,B,2,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 11
+      CALL DSGESV_GMRES(2,1,A,2,IP,B,2,X,2,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSGESV_GMRES', INFOT, NOUT, LERR, OK )
+*
+      SRNAMT = 'DHGESV'
+      INFOT = 1
+      CALL DHGESV('/',0,0,A,1,IP,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 2
+      CALL DHGESV('B',-1,0,A,1,IP,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 3
+      CALL DHGESV('B',0,-1,A,1,IP,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 5
+      CALL DHGESV('B',2,1,A,1,IP,B,2,X,2,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 8
+      CALL DHGESV('B',2,1,A,2,IP,B,1,X,2,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 10
+      CALL DHGESV('B',2,1,A,2,IP,B,2,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 12
+      CALL DHGESV('B',2,1,A,2,IP,B,2,X,2,
+     $            WORK,1,SWORK,1,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
+      INFOT = 14
+      CALL DHGESV('B',2,1,A,2,IP,B,2,X,2,
+     $            WORK,LW,SWORK,1,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHGESV', INFOT, NOUT, LERR, OK )
 *
 *     Print a summary line.
 *
       IF( OK ) THEN
-         WRITE( NOUT, FMT = 9999 )'DSGESV'
+         WRITE( NOUT, FMT = 9999 )'DSGESV, DSGESV_GMRES and DHGESV'
       ELSE
-         WRITE( NOUT, FMT = 9998 )'DSGESV'
+         WRITE( NOUT, FMT = 9998 )'DSGESV, DSGESV_GMRES and DHGESV'
       END IF
 *
- 9999 FORMAT( 1X, A6, ' drivers passed the tests of the error exits' )
- 9998 FORMAT( ' *** ', A6, ' drivers failed the tests of the error ',
+ 9999 FORMAT( 1X, A, ' drivers passed the tests of the error exits' )
+ 9998 FORMAT( ' *** ', A, ' drivers failed the tests of the error ',
      $      'exits ***' )
 *
       RETURN
@@ -58,6 +58,8 @@
 *     .. Parameters ..
       INTEGER            NMAX
       PARAMETER          ( NMAX = 4 )
+      INTEGER            LW
+      PARAMETER          ( LW = 100 )
 *     ..
 *     .. Local Scalars ..
       INTEGER            I, INFO, ITER, J
@@ -67,10 +69,11 @@
      $                   C( NMAX ), R( NMAX ), R1( NMAX ), R2( NMAX ),
      $                   W( 2*NMAX ), X( NMAX )
       DOUBLE PRECISION   WORK(NMAX*NMAX)
+      INTEGER(KIND=SELECTED_INT_KIND(4)) HWORK( 1 )
       REAL               SWORK(NMAX*NMAX)
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CHKXER, DSPOSV
+      EXTERNAL           CHKXER, DSPOSV, DSPOSV_GMRES, DHPOSV
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -125,17 +128,78 @@
       INFOT = 9
       CALL DSPOSV('U',2,1,A,2,B,2,X,1,WORK,SWORK,ITER,INFO)
       CALL CHKXER( 'DSPOSV', INFOT, NOUT, LERR, OK )
+*
+      SRNAMT = 'DSPOSV_GMRES'
+      INFOT = 1
+      CALL DSPOSV_GMRES('/',0,0,A,1,B,1,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 2
+      CALL DSPOSV_GMRES('U',-1,0,A,1,B,1,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 3
+      CALL DSPOSV_GMRES('U',0,-1,A,1,B,1,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 5
+      CALL DSPOSV_GMRES('U',2,1,A,1,B,2,X,2,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 7
+      CALL DSPOSV_GMRES('U',2,1,A,2,B,1,X,2,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 9
+      CALL DSPOSV_GMRES('U',2,1,A,2,B,2,X,1,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 11
+      CALL DSPOSV_GMRES('U',2,1,A,2,B,2,X,2,WORK,1,SWORK,ITER,INFO)
+      CALL CHKXER( 'DSPOSV_GMRES', INFOT, NOUT, LERR, OK )
+*
+      SRNAMT = 'DHPOSV'
+      INFOT = 1
+      CALL DHPOSV('/','U',0,0,A,1,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 2
+      CALL DHPOSV('B','/',0,0,A,1,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 3
+      CALL DHPOSV('B','U',-1,0,A,1,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 4
+      CALL DHPOSV('B','U',0,-1,A,1,B,1,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 6
+      CALL DHPOSV('B','U',2,1,A,1,B,2,X,2,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 8
+      CALL DHPOSV('B','U',2,1,A,2,B,1,X,2,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 10
+      CALL DHPOSV('B','U',2,1,A,2,B,2,X,1,
+     $            WORK,LW,SWORK,LW,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 12
+      CALL DHPOSV('B','U',2,1,A,2,B,2,X,2,
+     $            WORK,1,SWORK,1,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
+      INFOT = 14
+      CALL DHPOSV('B','U',2,1,A,2,B,2,X,2,
+     $            WORK,LW,SWORK,1,HWORK,ITER,INFO)
+      CALL CHKXER( 'DHPOSV', INFOT, NOUT, LERR, OK )
 *
 *     Print a summary line.
 *
       IF( OK ) THEN
-         WRITE( NOUT, FMT = 9999 )'DSPOSV'
+         WRITE( NOUT, FMT = 9999 )'DSPOSV, DSPOSV_GMRES and DHPOSV'
       ELSE
-         WRITE( NOUT, FMT = 9998 )'DSPOSV'
+         WRITE( NOUT, FMT = 9998 )'DSPOSV, DSPOSV_GMRES and DHPOSV'
       END IF
 *
- 9999 FORMAT( 1X, A6, ' drivers passed the tests of the error exits' )
- 9998 FORMAT( ' *** ', A6, ' drivers failed the tests of the error ',
+ 9999 FORMAT( 1X, A, ' drivers passed the tests of the error exits' )
+ 9998 FORMAT( ' *** ', A, ' drivers failed the tests of the error ',
      $      'exits ***' )
 *
       RETURN
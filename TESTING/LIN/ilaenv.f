@@ -184,6 +184,8 @@
          IF ( NAME(2:6).EQ.'GEQR ' ) THEN
             IF (N3.EQ.2) THEN
                ILAENV = IPARMS ( 2 )
+            ELSE IF (N3.EQ.3) THEN
+               ILAENV = IPARMS ( 3 )
             ELSE
                ILAENV = IPARMS ( 1 )
             END IF
@@ -230,7 +230,7 @@
       COMMON             / SRNAMC / SRNAMT
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          MAX
+      INTRINSIC          MAX, MOD
 *     ..
 *     .. Data statements ..
       DATA               ISEEDY / 1988, 1989, 1990, 1991 /
@@ -349,6 +349,11 @@
                   NB = NBVAL( INB )
                   CALL XLAENV( 1, NB )
 *
+*                 Use the task-parallel SPOTRF_TASK and SPOTRS_TASK
+*                 for every other block size.
+*
+                  CALL XLAENV( 7, 1+MOD( INB, 2 ) )
+*
 *                 Compute the L*L' or U'*U factorization of the matrix.
 *
                   CALL SLACPY( UPLO, N, N, A, LDA, AFAC, LDA )
@@ -511,6 +516,7 @@
   100       CONTINUE
   110    CONTINUE
   120 CONTINUE
+      CALL XLAENV( 7, 1 )
 *
 *     Print a summary of the results.
 *
@@ -133,7 +133,7 @@
      $                   STSQR01, XLAENV
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC  MAX, MIN
+      INTRINSIC  MAX, MIN, MOD
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -178,6 +178,12 @@
                     NB = NBVAL( IMB )
                     CALL XLAENV( 2, NB )
 *
+*                 Alternate between the flat and the tree TSQR, and
+*                 between a binary and a ternary tree.
+*
+                    CALL XLAENV( 7, 1+MOD( IMB, 2 ) )
+                    CALL XLAENV( 3, 2+MOD( INB, 2 ) )
+*
 *                 Test SGEQR and SGEMQR
 *
                     CALL STSQR01('TS', M, N, MB, NB, RESULT )
@@ -200,6 +206,8 @@
               END IF
          END DO
       END DO
+*
+      CALL XLAENV( 7, 1 )
 *
 *     Do for each value of M in MVAL.
 *
@@ -90,6 +90,11 @@
       PARAMETER          ( NIN = 5, NOUT = 6 )
       INTEGER            LDAMAX
       PARAMETER          ( LDAMAX = NMAX )
+      INTEGER            KMAX
+      PARAMETER          ( KMAX = 30 )
+      INTEGER            LWORK
+      PARAMETER          ( LWORK = NMAX*( NMAX+MAXRHS*( KMAX+3 ) )+
+     $                   MAXRHS*( ( KMAX+1 )*( KMAX+3 )+3 ) )
 *     ..
 *     .. Local Scalars ..
       LOGICAL            FATAL, TSTDRV, TSTERR
@@ -109,7 +114,7 @@
       INTEGER            IWORK( NMAX ), MVAL( MAXIN ), NSVAL( MAXIN )
       DOUBLE PRECISION   RWORK(NMAX)
       COMPLEX*16         A( LDAMAX*NMAX, 2 ), B( NMAX*MAXRHS, 2 ),
-     $                   WORK( NMAX*MAXRHS*2 )
+     $                   WORK( LWORK )
       COMPLEX            SWORK(NMAX*(NMAX+MAXRHS))
 *     ..
 *     .. External Functions ..
@@ -301,7 +306,7 @@
             CALL ZDRVAB( DOTYPE, NM, MVAL, NNS,
      $                   NSVAL, THRESH, LDA, A( 1, 1 ),
      $                   A( 1, 2 ), B( 1, 1 ), B( 1, 2 ),
-     $                   WORK, RWORK, SWORK, IWORK, NOUT )
+     $                   WORK, LWORK, RWORK, SWORK, IWORK, NOUT )
          ELSE
             WRITE( NOUT, FMT = 9989 )'ZCGESV'
          END IF
@@ -321,7 +326,7 @@
             CALL ZDRVAC( DOTYPE, NM, MVAL, NNS, NSVAL,
      $                   THRESH, LDA, A( 1, 1 ), A( 1, 2 ),
      $                   B( 1, 1 ), B( 1, 2 ),
-     $                   WORK, RWORK, SWORK, NOUT )
+     $                   WORK, LWORK, RWORK, SWORK, NOUT )
          ELSE
             WRITE( NOUT, FMT = 9989 )'ZCPOSV'
          END IF
@@ -10,10 +10,10 @@
 *
 *       SUBROUTINE ZDRVAB( DOTYPE, NM, MVAL, NNS,
 *                          NSVAL, THRESH, NMAX, A, AFAC, B,
-*                          X, WORK, RWORK, SWORK, IWORK, NOUT )
+*                          X, WORK, LWORK, RWORK, SWORK, IWORK, NOUT )
 *
 *       .. Scalar Arguments ..
-*       INTEGER            NM, NMAX, NNS, NOUT
+*       INTEGER            LWORK, NM, NMAX, NNS, NOUT
 *       DOUBLE PRECISION   THRESH
 *       ..
 *       .. Array Arguments ..
@@ -31,7 +31,7 @@
 *>
 *> \verbatim
 *>
-*> ZDRVAB tests ZCGESV
+*> ZDRVAB tests ZCGESV and ZCGESV_GMRES
 *> \endverbatim
 *
 *  Arguments:
@@ -111,6 +111,13 @@
 *>                      (NMAX*max(3,NSMAX*2))
 *> \endverbatim
 *>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK, at least the minimal
+*>          workspace of ZCGESV_GMRES for N = NMAX and NRHS = NSMAX.
+*> \endverbatim
+*>
 *> \param[out] RWORK
 *> \verbatim
 *>          RWORK is DOUBLE PRECISION array, dimension
@@ -148,14 +155,14 @@
 *  =====================================================================
       SUBROUTINE ZDRVAB( DOTYPE, NM, MVAL, NNS,
      $                   NSVAL, THRESH, NMAX, A, AFAC, B,
-     $                   X, WORK, RWORK, SWORK, IWORK, NOUT )
+     $                   X, WORK, LWORK, RWORK, SWORK, IWORK, NOUT )
 *
 *  -- LAPACK test routine --
 *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
 *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
 *
 *     .. Scalar Arguments ..
-      INTEGER            NM, NMAX, NNS, NOUT
+      INTEGER            LWORK, NM, NMAX, NNS, NOUT
       DOUBLE PRECISION   THRESH
 *     ..
 *     .. Array Arguments ..
@@ -181,7 +188,8 @@
       LOGICAL            ZEROT
       CHARACTER          DIST, TRANS, TYPE, XTYPE
       CHARACTER*3        PATH
-      INTEGER            I, IM, IMAT, INFO, IOFF, IRHS,
+      CHARACTER*12       SUBNAM
+      INTEGER            I, IFUNC, IM, IMAT, INFO, IOFF, IRHS,
      $                   IZERO, KL, KU, LDA, M, MODE, N,
      $                   NERRS, NFAIL, NIMAT, NRHS, NRUN
       DOUBLE PRECISION   ANORM, CNDNUM
@@ -191,14 +199,14 @@
       DOUBLE PRECISION   RESULT( NTESTS )
 *     ..
 *     .. Local Variables ..
-      INTEGER            ITER, KASE
+      INTEGER            ITER, ITERSV, KASE
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALAERH, ALAHD, ZGET08, ZLACPY, ZLARHS, ZLASET,
      $                   ZLATB4, ZLATMS
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          DCMPLX, DBLE, MAX, MIN, SQRT
+      INTRINSIC          DCMPLX, DBLE, MAX, MIN, SQRT, TRIM
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -305,80 +313,111 @@
      $                      KU, NRHS, A, LDA, X, LDA, B,
      $                      LDA, ISEED, INFO )
 *
-               SRNAMT = 'ZCGESV'
+               DO 50 IFUNC = 1, 2
+                  IF( IFUNC.EQ.1 ) THEN
+                     SUBNAM = 'ZCGESV'
+                  ELSE
+                     SUBNAM = 'ZCGESV_GMRES'
+                  END IF
+                  SRNAMT = SUBNAM
 *
-               KASE = KASE + 1
+                  KASE = KASE + 1
 *
-               CALL ZLACPY( 'Full', M, N, A, LDA, AFAC, LDA )
+                  CALL ZLACPY( 'Full', M, N, A, LDA, AFAC, LDA )
 *
-               CALL ZCGESV( N, NRHS, A, LDA, IWORK, B, LDA, X, LDA,
-     $                      WORK, SWORK, RWORK, ITER, INFO)
+                  IF( IFUNC.EQ.1 ) THEN
+                     CALL ZCGESV( N, NRHS, A, LDA, IWORK, B, LDA, X,
+     $                            LDA, WORK, SWORK, RWORK, ITER, INFO )
+                  ELSE
+                     CALL ZCGESV_GMRES( N, NRHS, A, LDA, IWORK, B, LDA,
+     $                                  X, LDA, WORK, LWORK, SWORK,
+     $                                  RWORK, ITER, INFO )
+                  END IF
 *
-               IF (ITER.LT.0) THEN
-                   CALL ZLACPY( 'Full', M, N, AFAC, LDA, A, LDA )
-               ENDIF
+                  IF( IFUNC.EQ.1 )
+     $               ITERSV = ITER
 *
-*              Check error code from ZCGESV. This should be the same as
-*              the one of DGETRF.
+                  IF (ITER.LT.0) THEN
+                      CALL ZLACPY( 'Full', M, N, AFAC, LDA, A, LDA )
+                  ENDIF
 *
-               IF( INFO.NE.IZERO ) THEN
+*                 Check error code from ZCGESV. This should be the same
+*                 as the one of DGETRF.
 *
-                  IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
-     $               CALL ALAHD( NOUT, PATH )
-                  NERRS = NERRS + 1
+                  IF( INFO.NE.IZERO ) THEN
 *
-                  IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
-                     WRITE( NOUT, FMT = 9988 )'ZCGESV',INFO,
-     $                         IZERO,M,IMAT
-                  ELSE
-                     WRITE( NOUT, FMT = 9975 )'ZCGESV',INFO,
-     $                         M, IMAT
+                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                  CALL ALAHD( NOUT, PATH )
+                     NERRS = NERRS + 1
+*
+                     IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
+                        WRITE( NOUT, FMT = 9988 )TRIM( SUBNAM ), INFO,
+     $                            IZERO, M, IMAT
+                     ELSE
+                        WRITE( NOUT, FMT = 9975 )TRIM( SUBNAM ), INFO,
+     $                            M, IMAT
+                     END IF
                   END IF
-               END IF
 *
-*              Skip the remaining test if the matrix is singular.
+*                 Skip the remaining test if the matrix is singular.
 *
-               IF( INFO.NE.0 )
-     $            GO TO 100
+                  IF( INFO.NE.0 )
+     $               GO TO 50
 *
-*              Check the quality of the solution
+*                 Up to type 8, CNDNUM = sqrt(0.1/EPS), GMRES-IR must
+*                 converge whenever the refinement of ZCGESV could run,
+*                 that is unless the conversion to single precision
+*                 (ITER = -2) or the single precision factorization
+*                 (ITER = -3) failed.
 *
-               CALL ZLACPY( 'Full', N, NRHS, B, LDA, WORK, LDA )
+                  IF( IFUNC.EQ.2 .AND. IMAT.LE.8 .AND. ITER.LT.0 .AND.
+     $               ( ITERSV.GE.0 .OR. ITERSV.LT.-3 ) ) THEN
+                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                  CALL ALAHD( NOUT, PATH )
+                     NERRS = NERRS + 1
+                     WRITE( NOUT, FMT = 9970 )TRIM( SUBNAM ), ITER, N,
+     $                  NRHS, IMAT
+                  END IF
 *
-               CALL ZGET08( TRANS, N, N, NRHS, A, LDA, X, LDA, WORK,
-     $                      LDA, RWORK, RESULT( 1 ) )
+*                 Check the quality of the solution
 *
-*              Check if the test passes the testing.
-*              Print information about the tests that did not
-*              pass the testing.
+                  CALL ZLACPY( 'Full', N, NRHS, B, LDA, WORK, LDA )
 *
-*              If iterative refinement has been used and claimed to
-*              be successful (ITER>0), we want
-*                NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS*SRQT(N)) < 1
+                  CALL ZGET08( TRANS, N, N, NRHS, A, LDA, X, LDA, WORK,
+     $                         LDA, RWORK, RESULT( 1 ) )
 *
-*              If double precision has been used (ITER<0), we want
-*                NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS) < THRES
-*              (Cf. the linear solver testing routines)
+*                 Check if the test passes the testing.
+*                 Print information about the tests that did not
+*                 pass the testing.
 *
-               IF ((THRESH.LE.0.0E+00)
-     $            .OR.((ITER.GE.0).AND.(N.GT.0)
-     $                 .AND.(RESULT(1).GE.SQRT(DBLE(N))))
-     $            .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH))) THEN
+*                 If iterative refinement has been used and claimed to
+*                 be successful (ITER>0), we want
+*                   NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS*SRQT(N)) < 1
 *
-                  IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
-                     WRITE( NOUT, FMT = 8999 )'DGE'
-                     WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
-                     WRITE( NOUT, FMT = 8979 )
-                     WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
-                     WRITE( NOUT, FMT = 8960 )1
-                     WRITE( NOUT, FMT = '( '' Messages:'' )' )
-                  END IF
+*                 If double precision has been used (ITER<0), we want
+*                   NORMI(B - A*X)/(NORMI(A)*NORMI(X)*EPS) < THRES
+*                 (Cf. the linear solver testing routines)
 *
-                  WRITE( NOUT, FMT = 9998 )TRANS, N, NRHS,
-     $               IMAT, 1, RESULT( 1 )
-                  NFAIL = NFAIL + 1
-               END IF
-               NRUN = NRUN + 1
+                  IF ((THRESH.LE.0.0E+00)
+     $               .OR.((ITER.GE.0).AND.(N.GT.0)
+     $                    .AND.(RESULT(1).GE.SQRT(DBLE(N))))
+     $               .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH))) THEN
+*
+                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
+                        WRITE( NOUT, FMT = 8999 )'DGE'
+                        WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
+                        WRITE( NOUT, FMT = 8979 )
+                        WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
+                        WRITE( NOUT, FMT = 8960 )1
+                        WRITE( NOUT, FMT = '( '' Messages:'' )' )
+                     END IF
+*
+                     WRITE( NOUT, FMT = 9998 )TRIM( SUBNAM ), TRANS, N,
+     $                  NRHS, IMAT, 1, RESULT( 1 )
+                     NFAIL = NFAIL + 1
+                  END IF
+                  NRUN = NRUN + 1
+   50          CONTINUE
    60       CONTINUE
   100    CONTINUE
   120 CONTINUE
@@ -386,32 +425,35 @@
 *     Print a summary of the results.
 *
       IF( NFAIL.GT.0 ) THEN
-         WRITE( NOUT, FMT = 9996 )'ZCGESV', NFAIL, NRUN
+         WRITE( NOUT, FMT = 9996 )'ZCGESV and ZCGESV_GMRES', NFAIL,
+     $      NRUN
       ELSE
-         WRITE( NOUT, FMT = 9995 )'ZCGESV', NRUN
+         WRITE( NOUT, FMT = 9995 )'ZCGESV and ZCGESV_GMRES', NRUN
       END IF
       IF( NERRS.GT.0 ) THEN
          WRITE( NOUT, FMT = 9994 )NERRS
       END IF
 *
- 9998 FORMAT( ' TRANS=''', A1, ''', N =', I5, ', NRHS=', I3, ', type ',
-     $      I2, ', test(', I2, ') =', G12.5 )
- 9996 FORMAT( 1X, A6, ': ', I6, ' out of ', I6,
+ 9998 FORMAT( 1X, A, ', TRANS=''', A1, ''', N =', I5, ', NRHS=', I3,
+     $      ', type ', I2, ', test(', I2, ') =', G12.5 )
+ 9996 FORMAT( 1X, A, ': ', I6, ' out of ', I6,
      $      ' tests failed to pass the threshold' )
- 9995 FORMAT( /1X, 'All tests for ', A6,
+ 9995 FORMAT( /1X, 'All tests for ', A,
      $      ' routines passed the threshold ( ', I6, ' tests run)' )
  9994 FORMAT( 6X, I6, ' error messages recorded' )
 *
 *     SUBNAM, INFO, INFOE, M, IMAT
 *
- 9988 FORMAT( ' *** ', A6, ' returned with INFO =', I5, ' instead of ',
+ 9988 FORMAT( ' *** ', A, ' returned with INFO =', I5, ' instead of ',
      $      I5, / ' ==> M =', I5, ', type ',
      $      I2 )
 *
 *     SUBNAM, INFO, M, IMAT
 *
- 9975 FORMAT( ' *** Error code from ', A6, '=', I5, ' for M=', I5,
+ 9975 FORMAT( ' *** Error code from ', A, '=', I5, ' for M=', I5,
      $      ', type ', I2 )
+ 9970 FORMAT( ' *** ', A, ' fell back to full precision, ITER =',
+     $      I5, / ' ==> N =', I5, ', NRHS=', I3, ', type ', I2 )
  8999 FORMAT( / 1X, A3, ':  General dense matrices' )
  8979 FORMAT( 4X, '1. Diagonal', 24X, '7. Last n/2 columns zero', / 4X,
      $      '2. Upper triangular', 16X,
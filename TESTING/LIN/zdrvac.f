@@ -9,11 +9,11 @@
 *  ===========
 *
 *       SUBROUTINE ZDRVAC( DOTYPE, NM, MVAL, NNS, NSVAL, THRESH, NMAX,
-*                          A, AFAC, B, X, WORK,
+*                          A, AFAC, B, X, WORK, LWORK,
 *                          RWORK, SWORK, NOUT )
 *
 *       .. Scalar Arguments ..
-*       INTEGER            NMAX, NM, NNS, NOUT
+*       INTEGER            LWORK, NMAX, NM, NNS, NOUT
 *       DOUBLE PRECISION   THRESH
 *       ..
 *       .. Array Arguments ..
@@ -31,7 +31,7 @@
 *>
 *> \verbatim
 *>
-*> ZDRVAC tests ZCPOSV.
+*> ZDRVAC tests ZCPOSV and ZCPOSV_GMRES.
 *> \endverbatim
 *
 *  Arguments:
@@ -110,6 +110,13 @@
 *>                      (NMAX*max(3,NSMAX))
 *> \endverbatim
 *>
+*> \param[in] LWORK
+*> \verbatim
+*>          LWORK is INTEGER
+*>          The dimension of the array WORK, at least the minimal
+*>          workspace of ZCPOSV_GMRES for N = NMAX and NRHS = NSMAX.
+*> \endverbatim
+*>
 *> \param[out] RWORK
 *> \verbatim
 *>          RWORK is DOUBLE PRECISION array, dimension
@@ -140,7 +147,7 @@
 *
 *  =====================================================================
       SUBROUTINE ZDRVAC( DOTYPE, NM, MVAL, NNS, NSVAL, THRESH, NMAX,
-     $                   A, AFAC, B, X, WORK,
+     $                   A, AFAC, B, X, WORK, LWORK,
      $                   RWORK, SWORK, NOUT )
 *
 *  -- LAPACK test routine --
@@ -148,7 +155,7 @@
 *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
 *
 *     .. Scalar Arguments ..
-      INTEGER            NMAX, NM, NNS, NOUT
+      INTEGER            LWORK, NMAX, NM, NNS, NOUT
       DOUBLE PRECISION   THRESH
 *     ..
 *     .. Array Arguments ..
@@ -174,7 +181,8 @@
       LOGICAL            ZEROT
       CHARACTER          DIST, TYPE, UPLO, XTYPE
       CHARACTER*3        PATH
-      INTEGER            I, IM, IMAT, INFO, IOFF, IRHS, IUPLO,
+      CHARACTER*12       SUBNAM
+      INTEGER            I, IFUNC, IM, IMAT, INFO, IOFF, IRHS, IUPLO,
      $                   IZERO, KL, KU, LDA, MODE, N,
      $                   NERRS, NFAIL, NIMAT, NRHS, NRUN
       DOUBLE PRECISION   ANORM, CNDNUM
@@ -185,15 +193,15 @@
       DOUBLE PRECISION   RESULT( NTESTS )
 *     ..
 *     .. Local Variables ..
-      INTEGER            ITER, KASE
+      INTEGER            ITER, ITERSV, KASE
 *     ..
 *     .. External Subroutines ..
       EXTERNAL           ALAERH, ZLACPY, ZLAIPD,
      $                   ZLARHS, ZLATB4, ZLATMS,
-     $                   ZPOT06, ZCPOSV
+     $                   ZPOT06, ZCPOSV, ZCPOSV_GMRES
 *     ..
 *     .. Intrinsic Functions ..
-      INTRINSIC          DBLE, MAX, SQRT
+      INTRINSIC          DBLE, MAX, SQRT, TRIM
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -327,80 +335,115 @@
 *                 Compute the L*L' or U'*U factorization of the
 *                 matrix and solve the system.
 *
-                  SRNAMT = 'ZCPOSV '
-                  KASE = KASE + 1
+                  DO 55 IFUNC = 1, 2
+                     IF( IFUNC.EQ.1 ) THEN
+                        SUBNAM = 'ZCPOSV'
+                     ELSE
+                        SUBNAM = 'ZCPOSV_GMRES'
+                     END IF
+                     SRNAMT = SUBNAM
+                     KASE = KASE + 1
 *
-                  CALL ZLACPY( 'All', N, N, A, LDA, AFAC, LDA)
+                     CALL ZLACPY( 'All', N, N, A, LDA, AFAC, LDA)
 *
-                  CALL ZCPOSV( UPLO, N, NRHS, AFAC, LDA, B, LDA, X, LDA,
-     $                         WORK, SWORK, RWORK, ITER, INFO )
+                     IF( IFUNC.EQ.1 ) THEN
+                        CALL ZCPOSV( UPLO, N, NRHS, AFAC, LDA, B, LDA,
+     $                               X, LDA, WORK, SWORK, RWORK, ITER,
+     $                               INFO )
+                     ELSE
+                        CALL ZCPOSV_GMRES( UPLO, N, NRHS, AFAC, LDA, B,
+     $                                     LDA, X, LDA, WORK, LWORK,
+     $                                     SWORK, RWORK, ITER, INFO )
+                     END IF
 *
-                  IF (ITER.LT.0) THEN
-                     CALL ZLACPY( 'All', N, N, A, LDA, AFAC, LDA )
-                  ENDIF
+                     IF( IFUNC.EQ.1 )
+     $                  ITERSV = ITER
 *
-*                 Check error code from ZCPOSV .
+                     IF (ITER.LT.0) THEN
+                        CALL ZLACPY( 'All', N, N, A, LDA, AFAC, LDA )
+                     ENDIF
 *
-                  IF( INFO.NE.IZERO ) THEN
+*                    Check error code from ZCPOSV or ZCPOSV_GMRES.
 *
-                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
-     $                  CALL ALAHD( NOUT, PATH )
-                     NERRS = NERRS + 1
+                     IF( INFO.NE.IZERO ) THEN
 *
-                     IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
-                        WRITE( NOUT, FMT = 9988 )'ZCPOSV',INFO,IZERO,N,
-     $                     IMAT
-                     ELSE
-                        WRITE( NOUT, FMT = 9975 )'ZCPOSV',INFO,N,IMAT
+                        IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                     CALL ALAHD( NOUT, PATH )
+                        NERRS = NERRS + 1
+*
+                        IF( INFO.NE.IZERO .AND. IZERO.NE.0 ) THEN
+                           WRITE( NOUT, FMT = 9988 )TRIM( SUBNAM ),
+     $                           INFO, IZERO, N, IMAT
+                        ELSE
+                           WRITE( NOUT, FMT = 9975 )TRIM( SUBNAM ),
+     $                           INFO, N, IMAT
+                        END IF
                      END IF
-                  END IF
 *
-*                 Skip the remaining test if the matrix is singular.
+*                    Skip the remaining test if the matrix is singular.
+*
+                     IF( INFO.NE.0 )
+     $                  GO TO 55
+*
+*                    Up to type 6, CNDNUM = sqrt(0.1/EPS), GMRES-IR must
+*                    converge whenever the refinement of ZCPOSV could
+*                    run, that is unless the conversion to single
+*                    precision (ITER = -2) or the single precision
+*                    factorization (ITER = -3) failed.
+*
+                     IF( IFUNC.EQ.2 .AND. IMAT.LE.6 .AND.
+     $                  ITER.LT.0 .AND.
+     $                  ( ITERSV.GE.0 .OR. ITERSV.LT.-3 ) ) THEN
+                        IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 )
+     $                     CALL ALAHD( NOUT, PATH )
+                        NERRS = NERRS + 1
+                        WRITE( NOUT, FMT = 9970 )TRIM( SUBNAM ),
+     $                     ITER, N, NRHS, IMAT
+                     END IF
 *
-                  IF( INFO.NE.0 )
-     $               GO TO 110
+*                    Check the quality of the solution
 *
-*                 Check the quality of the solution
+                     CALL ZLACPY( 'All', N, NRHS, B, LDA, WORK, LDA )
 *
-                  CALL ZLACPY( 'All', N, NRHS, B, LDA, WORK, LDA )
+                     CALL ZPOT06( UPLO, N, NRHS, A, LDA, X, LDA, WORK,
+     $                  LDA, RWORK, RESULT( 1 ) )
 *
-                  CALL ZPOT06( UPLO, N, NRHS, A, LDA, X, LDA, WORK,
-     $               LDA, RWORK, RESULT( 1 ) )
+*                    Check if the test passes the testing.
+*                    Print information about the tests that did not
+*                    pass the testing.
 *
-*                 Check if the test passes the testing.
-*                 Print information about the tests that did not
-*                 pass the testing.
+*                    If iterative refinement has been used and claimed
+*                    to be successful (ITER>0), we want
+*                    NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS*SRQT(N)) < 1
 *
-*                 If iterative refinement has been used and claimed to
-*                 be successful (ITER>0), we want
-*                 NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS*SRQT(N)) < 1
+*                    If double precision has been used (ITER<0), we want
+*                    NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS) < THRES
+*                    (Cf. the linear solver testing routines)
 *
-*                 If double precision has been used (ITER<0), we want
-*                 NORM1(B - A*X)/(NORM1(A)*NORM1(X)*EPS) < THRES
-*                 (Cf. the linear solver testing routines)
+                     IF ((THRESH.LE.0.0E+00)
+     $                  .OR.((ITER.GE.0).AND.(N.GT.0)
+     $                  .AND.(RESULT(1).GE.SQRT(DBLE(N))))
+     $                  .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH)))
+     $                  THEN
 *
-                  IF ((THRESH.LE.0.0E+00)
-     $               .OR.((ITER.GE.0).AND.(N.GT.0)
-     $               .AND.(RESULT(1).GE.SQRT(DBLE(N))))
-     $               .OR.((ITER.LT.0).AND.(RESULT(1).GE.THRESH))) THEN
+                        IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
+                           WRITE( NOUT, FMT = 8999 )'ZPO'
+                           WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
+                           WRITE( NOUT, FMT = 8979 )
+                           WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
+                           WRITE( NOUT, FMT = 8960 )1
+                           WRITE( NOUT, FMT = '( '' Messages:'' )' )
+                        END IF
 *
-                     IF( NFAIL.EQ.0 .AND. NERRS.EQ.0 ) THEN
-                        WRITE( NOUT, FMT = 8999 )'ZPO'
-                        WRITE( NOUT, FMT = '( '' Matrix types:'' )' )
-                        WRITE( NOUT, FMT = 8979 )
-                        WRITE( NOUT, FMT = '( '' Test ratios:'' )' )
-                        WRITE( NOUT, FMT = 8960 )1
-                        WRITE( NOUT, FMT = '( '' Messages:'' )' )
-                     END IF
+                        WRITE( NOUT, FMT = 9998 )TRIM( SUBNAM ), UPLO,
+     $                     N, NRHS, IMAT, 1, RESULT( 1 )
 *
-                     WRITE( NOUT, FMT = 9998 )UPLO, N, NRHS, IMAT, 1,
-     $                  RESULT( 1 )
+                        NFAIL = NFAIL + 1
 *
-                     NFAIL = NFAIL + 1
-*
-                  END IF
+                     END IF
 *
-                  NRUN = NRUN + 1
+                     NRUN = NRUN + 1
+   55             CONTINUE
 *
    60          CONTINUE
   100       CONTINUE
@@ -410,32 +453,35 @@
 *     Print a summary of the results.
 *
       IF( NFAIL.GT.0 ) THEN
-         WRITE( NOUT, FMT = 9996 )'ZCPOSV', NFAIL, NRUN
+         WRITE( NOUT, FMT = 9996 )'ZCPOSV and ZCPOSV_GMRES', NFAIL,
+     $      NRUN
       ELSE
-         WRITE( NOUT, FMT = 9995 )'ZCPOSV', NRUN
+         WRITE( NOUT, FMT = 9995 )'ZCPOSV and ZCPOSV_GMRES', NRUN
       END IF
       IF( NERRS.GT.0 ) THEN
          WRITE( NOUT, FMT = 9994 )NERRS
       END IF
 *
- 9998 FORMAT( ' UPLO=''', A1, ''', N =', I5, ', NRHS=', I3, ', type ',
-     $      I2, ', test(', I2, ') =', G12.5 )
- 9996 FORMAT( 1X, A6, ': ', I6, ' out of ', I6,
+ 9998 FORMAT( 1X, A, ', UPLO=''', A1, ''', N =', I5, ', NRHS=', I3,
+     $      ', type ', I2, ', test(', I2, ') =', G12.5 )
+ 9996 FORMAT( 1X, A, ': ', I6, ' out of ', I6,
      $      ' tests failed to pass the threshold' )
- 9995 FORMAT( /1X, 'All tests for ', A6,
+ 9995 FORMAT( /1X, 'All tests for ', A,
      $      ' routines passed the threshold ( ', I6, ' tests run)' )
  9994 FORMAT( 6X, I6, ' error messages recorded' )
 *
 *     SUBNAM, INFO, INFOE, N, IMAT
 *
- 9988 FORMAT( ' *** ', A6, ' returned with INFO =', I5, ' instead of ',
+ 9988 FORMAT( ' *** ', A, ' returned with INFO =', I5, ' instead of ',
      $      I5, / ' ==> N =', I5, ', type ',
      $      I2 )
 *
 *     SUBNAM, INFO, N, IMAT
 *
- 9975 FORMAT( ' *** Error code from ', A6, '=', I5, ' for M=', I5,
+ 9975 FORMAT( ' *** Error code from ', A, '=', I5, ' for M=', I5,
      $      ', type ', I2 )
+ 9970 FORMAT( ' *** ', A, ' fell back to full precision, ITER =',
+     $      I5, / ' ==> N =', I5, ', NRHS=', I3, ', type ', I2 )
  8999 FORMAT( / 1X, A3, ':  positive definite dense matrices' )
  8979 FORMAT( 4X, '1. Diagonal', 24X, '7. Last n/2 columns zero', / 4X,
      $      '2. Upper triangular', 16X,
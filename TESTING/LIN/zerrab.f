@@ -74,7 +74,7 @@
 *     .. External Functions ..
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CHKXER, ZCGESV
+      EXTERNAL           CHKXER, ZCGESV, ZCGESV_GMRES
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -127,17 +127,39 @@
       INFOT = 9
       CALL ZCGESV(2,1,A,2,IP,B,2,X,1,WORK,SWORK,RWORK,ITER,INFO)
       CALL CHKXER( 'ZCGESV', INFOT, NOUT, LERR, OK )
+*
+      SRNAMT = 'ZCGESV_GMRES'
+      INFOT = 1
+      CALL ZCGESV_GMRES(-1,0,A,1,IP,B,1,X,1,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 2
+      CALL ZCGESV_GMRES(0,-1,A,1,IP,B,1,X,1,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 4
+      CALL ZCGESV_GMRES(2,1,A,1,IP,B,2,X,2,WORK,1,SWORK,RWORK,ITER,INFO)
+      CALL CHKXER( 'ZCGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 7
+      CALL ZCGESV_GMRES(2,1,A,2,IP,B,1,X,2,WORK,1,SWORK,RWORK,ITER,INFO)
+      CALL CHKXER( 'ZCGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 9
+      CALL ZCGESV_GMRES(2,1,A,2,IP,B,2,X,1,WORK,1,SWORK,RWORK,ITER,INFO)
+      CALL CHKXER( 'ZCGESV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 11
+      CALL ZCGESV_GMRES(2,1,A,2,IP,B,2,X,2,WORK,1,SWORK,RWORK,ITER,INFO)
+      CALL CHKXER( 'ZCGESV_GMRES', INFOT, NOUT, LERR, OK )
 *
 *     Print a summary line.
 *
       IF( OK ) THEN
-         WRITE( NOUT, FMT = 9999 )'ZCGESV'
+         WRITE( NOUT, FMT = 9999 )'ZCGESV and ZCGESV_GMRES'
       ELSE
-         WRITE( NOUT, FMT = 9998 )'ZCGESV'
+         WRITE( NOUT, FMT = 9998 )'ZCGESV and ZCGESV_GMRES'
       END IF
 *
- 9999 FORMAT( 1X, A6, ' drivers passed the tests of the error exits' )
- 9998 FORMAT( ' *** ', A6, ' drivers failed the tests of the error ',
+ 9999 FORMAT( 1X, A, ' drivers passed the tests of the error exits' )
+ 9998 FORMAT( ' *** ', A, ' drivers failed the tests of the error ',
      $      'exits ***' )
 *
       RETURN
@@ -71,7 +71,7 @@
       COMPLEX            SWORK(NMAX*NMAX)
 *     ..
 *     .. External Subroutines ..
-      EXTERNAL           CHKXER, ZCPOSV
+      EXTERNAL           CHKXER, ZCPOSV, ZCPOSV_GMRES
 *     ..
 *     .. Scalars in Common ..
       LOGICAL            LERR, OK
@@ -126,17 +126,47 @@
       INFOT = 9
       CALL ZCPOSV('U',2,1,A,2,B,2,X,1,WORK,SWORK,RWORK,ITER,INFO)
       CALL CHKXER( 'ZCPOSV', INFOT, NOUT, LERR, OK )
+*
+      SRNAMT = 'ZCPOSV_GMRES'
+      INFOT = 1
+      CALL ZCPOSV_GMRES('/',0,0,A,1,B,1,X,1,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 2
+      CALL ZCPOSV_GMRES('U',-1,0,A,1,B,1,X,1,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 3
+      CALL ZCPOSV_GMRES('U',0,-1,A,1,B,1,X,1,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 5
+      CALL ZCPOSV_GMRES('U',2,1,A,1,B,2,X,2,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 7
+      CALL ZCPOSV_GMRES('U',2,1,A,2,B,1,X,2,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 9
+      CALL ZCPOSV_GMRES('U',2,1,A,2,B,2,X,1,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
+      INFOT = 11
+      CALL ZCPOSV_GMRES('U',2,1,A,2,B,2,X,2,WORK,1,SWORK,RWORK,ITER,
+     $                  INFO)
+      CALL CHKXER( 'ZCPOSV_GMRES', INFOT, NOUT, LERR, OK )
 *
 *     Print a summary line.
 *
       IF( OK ) THEN
-         WRITE( NOUT, FMT = 9999 )'ZCPOSV'
+         WRITE( NOUT, FMT = 9999 )'ZCPOSV and ZCPOSV_GMRES'
       ELSE
-         WRITE( NOUT, FMT = 9998 )'ZCPOSV'
+         WRITE( NOUT, FMT = 9998 )'ZCPOSV and ZCPOSV_GMRES'
       END IF
 *
- 9999 FORMAT( 1X, A6, ' drivers passed the tests of the error exits' )
- 9998 FORMAT( ' *** ', A6, ' drivers failed the tests of the error ',
+ 9999 FORMAT( 1X, A, ' drivers passed the tests of the error exits' )
+ 9998 FORMAT( ' *** ', A, ' drivers failed the tests of the error ',
      $      'exits ***' )
 *
       RETURN
@@ -0,0 +1,423 @@
+*> \brief \b CTIMDR
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE CTIMDR( NAME, OPT, M, N, NREP, TMIN, TAVG, FLOPS,
+*                          WSIZE, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER*( * )    NAME, OPT
+*       INTEGER            INFO, M, N, NREP
+*       INTEGER*8          WSIZE
+*       DOUBLE PRECISION   FLOPS, TAVG, TMIN
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> CTIMDR times a complex driver or factorization on a random
+*> M-by-N matrix, and returns its operation count and the size of the
+*> workspace it asks for.
+*>
+*> NAME is CGETRF, CPOTRF, CGEQRF, CGELS, CGESVD, CGESDD, CHEEVD,
+*> CHEEVR or CGEEV.  CPOTRF, CHEEVD, CHEEVR and CGEEV use a matrix of
+*> order N, Hermitian positive definite for CPOTRF and Hermitian for
+*> CHEEVD and CHEEVR; M is not referenced.
+*>
+*> The operation count is the usual one of the factorizations, and a
+*> nominal one for the iterative drivers (CGESVD, CGESDD, CHEEVD,
+*> CHEEVR and CGEEV): the count of Golub and Van Loan for the classical
+*> algorithm, which does not depend on the data.  A complex operation
+*> is counted as 4 real ones.  It is only meant to
+*> turn the times into rates that can be compared from one size to
+*> another.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] NAME
+*> \verbatim
+*>          NAME is CHARACTER*(*)
+*>          The name of the routine, in upper case.
+*> \endverbatim
+*>
+*> \param[in] OPT
+*> \verbatim
+*>          OPT is CHARACTER*(*)
+*>          For CGESVD, CGESDD, CHEEVD, CHEEVR and CGEEV:
+*>          = 'N' or ' ': eigenvalues or singular values only;
+*>          = 'V': also the eigenvectors (the right ones for CGEEV),
+*>                 or the first min(M,N) left and right singular
+*>                 vectors.
+*>          For CGELS, the number of right hand sides (1 if blank).
+*>          Not referenced otherwise.
+*> \endverbatim
+*>
+*> \param[in] M
+*> \verbatim
+*>          M is INTEGER
+*>          The number of rows of the matrix.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The number of columns of the matrix.
+*> \endverbatim
+*>
+*> \param[in] NREP
+*> \verbatim
+*>          NREP is INTEGER
+*>          The number of runs.
+*> \endverbatim
+*>
+*> \param[out] TMIN
+*> \verbatim
+*>          TMIN is DOUBLE PRECISION
+*>          The wall clock time of the fastest run, in seconds.
+*> \endverbatim
+*>
+*> \param[out] TAVG
+*> \verbatim
+*>          TAVG is DOUBLE PRECISION
+*>          The average wall clock time of the runs, in seconds.
+*> \endverbatim
+*>
+*> \param[out] FLOPS
+*> \verbatim
+*>          FLOPS is DOUBLE PRECISION
+*>          The number of floating point operations of one run.
+*> \endverbatim
+*>
+*> \param[out] WSIZE
+*> \verbatim
+*>          WSIZE is INTEGER*8
+*>          The size in bytes of the optimal workspace returned by the
+*>          workspace query (WORK, RWORK and IWORK).
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0: successful exit
+*>          = -1: NAME is not one of the routines above
+*>          = -2: OPT is not valid
+*>          > 0: the routine returned INFO
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup timing
+*
+*  =====================================================================
+      SUBROUTINE CTIMDR( NAME, OPT, M, N, NREP, TMIN, TAVG, FLOPS,
+     $                   WSIZE, INFO )
+*
+*  -- LAPACK timing routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER*( * )    NAME, OPT
+      INTEGER            INFO, M, N, NREP
+      INTEGER*8          WSIZE
+      DOUBLE PRECISION   FLOPS, TAVG, TMIN
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      REAL               ZERO
+      PARAMETER          ( ZERO = 0.0E+0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            WANTV
+      CHARACTER          JOB, JOBS
+      CHARACTER*8        SUBNAM
+      INTEGER            I, IOS, IREP, J, LDB, LIWORK, LRWORK, LWORK,
+     $                   MA, MN, MX, NEIG, NRHS
+      DOUBLE PRECISION   DM, DN, DR, T
+*     ..
+*     .. Local Arrays ..
+      INTEGER            ISEED( 4 ), IWQ( 1 )
+      REAL               RWQ( 1 )
+      COMPLEX            WQ( 1 )
+      INTEGER, ALLOCATABLE :: IWORK( : )
+      REAL, ALLOCATABLE  :: RWORK( : ), S( : )
+      COMPLEX, ALLOCATABLE :: A( :, : ), ASAV( :, : ), B( :, : ),
+     $                        BSAV( :, : ), TAU( : ), U( :, : ),
+     $                        VT( :, : ), WORK( : )
+*     ..
+*     .. External Functions ..
+      DOUBLE PRECISION   DWTIME
+      EXTERNAL           DWTIME
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           CGEEV, CGELS, CGEQRF, CGESDD, CGESVD, CGETRF,
+     $                   CHEEVD, CHEEVR, CLACPY, CLARNV, CPOTRF
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          CONJG, DBLE, INT, MAX, MIN, REAL,
+     $                   STORAGE_SIZE
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      TMIN = 0.0D+0
+      TAVG = 0.0D+0
+      FLOPS = 0.0D+0
+      WSIZE = 0
+      SUBNAM = NAME( 2: )
+      IF( SUBNAM.NE.'GETRF' .AND. SUBNAM.NE.'POTRF' .AND.
+     $    SUBNAM.NE.'GEQRF' .AND. SUBNAM.NE.'GELS' .AND.
+     $    SUBNAM.NE.'GESVD' .AND. SUBNAM.NE.'GESDD' .AND.
+     $    SUBNAM.NE.'HEEVD' .AND. SUBNAM.NE.'HEEVR' .AND.
+     $    SUBNAM.NE.'GEEV' ) THEN
+         INFO = -1
+         RETURN
+      END IF
+*
+*     Decode OPT
+*
+      NRHS = 1
+      WANTV = .FALSE.
+      IF( SUBNAM.EQ.'GELS' ) THEN
+         IF( OPT.NE.' ' ) THEN
+            READ( OPT, FMT = *, IOSTAT = IOS )NRHS
+            IF( IOS.NE.0 .OR. NRHS.LT.0 )
+     $         INFO = -2
+         END IF
+      ELSE IF( OPT.EQ.'V' ) THEN
+         WANTV = .TRUE.
+      ELSE IF( OPT.NE.' ' .AND. OPT.NE.'N' ) THEN
+         INFO = -2
+      END IF
+      IF( INFO.NE.0 )
+     $   RETURN
+      JOB = 'N'
+      JOBS = 'N'
+      IF( WANTV ) THEN
+         JOB = 'V'
+         JOBS = 'S'
+      END IF
+*
+      IF( SUBNAM.EQ.'POTRF' .OR. SUBNAM.EQ.'HEEVD' .OR.
+     $    SUBNAM.EQ.'HEEVR' .OR. SUBNAM.EQ.'GEEV' ) THEN
+         MA = N
+      ELSE
+         MA = M
+      END IF
+      MN = MIN( MA, N )
+      MX = MAX( MA, N )
+      LDB = MAX( 1, MX )
+*
+*     Operation count, in real operations
+*
+      DM = DBLE( MA )
+      DN = DBLE( N )
+      DR = DBLE( NRHS )
+      IF( SUBNAM.EQ.'GETRF' ) THEN
+         DR = DBLE( MN )
+         FLOPS = 2.0D0*( DM*DN*DR-( DM+DN )*DR*DR / 2.0D0+
+     $           DR*DR*DR / 3.0D0 )
+      ELSE IF( SUBNAM.EQ.'POTRF' ) THEN
+         FLOPS = DN*DN*DN / 3.0D0
+      ELSE IF( SUBNAM.EQ.'GEQRF' ) THEN
+         IF( MA.GE.N ) THEN
+            FLOPS = 2.0D0*DM*DN*DN - 2.0D0*DN*DN*DN / 3.0D0
+         ELSE
+            FLOPS = 2.0D0*DN*DM*DM - 2.0D0*DM*DM*DM / 3.0D0
+         END IF
+      ELSE IF( SUBNAM.EQ.'GELS' ) THEN
+         IF( MA.GE.N ) THEN
+            FLOPS = 2.0D0*DM*DN*DN - 2.0D0*DN*DN*DN / 3.0D0 +
+     $              DR*( 4.0D0*DM*DN-DN*DN )
+         ELSE
+            FLOPS = 2.0D0*DN*DM*DM - 2.0D0*DM*DM*DM / 3.0D0 +
+     $              DR*( 4.0D0*DM*DN-DM*DM )
+         END IF
+      ELSE IF( SUBNAM.EQ.'GESVD' .OR. SUBNAM.EQ.'GESDD' ) THEN
+         DM = DBLE( MX )
+         DN = DBLE( MN )
+         IF( WANTV ) THEN
+            FLOPS = 6.0D0*DM*DN*DN + 20.0D0*DN*DN*DN
+         ELSE
+            FLOPS = 4.0D0*DM*DN*DN - 4.0D0*DN*DN*DN / 3.0D0
+         END IF
+      ELSE IF( SUBNAM.EQ.'HEEVD' .OR. SUBNAM.EQ.'HEEVR' ) THEN
+         IF( WANTV ) THEN
+            FLOPS = 9.0D0*DN*DN*DN
+         ELSE
+            FLOPS = 4.0D0*DN*DN*DN / 3.0D0
+         END IF
+      ELSE
+         IF( WANTV ) THEN
+            FLOPS = 25.0D0*DN*DN*DN
+         ELSE
+            FLOPS = 10.0D0*DN*DN*DN
+         END IF
+      END IF
+      FLOPS = 4.0D0*FLOPS
+*
+*     Generate the matrix, the same one for every call
+*
+      ALLOCATE( A( MAX( 1, MA ), MAX( 1, N ) ),
+     $          ASAV( MAX( 1, MA ), MAX( 1, N ) ),
+     $          S( MAX( 1, MX ) ), TAU( MAX( 1, MX ) ),
+     $          IWORK( MAX( 1, 2*MX ) ) )
+      ISEED( 1 ) = 1988
+      ISEED( 2 ) = 1989
+      ISEED( 3 ) = 1990
+      ISEED( 4 ) = 1991
+      DO 10 J = 1, N
+         CALL CLARNV( 2, ISEED, MA, ASAV( 1, J ) )
+   10 CONTINUE
+      IF( SUBNAM.EQ.'POTRF' .OR. SUBNAM( 1: 2 ).EQ.'HE' ) THEN
+*
+*        Hermitian, and positive definite for CPOTRF
+*
+         DO 30 J = 1, N
+            DO 20 I = J + 1, N
+               ASAV( J, I ) = CONJG( ASAV( I, J ) )
+   20       CONTINUE
+            ASAV( J, J ) = REAL( ASAV( J, J ) ) + REAL( N )
+   30    CONTINUE
+      END IF
+      IF( SUBNAM.EQ.'GELS' ) THEN
+         ALLOCATE( B( LDB, MAX( 1, NRHS ) ),
+     $             BSAV( LDB, MAX( 1, NRHS ) ) )
+         DO 40 J = 1, NRHS
+            CALL CLARNV( 2, ISEED, MX, BSAV( 1, J ) )
+   40    CONTINUE
+      END IF
+      IF( WANTV ) THEN
+         ALLOCATE( U( MAX( 1, MA ), MAX( 1, MX ) ),
+     $             VT( MAX( 1, MX ), MAX( 1, N ) ) )
+      ELSE
+         ALLOCATE( U( 1, 1 ), VT( 1, 1 ) )
+      END IF
+*
+*     Query the workspace.  CGESVD, CGESDD and CGEEV do not return
+*     the size of RWORK, which is that of their documentation.
+*
+      WQ( 1 ) = ZERO
+      RWQ( 1 ) = ZERO
+      IWQ( 1 ) = 0
+      IF( SUBNAM.EQ.'GEQRF' ) THEN
+         CALL CGEQRF( MA, N, A, MAX( 1, MA ), TAU, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'GELS' ) THEN
+         CALL CGELS( 'No transpose', MA, N, NRHS, A, MAX( 1, MA ), B,
+     $               LDB, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'GESVD' ) THEN
+         CALL CGESVD( JOBS, JOBS, MA, N, A, MAX( 1, MA ), S, U,
+     $                MAX( 1, MA ), VT, MAX( 1, MX ), WQ, -1, RWQ,
+     $                INFO )
+         RWQ( 1 ) = 5*MN
+      ELSE IF( SUBNAM.EQ.'GESDD' ) THEN
+         CALL CGESDD( JOBS, MA, N, A, MAX( 1, MA ), S, U, MAX( 1, MA ),
+     $                VT, MAX( 1, MX ), WQ, -1, RWQ, IWORK, INFO )
+         IF( WANTV ) THEN
+            RWQ( 1 ) = MAX( 5*MN*MN+5*MN, 2*MX*MN+2*MN*MN+MN )
+         ELSE
+            RWQ( 1 ) = 7*MN
+         END IF
+         IWQ( 1 ) = 8*MN
+      ELSE IF( SUBNAM.EQ.'HEEVD' ) THEN
+         CALL CHEEVD( JOB, 'Lower', N, A, MAX( 1, N ), S, WQ, -1, RWQ,
+     $                -1, IWQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'HEEVR' ) THEN
+         CALL CHEEVR( JOB, 'All', 'Lower', N, A, MAX( 1, N ), ZERO,
+     $                ZERO, 0, 0, ZERO, NEIG, S, U, MAX( 1, N ), IWORK,
+     $                WQ, -1, RWQ, -1, IWQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'GEEV' ) THEN
+         CALL CGEEV( 'No left', JOB, N, A, MAX( 1, N ), TAU, U,
+     $               MAX( 1, N ), VT, MAX( 1, N ), WQ, -1, RWQ, INFO )
+         RWQ( 1 ) = 2*N
+      END IF
+      LWORK = MAX( 1, INT( WQ( 1 ) ) )
+      LRWORK = MAX( 1, INT( RWQ( 1 ) ) )
+      LIWORK = MAX( 1, IWQ( 1 ) )
+      IF( WQ( 1 ).NE.ZERO )
+     $   WSIZE = WSIZE + INT( LWORK, 8 )*( STORAGE_SIZE( WQ ) / 8 )
+      IF( RWQ( 1 ).NE.ZERO )
+     $   WSIZE = WSIZE + INT( LRWORK, 8 )*( STORAGE_SIZE( RWQ ) / 8 )
+      IF( IWQ( 1 ).NE.0 )
+     $   WSIZE = WSIZE + INT( LIWORK, 8 )*( STORAGE_SIZE( IWQ ) / 8 )
+      ALLOCATE( WORK( LWORK ), RWORK( LRWORK ) )
+      DEALLOCATE( IWORK )
+      ALLOCATE( IWORK( LIWORK+2*MX ) )
+*
+      DO 50 IREP = 1, MAX( 1, NREP )
+         CALL CLACPY( 'Full', MA, N, ASAV, MAX( 1, MA ), A,
+     $                MAX( 1, MA ) )
+         IF( SUBNAM.EQ.'GELS' )
+     $      CALL CLACPY( 'Full', MX, NRHS, BSAV, LDB, B, LDB )
+         T = DWTIME( )
+         IF( SUBNAM.EQ.'GETRF' ) THEN
+            CALL CGETRF( MA, N, A, MAX( 1, MA ), IWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'POTRF' ) THEN
+            CALL CPOTRF( 'Lower', N, A, MAX( 1, N ), INFO )
+         ELSE IF( SUBNAM.EQ.'GEQRF' ) THEN
+            CALL CGEQRF( MA, N, A, MAX( 1, MA ), TAU, WORK, LWORK,
+     $                   INFO )
+         ELSE IF( SUBNAM.EQ.'GELS' ) THEN
+            CALL CGELS( 'No transpose', MA, N, NRHS, A, MAX( 1, MA ),
+     $                  B, LDB, WORK, LWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'GESVD' ) THEN
+            CALL CGESVD( JOBS, JOBS, MA, N, A, MAX( 1, MA ), S, U,
+     $                   MAX( 1, MA ), VT, MAX( 1, MX ), WORK, LWORK,
+     $                   RWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'GESDD' ) THEN
+            CALL CGESDD( JOBS, MA, N, A, MAX( 1, MA ), S, U,
+     $                   MAX( 1, MA ), VT, MAX( 1, MX ), WORK, LWORK,
+     $                   RWORK, IWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'HEEVD' ) THEN
+            CALL CHEEVD( JOB, 'Lower', N, A, MAX( 1, N ), S, WORK,
+     $                   LWORK, RWORK, LRWORK, IWORK, LIWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'HEEVR' ) THEN
+            CALL CHEEVR( JOB, 'All', 'Lower', N, A, MAX( 1, N ), ZERO,
+     $                   ZERO, 0, 0, ZERO, NEIG, S, U, MAX( 1, N ),
+     $                   IWORK( LIWORK+1 ), WORK, LWORK, RWORK, LRWORK,
+     $                   IWORK, LIWORK, INFO )
+         ELSE
+            CALL CGEEV( 'No left', JOB, N, A, MAX( 1, N ), TAU, U,
+     $                  MAX( 1, N ), VT, MAX( 1, N ), WORK, LWORK,
+     $                  RWORK, INFO )
+         END IF
+         T = DWTIME( ) - T
+         IF( INFO.NE.0 )
+     $      GO TO 60
+         IF( IREP.EQ.1 ) THEN
+            TMIN = T
+         ELSE
+            TMIN = MIN( TMIN, T )
+         END IF
+         TAVG = TAVG + T
+   50 CONTINUE
+      TAVG = TAVG / DBLE( MAX( 1, NREP ) )
+*
+   60 CONTINUE
+      DEALLOCATE( A, ASAV, S, TAU, IWORK, U, VT, WORK, RWORK )
+      IF( ALLOCATED( B ) )
+     $   DEALLOCATE( B, BSAV )
+      RETURN
+*
+*     End of CTIMDR
+*
+      END
@@ -0,0 +1,243 @@
+*> \brief \b DTUNE
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       SUBROUTINE DTUNE( NAME, N, NREP, TIME, INFO )
+*
+*       .. Scalar Arguments ..
+*       CHARACTER*( * )    NAME
+*       INTEGER            INFO, N, NREP
+*       DOUBLE PRECISION   TIME
+*       ..
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> DTUNE times the double precision routine whose tuning parameters
+*> ILAENV looks up under NAME, on a random matrix of order N, with
+*> the parameters currently in the table of ILAENVTAB.
+*>
+*> NAME is DGETRF, DPOTRF, DGEQRF, DGELQF, DSYTRD, DGEBRD, DGEHRD or
+*> DSYTRD_2STAGE, which times that routine, or DHSEQR or DLAQR0, which
+*> time DHSEQR computing the Schur form and the Schur vectors of an
+*> upper Hessenberg matrix.
+*> \endverbatim
+*
+*  Arguments:
+*  ==========
+*
+*> \param[in] NAME
+*> \verbatim
+*>          NAME is CHARACTER*(*)
+*>          The name of the routine, in upper case.
+*> \endverbatim
+*>
+*> \param[in] N
+*> \verbatim
+*>          N is INTEGER
+*>          The order of the matrix.
+*> \endverbatim
+*>
+*> \param[in] NREP
+*> \verbatim
+*>          NREP is INTEGER
+*>          The number of runs; the shortest time is returned.
+*> \endverbatim
+*>
+*> \param[out] TIME
+*> \verbatim
+*>          TIME is DOUBLE PRECISION
+*>          The wall clock time of the fastest run, in seconds.
+*> \endverbatim
+*>
+*> \param[out] INFO
+*> \verbatim
+*>          INFO is INTEGER
+*>          = 0: successful exit
+*>          = -1: NAME is not one of the routines above
+*>          > 0: the routine returned INFO
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup timing
+*
+*  =====================================================================
+      SUBROUTINE DTUNE( NAME, N, NREP, TIME, INFO )
+*
+*  -- LAPACK timing routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*     .. Scalar Arguments ..
+      CHARACTER*( * )    NAME
+      INTEGER            INFO, N, NREP
+      DOUBLE PRECISION   TIME
+*     ..
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      DOUBLE PRECISION   ZERO
+      PARAMETER          ( ZERO = 0.0D+0 )
+*     ..
+*     .. Local Scalars ..
+      CHARACTER*12       SUBNAM
+      INTEGER            I, IREP, J, LHOUS, LWORK
+      DOUBLE PRECISION   T
+*     ..
+*     .. Local Arrays ..
+      INTEGER            ISEED( 4 )
+      DOUBLE PRECISION   WQ( 1 ), HQ( 1 )
+      INTEGER, ALLOCATABLE :: IPIV( : )
+      DOUBLE PRECISION, ALLOCATABLE :: A( :, : ), ASAV( :, : ),
+     $                                 D( : ), E( : ), TAU( : ),
+     $                                 HOUS( : ), WORK( : ), Z( :, : )
+*     ..
+*     .. External Functions ..
+      DOUBLE PRECISION   DWTIME
+      EXTERNAL           DWTIME
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           DGEBRD, DGEHRD, DGELQF, DGEQRF, DGETRF,
+     $                   DHSEQR, DLACPY, DLARNV, DPOTRF, DSYTRD,
+     $                   DSYTRD_2STAGE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          DBLE, INT, MAX, MIN
+*     ..
+*     .. Executable Statements ..
+*
+      INFO = 0
+      TIME = ZERO
+      SUBNAM = NAME( 2: )
+      IF( SUBNAM.NE.'GETRF' .AND. SUBNAM.NE.'POTRF' .AND.
+     $    SUBNAM.NE.'GEQRF' .AND. SUBNAM.NE.'GELQF' .AND.
+     $    SUBNAM.NE.'SYTRD' .AND. SUBNAM.NE.'GEBRD' .AND.
+     $    SUBNAM.NE.'GEHRD' .AND. SUBNAM.NE.'HSEQR' .AND.
+     $    SUBNAM.NE.'LAQR0' .AND. SUBNAM.NE.'SYTRD_2STAGE' ) THEN
+         INFO = -1
+         RETURN
+      END IF
+*
+*     Generate the matrix, the same one for every call
+*
+      ALLOCATE( A( N, N ), ASAV( N, N ), D( N ), E( N ),
+     $          TAU( 2*N ), IPIV( N ) )
+      ISEED( 1 ) = 1988
+      ISEED( 2 ) = 1989
+      ISEED( 3 ) = 1990
+      ISEED( 4 ) = 1991
+      DO 10 J = 1, N
+         CALL DLARNV( 2, ISEED, N, ASAV( 1, J ) )
+   10 CONTINUE
+      IF( SUBNAM.EQ.'POTRF' .OR. SUBNAM( 1: 5 ).EQ.'SYTRD' ) THEN
+*
+*        Symmetric, and positive definite for DPOTRF
+*
+         DO 30 J = 1, N
+            DO 20 I = J + 1, N
+               ASAV( J, I ) = ASAV( I, J )
+   20       CONTINUE
+            ASAV( J, J ) = ASAV( J, J ) + DBLE( N )
+   30    CONTINUE
+      ELSE IF( SUBNAM.EQ.'HSEQR' .OR. SUBNAM.EQ.'LAQR0' ) THEN
+*
+*        Upper Hessenberg
+*
+         DO 50 J = 1, N
+            DO 40 I = J + 2, N
+               ASAV( I, J ) = ZERO
+   40       CONTINUE
+   50    CONTINUE
+      END IF
+*
+*     Query the workspace, with the parameters that will be used
+*
+      LWORK = 1
+      LHOUS = 1
+      IF( SUBNAM.EQ.'GEQRF' ) THEN
+         CALL DGEQRF( N, N, A, N, TAU, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'GELQF' ) THEN
+         CALL DGELQF( N, N, A, N, TAU, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'SYTRD' ) THEN
+         CALL DSYTRD( 'Lower', N, A, N, D, E, TAU, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'GEBRD' ) THEN
+         CALL DGEBRD( N, N, A, N, D, E, TAU, TAU( N+1 ), WQ, -1,
+     $                INFO )
+      ELSE IF( SUBNAM.EQ.'GEHRD' ) THEN
+         CALL DGEHRD( N, 1, N, A, N, TAU, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'HSEQR' .OR. SUBNAM.EQ.'LAQR0' ) THEN
+         ALLOCATE( Z( N, N ) )
+         CALL DHSEQR( 'Schur', 'Initialize', N, 1, N, A, N, D, E, Z,
+     $                N, WQ, -1, INFO )
+      ELSE IF( SUBNAM.EQ.'SYTRD_2STAGE' ) THEN
+         CALL DSYTRD_2STAGE( 'No vectors', 'Lower', N, A, N, D, E,
+     $                       TAU, HQ, -1, WQ, -1, INFO )
+         LHOUS = MAX( 1, INT( HQ( 1 ) ) )
+      ELSE
+         WQ( 1 ) = ZERO
+      END IF
+      LWORK = MAX( 1, INT( WQ( 1 ) ) )
+      ALLOCATE( WORK( LWORK ), HOUS( LHOUS ) )
+*
+      DO 60 IREP = 1, MAX( 1, NREP )
+         CALL DLACPY( 'Full', N, N, ASAV, N, A, N )
+         T = DWTIME( )
+         IF( SUBNAM.EQ.'GETRF' ) THEN
+            CALL DGETRF( N, N, A, N, IPIV, INFO )
+         ELSE IF( SUBNAM.EQ.'POTRF' ) THEN
+            CALL DPOTRF( 'Lower', N, A, N, INFO )
+         ELSE IF( SUBNAM.EQ.'GEQRF' ) THEN
+            CALL DGEQRF( N, N, A, N, TAU, WORK, LWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'GELQF' ) THEN
+            CALL DGELQF( N, N, A, N, TAU, WORK, LWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'SYTRD' ) THEN
+            CALL DSYTRD( 'Lower', N, A, N, D, E, TAU, WORK, LWORK,
+     $                   INFO )
+         ELSE IF( SUBNAM.EQ.'GEBRD' ) THEN
+            CALL DGEBRD( N, N, A, N, D, E, TAU, TAU( N+1 ), WORK,
+     $                   LWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'GEHRD' ) THEN
+            CALL DGEHRD( N, 1, N, A, N, TAU, WORK, LWORK, INFO )
+         ELSE IF( SUBNAM.EQ.'HSEQR' .OR. SUBNAM.EQ.'LAQR0' ) THEN
+            CALL DHSEQR( 'Schur', 'Initialize', N, 1, N, A, N, D, E,
+     $                   Z, N, WORK, LWORK, INFO )
+         ELSE
+            CALL DSYTRD_2STAGE( 'No vectors', 'Lower', N, A, N, D, E,
+     $                          TAU, HOUS, LHOUS, WORK, LWORK, INFO )
+         END IF
+         T = DWTIME( ) - T
+         IF( INFO.NE.0 )
+     $      GO TO 70
+         IF( IREP.EQ.1 ) THEN
+            TIME = T
+         ELSE
+            TIME = MIN( TIME, T )
+         END IF
+   60 CONTINUE
+*
+   70 CONTINUE
+      DEALLOCATE( A, ASAV, D, E, TAU, IPIV, WORK, HOUS )
+      IF( ALLOCATED( Z ) )
+     $   DEALLOCATE( Z )
+      RETURN
+*
+*     End of DTUNE
+*
+      END
@@ -0,0 +1,58 @@
+*> \brief \b DWTIME
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*      DOUBLE PRECISION FUNCTION DWTIME( )
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*>  DWTIME returns the wall clock time in seconds, from an arbitrary
+*>  origin.  Unlike DSECND, which returns the user time of the process,
+*>  it does not add up the time of the threads of the threaded BLAS or
+*>  of the OpenMP code of LAPACK.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup timing
+*
+*  =====================================================================
+      DOUBLE PRECISION FUNCTION DWTIME( )
+*
+*  -- LAPACK timing routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+* =====================================================================
+*
+*     .. Local Scalars ..
+      INTEGER*8          COUNT, RATE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          DBLE, SYSTEM_CLOCK
+*     ..
+*     .. Executable Statements ..
+*
+      CALL SYSTEM_CLOCK( COUNT, RATE )
+      DWTIME = DBLE( COUNT ) / DBLE( RATE )
+      RETURN
+*
+*     End of DWTIME
+*
+      END
@@ -0,0 +1,254 @@
+*> \brief \b ILAENVTUNE
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       PROGRAM ILAENVTUNE
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> ILAENVTUNE chooses the tuning parameters of ILAENV for the current
+*> machine.  For each routine and parameter of the input file, it
+*> times the routine with the built-in value of the parameter and with
+*> each of the values given, and keeps the fastest one in the table of
+*> ILAENVTAB.  The table is then written to a file, which LAPACK loads
+*> when the environment variable LAPACK_ILAENV_FILE names it.
+*>
+*> The parameters are tuned in the order of the input file, each one
+*> with the values already chosen for the previous ones.  A parameter
+*> is only added to the table if one of its values is faster than the
+*> built-in value.
+*>
+*> The routines that can be tuned are those of STUNE, DTUNE, CTUNE
+*> and ZTUNE.  The times are wall clock times, so that the threads of
+*> the BLAS and of LAPACK are taken into account: the tuning should be
+*> run with the number of threads of the production runs.
+*>
+*> The input file is read from unit 5:
+*>
+*> Line 1:  Title (ignored)
+*> Line 2:  Name of the output file
+*> Line 3:  Order N of the matrices
+*> Line 4:  Number of runs of each timing; the fastest one is kept
+*> Lines 5 to end:  A routine name, a parameter, the number of values
+*>          and the values, for example
+*>
+*>          DGETRF  NB  6  32 48 64 96 128 192
+*>
+*>          The parameter is NB, NX, NMIN, NW, NIBBLE, NS or KD, or an
+*>          ISPEC of ILAENV.  Lines starting with # or * are skipped.
+*>
+*> The results are printed on unit 6.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup timing
+*
+*  =====================================================================
+      PROGRAM ILAENVTUNE
+*
+*  -- LAPACK timing routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      INTEGER            NIN, NOUT, MAXVAL
+      PARAMETER          ( NIN = 5, NOUT = 6, MAXVAL = 32 )
+*     ..
+*     .. Local Scalars ..
+      CHARACTER*16       NAME
+      CHARACTER*6        WORD
+      CHARACTER*132      LINE
+      CHARACTER*80       OUTFIL
+      INTEGER            I, IBEST, IC, INFO, IOS, ISPEC, IVAL, N, NERR,
+     $                   NREP, NTUNED, NV
+      DOUBLE PRECISION   T, TBEST, TDEF
+*     ..
+*     .. Local Arrays ..
+      INTEGER            IV( MAXVAL ), IVTUNE( 3, 64 )
+      CHARACTER*16       NAMES( 64 )
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           CTUNE, DTUNE, ILAENVTAB, STUNE, ZTUNE
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          ADJUSTL, CHAR, ICHAR, MIN, TRIM
+*     ..
+*     .. Executable Statements ..
+*
+      READ( NIN, FMT = * )
+      READ( NIN, FMT = * )OUTFIL
+      READ( NIN, FMT = * )N
+      READ( NIN, FMT = * )NREP
+      WRITE( NOUT, FMT = 9999 )N, NREP
+*
+*     Start from the built-in values
+*
+      CALL ILAENVTAB( 'R', 0, ' ', IVAL, INFO )
+      NTUNED = 0
+*
+   10 CONTINUE
+      READ( NIN, FMT = '(A)', END = 60 )LINE
+      LINE = ADJUSTL( LINE )
+      IF( LINE.EQ.' ' .OR. LINE( 1: 1 ).EQ.'#' .OR.
+     $    LINE( 1: 1 ).EQ.'*' )GO TO 10
+      NV = 0
+      READ( LINE, FMT = *, IOSTAT = IOS )NAME, WORD, NV,
+     $   ( IV( I ), I = 1, MIN( NV, MAXVAL ) )
+      IF( IOS.NE.0 .OR. NV.LT.1 .OR. NV.GT.MAXVAL ) THEN
+         WRITE( NOUT, FMT = 9998 )TRIM( LINE )
+         GO TO 10
+      END IF
+*
+*     Convert the name and the parameter to upper case
+*
+      DO 20 I = 1, 16
+         IC = ICHAR( NAME( I: I ) )
+         IF( IC.GE.97 .AND. IC.LE.122 )
+     $      NAME( I: I ) = CHAR( IC-32 )
+         IF( I.LE.6 ) THEN
+            IC = ICHAR( WORD( I: I ) )
+            IF( IC.GE.97 .AND. IC.LE.122 )
+     $         WORD( I: I ) = CHAR( IC-32 )
+         END IF
+   20 CONTINUE
+*
+      IF( WORD.EQ.'NB' ) THEN
+         ISPEC = 1
+      ELSE IF( WORD.EQ.'NX' ) THEN
+         ISPEC = 3
+      ELSE IF( WORD.EQ.'NMIN' ) THEN
+         ISPEC = 12
+      ELSE IF( WORD.EQ.'NW' ) THEN
+         ISPEC = 13
+      ELSE IF( WORD.EQ.'NIBBLE' ) THEN
+         ISPEC = 14
+      ELSE IF( WORD.EQ.'NS' ) THEN
+         ISPEC = 15
+      ELSE IF( WORD.EQ.'KD' ) THEN
+         ISPEC = 17
+      ELSE
+         READ( WORD, FMT = *, IOSTAT = IOS )ISPEC
+         IF( IOS.NE.0 .OR. ISPEC.LT.1 .OR. ISPEC.GT.18 ) THEN
+            WRITE( NOUT, FMT = 9998 )TRIM( LINE )
+            GO TO 10
+         END IF
+      END IF
+*
+*     Time the built-in value, then each value of the line.  The
+*     first run (I = -1) only warms up the caches and is not counted.
+*
+      CALL ILAENVTAB( 'D', ISPEC, NAME, IVAL, INFO )
+      IBEST = 0
+      DO 30 I = -1, NV
+         IF( I.GT.0 )
+     $      CALL ILAENVTAB( 'S', ISPEC, NAME, IV( I ), INFO )
+         IF( NAME( 1: 1 ).EQ.'S' ) THEN
+            CALL STUNE( NAME, N, NREP, T, INFO )
+         ELSE IF( NAME( 1: 1 ).EQ.'D' ) THEN
+            CALL DTUNE( NAME, N, NREP, T, INFO )
+         ELSE IF( NAME( 1: 1 ).EQ.'C' ) THEN
+            CALL CTUNE( NAME, N, NREP, T, INFO )
+         ELSE IF( NAME( 1: 1 ).EQ.'Z' ) THEN
+            CALL ZTUNE( NAME, N, NREP, T, INFO )
+         ELSE
+            INFO = -1
+         END IF
+         IF( INFO.EQ.-1 ) THEN
+            WRITE( NOUT, FMT = 9997 )NAME
+            CALL ILAENVTAB( 'D', ISPEC, NAME, IVAL, INFO )
+            GO TO 10
+         END IF
+         IF( I.LT.0 )
+     $      GO TO 30
+         IF( I.EQ.0 ) THEN
+            WRITE( NOUT, FMT = 9996 )NAME, WORD, T
+            TDEF = T
+            TBEST = T
+         ELSE
+            WRITE( NOUT, FMT = 9995 )IV( I ), T
+         END IF
+         IF( INFO.NE.0 ) THEN
+            WRITE( NOUT, FMT = 9994 )INFO
+         ELSE IF( T.LT.TBEST ) THEN
+            IBEST = I
+            TBEST = T
+         END IF
+   30 CONTINUE
+*
+*     Keep the fastest value, if it is not the built-in one
+*
+      IF( IBEST.EQ.0 ) THEN
+         CALL ILAENVTAB( 'D', ISPEC, NAME, IVAL, INFO )
+         WRITE( NOUT, FMT = 9993 )
+      ELSE
+         CALL ILAENVTAB( 'S', ISPEC, NAME, IV( IBEST ), INFO )
+         WRITE( NOUT, FMT = 9992 )WORD, IV( IBEST ),
+     $      ( TDEF-TBEST ) / TDEF*100.0D0
+         IF( NTUNED.LT.64 ) THEN
+            NTUNED = NTUNED + 1
+            NAMES( NTUNED ) = NAME
+            IVTUNE( 1, NTUNED ) = ISPEC
+            IVTUNE( 2, NTUNED ) = IV( IBEST )
+         END IF
+      END IF
+      GO TO 10
+*
+*     Write the table, and check that it reads back
+*
+   60 CONTINUE
+      CALL ILAENVTAB( 'W', 0, OUTFIL, IVAL, INFO )
+      IF( INFO.NE.0 ) THEN
+         WRITE( NOUT, FMT = 9991 )TRIM( OUTFIL )
+         STOP
+      END IF
+      CALL ILAENVTAB( 'R', 0, ' ', IVAL, INFO )
+      CALL ILAENVTAB( 'L', 0, OUTFIL, IVAL, INFO )
+      NERR = 0
+      DO 70 I = 1, NTUNED
+         CALL ILAENVTAB( 'G', IVTUNE( 1, I ), NAMES( I ),
+     $                   IVTUNE( 3, I ), INFO )
+         IF( INFO.NE.0 .OR. IVTUNE( 3, I ).NE.IVTUNE( 2, I ) )
+     $      NERR = NERR + 1
+   70 CONTINUE
+      IF( NERR.EQ.0 ) THEN
+         WRITE( NOUT, FMT = 9990 )NTUNED, TRIM( OUTFIL )
+      ELSE
+         WRITE( NOUT, FMT = 9989 )TRIM( OUTFIL ), NERR
+      END IF
+*
+ 9999 FORMAT( ' Tuning of the ILAENV parameters', /
+     $      ' Matrices of order ', I6, ', fastest of ', I3, ' runs', / )
+ 9998 FORMAT( ' *** Invalid input line: ', A )
+ 9997 FORMAT( ' *** ', A, ' cannot be tuned' )
+ 9996 FORMAT( 1X, A16, 1X, A6, '  built-in ', F12.4, ' s' )
+ 9995 FORMAT( 25X, I10, F12.4, ' s' )
+ 9994 FORMAT( 25X, ' *** INFO = ', I6 )
+ 9993 FORMAT( 25X, ' -> built-in value kept', / )
+ 9992 FORMAT( 25X, ' -> ', A6, ' = ', I6, ', ', F6.1, '% faster', / )
+ 9991 FORMAT( ' *** Cannot write the table to ', A )
+ 9990 FORMAT( 1X, I4, ' parameters written to ', A )
+ 9989 FORMAT( ' *** The table read back from ', A, ' differs in ', I4,
+     $      ' entries' )
+*
+*     End of ILAENVTUNE
+*
+      END
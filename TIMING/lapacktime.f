@@ -0,0 +1,273 @@
+*> \brief \b LAPACKTIME
+*
+*  =========== DOCUMENTATION ===========
+*
+* Online html documentation available at
+*            http://www.netlib.org/lapack/explore-html/
+*
+*  Definition:
+*  ===========
+*
+*       PROGRAM LAPACKTIME
+*
+*
+*> \par Purpose:
+*  =============
+*>
+*> \verbatim
+*>
+*> LAPACKTIME is the timing program for the main LAPACK drivers and
+*> factorizations.  For each routine and matrix size of the input
+*> file, it reports the wall clock time, the rate in GFLOP/s and the
+*> size of the workspace, on unit 6 and in a CSV or JSON file that can
+*> be compared from one release to the next.
+*>
+*> The routines that can be timed are xGETRF, xPOTRF, xGEQRF, xGELS,
+*> xGESVD, xGESDD, xSYEVD, xSYEVR (xHEEVD, xHEEVR in complex) and
+*> xGEEV, in the four precisions; see STIMDR, DTIMDR, CTIMDR and ZTIMDR.
+*> The rates of the iterative drivers use a nominal operation count.
+*> The times are wall clock times, which include the threads of the
+*> BLAS and of LAPACK; the number of threads of LAPACK (ILATHREADS) is
+*> reported with them.
+*>
+*> The input file is read from unit 5:
+*>
+*> Line 1:  Title, also written to the JSON file
+*> Line 2:  Output format (CSV or JSON) and name of the output file
+*> Line 3:  Number of runs of each timing; the fastest one gives the
+*>          rate, and the average is also reported
+*> Line 4:  Number of matrix sizes, NSIZE
+*> Line 5:  Values of M (NSIZE values)
+*> Line 6:  Values of N (NSIZE values); the I-th matrix is M(I)-by-N(I)
+*>          except for the routines on square matrices, which use
+*>          order N(I)
+*> Lines 7 to end:  A routine name and an option, for example
+*>
+*>          DGESDD  V
+*>
+*>          The option is V to also compute the eigenvectors or the
+*>          singular vectors, or the number of right hand sides of
+*>          xGELS.  Lines starting with # or * are skipped.
+*>
+*> A failure is reported with *** on unit 6, and a nonzero value of
+*> info in the output file.
+*> \endverbatim
+*
+*  Authors:
+*  ========
+*
+*> \author Univ. of Tennessee
+*> \author Univ. of California Berkeley
+*> \author Univ. of Colorado Denver
+*> \author NAG Ltd.
+*
+*> \ingroup timing
+*
+*  =====================================================================
+      PROGRAM LAPACKTIME
+*
+*  -- LAPACK timing routine --
+*  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+*  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+*
+*  =====================================================================
+*
+*     .. Parameters ..
+      INTEGER            NIN, NOUT, MAXSIZ
+      PARAMETER          ( NIN = 5, NOUT = 6, MAXSIZ = 64 )
+      DOUBLE PRECISION   ZERO
+      PARAMETER          ( ZERO = 0.0D+0 )
+*     ..
+*     .. Local Scalars ..
+      LOGICAL            FIRST, JSON
+      CHARACTER*8        OPT, SUBNAM
+      CHARACTER*4        OUTFMT
+      CHARACTER*16       NAME
+      CHARACTER*80       OUTFIL, TITLE
+      CHARACTER*132      LINE
+      CHARACTER*256      BUF
+      INTEGER            I, IC, INFO, IOS, ISIZ, M, N, NFAIL, NOUTF,
+     $                   NREP, NSIZE, NTHR
+      INTEGER*8          WSIZE
+      DOUBLE PRECISION   FLOPS, GFLOPS, TAVG, TMIN
+*     ..
+*     .. Local Arrays ..
+      INTEGER            MVAL( MAXSIZ ), NVAL( MAXSIZ )
+*     ..
+*     .. External Functions ..
+      INTEGER            ILATHREADS
+      EXTERNAL           ILATHREADS
+*     ..
+*     .. External Subroutines ..
+      EXTERNAL           CTIMDR, DTIMDR, STIMDR, ZTIMDR
+*     ..
+*     .. Intrinsic Functions ..
+      INTRINSIC          ADJUSTL, CHAR, ICHAR, TRIM
+*     ..
+*     .. Executable Statements ..
+*
+      READ( NIN, FMT = '(A)' )TITLE
+      READ( NIN, FMT = * )OUTFMT, OUTFIL
+      READ( NIN, FMT = * )NREP
+      READ( NIN, FMT = * )NSIZE
+      IF( NSIZE.LT.1 .OR. NSIZE.GT.MAXSIZ ) THEN
+         WRITE( NOUT, FMT = 9999 )'NSIZE', NSIZE, MAXSIZ
+         STOP
+      END IF
+      READ( NIN, FMT = * )( MVAL( I ), I = 1, NSIZE )
+      READ( NIN, FMT = * )( NVAL( I ), I = 1, NSIZE )
+      DO 10 I = 1, 4
+         IC = ICHAR( OUTFMT( I: I ) )
+         IF( IC.GE.97 .AND. IC.LE.122 )
+     $      OUTFMT( I: I ) = CHAR( IC-32 )
+   10 CONTINUE
+      JSON = OUTFMT.EQ.'JSON'
+      IF( .NOT.JSON .AND. OUTFMT.NE.'CSV' ) THEN
+         WRITE( NOUT, FMT = 9998 )TRIM( OUTFMT )
+         STOP
+      END IF
+*
+      OPEN( NEWUNIT = NOUTF, FILE = OUTFIL, STATUS = 'REPLACE',
+     $      ACTION = 'WRITE', IOSTAT = IOS )
+      IF( IOS.NE.0 ) THEN
+         WRITE( NOUT, FMT = 9997 )TRIM( OUTFIL )
+         STOP
+      END IF
+      NTHR = ILATHREADS( )
+      IF( JSON ) THEN
+         WRITE( NOUTF, FMT = '(A)' )'{'
+         WRITE( NOUTF, FMT = '(3A)' )'  "title": "', TRIM( TITLE ),
+     $      '",'
+         WRITE( NOUTF, FMT = '(A)' )'  "results": ['
+      ELSE
+         WRITE( NOUTF, FMT = '(A)' )'routine,option,m,n,threads,runs,'
+     $      // 'time_min,time_avg,gflops,workspace,info'
+      END IF
+      WRITE( NOUT, FMT = 9996 )TRIM( TITLE ), NTHR, NREP
+      FIRST = .TRUE.
+      NFAIL = 0
+*
+   20 CONTINUE
+      READ( NIN, FMT = '(A)', END = 50 )LINE
+      LINE = ADJUSTL( LINE )
+      IF( LINE.EQ.' ' .OR. LINE( 1: 1 ).EQ.'#' .OR.
+     $    LINE( 1: 1 ).EQ.'*' )GO TO 20
+      READ( LINE, FMT = *, IOSTAT = IOS )NAME
+      IF( IOS.NE.0 ) THEN
+         WRITE( NOUT, FMT = 9995 )TRIM( LINE )
+         GO TO 20
+      END IF
+      OPT = ' '
+      READ( LINE, FMT = *, IOSTAT = IOS )NAME, OPT
+*
+*     Convert the name and the option to upper case
+*
+      DO 30 I = 1, 16
+         IC = ICHAR( NAME( I: I ) )
+         IF( IC.GE.97 .AND. IC.LE.122 )
+     $      NAME( I: I ) = CHAR( IC-32 )
+         IF( I.LE.8 ) THEN
+            IC = ICHAR( OPT( I: I ) )
+            IF( IC.GE.97 .AND. IC.LE.122 )
+     $         OPT( I: I ) = CHAR( IC-32 )
+         END IF
+   30 CONTINUE
+      SUBNAM = NAME( 2: )
+      WRITE( NOUT, FMT = * )
+*
+      DO 40 ISIZ = 1, NSIZE
+         M = MVAL( ISIZ )
+         N = NVAL( ISIZ )
+         IF( SUBNAM.EQ.'POTRF' .OR. SUBNAM( 3: 5 ).EQ.'EVD' .OR.
+     $       SUBNAM( 3: 5 ).EQ.'EVR' .OR. SUBNAM.EQ.'GEEV' )M = N
+         IF( NAME( 1: 1 ).EQ.'S' ) THEN
+            CALL STIMDR( NAME, OPT, M, N, NREP, TMIN, TAVG, FLOPS,
+     $                   WSIZE, INFO )
+         ELSE IF( NAME( 1: 1 ).EQ.'D' ) THEN
+            CALL DTIMDR( NAME, OPT, M, N, NREP, TMIN, TAVG, FLOPS,
+     $                   WSIZE, INFO )
+         ELSE IF( NAME( 1: 1 ).EQ.'C' ) THEN
+            CALL CTIMDR( NAME, OPT, M, N, NREP, TMIN, TAVG, FLOPS,
+     $                   WSIZE, INFO )
+         ELSE IF( NAME( 1: 1 ).EQ.'Z' ) THEN
+            CALL ZTIMDR( NAME, OPT, M, N, NREP, TMIN, TAVG, FLOPS,
+     $                   WSIZE, INFO )
+         ELSE
+            INFO = -1
+         END IF
+         IF( INFO.EQ.-1 ) THEN
+            WRITE( NOUT, FMT = 9994 )TRIM( NAME )
+            GO TO 20
+         ELSE IF( INFO.EQ.-2 ) THEN
+            WRITE( NOUT, FMT = 9993 )TRIM( OPT ), TRIM( NAME )
+            GO TO 20
+         END IF
+         IF( TMIN.GT.ZERO ) THEN
+            GFLOPS = FLOPS / TMIN*1.0D-9
+         ELSE
+            GFLOPS = ZERO
+         END IF
+         IF( INFO.NE.0 ) THEN
+            NFAIL = NFAIL + 1
+            WRITE( NOUT, FMT = 9992 )NAME, OPT, M, N, INFO
+         ELSE
+            WRITE( NOUT, FMT = 9991 )NAME, OPT, M, N, TMIN, GFLOPS,
+     $         WSIZE
+         END IF
+*
+         IF( JSON ) THEN
+            WRITE( BUF, FMT = 9990 )TRIM( NAME ), TRIM( OPT ), M, N,
+     $         NTHR, NREP, TMIN, TAVG, GFLOPS, WSIZE, INFO
+            IF( .NOT.FIRST )
+     $         WRITE( NOUTF, FMT = '(A)' )','
+            WRITE( NOUTF, FMT = '(A)', ADVANCE = 'NO' )TRIM( BUF )
+         ELSE
+            WRITE( BUF, FMT = 9989 )TRIM( NAME ), TRIM( OPT ), M, N,
+     $         NTHR, NREP, TMIN, TAVG, GFLOPS, WSIZE, INFO
+            WRITE( NOUTF, FMT = '(A)' )TRIM( BUF )
+         END IF
+         FIRST = .FALSE.
+   40 CONTINUE
+      GO TO 20
+*
+   50 CONTINUE
+      IF( JSON ) THEN
+         IF( .NOT.FIRST )
+     $      WRITE( NOUTF, FMT = * )
+         WRITE( NOUTF, FMT = '(A)' )'  ]'
+         WRITE( NOUTF, FMT = '(A)' )'}'
+      END IF
+      CLOSE( NOUTF )
+      WRITE( NOUT, FMT = * )
+      IF( NFAIL.EQ.0 ) THEN
+         WRITE( NOUT, FMT = 9988 )TRIM( OUTFIL )
+      ELSE
+         WRITE( NOUT, FMT = 9987 )NFAIL, TRIM( OUTFIL )
+      END IF
+*
+ 9999 FORMAT( ' *** Invalid input value: ', A, ' = ', I6,
+     $      '; must be between 1 and ', I6 )
+ 9998 FORMAT( ' *** Invalid output format: ', A,
+     $      '; must be CSV or JSON' )
+ 9997 FORMAT( ' *** Cannot open the output file ', A )
+ 9996 FORMAT( 1X, A, /, ' LAPACK threads: ', I4, ', runs: ', I4, //,
+     $      ' Routine          Opt          M       N    Time (s)',
+     $      '     GFLOP/s   Workspace (bytes)' )
+ 9995 FORMAT( ' *** Invalid input line: ', A )
+ 9994 FORMAT( ' *** ', A, ' cannot be timed' )
+ 9993 FORMAT( ' *** Invalid option ', A, ' for ', A )
+ 9992 FORMAT( 1X, A16, 1X, A8, 2I8, ' *** INFO = ', I8 )
+ 9991 FORMAT( 1X, A16, 1X, A8, 2I8, ES12.4, F12.3, I20 )
+ 9990 FORMAT( '    {"routine": "', A, '", "option": "', A, '", "m": ',
+     $      I0, ', "n": ', I0, ', "threads": ', I0, ', "runs": ', I0,
+     $      ', "time_min": ', ES11.5, ', "time_avg": ', ES11.5,
+     $      ', "gflops": ', ES11.5, ', "workspace": ', I0,
+     $      ', "info": ', I0, '}' )
+ 9989 FORMAT( A, ',', A, ',', I0, ',', I0, ',', I0, ',', I0, ',',
+     $      ES11.5, ',', ES11.5, ',', ES11.5, ',', I0, ',', I0 )
+ 9988 FORMAT( ' Results written to ', A )
+ 9987 FORMAT( ' *** ', I6, ' runs failed; results written to ', A )
+*
+*     End of LAPACKTIME
+*
+      END
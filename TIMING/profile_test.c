@@ -0,0 +1,117 @@
+/*
+ * profile_test.c
+ * Check of the profiling hooks of LAPACK (BUILD_PROFILE=ON).
+ *
+ * The program factors a matrix with DGETRF and DPOTRF, and checks with
+ * the functions of lapack_profile.h that the calls of the two routines
+ * and of the BLAS routines they call have been recorded, with plausible
+ * times and operation counts.  It then writes the table of counters and
+ * checks that lapack_profile_reset clears them.
+ *
+ * The program prints *** and returns 1 if a check fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "lapack.h"
+#include "lapack_profile.h"
+
+#define N 300
+
+static int fails = 0;
+
+static void check( int ok, const char *what )
+{
+   if( !ok ) {
+      printf( " *** Failed: %s\n", what );
+      fails++;
+   }
+}
+
+/* Checks the entry of the routine name; flops is its nominal count */
+static void check_routine( const char *name, long long calls,
+                           double flops )
+{
+   lapack_profile_entry e;
+   char what[128];
+
+   if( lapack_profile_find( name, &e ) != 0 ) {
+      snprintf( what, sizeof( what ), "%s not recorded", name );
+      check( 0, what );
+      return;
+   }
+   printf( " %-8s %6lld calls %10.4f s %10.4f s self %12.4e flops\n",
+           e.name, e.calls, e.time, e.self_time, e.flops );
+   snprintf( what, sizeof( what ), "%s counters", name );
+   check( ( calls == 0 ? e.calls > 0 : e.calls == calls ) &&
+          e.time >= 0.0 && e.self_time <= e.time * 1.0001 + 1.0e-6, what );
+   if( flops > 0.0 ) {
+      snprintf( what, sizeof( what ), "%s operation count", name );
+      check( e.flops > 0.5 * flops && e.flops < 1.5 * flops, what );
+   }
+}
+
+int main( void )
+{
+   lapack_int n = N, info, i, j;
+   lapack_int *ipiv;
+   double *a, *b;
+   lapack_profile_entry e;
+   long long h;
+   int k, nent;
+
+   a = (double *) malloc( N * N * sizeof( double ) );
+   b = (double *) malloc( N * N * sizeof( double ) );
+   ipiv = (lapack_int *) malloc( N * sizeof( lapack_int ) );
+   if( a == NULL || b == NULL || ipiv == NULL ) return 1;
+   srand( 1 );
+   for( j = 0; j < N; j++ ) {
+      for( i = 0; i < N; i++ ) {
+         a[i + j * N] = (double) rand() / RAND_MAX - 0.5;
+         b[i + j * N] = 1.0 / ( 1.0 + i + j );
+      }
+      b[j + j * N] += N;
+   }
+
+   lapack_profile_reset();
+   LAPACK_dgetrf( &n, &n, a, &n, ipiv, &info );
+   check( info == 0, "DGETRF" );
+   LAPACK_dpotrf( "L", &n, b, &n, &info );
+   check( info == 0, "DPOTRF" );
+
+   /* The counts of the BLAS calls include the unblocked code */
+   check_routine( "dgetrf", 1, 2.0 / 3.0 * N * N * N );
+   check_routine( "dpotrf", 1, 1.0 / 3.0 * N * N * N );
+   check_routine( "dgemm", 0, 0.0 );
+   check_routine( "dtrsm", 0, 0.0 );
+
+   lapack_profile_find( "DGEMM", &e );
+   check( e.blas == 1, "DGEMM is a BLAS routine" );
+   for( h = 0, k = 0; k < LAPACK_PROFILE_NBINS; k++ ) h += e.hist[k];
+   check( h == e.calls, "histogram of DGEMM" );
+
+   nent = lapack_profile_count();
+   check( nent >= 4, "number of routines" );
+   for( k = 1; k < nent; k++ ) {
+      lapack_profile_entry e0;
+      lapack_profile_get( k - 1, &e0 );
+      lapack_profile_get( k, &e );
+      check( e0.time >= e.time, "order of the routines" );
+   }
+   check( lapack_profile_get( nent, &e ) == 1, "lapack_profile_get range" );
+   check( lapack_profile_dump( "profile_test.txt" ) == 0,
+          "lapack_profile_dump" );
+
+   lapack_profile_reset();
+   check( lapack_profile_find( "dgetrf", &e ) == 1, "lapack_profile_reset" );
+
+   free( a );
+   free( b );
+   free( ipiv );
+   if( fails != 0 ) {
+      printf( " *** %d checks failed\n", fails );
+      return 1;
+   }
+   printf( " All checks passed\n" );
+   return 0;
+}